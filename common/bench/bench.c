@@ -0,0 +1,416 @@
+#include "bench.h"
+#include "win32_file.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for QueryPerformanceCounter()
+#include <stdio.h>    // required for printf()
+#include <stdlib.h>   // required for qsort()
+#include <math.h>     // required for ceil()
+#include <assert.h>   // required for assert()
+
+#define BENCH_CSV_HEADER L"name,input_bytes,samples,iters,min_ns,p50_ns,p90_ns,p99_ns,max_ns,mean_ns,mib_per_s"
+#define BENCH_CSV_FIELD_COUNT 11U
+// Index of fields used by BenchCompareBaseline()
+#define BENCH_CSV_NAME_INDEX        0U
+#define BENCH_CSV_INPUT_BYTES_INDEX 1U
+#define BENCH_CSV_P50_NS_INDEX      5U
+// Max wchars in one numeric CSV field
+#define BENCH_CSV_NUMBER_WCHAR_ARR_LEN 64U
+
+static int
+StaticCompareDouble(_In_ const void *lpLeft,
+                    _In_ const void *lpRight)
+{
+    const double left  = *((const double *) lpLeft);
+    const double right = *((const double *) lpRight);
+    return (left > right) - (left < right);
+}
+
+static double
+StaticNanosPerCall(_In_ const LARGE_INTEGER *lpFreq,
+                   _In_ const LARGE_INTEGER *lpBegin,
+                   _In_ const LARGE_INTEGER *lpEnd,
+                   _In_ const size_t         ulIterCount)
+{
+    const double x = (1e9 * ((double) (lpEnd->QuadPart - lpBegin->QuadPart)))
+                     / ((double) lpFreq->QuadPart) / ((double) ulIterCount);
+    return x;
+}
+
+/**
+ * @return nanoseconds per call
+ */
+static double
+StaticRunSample(_In_    const LARGE_INTEGER *lpFreq,
+                _In_    const size_t         ulIterCount,
+                _In_    const BenchFunc      fpBenchFunc,
+                _Inout_ void                *lpContext)
+{
+    LARGE_INTEGER begin;
+    QueryPerformanceCounter(&begin);
+
+    for (size_t i = 0; i < ulIterCount; ++i)
+    {
+        fpBenchFunc(lpContext);
+    }
+
+    LARGE_INTEGER end;
+    QueryPerformanceCounter(&end);
+
+    const double x = StaticNanosPerCall(lpFreq, &begin, &end, ulIterCount);
+    return x;
+}
+
+/**
+ * Nearest-rank percentile.
+ * Ref: https://en.wikipedia.org/wiki/Percentile#The_nearest-rank_method
+ *
+ * @param lpSortedNanosArr
+ *        sorted ascending
+ *
+ * @param dPercentile
+ *        Ex: 0.99
+ */
+static double
+StaticPercentile(_In_ const double *lpSortedNanosArr,
+                 _In_ const size_t  ulSize,
+                 _In_ const double  dPercentile)
+{
+    assert(ulSize > 0);
+    size_t ulRank = (size_t) ceil(dPercentile * ((double) ulSize));
+    if (0 == ulRank) {
+        ulRank = 1;
+    }
+    const double x = lpSortedNanosArr[ulRank - 1U];
+    return x;
+}
+
+static double
+StaticMiBPerSecond(_In_ const struct BenchResult *lpResult)
+{
+    if (0 == lpResult->ulInputByteSize || lpResult->dP50Nanos <= 0.0) {
+        return 0.0;
+    }
+    const double dMiB = ((double) lpResult->ulInputByteSize) / (1024.0 * 1024.0);
+    const double x = dMiB / (lpResult->dP50Nanos / 1e9);
+    return x;
+}
+
+static struct BenchResult *
+StaticAppendResult(_Inout_ struct BenchSuite *lpSuite)
+{
+    if (lpSuite->ulResultSize == lpSuite->ulResultCapacity)
+    {
+        lpSuite->ulResultCapacity = (0 == lpSuite->ulResultCapacity) ? 16U : 2U * lpSuite->ulResultCapacity;
+        struct BenchResult *lpNewResultArr = xcalloc(lpSuite->ulResultCapacity, sizeof(struct BenchResult));
+        // Intentional: Not xrealloc().  Why?  Small name WStr points into itself: Move each name.  See: WStrMove()
+        for (size_t i = 0; i < lpSuite->ulResultSize; ++i)
+        {
+            struct BenchResult *lpOldResult = lpSuite->lpResultArr + i;
+            struct BenchResult *lpNewResult = lpNewResultArr + i;
+            WStrMove(&(lpNewResult->nameWStr), &(lpOldResult->nameWStr));
+            lpNewResult->ulInputByteSize = lpOldResult->ulInputByteSize;
+            lpNewResult->ulSampleCount   = lpOldResult->ulSampleCount;
+            lpNewResult->ulIterCount     = lpOldResult->ulIterCount;
+            lpNewResult->dMinNanos       = lpOldResult->dMinNanos;
+            lpNewResult->dP50Nanos       = lpOldResult->dP50Nanos;
+            lpNewResult->dP90Nanos       = lpOldResult->dP90Nanos;
+            lpNewResult->dP99Nanos       = lpOldResult->dP99Nanos;
+            lpNewResult->dMaxNanos       = lpOldResult->dMaxNanos;
+            lpNewResult->dMeanNanos      = lpOldResult->dMeanNanos;
+        }
+        xfree((void **) &(lpSuite->lpResultArr));
+        lpSuite->lpResultArr = lpNewResultArr;
+    }
+    struct BenchResult *lpResult = lpSuite->lpResultArr + lpSuite->ulResultSize;
+    *lpResult = (struct BenchResult) {0};
+    ++(lpSuite->ulResultSize);
+    return lpResult;
+}
+
+void
+BenchRun(_Inout_ struct BenchSuite *lpSuite,
+         _In_    const wchar_t     *lpNameWCharArr,
+         _In_    const size_t       ulInputByteSize,
+         _In_    const BenchFunc    fpBenchFunc,
+         _Inout_ void              *lpContext)
+{
+    assert(NULL != lpSuite);
+    assert(NULL != lpNameWCharArr);
+    assert(NULL == wcspbrk(lpNameWCharArr, L",\""));
+    assert(NULL != fpBenchFunc);
+
+    const size_t ulWarmupCount = (0 == lpSuite->ulWarmupCount) ? BENCH_DEFAULT_WARMUP_COUNT : lpSuite->ulWarmupCount;
+    const size_t ulSampleCount = (0 == lpSuite->ulSampleCount) ? BENCH_DEFAULT_SAMPLE_COUNT : lpSuite->ulSampleCount;
+
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+
+    // Intentional: Calibrate from the fastest warmup call.  Why?  First call includes cold caches and page faults.
+    double dMinWarmupNanos = 0.0;
+    for (size_t i = 0; i < ulWarmupCount; ++i)
+    {
+        const double dNanos = StaticRunSample(&freq, 1U, fpBenchFunc, lpContext);
+        if (0 == i || dNanos < dMinWarmupNanos) {
+            dMinWarmupNanos = dNanos;
+        }
+    }
+
+    size_t ulIterCount = 1U;
+    if (dMinWarmupNanos < BENCH_MIN_SAMPLE_NANOS) {
+        ulIterCount = (size_t) ceil(BENCH_MIN_SAMPLE_NANOS / ((dMinWarmupNanos > 1.0) ? dMinWarmupNanos : 1.0));
+    }
+
+    double *lpNanosArr = xcalloc(ulSampleCount, sizeof(double));
+    double dSumNanos = 0.0;
+    for (size_t i = 0; i < ulSampleCount; ++i)
+    {
+        lpNanosArr[i] = StaticRunSample(&freq, ulIterCount, fpBenchFunc, lpContext);
+        dSumNanos += lpNanosArr[i];
+    }
+
+    qsort(lpNanosArr, ulSampleCount, sizeof(lpNanosArr[0]), StaticCompareDouble);
+
+    struct BenchResult *lpResult = StaticAppendResult(lpSuite);
+    WStrCopyWCharArr(&(lpResult->nameWStr), lpNameWCharArr, wcslen(lpNameWCharArr));
+    lpResult->ulInputByteSize = ulInputByteSize;
+    lpResult->ulSampleCount   = ulSampleCount;
+    lpResult->ulIterCount     = ulIterCount;
+    lpResult->dMinNanos       = lpNanosArr[0];
+    lpResult->dP50Nanos       = StaticPercentile(lpNanosArr, ulSampleCount, 0.50);
+    lpResult->dP90Nanos       = StaticPercentile(lpNanosArr, ulSampleCount, 0.90);
+    lpResult->dP99Nanos       = StaticPercentile(lpNanosArr, ulSampleCount, 0.99);
+    lpResult->dMaxNanos       = lpNanosArr[ulSampleCount - 1U];
+    lpResult->dMeanNanos      = dSumNanos / ((double) ulSampleCount);
+
+    xfree((void **) &lpNanosArr);
+
+    printf("%-24ls: %10zu bytes, %8zu iters: p50 %14.1f ns, p90 %14.1f ns, p99 %14.1f ns, min %14.1f ns, max %14.1f ns, %10.1f MiB/s\n",
+           lpNameWCharArr, ulInputByteSize, ulIterCount, lpResult->dP50Nanos, lpResult->dP90Nanos, lpResult->dP99Nanos,
+           lpResult->dMinNanos, lpResult->dMaxNanos, StaticMiBPerSecond(lpResult));
+}
+
+void
+BenchWriteCsv(_In_ const struct BenchSuite *lpSuite,
+              _In_ const wchar_t           *lpFilePathWCharArr)
+{
+    assert(NULL != lpSuite);
+    assert(NULL != lpFilePathWCharArr);
+
+    struct WStrBuilder sb = {0};
+    WStrBuilderAppendWCharArr(&sb, BENCH_CSV_HEADER L"\n", wcslen(BENCH_CSV_HEADER L"\n"));
+
+    for (size_t i = 0; i < lpSuite->ulResultSize; ++i)
+    {
+        const struct BenchResult *lpResult = lpSuite->lpResultArr + i;
+        WStrBuilderAppendF(&sb, L"%ls,%zu,%zu,%zu,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+                           lpResult->nameWStr.lpWCharArr, lpResult->ulInputByteSize, lpResult->ulSampleCount,
+                           lpResult->ulIterCount, lpResult->dMinNanos, lpResult->dP50Nanos, lpResult->dP90Nanos,
+                           lpResult->dP99Nanos, lpResult->dMaxNanos, lpResult->dMeanNanos, StaticMiBPerSecond(lpResult));
+    }
+
+    struct WStr csvWStr = {0};
+    WStrBuilderMoveToWStr(&sb, &csvWStr);
+    WStrFileWrite(lpFilePathWCharArr, CP_UTF8, &csvWStr);
+    WStrFree(&csvWStr);
+}
+
+void
+BenchWriteJson(_In_ const struct BenchSuite *lpSuite,
+               _In_ const wchar_t           *lpFilePathWCharArr)
+{
+    assert(NULL != lpSuite);
+    assert(NULL != lpFilePathWCharArr);
+
+    struct WStrBuilder sb = {0};
+    WStrBuilderAppendWCharArr(&sb, L"[\n", 2);
+
+    for (size_t i = 0; i < lpSuite->ulResultSize; ++i)
+    {
+        const struct BenchResult *lpResult = lpSuite->lpResultArr + i;
+        WStrBuilderAppendF(&sb,
+                           L"  {\"name\": \"%ls\", \"input_bytes\": %zu, \"samples\": %zu, \"iters\": %zu"
+                           L", \"min_ns\": %.1f, \"p50_ns\": %.1f, \"p90_ns\": %.1f, \"p99_ns\": %.1f, \"max_ns\": %.1f"
+                           L", \"mean_ns\": %.1f, \"mib_per_s\": %.1f}%ls\n",
+                           lpResult->nameWStr.lpWCharArr, lpResult->ulInputByteSize, lpResult->ulSampleCount,
+                           lpResult->ulIterCount, lpResult->dMinNanos, lpResult->dP50Nanos, lpResult->dP90Nanos,
+                           lpResult->dP99Nanos, lpResult->dMaxNanos, lpResult->dMeanNanos, StaticMiBPerSecond(lpResult),
+                           (i + 1U < lpSuite->ulResultSize) ? L"," : L"");
+    }
+    WStrBuilderAppendWCharArr(&sb, L"]\n", 2);
+
+    struct WStr jsonWStr = {0};
+    WStrBuilderMoveToWStr(&sb, &jsonWStr);
+    WStrFileWrite(lpFilePathWCharArr, CP_UTF8, &jsonWStr);
+    WStrFree(&jsonWStr);
+}
+
+/**
+ * @return true if field is a complete number
+ */
+static bool
+StaticParseSizeField(_In_  const struct WStrView *lpFieldWStrView,
+                     _Out_ size_t                *lpulValue)
+{
+    wchar_t lpWCharArr[BENCH_CSV_NUMBER_WCHAR_ARR_LEN];
+    struct WStr fieldWStr = {0};
+    WStrInitStackBuffer(&fieldWStr, lpWCharArr, sizeof(lpWCharArr) / sizeof(lpWCharArr[0]));
+    WStrCopyWStrView(&fieldWStr, lpFieldWStrView);
+
+    wchar_t *lpEnd = NULL;
+    *lpulValue = (size_t) wcstoull(fieldWStr.lpWCharArr, &lpEnd, 10);
+    const bool x = (fieldWStr.ulSize > 0 && lpEnd == fieldWStr.lpWCharArr + fieldWStr.ulSize);
+    WStrFree(&fieldWStr);
+    return x;
+}
+
+/**
+ * @return true if field is a complete number
+ */
+static bool
+StaticParseDoubleField(_In_  const struct WStrView *lpFieldWStrView,
+                       _Out_ double                *lpdValue)
+{
+    wchar_t lpWCharArr[BENCH_CSV_NUMBER_WCHAR_ARR_LEN];
+    struct WStr fieldWStr = {0};
+    WStrInitStackBuffer(&fieldWStr, lpWCharArr, sizeof(lpWCharArr) / sizeof(lpWCharArr[0]));
+    WStrCopyWStrView(&fieldWStr, lpFieldWStrView);
+
+    wchar_t *lpEnd = NULL;
+    *lpdValue = wcstod(fieldWStr.lpWCharArr, &lpEnd);
+    const bool x = (fieldWStr.ulSize > 0 && lpEnd == fieldWStr.lpWCharArr + fieldWStr.ulSize);
+    WStrFree(&fieldWStr);
+    return x;
+}
+
+/**
+ * @return true if baseline line for lpResult is found
+ */
+static bool
+StaticFindBaselineP50Nanos(_In_  const struct WStrViewArr *lpLineWStrViewArr,
+                           _In_  const struct BenchResult *lpResult,
+                           _Out_ double                   *lpdBaselineP50Nanos)
+{
+    const struct WStrView nameWStrView = WSTR_VIEW_FROM_WSTR(&(lpResult->nameWStr));
+    const struct WStrView delimWStrView = WSTR_VIEW_FROM_LITERAL(L",");
+    const struct WStrViewSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                                 .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    bool bIsFound = false;
+    // Intentional: Skip header line.
+    for (size_t i = 1; false == bIsFound && i < lpLineWStrViewArr->ulSize; ++i)
+    {
+        struct WStrViewArr fieldWStrViewArr = {0};
+        WStrSplitView(lpLineWStrViewArr->lpWStrViewArr + i, &delimWStrView, &options, &fieldWStrViewArr);
+
+        size_t ulInputByteSize = 0;
+        if (BENCH_CSV_FIELD_COUNT == fieldWStrViewArr.ulSize
+            && 0 == WStrViewCompare(&nameWStrView, fieldWStrViewArr.lpWStrViewArr + BENCH_CSV_NAME_INDEX)
+            && StaticParseSizeField(fieldWStrViewArr.lpWStrViewArr + BENCH_CSV_INPUT_BYTES_INDEX, &ulInputByteSize)
+            && ulInputByteSize == lpResult->ulInputByteSize)
+        {
+            bIsFound = StaticParseDoubleField(fieldWStrViewArr.lpWStrViewArr + BENCH_CSV_P50_NS_INDEX, lpdBaselineP50Nanos);
+        }
+        WStrViewArrFree(&fieldWStrViewArr);
+    }
+    return bIsFound;
+}
+
+size_t
+BenchCompareBaseline(_In_ const struct BenchSuite *lpSuite,
+                     _In_ const wchar_t           *lpBaselineFilePathWCharArr,
+                     _In_ const double             dMaxRatio)
+{
+    assert(NULL != lpSuite);
+    assert(NULL != lpBaselineFilePathWCharArr);
+    assert(dMaxRatio > 0.0);
+
+    if (false == Win32FileExists(lpBaselineFilePathWCharArr))
+    {
+        printf("INFO: No baseline: [%ls]: Save one with: ./build.bash --save-baseline\n", lpBaselineFilePathWCharArr);
+        return 0;
+    }
+
+    struct WStr baselineWStr = {0};
+    WStrFileRead(lpBaselineFilePathWCharArr, CP_UTF8, &baselineWStr);
+
+    const struct WStrView baselineWStrView = WSTR_VIEW_FROM_WSTR(&baselineWStr);
+    const struct WStrViewSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                                 .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    struct WStrViewArr lineWStrViewArr = {0};
+    WStrSplitNewLineView(&baselineWStrView, &options, &lineWStrViewArr);
+
+    size_t ulRegressionCount = 0;
+    for (size_t i = 0; i < lpSuite->ulResultSize; ++i)
+    {
+        const struct BenchResult *lpResult = lpSuite->lpResultArr + i;
+        double dBaselineP50Nanos = 0.0;
+        if (false == StaticFindBaselineP50Nanos(&lineWStrViewArr, lpResult, &dBaselineP50Nanos)
+            || dBaselineP50Nanos <= 0.0)
+        {
+            printf("%-10s %-24ls: %10zu bytes: p50 %14.1f ns: not in baseline\n",
+                   "NEW", lpResult->nameWStr.lpWCharArr, lpResult->ulInputByteSize, lpResult->dP50Nanos);
+            continue;
+        }
+
+        const double dRatio = lpResult->dP50Nanos / dBaselineP50Nanos;
+        const char *lpszStatus = "ok";
+        if (dRatio > dMaxRatio)
+        {
+            lpszStatus = "REGRESSION";
+            ++ulRegressionCount;
+        }
+        else if (dRatio < 1.0 / dMaxRatio)
+        {
+            lpszStatus = "IMPROVED";
+        }
+        printf("%-10s %-24ls: %10zu bytes: p50 %14.1f ns, baseline %14.1f ns, ratio %6.3f\n",
+               lpszStatus, lpResult->nameWStr.lpWCharArr, lpResult->ulInputByteSize, lpResult->dP50Nanos,
+               dBaselineP50Nanos, dRatio);
+    }
+
+    WStrViewArrFree(&lineWStrViewArr);
+    WStrFree(&baselineWStr);
+    return ulRegressionCount;
+}
+
+size_t
+BenchSuiteFinish(_In_ const struct BenchSuite *lpSuite)
+{
+    assert(NULL != lpSuite);
+    assert(NULL != lpSuite->lpNameWCharArr);
+
+    struct WStr pathWStr = {0};
+
+    WStrSPrintF(&pathWStr, L"%ls.csv", lpSuite->lpNameWCharArr);
+    BenchWriteCsv(lpSuite, pathWStr.lpWCharArr);
+    printf("Wrote: [%ls]\n", pathWStr.lpWCharArr);
+
+    WStrSPrintF(&pathWStr, L"%ls.json", lpSuite->lpNameWCharArr);
+    BenchWriteJson(lpSuite, pathWStr.lpWCharArr);
+    printf("Wrote: [%ls]\n", pathWStr.lpWCharArr);
+
+    WStrSPrintF(&pathWStr, L"baseline\\%ls.csv", lpSuite->lpNameWCharArr);
+    const size_t ulRegressionCount = BenchCompareBaseline(lpSuite, pathWStr.lpWCharArr, BENCH_DEFAULT_MAX_BASELINE_RATIO);
+    if (ulRegressionCount > 0) {
+        printf("%ls: %zu regression(s) versus [%ls]\n", lpSuite->lpNameWCharArr, ulRegressionCount, pathWStr.lpWCharArr);
+    }
+
+    WStrFree(&pathWStr);
+    return ulRegressionCount;
+}
+
+void
+BenchSuiteFree(_Inout_ struct BenchSuite *lpSuite)
+{
+    assert(NULL != lpSuite);
+
+    for (size_t i = 0; i < lpSuite->ulResultSize; ++i)
+    {
+        WStrFree(&(lpSuite->lpResultArr[i].nameWStr));
+    }
+    xfree((void **) &(lpSuite->lpResultArr));
+    *lpSuite = (struct BenchSuite) {
+        .lpNameWCharArr = lpSuite->lpNameWCharArr,
+        .ulWarmupCount  = lpSuite->ulWarmupCount,
+        .ulSampleCount  = lpSuite->ulSampleCount,
+    };
+}
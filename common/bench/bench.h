@@ -0,0 +1,126 @@
+#ifndef H_COMMON_BENCH_BENCH
+#define H_COMMON_BENCH_BENCH
+
+#include "win32.h"
+#include "wstr.h"
+#include <sal.h>      // required for _In_, etc.
+#include <stddef.h>   // required for size_t
+#include <stdbool.h>  // required for bool
+
+// Shared harness for *_bench.c: warmup, timed samples with QueryPerformanceCounter(), percentiles, CSV and JSON
+// results, and comparison against a stored baseline CSV, so regressions show up.
+
+#define BENCH_DEFAULT_WARMUP_COUNT 3U
+#define BENCH_DEFAULT_SAMPLE_COUNT 31U
+// Intentional: Each sample is at least this long.  Why?  Short calls are repeated: QueryPerformanceCounter() resolution
+// is about 100 ns.
+#define BENCH_MIN_SAMPLE_NANOS 1000000.0
+// If median is more than this ratio of baseline median, then it is a regression.  Allows for normal run-to-run noise.
+#define BENCH_DEFAULT_MAX_BASELINE_RATIO 1.20
+
+/**
+ * One call to measure.  Must include any cleanup, e.g., WStrArrFree(): Each call must begin from same state.
+ *
+ * @param lpContext
+ *        Ex: inputs and outputs for one call
+ */
+typedef void (*BenchFunc)(_Inout_ void *lpContext);
+
+struct BenchResult
+{
+    // Ex: L"WStrSplit"
+    // Intentional: Name and ulInputByteSize are key for baseline.  Why?  Same function is measured for many sizes.
+    struct WStr nameWStr;
+    // Input bytes per call.  Used for throughput.  Zero if not meaningful.
+    size_t      ulInputByteSize;
+    size_t      ulSampleCount;
+    // Calls per sample.  See: BENCH_MIN_SAMPLE_NANOS
+    size_t      ulIterCount;
+    // Each value is nanoseconds per call
+    double      dMinNanos;
+    double      dP50Nanos;
+    double      dP90Nanos;
+    double      dP99Nanos;
+    double      dMaxNanos;
+    double      dMeanNanos;
+};
+
+/**
+ * <pre>{@code
+ * struct BenchSuite suite = {.lpNameWCharArr = L"wstr_bench"};
+ * BenchRun(&suite, L"WStrSplit", ulInputByteSize, StaticSplit, &context);
+ * const size_t ulRegressionCount = BenchSuiteFinish(&suite);
+ * BenchSuiteFree(&suite);
+ * }</pre>
+ */
+struct BenchSuite
+{
+    // Ex: L"wstr_bench" -> "wstr_bench.csv", "wstr_bench.json", and baseline "baseline\wstr_bench.csv"
+    const wchar_t      *lpNameWCharArr;
+    // If zero, BENCH_DEFAULT_WARMUP_COUNT
+    size_t              ulWarmupCount;
+    // If zero, BENCH_DEFAULT_SAMPLE_COUNT
+    size_t              ulSampleCount;
+    struct BenchResult *lpResultArr;
+    size_t              ulResultSize;
+    size_t              ulResultCapacity;
+};
+
+/**
+ * Warmup, then measure samples of fpBenchFunc.  Result is appended to lpSuite and printed to stdout.
+ *
+ * @param lpNameWCharArr
+ *        must not contain ',' or '"'.  Why?  CSV and JSON are not escaped.
+ *
+ * @param ulInputByteSize
+ *        input bytes per call; zero if not meaningful
+ */
+void
+BenchRun(_Inout_ struct BenchSuite *lpSuite,
+         _In_    const wchar_t     *lpNameWCharArr,
+         _In_    const size_t       ulInputByteSize,
+         _In_    const BenchFunc    fpBenchFunc,
+         _Inout_ void              *lpContext);
+
+/**
+ * Header line, then one line per result.
+ * Ex: "WStrSplit,65536,31,4,1234.5,1300.0,1350.2,1400.9,1401.0,1310.7,48.1"
+ */
+void
+BenchWriteCsv(_In_ const struct BenchSuite *lpSuite,
+              _In_ const wchar_t           *lpFilePathWCharArr);
+
+/**
+ * Array of objects: one per result.  Same fields as BenchWriteCsv().
+ */
+void
+BenchWriteJson(_In_ const struct BenchSuite *lpSuite,
+               _In_ const wchar_t           *lpFilePathWCharArr);
+
+/**
+ * Compare median of each result against baseline CSV from BenchWriteCsv().  Print one line per result to stdout.
+ * Results missing from baseline are printed, but never a regression.
+ *
+ * @param dMaxRatio
+ *        usually BENCH_DEFAULT_MAX_BASELINE_RATIO
+ *
+ * @return number of results where (median / baseline median) > dMaxRatio
+ *         zero if baseline file does not exist
+ */
+size_t
+BenchCompareBaseline(_In_ const struct BenchSuite *lpSuite,
+                     _In_ const wchar_t           *lpBaselineFilePathWCharArr,
+                     _In_ const double             dMaxRatio);
+
+/**
+ * Write "<name>.csv" and "<name>.json", then compare against "baseline\<name>.csv".
+ *
+ * @return number of regressions.  See: BenchCompareBaseline()
+ */
+size_t
+BenchSuiteFinish(_In_ const struct BenchSuite *lpSuite);
+
+void
+BenchSuiteFree(_Inout_ struct BenchSuite *lpSuite);
+
+#endif  // H_COMMON_BENCH_BENCH
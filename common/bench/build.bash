@@ -0,0 +1,142 @@
+#!/usr/bin/env bash
+
+COMMON_DIR_PATH='..'
+source "$(dirname "$0")/$COMMON_DIR_PATH/bashlib"
+
+ARG_SAVE_BASELINE='--save-baseline'
+BASELINE_DIR_PATH='baseline'
+
+main()
+{
+    local this_script_abs_dir_path
+    this_script_abs_dir_path="$(dirname "$(readlink --canonicalize "$0")")"
+
+    local is_save_baseline=$BASHLIB_FALSE
+
+    local arg
+    for arg in "$@"
+    do
+        if [ "$BASHLIB_ARG_HELP" = "$arg" ] || [ "$BASHLIB_ARG_HELP2" = "$arg" ]
+        then
+            show_help_then_exit
+
+        elif [ "$ARG_SAVE_BASELINE" = "$arg" ]
+        then
+            if [ $BASHLIB_FALSE = $is_save_baseline ]
+            then
+                is_save_baseline=$BASHLIB_TRUE
+            else
+                printf -- '\nError: Found multiple %s arguments\n' "$ARG_SAVE_BASELINE"
+                show_help_then_exit
+            fi
+        else
+            printf -- '\nError: Unknown argument: [%s]\n' "$arg"
+            show_help_then_exit
+        fi
+    done
+
+    bashlib_log_and_run_cmd \
+        cd "$this_script_abs_dir_path"
+
+    bashlib_log_and_run_cmd \
+        rm --force *.o *.exe
+
+    # Intentional: Always benchmark release (optimised) build.  Why?  Debug build numbers are meaningless.
+    bashlib_log_and_run_cmd \
+        ../build.bash --clean --release
+
+    # Shared harness for all benchmarks.  Ex: BenchRun()
+    bashlib_log_and_run_gcc_cmd_if_necessary \
+        $BASHLIB_TRUE bench.c bench.o -iquote "$COMMON_DIR_PATH"
+
+    # Build, then run
+    local csrc
+    for csrc in *_bench.c
+    do
+        local bname
+        # Ex: "wstr_split_bench.c" -> "wstr_split_bench"
+        bname="$(basename "$csrc" '.c')"
+        build "$bname"
+    done
+
+    # Intentional: Run all benchmarks before exit on regression.  Why?  Each one writes its own results.
+    # Each *_bench.exe that uses BenchSuiteFinish() exits non-zero if any result regressed versus its baseline.
+    local failed_bname_arr=()
+    for csrc in *_bench.c
+    do
+        local bname
+        # Ex: "wstr_split_bench.c" -> "wstr_split_bench"
+        bname="$(basename "$csrc" '.c')"
+        if ! bashlib_log_and_run_cmd wine64 "$bname.exe"
+        then
+            failed_bname_arr+=("$bname")
+        fi
+    done
+
+    if [ $BASHLIB_TRUE = $is_save_baseline ]
+    then
+        bashlib_log_and_run_cmd \
+            mkdir --parents "$BASELINE_DIR_PATH"
+
+        # Ex: "wstr_bench.csv" -> "baseline/wstr_bench.csv"
+        bashlib_log_and_run_cmd \
+            cp --verbose *.csv "$BASELINE_DIR_PATH/"
+    fi
+
+    bashlib_log_and_run_cmd \
+        cd -
+
+    if [ 0 != ${#failed_bname_arr[@]} ]
+    then
+        bashlib_logf 'Error: Failed or regressed: %s' "${failed_bname_arr[*]}"
+        exit 1
+    fi
+}
+
+build()
+{
+    # Ex: "wstr_split_bench"
+    local bench_module="$1" ; shift
+
+    local is_release=$BASHLIB_TRUE
+
+    # Note: -iquote is more specific than -I
+    bashlib_log_and_run_gcc_cmd_if_necessary \
+        $is_release "$bench_module.c" "$bench_module.o" -iquote "$COMMON_DIR_PATH"
+
+    bashlib_log_and_run_gcc_cmd \
+        $is_release \
+        -o "$bench_module.exe" \
+        "$COMMON_DIR_PATH/"*.o \
+        bench.o \
+        "$bench_module.o" \
+        -lgdi32 -lole32 -lpsapi
+
+    bashlib_log_and_run_cmd \
+        ls -l "$bench_module.exe"
+}
+
+show_help_then_exit()
+{
+    printf -- '\n'
+    printf -- 'Usage: %s [%s] [%s|%s]\n' "$0" "$ARG_SAVE_BASELINE" "$BASHLIB_ARG_HELP" "$BASHLIB_ARG_HELP2"
+    printf -- 'Build, then run all benchmarks: *_bench.c\n'
+    printf -- 'Results are written to *.csv and *.json, then compared to %s/*.csv, if it exists.\n' "$BASELINE_DIR_PATH"
+    printf -- '\n'
+    printf -- 'Required Arguments:\n'
+    printf -- '    None\n'
+    printf -- '\n'
+    printf -- 'Optional Arguments:\n'
+    printf -- '    %s: After run, copy *.csv to %s/\n' "$ARG_SAVE_BASELINE" "$BASELINE_DIR_PATH"
+    printf -- '        Baseline is specific to one machine.  Save again after hardware or toolchain changes.\n'
+    printf -- '\n'
+    printf -- '    %s or %s: Show this help\n' "$BASHLIB_ARG_HELP" "$BASHLIB_ARG_HELP2"
+    printf -- '\n'
+    printf -- 'Compatibility Notes:\n'
+    printf -- '    This Bash shell script is compatible with Linux, Cygwin, and MSYS2\n'
+    printf -- '\n'
+
+    exit 1
+}
+
+main "$@"
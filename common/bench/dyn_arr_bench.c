@@ -0,0 +1,157 @@
+#include "bench.h"
+#include "dyn_arr.h"
+#include "wstr.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <assert.h>   // required for assert()
+
+// Like passport struct ConfigEntry: Only pointers.  No move function: Grow with xrealloc().
+struct PtrEntry
+{
+    const struct WStr *lpUsernameWStr;
+    const struct WStr *lpPasswordWStr;
+};
+
+DYN_ARR_DECLARE(PtrEntryDynArr, struct PtrEntry)
+DYN_ARR_DEFINE(PtrEntryDynArr, struct PtrEntry, NULL)
+
+// Like send_input struct ConfigEntry: struct WStr may point to its own inline buffer, so a move function is required.
+struct WStrEntry
+{
+    struct WStr sendKeysWStr;
+    size_t      ulData;
+};
+
+static void
+StaticWStrEntryMove(_Inout_ struct WStrEntry *lpDestEntry,
+                    _Inout_ struct WStrEntry *lpSrcEntry)
+{
+    WStrMove(&(lpDestEntry->sendKeysWStr), &(lpSrcEntry->sendKeysWStr));
+    lpDestEntry->ulData = lpSrcEntry->ulData;
+    lpSrcEntry->ulData  = 0;
+}
+
+DYN_ARR_DECLARE(WStrEntryDynArr, struct WStrEntry)
+DYN_ARR_DEFINE(WStrEntryDynArr, struct WStrEntry, StaticWStrEntryMove)
+
+struct BenchContext
+{
+    size_t ulCount;
+};
+
+/**
+ * Same as ConfigEntryDynArr_IncreaseCapacity() before DYN_ARR_DEFINE(): Capacity grows by exactly one per append.
+ */
+static void
+StaticWStrEntryAppendGrowByOne(_Inout_ struct WStrEntryDynArr *lpDynArr,
+                               _Inout_ struct WStrEntry       *lpEntry)
+{
+    ++(lpDynArr->ulCapacity);
+    struct WStrEntry *lpElemArr = xcalloc(lpDynArr->ulCapacity, sizeof(struct WStrEntry));
+    for (size_t i = 0; i < lpDynArr->ulSize; ++i)
+    {
+        StaticWStrEntryMove(lpElemArr + i, lpDynArr->lpElemArr + i);
+    }
+    xfree((void **) &(lpDynArr->lpElemArr));
+    lpDynArr->lpElemArr = lpElemArr;
+
+    StaticWStrEntryMove(lpDynArr->lpElemArr + lpDynArr->ulSize, lpEntry);
+    ++(lpDynArr->ulSize);
+}
+
+static void
+StaticWStrEntryFree(_Inout_ struct WStrEntryDynArr *lpDynArr)
+{
+    for (size_t i = 0; i < lpDynArr->ulSize; ++i)
+    {
+        WStrFree(&(lpDynArr->lpElemArr[i].sendKeysWStr));
+    }
+    WStrEntryDynArr_Free(lpDynArr);
+}
+
+static void
+StaticWStrEntryInit(_In_  const size_t      i,
+                    _Out_ struct WStrEntry *lpEntry)
+{
+    // Intentional: Short text.  Why?  Usual send keys text: Small string, so move copies inline buffer.
+    WStrCopyWCharArr(&(lpEntry->sendKeysWStr), L"password", 8U);
+    lpEntry->ulData = i;
+}
+
+static void
+StaticWStrEntryGrowByOne(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    struct WStrEntryDynArr dynArr = {0};
+    for (size_t i = 0; i < lpContext->ulCount; ++i)
+    {
+        struct WStrEntry entry = {0};
+        StaticWStrEntryInit(i, &entry);
+        StaticWStrEntryAppendGrowByOne(&dynArr, &entry);
+    }
+    StaticWStrEntryFree(&dynArr);
+}
+
+static void
+StaticWStrEntryPush(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    struct WStrEntryDynArr dynArr = {0};
+    for (size_t i = 0; i < lpContext->ulCount; ++i)
+    {
+        struct WStrEntry entry = {0};
+        StaticWStrEntryInit(i, &entry);
+        WStrEntryDynArr_Push(&dynArr, &entry);
+    }
+    WStrEntryDynArr_ShrinkToFit(&dynArr);
+    StaticWStrEntryFree(&dynArr);
+}
+
+static void
+StaticPtrEntryPush(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    static const struct WStr usernameWStr = WSTR_FROM_LITERAL(L"username");
+    static const struct WStr passwordWStr = WSTR_FROM_LITERAL(L"password");
+    struct PtrEntryDynArr dynArr = {0};
+    for (size_t i = 0; i < lpContext->ulCount; ++i)
+    {
+        struct PtrEntry entry = {.lpUsernameWStr = &usernameWStr, .lpPasswordWStr = &passwordWStr};
+        PtrEntryDynArr_Push(&dynArr, &entry);
+    }
+    PtrEntryDynArr_ShrinkToFit(&dynArr);
+    PtrEntryDynArr_Free(&dynArr);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    struct BenchSuite suite = {.lpNameWCharArr = L"dyn_arr_bench"};
+
+    // Number of config entries.  Intentional: Grow-by-one only for 1k.  Why?  Quadratic: 10k is about 100x slower.
+    const size_t ulCountArr[] = {1000U, 10U * 1000U, 100U * 1000U};
+    const size_t ulCountArrSize = sizeof(ulCountArr) / sizeof(ulCountArr[0]);
+    for (size_t i = 0; i < ulCountArrSize; ++i)
+    {
+        struct BenchContext context = {.ulCount = ulCountArr[i]};
+        const size_t ulWStrEntryByteSize = context.ulCount * sizeof(struct WStrEntry);
+        if (context.ulCount <= 1000U)
+        {
+            BenchRun(&suite, L"WStrEntry grow by one", ulWStrEntryByteSize, StaticWStrEntryGrowByOne, &context);
+        }
+        BenchRun(&suite, L"WStrEntryDynArr_Push", ulWStrEntryByteSize, StaticWStrEntryPush, &context);
+        BenchRun(&suite, L"PtrEntryDynArr_Push", context.ulCount * sizeof(struct PtrEntry), StaticPtrEntryPush, &context);
+    }
+
+    const size_t ulRegressionCount = BenchSuiteFinish(&suite);
+    BenchSuiteFree(&suite);
+
+    // Intentional: Non-zero exit.  Why?  build.bash stops (set -e) if any regression.
+    const int x = (0 == ulRegressionCount) ? 0 : 1;
+    return x;
+}
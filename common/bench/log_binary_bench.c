@@ -0,0 +1,68 @@
+#include "bench.h"
+#include "log.h"
+#include "log_binary.h"
+#include "win32_file.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for FILE
+#include <assert.h>   // required for assert()
+
+static const wchar_t *BENCH_TEXT_FILE_PATH   = L"log_binary_bench.log";
+static const wchar_t *BENCH_BINARY_FILE_PATH = L"log_binary_bench.binlog";
+
+struct BenchContext
+{
+    FILE                   *fp;
+    struct LogBinaryWriter  writer;
+    unsigned                uIndex;
+};
+
+// Ex: LowLevelKeyboardProc() in passport and send_input
+
+static void
+StaticLogWF(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    ++lpContext->uIndex;
+    LogWF(lpContext->fp, L"INFO: LowLevelKeyboardProc: vkCode:%u, scanCode:%u, flags:0x%x, name:%ls\r\n",
+          lpContext->uIndex, 0x1EU, 0x80U, L"VK_A");
+}
+
+static void
+StaticLogBinaryWF(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    ++lpContext->uIndex;
+    LOG_BINARY_WF(&(lpContext->writer), L"INFO: LowLevelKeyboardProc: vkCode:%u, scanCode:%u, flags:0x%x, name:%ls\r\n",
+                  lpContext->uIndex, 0x1EU, 0x80U, L"VK_A");
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    struct BenchSuite suite = {.lpNameWCharArr = L"log_binary_bench"};
+
+    struct BenchContext context = {0};
+    // Intentional: Both write to a file.  Why?  Console output is much slower, and would hide the difference.
+    context.fp = _wfopen(BENCH_TEXT_FILE_PATH, L"wb");
+    assert(NULL != context.fp);
+    LogBinaryWriterOpen(&(context.writer), BENCH_BINARY_FILE_PATH, LOG_BINARY_DEFAULT_BUFFER_BYTE_SIZE);
+
+    BenchRun(&suite, L"LogWF", 0, StaticLogWF, &context);
+    BenchRun(&suite, L"LOG_BINARY_WF", 0, StaticLogBinaryWF, &context);
+
+    fclose(context.fp);
+    LogBinaryWriterClose(&(context.writer));
+    Win32FileDelete(BENCH_TEXT_FILE_PATH);
+    Win32FileDelete(BENCH_BINARY_FILE_PATH);
+
+    const size_t ulRegressionCount = BenchSuiteFinish(&suite);
+    BenchSuiteFree(&suite);
+
+    // Intentional: Non-zero exit.  Why?  build.bash stops (set -e) if any regression.
+    const int x = (0 == ulRegressionCount) ? 0 : 1;
+    return x;
+}
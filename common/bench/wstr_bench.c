@@ -0,0 +1,215 @@
+#include "bench.h"
+#include "wstr.h"
+#include "wstr_simd.h"
+#include "win32_file.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <assert.h>   // required for assert()
+
+#define BENCH_FILE_PATH L"wstr_bench.txt"
+// Number of pieces for WStrConcatMany()
+#define PIECE_COUNT 8U
+
+struct BenchContext
+{
+    // Ex: L"  abcdefghij | bcdefghijk  \r\n" repeated
+    struct WStr    textWStr;
+    // textWStr with leading and trailing spaces
+    struct WStr    paddedTextWStr;
+    // textWStr split by newline: Input for WStrJoin()
+    struct WStrArr lineWStrArr;
+    // textWStr in PIECE_COUNT pieces: Input for WStrConcatMany()
+    struct WStr    pieceWStrArr[PIECE_COUNT];
+    // Output of each call.  Freed at end of each call.
+    struct WStr    outWStr;
+    struct WStrArr outWStrArr;
+};
+
+static void
+StaticCreateText(_In_    const size_t  ulMinSize,
+                 _Inout_ struct WStr   *lpWStrText)
+{
+    // Like config file line: "key | value"
+    const size_t ulTokenSize = 10U;
+    const wchar_t *lpRecordFormat = L"  %ls | %ls  \r\n";
+    struct WStrBuilder sb = {0};
+    wchar_t lpKeyWCharArr[16] = {0};
+    wchar_t lpValueWCharArr[16] = {0};
+    for (size_t i = 0; sb.ulSize < ulMinSize; ++i)
+    {
+        for (size_t j = 0; j < ulTokenSize; ++j)
+        {
+            lpKeyWCharArr[j]   = L'a' + ((i + j) % 26);
+            lpValueWCharArr[j] = L'a' + ((i + j + 1U) % 26);
+        }
+        WStrBuilderAppendF(&sb, lpRecordFormat, lpKeyWCharArr, lpValueWCharArr);
+    }
+    WStrBuilderMoveToWStr(&sb, lpWStrText);
+}
+
+static void
+StaticContextInit(_Inout_ struct BenchContext *lpContext,
+                  _In_    const size_t          ulMinSize)
+{
+    StaticCreateText(ulMinSize, &(lpContext->textWStr));
+
+    const struct WStr padWStr = WSTR_FROM_LITERAL(L"        ");
+    WStrConcatMany(&(lpContext->paddedTextWStr), &padWStr, &(lpContext->textWStr), &padWStr, NULL);
+
+    const struct WStrSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                             .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    WStrSplitNewLine(&(lpContext->textWStr), &options, &(lpContext->lineWStrArr));
+
+    const size_t ulPieceSize = lpContext->textWStr.ulSize / PIECE_COUNT;
+    for (size_t i = 0; i < PIECE_COUNT; ++i)
+    {
+        const size_t ulOffset = i * ulPieceSize;
+        const size_t ulSize = (i + 1U < PIECE_COUNT) ? ulPieceSize : (lpContext->textWStr.ulSize - ulOffset);
+        WStrCopyWCharArr(lpContext->pieceWStrArr + i, lpContext->textWStr.lpWCharArr + ulOffset, ulSize);
+    }
+
+    // Input for WStrFileRead()
+    WStrFileWrite(BENCH_FILE_PATH, CP_UTF8, &(lpContext->textWStr));
+}
+
+static void
+StaticContextFree(_Inout_ struct BenchContext *lpContext)
+{
+    WStrFree(&(lpContext->textWStr));
+    WStrFree(&(lpContext->paddedTextWStr));
+    WStrArrFree(&(lpContext->lineWStrArr));
+    for (size_t i = 0; i < PIECE_COUNT; ++i)
+    {
+        WStrFree(lpContext->pieceWStrArr + i);
+    }
+    WStrFree(&(lpContext->outWStr));
+    WStrArrFree(&(lpContext->outWStrArr));
+}
+
+static void
+StaticSplit(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    const struct WStr delimWStr = WSTR_FROM_LITERAL(L"|");
+    const struct WStrSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                             .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    WStrSplit(&(lpContext->textWStr), &delimWStr, &options, &(lpContext->outWStrArr));
+    WStrArrFree(&(lpContext->outWStrArr));
+}
+
+static void
+StaticSplitNewLine(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    const struct WStrSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                             .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    WStrSplitNewLine(&(lpContext->textWStr), &options, &(lpContext->outWStrArr));
+    WStrArrFree(&(lpContext->outWStrArr));
+}
+
+static void
+StaticJoin(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    const struct WStr delimWStr = WSTR_FROM_LITERAL(L"\r\n");
+    WStrJoin(&(lpContext->lineWStrArr), &delimWStr, &(lpContext->outWStr));
+    WStrFree(&(lpContext->outWStr));
+}
+
+/**
+ * Intentional: Copy, then trim.  Why?  WStrTrimSpace() is in place: Each call must begin from same padded text.
+ */
+static void
+StaticCopyThenTrim(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    WStrCopyWStr(&(lpContext->outWStr), &(lpContext->paddedTextWStr));
+    WStrTrimSpace(&(lpContext->outWStr));
+    WStrFree(&(lpContext->outWStr));
+}
+
+static void
+StaticConcatMany(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    const struct WStr *p = lpContext->pieceWStrArr;
+    WStrConcatMany(&(lpContext->outWStr), p + 0, p + 1, p + 2, p + 3, p + 4, p + 5, p + 6, p + 7, NULL);
+    WStrFree(&(lpContext->outWStr));
+}
+
+static void
+StaticSPrintF(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    WStrSPrintF(&(lpContext->outWStr), L"%ls|%d|%ls",
+                lpContext->pieceWStrArr[0].lpWCharArr, 12345, lpContext->pieceWStrArr[1].lpWCharArr);
+    WStrFree(&(lpContext->outWStr));
+}
+
+static void
+StaticFileRead(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    WStrFileRead(BENCH_FILE_PATH, CP_UTF8, &(lpContext->outWStr));
+    WStrFree(&(lpContext->outWStr));
+}
+
+static void
+StaticFileWrite(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    WStrFileWrite(BENCH_FILE_PATH, CP_UTF8, &(lpContext->textWStr));
+}
+
+static void
+StaticBenchSize(_Inout_ struct BenchSuite *lpSuite,
+                _In_    const size_t       ulMinSize)
+{
+    struct BenchContext context = {0};
+    StaticContextInit(&context, ulMinSize);
+
+    const size_t ulTextByteSize = context.textWStr.ulSize * sizeof(wchar_t);
+    // Input of WStrSPrintF() is two pieces
+    const size_t ulSPrintFByteSize = (context.pieceWStrArr[0].ulSize + context.pieceWStrArr[1].ulSize) * sizeof(wchar_t);
+
+    BenchRun(lpSuite, L"WStrSplit", ulTextByteSize, StaticSplit, &context);
+    BenchRun(lpSuite, L"WStrSplitNewLine", ulTextByteSize, StaticSplitNewLine, &context);
+    BenchRun(lpSuite, L"WStrJoin", ulTextByteSize, StaticJoin, &context);
+    BenchRun(lpSuite, L"WStrCopy+WStrTrimSpace", context.paddedTextWStr.ulSize * sizeof(wchar_t), StaticCopyThenTrim, &context);
+    BenchRun(lpSuite, L"WStrConcatMany", ulTextByteSize, StaticConcatMany, &context);
+    BenchRun(lpSuite, L"WStrSPrintF", ulSPrintFByteSize, StaticSPrintF, &context);
+    BenchRun(lpSuite, L"WStrFileRead", ulTextByteSize, StaticFileRead, &context);
+    BenchRun(lpSuite, L"WStrFileWrite", ulTextByteSize, StaticFileWrite, &context);
+
+    StaticContextFree(&context);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Intentional: Default SIMD level only.  Why?  Baseline is for the code path used by the apps.
+    // For each SIMD level, see: wstr_split_bench.c
+    printf("simd %d\n", WStrSimdGetLevel());
+
+    // Intentional: Results for all sizes are in one suite.  Why?  Baseline key is name and input size.
+    struct BenchSuite suite = {.lpNameWCharArr = L"wstr_bench"};
+
+    // Number of wchar_t: About 1 Ki, 64 Ki, 4 Mi
+    StaticBenchSize(&suite, 1024U);
+    StaticBenchSize(&suite, 64U * 1024U);
+    StaticBenchSize(&suite, 4U * 1024U * 1024U);
+
+    Win32FileDelete(BENCH_FILE_PATH);
+
+    const size_t ulRegressionCount = BenchSuiteFinish(&suite);
+    BenchSuiteFree(&suite);
+
+    // Intentional: Non-zero exit.  Why?  build.bash stops (set -e) if any regression.
+    const int x = (0 == ulRegressionCount) ? 0 : 1;
+    return x;
+}
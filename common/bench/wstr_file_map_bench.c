@@ -0,0 +1,345 @@
+#include "wstr.h"
+#include "wstr_file_map.h"
+#include "wstr_line_reader.h"
+#include "win32_last_error.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <psapi.h>    // required for GetProcessMemoryInfo()
+#include <stdio.h>    // required for printf()
+#include <stdlib.h>   // required for qsort()
+#include <string.h>   // required for strlen()
+#include <assert.h>   // required for assert()
+
+#define WARMUP_COUNT 2U
+#define SAMPLE_COUNT 10U
+
+// 128 MiB of UTF-8
+#define FILE_MIN_BYTE_SIZE (128U * 1024U * 1024U)
+
+static const wchar_t *BENCH_FILE_PATH = L"wstr_file_map_bench.txt";
+
+/**
+ * Previous implementation of WStrFileRead(): ReadFile() into heap buffer, then MultiByteToWideChar() twice with -1.
+ * Keep as baseline for comparison.  BOM checks are removed: Bench file has no BOM.
+ */
+static void
+StaticWStrFileReadOld(_In_    const wchar_t *lpFilePathWCharArr,
+                      _In_    const UINT     codePage,  // Ex: CP_UTF8
+                      _Inout_ struct WStr   *lpDestWStr)
+{
+    WStrFree(lpDestWStr);
+
+    const HANDLE hReadFile = CreateFile(lpFilePathWCharArr, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE == hReadFile)
+    {
+        Win32LastErrorFPutWSAbort(stderr,          // _In_ FILE          *lpStream
+                                  L"CreateFile");  // _In_ const wchar_t *lpMessage
+    }
+
+    LARGE_INTEGER fileSize = {0};
+    if (!GetFileSizeEx(hReadFile, &fileSize))
+    {
+        Win32LastErrorFPutWSAbort(stderr,             // _In_ FILE          *lpStream
+                                  L"GetFileSizeEx");  // _In_ const wchar_t *lpMessage
+    }
+    const DWORD dwFileSize = (DWORD) fileSize.QuadPart;
+
+    char *lpCharArr = xcalloc(dwFileSize + LEN_NUL_CHAR, sizeof(char));
+
+    DWORD dwNumberOfBytesRead = 0;
+    if (!ReadFile(hReadFile, lpCharArr, dwFileSize, &dwNumberOfBytesRead, NULL))
+    {
+        Win32LastErrorFPutWSAbort(stderr,        // _In_ FILE          *lpStream
+                                  L"ReadFile");  // _In_ const wchar_t *lpMessage
+    }
+    assert(dwFileSize == dwNumberOfBytesRead);
+    CloseHandle(hReadFile);
+
+    const int iWCharArrLen = MultiByteToWideChar(codePage, MB_ERR_INVALID_CHARS, lpCharArr, -1, NULL, 0);
+    assert(iWCharArrLen > 0);
+    wchar_t *lpWCharArr = xcalloc(iWCharArrLen, sizeof(wchar_t));
+    const int iWCharArrLen2 = MultiByteToWideChar(codePage, MB_ERR_INVALID_CHARS, lpCharArr, -1, lpWCharArr, iWCharArrLen);
+    assert(iWCharArrLen == iWCharArrLen2);
+
+    xfree((void **) &lpCharArr);
+
+    lpDestWStr->lpWCharArr = lpWCharArr;
+    lpDestWStr->ulSize     = iWCharArrLen - LEN_NUL_CHAR;
+}
+
+/**
+ * @return number of decoded wchars or lines
+ */
+typedef size_t (*ReadFunc)();
+
+static size_t
+StaticReadOld()
+{
+    struct WStr wstr = {0};
+    StaticWStrFileReadOld(BENCH_FILE_PATH, CP_UTF8, &wstr);
+    const size_t ulSize = wstr.ulSize;
+    WStrFree(&wstr);
+    return ulSize;
+}
+
+static size_t
+StaticWStrFileRead()
+{
+    struct WStr wstr = {0};
+    WStrFileRead(BENCH_FILE_PATH, CP_UTF8, &wstr);
+    const size_t ulSize = wstr.ulSize;
+    WStrFree(&wstr);
+    return ulSize;
+}
+
+// Startup time: Time to first line.
+static size_t
+StaticWStrFileMapFirstLine()
+{
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, BENCH_FILE_PATH, CP_UTF8);
+    struct WStrView lineWStrView = {0};
+    const bool bHasLine = WStrFileMapNextLine(&fileMap, &lineWStrView);
+    WStrFileMapClose(&fileMap);
+    return bHasLine ? 1U : 0U;
+}
+
+static size_t
+StaticWStrFileMapAllLines()
+{
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, BENCH_FILE_PATH, CP_UTF8);
+    struct WStrView lineWStrView = {0};
+    while (WStrFileMapNextLine(&fileMap, &lineWStrView))
+    {
+        // Empty
+    }
+    const size_t ulLineCount = 1U + fileMap.ulLineIndex;
+    WStrFileMapClose(&fileMap);
+    return ulLineCount;
+}
+
+static size_t
+StaticWStrLineReaderAllLines()
+{
+    struct WStrLineReader reader = {0};
+    WStrLineReaderOpen(&reader, BENCH_FILE_PATH, CP_UTF8, WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE);
+    struct WStrView lineWStrView = {0};
+    while (WStrLineReaderNext(&reader, &lineWStrView))
+    {
+        // Empty
+    }
+    const size_t ulLineCount = 1U + reader.ulLineIndex;
+    WStrLineReaderClose(&reader);
+    return ulLineCount;
+}
+
+struct BenchCase
+{
+    const wchar_t *lpNameWCharArr;
+    ReadFunc       fpReadFunc;
+};
+
+static const struct BenchCase BENCH_CASE_ARR[] = {
+    {L"old: ReadFile+MultiByteToWideChar x2", StaticReadOld},
+    {L"WStrFileRead (mapped)",                StaticWStrFileRead},
+    {L"WStrFileMap: first line",              StaticWStrFileMapFirstLine},
+    {L"WStrFileMap: all lines",               StaticWStrFileMapAllLines},
+    {L"WStrLineReader: all lines",            StaticWStrLineReaderAllLines},
+};
+
+static const size_t BENCH_CASE_COUNT = sizeof(BENCH_CASE_ARR) / sizeof(BENCH_CASE_ARR[0]);
+
+static int
+StaticCompareDouble(_In_ const void *lpLeft,
+                    _In_ const void *lpRight)
+{
+    const double left  = *((const double *) lpLeft);
+    const double right = *((const double *) lpRight);
+    return (left > right) - (left < right);
+}
+
+static void
+StaticBench(_In_ const struct BenchCase *lpBenchCase,
+            _In_ const size_t            ulFileByteSize)
+{
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+
+    double lpSecondsArr[SAMPLE_COUNT];
+    size_t ulResult = 0;
+
+    for (size_t i = 0; i < WARMUP_COUNT + SAMPLE_COUNT; ++i)
+    {
+        LARGE_INTEGER begin;
+        QueryPerformanceCounter(&begin);
+
+        ulResult = lpBenchCase->fpReadFunc();
+
+        LARGE_INTEGER end;
+        QueryPerformanceCounter(&end);
+
+        if (i >= WARMUP_COUNT) {
+            lpSecondsArr[i - WARMUP_COUNT] = ((double) (end.QuadPart - begin.QuadPart)) / ((double) freq.QuadPart);
+        }
+    }
+
+    qsort(lpSecondsArr, SAMPLE_COUNT, sizeof(lpSecondsArr[0]), StaticCompareDouble);
+
+    const double dMiB = ((double) ulFileByteSize) / (1024.0 * 1024.0);
+    const double dMedianSeconds = lpSecondsArr[SAMPLE_COUNT / 2];
+    printf("%-40ls: %8.2f MiB, result %10zu: min %9.3f ms, median %9.3f ms, %8.1f MiB/s\n",
+           lpBenchCase->lpNameWCharArr, dMiB, ulResult, 1000.0 * lpSecondsArr[0], 1000.0 * dMedianSeconds, dMiB / dMedianSeconds);
+}
+
+/**
+ * Run one case once, then print peak memory of this process.
+ * Why a child process per case?  Peak counters cannot be reset.
+ * Working set includes file cache pages of a mapped view; pagefile usage is only private (heap) memory.
+ */
+static void
+StaticPrintPeakMemory(_In_ const struct BenchCase *lpBenchCase)
+{
+    lpBenchCase->fpReadFunc();
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/psapi/nf-psapi-getprocessmemoryinfo
+    PROCESS_MEMORY_COUNTERS counters = {.cb = sizeof(counters)};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        Win32LastErrorFPutWSAbort(stderr,                    // _In_ FILE          *lpStream
+                                  L"GetProcessMemoryInfo");  // _In_ const wchar_t *lpMessage
+    }
+    printf("%-40ls: peak working set %8.1f MiB, peak private %8.1f MiB\n",
+           lpBenchCase->lpNameWCharArr,
+           ((double) counters.PeakWorkingSetSize) / (1024.0 * 1024.0),
+           ((double) counters.PeakPagefileUsage) / (1024.0 * 1024.0));
+}
+
+static void
+StaticRunChildProcess(_In_ const size_t ulCaseIndex)
+{
+    wchar_t lpExePathWCharArr[MAX_PATH];
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/libloaderapi/nf-libloaderapi-getmodulefilenamew
+    const DWORD dwExePathSize = GetModuleFileNameW(NULL, lpExePathWCharArr, MAX_PATH);
+    if (0 == dwExePathSize || MAX_PATH == dwExePathSize)
+    {
+        Win32LastErrorFPutWSAbort(stderr,                  // _In_ FILE          *lpStream
+                                  L"GetModuleFileNameW");  // _In_ const wchar_t *lpMessage
+    }
+
+    struct WStr cmdLineWStr = {0};
+    WStrSPrintF(&cmdLineWStr, L"\"%ls\" %zu", lpExePathWCharArr, ulCaseIndex);
+
+    // Intentional: Flush before child writes to same stdout.
+    fflush(stdout);
+
+    STARTUPINFOW startupInfo = {.cb = sizeof(startupInfo)};
+    startupInfo.dwFlags    = STARTF_USESTDHANDLES;
+    startupInfo.hStdInput  = GetStdHandle(STD_INPUT_HANDLE);
+    startupInfo.hStdOutput = GetStdHandle(STD_OUTPUT_HANDLE);
+    startupInfo.hStdError  = GetStdHandle(STD_ERROR_HANDLE);
+    PROCESS_INFORMATION processInfo = {0};
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-createprocessw
+    if (!CreateProcessW(NULL,                    // [in, optional] LPCWSTR lpApplicationName
+                        cmdLineWStr.lpWCharArr,  // [in, out, optional] LPWSTR lpCommandLine
+                        NULL,                    // [in, optional] LPSECURITY_ATTRIBUTES lpProcessAttributes
+                        NULL,                    // [in, optional] LPSECURITY_ATTRIBUTES lpThreadAttributes
+                        TRUE,                    // [in] BOOL bInheritHandles
+                        0,                       // [in] DWORD dwCreationFlags
+                        NULL,                    // [in, optional] LPVOID lpEnvironment
+                        NULL,                    // [in, optional] LPCWSTR lpCurrentDirectory
+                        &startupInfo,            // [in] LPSTARTUPINFOW lpStartupInfo
+                        &processInfo))           // [out] LPPROCESS_INFORMATION lpProcessInformation
+    {
+        Win32LastErrorFPutWSAbort(stderr,              // _In_ FILE          *lpStream
+                                  L"CreateProcessW");  // _In_ const wchar_t *lpMessage
+    }
+    WaitForSingleObject(processInfo.hProcess, INFINITE);
+    CloseHandle(processInfo.hThread);
+    CloseHandle(processInfo.hProcess);
+    WStrFree(&cmdLineWStr);
+}
+
+/**
+ * Write config-like lines: mostly ASCII, with a few 3-byte UTF-8 chars per line.
+ *
+ * @return file size in bytes
+ */
+static size_t
+StaticCreateFile()
+{
+    const HANDLE hWriteFile = CreateFile(BENCH_FILE_PATH, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE == hWriteFile)
+    {
+        Win32LastErrorFPutWSAbort(stderr,          // _In_ FILE          *lpStream
+                                  L"CreateFile");  // _In_ const wchar_t *lpMessage
+    }
+
+    // Intentional: Write 1 MiB at a time.  Why?  Do not hold whole file in memory.
+    const size_t ulBufferSize = 1024U * 1024U;
+    char *lpCharArr = xcalloc(ulBufferSize, sizeof(char));
+    size_t ulFileByteSize = 0;
+    size_t ulLineIndex = 0;
+    while (ulFileByteSize < FILE_MIN_BYTE_SIZE)
+    {
+        size_t ulSize = 0;
+        while (true)
+        {
+            char lpLineCharArr[128];
+            const int iLineSize = snprintf(lpLineCharArr, sizeof(lpLineCharArr),
+                                           "key_%08zu | value for line %zu with \xE6\x9D\xB1\xE4\xBA\xAC text\r\n", ulLineIndex, ulLineIndex);
+            assert(iLineSize > 0 && (size_t) iLineSize < sizeof(lpLineCharArr));
+            if (ulSize + iLineSize > ulBufferSize) {
+                break;
+            }
+            memcpy(lpCharArr + ulSize, lpLineCharArr, iLineSize);
+            ulSize += iLineSize;
+            ++ulLineIndex;
+        }
+
+        DWORD dwNumberOfBytesWritten = 0;
+        if (!WriteFile(hWriteFile, lpCharArr, ulSize, &dwNumberOfBytesWritten, NULL))
+        {
+            Win32LastErrorFPutWSAbort(stderr,         // _In_ FILE          *lpStream
+                                      L"WriteFile");  // _In_ const wchar_t *lpMessage
+        }
+        assert(ulSize == dwNumberOfBytesWritten);
+        ulFileByteSize += ulSize;
+    }
+    xfree((void **) &lpCharArr);
+    CloseHandle(hWriteFile);
+    return ulFileByteSize;
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Child process: Argument is index of case.  Bench file already exists.
+    if (NULL != lpCmdLine && L'\0' != lpCmdLine[0])
+    {
+        const size_t ulCaseIndex = wcstoul(lpCmdLine, NULL, 10);
+        assert(ulCaseIndex < BENCH_CASE_COUNT);
+        StaticPrintPeakMemory(BENCH_CASE_ARR + ulCaseIndex);
+        return 0;
+    }
+
+    const size_t ulFileByteSize = StaticCreateFile();
+
+    for (size_t i = 0; i < BENCH_CASE_COUNT; ++i)
+    {
+        StaticBench(BENCH_CASE_ARR + i, ulFileByteSize);
+    }
+    for (size_t i = 0; i < BENCH_CASE_COUNT; ++i)
+    {
+        StaticRunChildProcess(i);
+    }
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(BENCH_FILE_PATH);
+    return 0;
+}
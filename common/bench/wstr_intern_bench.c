@@ -0,0 +1,153 @@
+#include "wstr_intern.h"
+#include "wstr_simd.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <stdlib.h>   // required for qsort()
+#include <assert.h>   // required for assert()
+
+#define WARMUP_COUNT 2U
+#define SAMPLE_COUNT 10U
+
+// Similar to passport config file: Many entries share few usernames and passwords.
+#define ENTRY_COUNT            50000U
+#define DISTINCT_USERNAME_COUNT 1000U
+#define DISTINCT_PASSWORD_COUNT 5000U
+
+struct BenchEntry
+{
+    struct WStr usernameWStr;
+    struct WStr passwordWStr;
+};
+
+static void
+StaticCreateEntryArr(_Inout_ struct BenchEntry *lpEntryArr)
+{
+    for (size_t i = 0; i < ENTRY_COUNT; ++i)
+    {
+        struct BenchEntry *lpEntry = lpEntryArr + i;
+        WStrSPrintF(&(lpEntry->usernameWStr), L"user%04zd@example.com", i % DISTINCT_USERNAME_COUNT);
+        // Intentional: Different stride than username.  Why?  Pairs are not all the same.
+        WStrSPrintF(&(lpEntry->passwordWStr), L"Password!%05zd", (i * 7U) % DISTINCT_PASSWORD_COUNT);
+    }
+}
+
+/**
+ * @return bytes for one struct WStr, plus heap bytes if too long for small string buffer
+ */
+static size_t
+StaticGetWStrByteSize(_In_ const struct WStr *lpWStr)
+{
+    size_t x = sizeof(struct WStr);
+    if (!WStrIsSmall(lpWStr)) {
+        x += (lpWStr->ulSize + LEN_NUL_CHAR) * sizeof(wchar_t);
+    }
+    return x;
+}
+
+static int
+StaticCompareDouble(_In_ const void *lpLeft,
+                    _In_ const void *lpRight)
+{
+    const double left  = *((const double *) lpLeft);
+    const double right = *((const double *) lpRight);
+    return (left > right) - (left < right);
+}
+
+static void
+StaticBench(_In_ const struct BenchEntry *lpEntryArr)
+{
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+
+    double lpSecondsArr[SAMPLE_COUNT];
+    size_t ulDistinctCount = 0;
+    size_t ulHeapByteSize = 0;
+
+    for (size_t i = 0; i < WARMUP_COUNT + SAMPLE_COUNT; ++i)
+    {
+        struct WStrIntern intern = {0};
+
+        LARGE_INTEGER begin;
+        QueryPerformanceCounter(&begin);
+
+        for (size_t j = 0; j < ENTRY_COUNT; ++j)
+        {
+            WStrInternWStr(&intern, &(lpEntryArr[j].usernameWStr));
+            WStrInternWStr(&intern, &(lpEntryArr[j].passwordWStr));
+        }
+
+        LARGE_INTEGER end;
+        QueryPerformanceCounter(&end);
+
+        ulDistinctCount = intern.ulSize;
+        ulHeapByteSize = WStrInternGetHeapByteSize(&intern);
+        WStrInternFree(&intern);
+
+        if (i >= WARMUP_COUNT) {
+            lpSecondsArr[i - WARMUP_COUNT] = ((double) (end.QuadPart - begin.QuadPart)) / ((double) freq.QuadPart);
+        }
+    }
+
+    qsort(lpSecondsArr, SAMPLE_COUNT, sizeof(lpSecondsArr[0]), StaticCompareDouble);
+
+    const double dMedianSeconds = lpSecondsArr[SAMPLE_COUNT / 2];
+    const double dNanosPerString = (1e9 * dMedianSeconds) / (2.0 * ENTRY_COUNT);
+    printf("WStrInternWStr: simd %d: %u entries, %zd distinct: min %8.3f ms, median %8.3f ms, %6.1f ns/string, %zd heap bytes\n",
+           WStrSimdGetLevel(), ENTRY_COUNT, ulDistinctCount, 1000.0 * lpSecondsArr[0], 1000.0 * dMedianSeconds,
+           dNanosPerString, ulHeapByteSize);
+}
+
+static void
+StaticPrintMemory(_In_ const struct BenchEntry *lpEntryArr)
+{
+    // Before: Each entry owns two struct WStr.
+    size_t ulCopyByteSize = 0;
+    for (size_t i = 0; i < ENTRY_COUNT; ++i)
+    {
+        ulCopyByteSize += StaticGetWStrByteSize(&(lpEntryArr[i].usernameWStr));
+        ulCopyByteSize += StaticGetWStrByteSize(&(lpEntryArr[i].passwordWStr));
+    }
+
+    // After: Each entry owns two pointers into one shared WStrIntern.
+    struct WStrIntern intern = {0};
+    for (size_t i = 0; i < ENTRY_COUNT; ++i)
+    {
+        WStrInternWStr(&intern, &(lpEntryArr[i].usernameWStr));
+        WStrInternWStr(&intern, &(lpEntryArr[i].passwordWStr));
+    }
+    const size_t ulInternByteSize = (ENTRY_COUNT * 2U * sizeof(const struct WStr *)) + WStrInternGetHeapByteSize(&intern);
+
+    printf("copy  : %u entries: %10zd bytes (excludes per-alloc heap overhead)\n", ENTRY_COUNT, ulCopyByteSize);
+    printf("intern: %u entries: %10zd bytes (%zd distinct strings)\n", ENTRY_COUNT, ulInternByteSize, intern.ulSize);
+    printf("intern / copy: %.3f\n", ((double) ulInternByteSize) / ((double) ulCopyByteSize));
+    WStrInternFree(&intern);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    struct BenchEntry *lpEntryArr = xcalloc(ENTRY_COUNT, sizeof(struct BenchEntry));
+    StaticCreateEntryArr(lpEntryArr);
+
+    StaticPrintMemory(lpEntryArr);
+
+    const enum EWStrSimdLevel eMaxLevel = WStrSimdGetMaxLevel();
+    for (int eLevel = WSTR_SIMD_LEVEL_SCALAR; eLevel <= (int) eMaxLevel; ++eLevel)
+    {
+        WStrSimdSetLevel((enum EWStrSimdLevel) eLevel);
+        StaticBench(lpEntryArr);
+    }
+
+    for (size_t i = 0; i < ENTRY_COUNT; ++i)
+    {
+        WStrFree(&(lpEntryArr[i].usernameWStr));
+        WStrFree(&(lpEntryArr[i].passwordWStr));
+    }
+    xfree((void **) &lpEntryArr);
+    return 0;
+}
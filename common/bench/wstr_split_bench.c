@@ -0,0 +1,257 @@
+#include "wstr.h"
+#include "wstr_simd.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <stdlib.h>   // required for qsort()
+#include <assert.h>   // required for assert()
+
+#define WARMUP_COUNT 2U
+#define SAMPLE_COUNT 10U
+
+/**
+ * Previous implementation of WStrSplit0(): Two passes with wcsstr().  Keep as baseline for comparison.
+ */
+static void
+StaticWStrSplitTwoPass(_In_    const struct WStr *lpWStrText,
+                       _In_    const struct WStr *lpWStrDelim,
+                       _Inout_ struct WStrArr    *lpTokenWStrArr)
+{
+    // Step 1: Count number of delimiters
+    size_t ulDelimCount = 0;
+    const wchar_t *lpIter = lpWStrText->lpWCharArr;
+    while (TRUE)
+    {
+        const wchar_t *lpNextDelim = wcsstr(lpIter, lpWStrDelim->lpWCharArr);
+        if (NULL == lpNextDelim) {
+            break;
+        }
+        lpIter = lpNextDelim + lpWStrDelim->ulSize;
+        ++ulDelimCount;
+    }
+
+    const size_t ulTokenCount = 1U + ulDelimCount;
+    WStrArrAlloc(lpTokenWStrArr, ulTokenCount);
+
+    // Step 2: Extract tokens between delimiters
+    lpIter = lpWStrText->lpWCharArr;
+    for (size_t ulTokenIndex = 0; ulTokenIndex < ulTokenCount; ++ulTokenIndex)
+    {
+        const wchar_t *lpNextDelim = wcsstr(lpIter, lpWStrDelim->lpWCharArr);
+        if (NULL == lpNextDelim) {
+            lpNextDelim = lpWStrText->lpWCharArr + lpWStrText->ulSize;
+        }
+        WStrCopyWCharArr(lpTokenWStrArr->lpWStrArr + ulTokenIndex, lpIter, lpNextDelim - lpIter);
+        lpIter = lpNextDelim + lpWStrDelim->ulSize;
+    }
+}
+
+static void
+StaticWStrSplit(_In_    const struct WStr *lpWStrText,
+                _In_    const struct WStr *lpWStrDelim,
+                _Inout_ struct WStrArr    *lpTokenWStrArr)
+{
+    const struct WStrSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                             .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    WStrSplit(lpWStrText, lpWStrDelim, &options, lpTokenWStrArr);
+}
+
+static void
+StaticWStrSplitArena(_In_    const struct WStr *lpWStrText,
+                     _In_    const struct WStr *lpWStrDelim,
+                     _Inout_ struct WStrArr    *lpTokenWStrArr)
+{
+    const struct WStrViewSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                                 .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    WStrSplitArena(lpWStrText, lpWStrDelim, &options, lpTokenWStrArr);
+}
+
+/**
+ * Previous implementation of WStrSplit() with WStrTrimSpace(): Copy each token, then copy again to trim.
+ * Keep as baseline for comparison.
+ */
+static void
+StaticWStrSplitThenTrim(_In_    const struct WStr *lpWStrText,
+                        _In_    const struct WStr *lpWStrDelim,
+                        _Inout_ struct WStrArr    *lpTokenWStrArr)
+{
+    const struct WStrSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                             .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    WStrSplit(lpWStrText, lpWStrDelim, &options, lpTokenWStrArr);
+    WStrArrForEach(lpTokenWStrArr, WStrTrimSpace);
+}
+
+static void
+StaticWStrSplitTrimFused(_In_    const struct WStr *lpWStrText,
+                         _In_    const struct WStr *lpWStrDelim,
+                         _Inout_ struct WStrArr    *lpTokenWStrArr)
+{
+    const struct WStrSplitOptions options = {.iMinTokenCount             = UNLIMITED_MIN_TOKEN_COUNT,
+                                             .iMaxTokenCount             = UNLIMITED_MAX_TOKEN_COUNT,
+                                             .fpNullableWStrConsumerFunc = WStrTrimSpace};
+    WStrSplit(lpWStrText, lpWStrDelim, &options, lpTokenWStrArr);
+}
+
+typedef void (*SplitFunc)(_In_    const struct WStr *lpWStrText,
+                          _In_    const struct WStr *lpWStrDelim,
+                          _Inout_ struct WStrArr    *lpTokenWStrArr);
+
+static int
+StaticCompareDouble(_In_ const void *lpLeft,
+                    _In_ const void *lpRight)
+{
+    const double left  = *((const double *) lpLeft);
+    const double right = *((const double *) lpRight);
+    return (left > right) - (left < right);
+}
+
+static void
+StaticBench(_In_ const char        *lpszName,
+            _In_ const SplitFunc    fpSplitFunc,
+            _In_ const struct WStr *lpWStrText,
+            _In_ const struct WStr *lpWStrDelim)
+{
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+
+    double lpSecondsArr[SAMPLE_COUNT];
+    size_t ulTokenCount = 0;
+
+    for (size_t i = 0; i < WARMUP_COUNT + SAMPLE_COUNT; ++i)
+    {
+        struct WStrArr tokenWStrArr = {};
+
+        LARGE_INTEGER begin;
+        QueryPerformanceCounter(&begin);
+
+        fpSplitFunc(lpWStrText, lpWStrDelim, &tokenWStrArr);
+
+        LARGE_INTEGER end;
+        QueryPerformanceCounter(&end);
+
+        ulTokenCount = tokenWStrArr.ulSize;
+        WStrArrFree(&tokenWStrArr);
+
+        if (i >= WARMUP_COUNT) {
+            lpSecondsArr[i - WARMUP_COUNT] = ((double) (end.QuadPart - begin.QuadPart)) / ((double) freq.QuadPart);
+        }
+    }
+
+    qsort(lpSecondsArr, SAMPLE_COUNT, sizeof(lpSecondsArr[0]), StaticCompareDouble);
+
+    const double dMiB = ((double) (lpWStrText->ulSize * sizeof(wchar_t))) / (1024.0 * 1024.0);
+    const double dMedianSeconds = lpSecondsArr[SAMPLE_COUNT / 2];
+    printf("%-24s: simd %d: %8.2f MiB, %10zu tokens: min %8.3f ms, median %8.3f ms, %8.1f MiB/s\n",
+           lpszName, WStrSimdGetLevel(), dMiB, ulTokenCount, 1000.0 * lpSecondsArr[0], 1000.0 * dMedianSeconds, dMiB / dMedianSeconds);
+}
+
+static void
+StaticBenchEachSimdLevel(_In_ const char        *lpszName,
+                         _In_ const SplitFunc    fpSplitFunc,
+                         _In_ const struct WStr *lpWStrText,
+                         _In_ const struct WStr *lpWStrDelim)
+{
+    const enum EWStrSimdLevel eMaxLevel = WStrSimdGetMaxLevel();
+    for (int eLevel = WSTR_SIMD_LEVEL_SCALAR; eLevel <= (int) eMaxLevel; ++eLevel)
+    {
+        WStrSimdSetLevel((enum EWStrSimdLevel) eLevel);
+        StaticBench(lpszName, fpSplitFunc, lpWStrText, lpWStrDelim);
+    }
+}
+
+/**
+ * @param ulTokenSize
+ *        short tokens fit in small string buffer; long tokens are heap allocated
+ *
+ * @param ulPadSize
+ *        number of spaces before and after each token
+ */
+static void
+StaticCreateText(_In_    const size_t  ulMinSize,
+                 _In_    const size_t  ulTokenSize,
+                 _In_    const size_t  ulPadSize,
+                 _In_    const wchar_t *lpDelim,
+                 _Inout_ struct WStr   *lpWStrText)
+{
+    const size_t ulDelimSize = wcslen(lpDelim);
+    const size_t ulRecordSize = ulPadSize + ulTokenSize + ulPadSize + ulDelimSize;
+    const size_t ulRecordCount = (ulMinSize + ulRecordSize - 1U) / ulRecordSize;
+    const size_t ulSize = ulRecordCount * ulRecordSize;
+
+    wchar_t *lpWCharArr = xcalloc(ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
+    wchar_t *lpIter = lpWCharArr;
+    for (size_t i = 0; i < ulRecordCount; ++i)
+    {
+        wmemset(lpIter, L' ', ulPadSize);
+        lpIter += ulPadSize;
+        for (size_t j = 0; j < ulTokenSize; ++j)
+        {
+            *lpIter = L'a' + ((i + j) % 26);
+            ++lpIter;
+        }
+        wmemset(lpIter, L' ', ulPadSize);
+        lpIter += ulPadSize;
+        wmemcpy(lpIter, lpDelim, ulDelimSize);
+        lpIter += ulDelimSize;
+    }
+    assert(lpWCharArr + ulSize == lpIter);
+
+    WStrFree(lpWStrText);
+    lpWStrText->lpWCharArr = lpWCharArr;
+    lpWStrText->ulSize     = ulSize;
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // 8 MiB of wchar_t
+    const size_t ulMinSize = 4U * 1024U * 1024U;
+
+    // Short tokens, e.g., config file lines: "key | value"
+    {
+    struct WStr textWStr = {};
+    const struct WStr delimWStr = WSTR_FROM_LITERAL(L"\r\n");
+    StaticCreateText(ulMinSize, 10, 0, delimWStr.lpWCharArr, &textWStr);
+    StaticBench("two-pass, short, \\r\\n", StaticWStrSplitTwoPass, &textWStr, &delimWStr);
+    StaticBenchEachSimdLevel("WStrSplit, short, \\r\\n", StaticWStrSplit, &textWStr, &delimWStr);
+    StaticBenchEachSimdLevel("WStrSplitArena, short, \\r\\n", StaticWStrSplitArena, &textWStr, &delimWStr);
+    WStrFree(&textWStr);
+    }
+
+    // Long tokens
+    {
+    struct WStr textWStr = {};
+    const struct WStr delimWStr = WSTR_FROM_LITERAL(L"|");
+    StaticCreateText(ulMinSize, 200, 0, delimWStr.lpWCharArr, &textWStr);
+    StaticBench("two-pass, long, |", StaticWStrSplitTwoPass, &textWStr, &delimWStr);
+    StaticBenchEachSimdLevel("WStrSplit, long, |", StaticWStrSplit, &textWStr, &delimWStr);
+    StaticBenchEachSimdLevel("WStrSplitArena, long, |", StaticWStrSplitArena, &textWStr, &delimWStr);
+    WStrFree(&textWStr);
+    }
+
+    // Padded tokens, e.g., config file tokens: " LCtrl + LShift + 0x50 "
+    {
+    struct WStr textWStr = {};
+    const struct WStr delimWStr = WSTR_FROM_LITERAL(L"|");
+    StaticCreateText(ulMinSize, 10, 2, delimWStr.lpWCharArr, &textWStr);
+    StaticBenchEachSimdLevel("split then trim, padded 10", StaticWStrSplitThenTrim, &textWStr, &delimWStr);
+    StaticBenchEachSimdLevel("fused trim, padded 10", StaticWStrSplitTrimFused, &textWStr, &delimWStr);
+    WStrFree(&textWStr);
+    }
+
+    // Padded long tokens: Both before and after trim, each token is heap allocated.
+    {
+    struct WStr textWStr = {};
+    const struct WStr delimWStr = WSTR_FROM_LITERAL(L"|");
+    StaticCreateText(ulMinSize, 40, 4, delimWStr.lpWCharArr, &textWStr);
+    StaticBenchEachSimdLevel("split then trim, padded 40", StaticWStrSplitThenTrim, &textWStr, &delimWStr);
+    StaticBenchEachSimdLevel("fused trim, padded 40", StaticWStrSplitTrimFused, &textWStr, &delimWStr);
+    WStrFree(&textWStr);
+    }
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+#include "wstr.h"
+#include "wstr_simd.h"
+#include "wstr_utf8.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <stdlib.h>   // required for qsort()
+#include <assert.h>   // required for assert()
+
+#define WARMUP_COUNT 2U
+#define SAMPLE_COUNT 10U
+
+/**
+ * @param lpSrc
+ *        terminated with '\0'
+ *
+ * @param lpDest
+ *        capacity is worst case.  Intentional: Allocate once outside timing.  Why?  Measure conversion, not allocation.
+ *
+ * @return number of chars or wchars written to lpDest
+ */
+typedef size_t (*TranscodeFunc)(_In_  const void   *lpSrc,
+                                _In_  const size_t  ulSrcSize,
+                                _Out_ void         *lpDest);
+
+/**
+ * Previous implementation of WStrFileRead(): Two passes with cbMultiByte == -1.  Keep as baseline for comparison.
+ */
+static size_t
+StaticDecodeTwoPass(_In_  const void   *lpSrc,
+                    __attribute__((unused)) _In_ const size_t ulSrcSize,
+                    _Out_ void         *lpDest)
+{
+    const int iWCharSize = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, lpSrc, -1, NULL, 0);
+    assert(iWCharSize > 0);
+    const int iWCharSize2 = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, lpSrc, -1, lpDest, iWCharSize);
+    assert(iWCharSize == iWCharSize2);
+    // Intentional: Exclude trailing null char.
+    return (size_t) iWCharSize2 - LEN_NUL_CHAR;
+}
+
+static size_t
+StaticWStrUtf8Decode(_In_  const void   *lpSrc,
+                     _In_  const size_t  ulSrcSize,
+                     _Out_ void         *lpDest)
+{
+    size_t ulDestSize = 0;
+    size_t ulInvalidByteOffset = 0;
+    const bool bIsValid = WStrUtf8Decode(lpSrc, ulSrcSize, lpDest, &ulDestSize, &ulInvalidByteOffset);
+    assert(bIsValid);
+    (void) bIsValid;
+    return ulDestSize;
+}
+
+/**
+ * Previous implementation of WStrFileWrite(): Two passes with cchWideChar == -1.  Keep as baseline for comparison.
+ */
+static size_t
+StaticEncodeTwoPass(_In_  const void   *lpSrc,
+                    __attribute__((unused)) _In_ const size_t ulSrcSize,
+                    _Out_ void         *lpDest)
+{
+    const int iCharSize = WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, lpSrc, -1, NULL, 0, NULL, NULL);
+    assert(iCharSize > 0);
+    const int iCharSize2 = WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, lpSrc, -1, lpDest, iCharSize, NULL, NULL);
+    assert(iCharSize == iCharSize2);
+    // Intentional: Exclude trailing null char.
+    return (size_t) iCharSize2 - LEN_NUL_CHAR;
+}
+
+static size_t
+StaticWStrUtf8Encode(_In_  const void   *lpSrc,
+                     _In_  const size_t  ulSrcSize,
+                     _Out_ void         *lpDest)
+{
+    size_t ulDestByteSize = 0;
+    size_t ulInvalidOffset = 0;
+    const bool bIsValid = WStrUtf8Encode(lpSrc, ulSrcSize, lpDest, &ulDestByteSize, &ulInvalidOffset);
+    assert(bIsValid);
+    (void) bIsValid;
+    return ulDestByteSize;
+}
+
+static int
+StaticCompareDouble(_In_ const void *lpLeft,
+                    _In_ const void *lpRight)
+{
+    const double left  = *((const double *) lpLeft);
+    const double right = *((const double *) lpRight);
+    return (left > right) - (left < right);
+}
+
+/**
+ * @param ulUtf8ByteSize
+ *        throughput is always reported as MiB of UTF-8, for both decode and encode
+ */
+static void
+StaticBench(_In_  const char          *lpszName,
+            _In_  const TranscodeFunc  fpTranscodeFunc,
+            _In_  const void          *lpSrc,
+            _In_  const size_t         ulSrcSize,
+            _Out_ void                *lpDest,
+            _In_  const size_t         ulUtf8ByteSize)
+{
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+
+    double lpSecondsArr[SAMPLE_COUNT];
+    size_t ulDestSize = 0;
+
+    for (size_t i = 0; i < WARMUP_COUNT + SAMPLE_COUNT; ++i)
+    {
+        LARGE_INTEGER begin;
+        QueryPerformanceCounter(&begin);
+
+        ulDestSize = fpTranscodeFunc(lpSrc, ulSrcSize, lpDest);
+
+        LARGE_INTEGER end;
+        QueryPerformanceCounter(&end);
+
+        if (i >= WARMUP_COUNT) {
+            lpSecondsArr[i - WARMUP_COUNT] = ((double) (end.QuadPart - begin.QuadPart)) / ((double) freq.QuadPart);
+        }
+    }
+
+    qsort(lpSecondsArr, SAMPLE_COUNT, sizeof(lpSecondsArr[0]), StaticCompareDouble);
+
+    const double dMiB = ((double) ulUtf8ByteSize) / (1024.0 * 1024.0);
+    const double dMedianSeconds = lpSecondsArr[SAMPLE_COUNT / 2];
+    printf("%-28s: simd %d: %8.2f MiB, %10zu out: min %8.3f ms, median %8.3f ms, %8.1f MiB/s\n",
+           lpszName, WStrSimdGetLevel(), dMiB, ulDestSize, 1000.0 * lpSecondsArr[0], 1000.0 * dMedianSeconds, dMiB / dMedianSeconds);
+}
+
+static void
+StaticBenchEachSimdLevel(_In_  const char          *lpszName,
+                         _In_  const TranscodeFunc  fpTranscodeFunc,
+                         _In_  const void          *lpSrc,
+                         _In_  const size_t         ulSrcSize,
+                         _Out_ void                *lpDest,
+                         _In_  const size_t         ulUtf8ByteSize)
+{
+    const enum EWStrSimdLevel eMaxLevel = WStrSimdGetMaxLevel();
+    for (int eLevel = WSTR_SIMD_LEVEL_SCALAR; eLevel <= (int) eMaxLevel; ++eLevel)
+    {
+        WStrSimdSetLevel((enum EWStrSimdLevel) eLevel);
+        StaticBench(lpszName, fpTranscodeFunc, lpSrc, ulSrcSize, lpDest, ulUtf8ByteSize);
+    }
+}
+
+/**
+ * Repeat lpLine until at least ulMinSize wchars.
+ */
+static void
+StaticCreateText(_In_    const size_t   ulMinSize,
+                 _In_    const wchar_t *lpLine,
+                 _Inout_ struct WStr   *lpWStrText)
+{
+    const size_t ulLineSize = wcslen(lpLine);
+    const size_t ulLineCount = (ulMinSize + ulLineSize - 1U) / ulLineSize;
+    const size_t ulSize = ulLineCount * ulLineSize;
+
+    wchar_t *lpWCharArr = xcalloc(ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
+    for (size_t i = 0; i < ulLineCount; ++i)
+    {
+        wmemcpy(lpWCharArr + (i * ulLineSize), lpLine, ulLineSize);
+    }
+
+    WStrFree(lpWStrText);
+    lpWStrText->lpWCharArr = lpWCharArr;
+    lpWStrText->ulSize     = ulSize;
+}
+
+static void
+StaticBenchText(_In_ const char    *lpszTextName,
+                _In_ const wchar_t *lpLine)
+{
+    // 8 MiB of wchar_t
+    const size_t ulMinSize = 4U * 1024U * 1024U;
+
+    struct WStr textWStr = {};
+    StaticCreateText(ulMinSize, lpLine, &textWStr);
+
+    // Worst case destination for both directions.  Plus one for trailing null char from two-pass baseline.
+    char *lpCharArr = xcalloc(WSTR_UTF8_MAX_BYTES_PER_WCHAR * textWStr.ulSize + LEN_NUL_CHAR, sizeof(char));
+    wchar_t *lpWCharArr = xcalloc(WSTR_UTF8_MAX_BYTES_PER_WCHAR * textWStr.ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
+
+    const size_t ulUtf8ByteSize = StaticWStrUtf8Encode(textWStr.lpWCharArr, textWStr.ulSize, lpCharArr);
+    // Above, xcalloc() sets trailing null char for two-pass baseline.
+
+    char lpszName[64];
+    snprintf(lpszName, sizeof(lpszName), "two-pass decode, %s", lpszTextName);
+    StaticBench(lpszName, StaticDecodeTwoPass, lpCharArr, ulUtf8ByteSize, lpWCharArr, ulUtf8ByteSize);
+    snprintf(lpszName, sizeof(lpszName), "WStrUtf8Decode, %s", lpszTextName);
+    StaticBenchEachSimdLevel(lpszName, StaticWStrUtf8Decode, lpCharArr, ulUtf8ByteSize, lpWCharArr, ulUtf8ByteSize);
+
+    snprintf(lpszName, sizeof(lpszName), "two-pass encode, %s", lpszTextName);
+    StaticBench(lpszName, StaticEncodeTwoPass, textWStr.lpWCharArr, textWStr.ulSize, lpCharArr, ulUtf8ByteSize);
+    snprintf(lpszName, sizeof(lpszName), "WStrUtf8Encode, %s", lpszTextName);
+    StaticBenchEachSimdLevel(lpszName, StaticWStrUtf8Encode, textWStr.lpWCharArr, textWStr.ulSize, lpCharArr, ulUtf8ByteSize);
+
+    xfree((void **) &lpWCharArr);
+    xfree((void **) &lpCharArr);
+    WStrFree(&textWStr);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Config file lines: All ASCII.  Best case for fast path.
+    StaticBenchText("ascii", L"shortcut_key | Ctrl+Shift+F1 | C:\\Program Files\\App\\app.exe\r\n");
+    // Mostly Japanese: Each kanji/kana is 3 bytes of UTF-8.  Fast path only helps for short ASCII runs.
+    StaticBenchText("cjk", L"ショートカットキー | 東京都新宿区西新宿二丁目 | 設定ファイル\r\n");
+    return 0;
+}
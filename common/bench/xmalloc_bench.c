@@ -0,0 +1,183 @@
+#include "bench.h"
+#include "xmalloc.h"
+#include "wstr.h"
+#include "wstr_hash_map.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <assert.h>   // required for assert()
+
+#define SMALL_BLOCK_COUNT     10000U
+#define SMALL_BLOCK_BYTE_SIZE 32U
+#define LARGE_BLOCK_COUNT     16U
+// Same as WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE
+#define LARGE_BLOCK_BYTE_SIZE (64U * 1024U)
+#define HASH_MAP_KEY_COUNT    10000U
+
+// Allocation-heavy workloads
+struct BenchContext
+{
+    void          *lpBlockArr[SMALL_BLOCK_COUNT];
+    // Ex: L"  key.123 | value.123  \r\n" repeated: Input for WStrSplit()
+    struct WStr    textWStr;
+    struct WStrArr tokenWStrArr;
+    // Ex: L"some.config.key.123": Input for WStrHashMap
+    struct WStr    keyWStrArr[HASH_MAP_KEY_COUNT];
+};
+
+static void
+StaticContextInit(_Inout_ struct BenchContext *lpContext)
+{
+    struct WStrBuilder sb = {0};
+    // 64 Ki wchars
+    for (size_t i = 0; sb.ulSize < 64U * 1024U; ++i)
+    {
+        WStrBuilderAppendF(&sb, L"  key.%zu | value.%zu  \r\n", i, i);
+    }
+    WStrBuilderMoveToWStr(&sb, &(lpContext->textWStr));
+
+    for (size_t i = 0; i < HASH_MAP_KEY_COUNT; ++i)
+    {
+        WStrSPrintF(lpContext->keyWStrArr + i, L"some.config.key.%zu", i);
+    }
+}
+
+static void
+StaticContextFree(_Inout_ struct BenchContext *lpContext)
+{
+    WStrFree(&(lpContext->textWStr));
+    WStrArrFree(&(lpContext->tokenWStrArr));
+    for (size_t i = 0; i < HASH_MAP_KEY_COUNT; ++i)
+    {
+        WStrFree(lpContext->keyWStrArr + i);
+    }
+}
+
+static void
+StaticSmallCalloc(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    for (size_t i = 0; i < SMALL_BLOCK_COUNT; ++i)
+    {
+        lpContext->lpBlockArr[i] = xcalloc(1, SMALL_BLOCK_BYTE_SIZE);
+    }
+    for (size_t i = 0; i < SMALL_BLOCK_COUNT; ++i)
+    {
+        xfree(lpContext->lpBlockArr + i);
+    }
+}
+
+static void
+StaticSmallMalloc(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    for (size_t i = 0; i < SMALL_BLOCK_COUNT; ++i)
+    {
+        lpContext->lpBlockArr[i] = xmalloc(SMALL_BLOCK_BYTE_SIZE);
+    }
+    for (size_t i = 0; i < SMALL_BLOCK_COUNT; ++i)
+    {
+        xfree(lpContext->lpBlockArr + i);
+    }
+}
+
+static void
+StaticLargeCalloc(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    for (size_t i = 0; i < LARGE_BLOCK_COUNT; ++i)
+    {
+        lpContext->lpBlockArr[i] = xcalloc(1, LARGE_BLOCK_BYTE_SIZE);
+    }
+    for (size_t i = 0; i < LARGE_BLOCK_COUNT; ++i)
+    {
+        xfree(lpContext->lpBlockArr + i);
+    }
+}
+
+static void
+StaticLargeMalloc(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    for (size_t i = 0; i < LARGE_BLOCK_COUNT; ++i)
+    {
+        lpContext->lpBlockArr[i] = xmalloc(LARGE_BLOCK_BYTE_SIZE);
+    }
+    for (size_t i = 0; i < LARGE_BLOCK_COUNT; ++i)
+    {
+        xfree(lpContext->lpBlockArr + i);
+    }
+}
+
+static void
+StaticSplit(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    const struct WStr delimWStr = WSTR_FROM_LITERAL(L"|");
+    const struct WStrSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                             .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+    WStrSplit(&(lpContext->textWStr), &delimWStr, &options, &(lpContext->tokenWStrArr));
+    WStrArrFree(&(lpContext->tokenWStrArr));
+}
+
+static void
+StaticHashMap(_Inout_ void *lpVoidContext)
+{
+    struct BenchContext *lpContext = lpVoidContext;
+    struct WStrHashMap map = {0};
+    for (size_t i = 0; i < HASH_MAP_KEY_COUNT; ++i)
+    {
+        const struct WStr *lpKeyWStr = lpContext->keyWStrArr + i;
+        WStrHashMapInsert(&map, lpKeyWStr->lpWCharArr, lpKeyWStr->ulSize, NULL);
+    }
+    WStrHashMapFree(&map);
+}
+
+/**
+ * @return number of regressions
+ */
+static size_t
+StaticBenchHeap(_In_ const enum EXMallocHeap  eHeap,
+                _In_ const wchar_t           *lpSuiteNameWCharArr)
+{
+    // Important: Suite and context are allocated from this heap.  Both must be freed before next XMallocInit().
+    XMallocInit(eHeap);
+
+    printf("%ls\n", lpSuiteNameWCharArr);
+    struct BenchSuite suite = {.lpNameWCharArr = lpSuiteNameWCharArr};
+    struct BenchContext *lpContext = xcalloc(1, sizeof(struct BenchContext));
+    StaticContextInit(lpContext);
+
+    BenchRun(&suite, L"xcalloc+xfree 32 B", SMALL_BLOCK_COUNT * SMALL_BLOCK_BYTE_SIZE, StaticSmallCalloc, lpContext);
+    BenchRun(&suite, L"xmalloc+xfree 32 B", SMALL_BLOCK_COUNT * SMALL_BLOCK_BYTE_SIZE, StaticSmallMalloc, lpContext);
+    BenchRun(&suite, L"xcalloc+xfree 64 KiB", LARGE_BLOCK_COUNT * LARGE_BLOCK_BYTE_SIZE, StaticLargeCalloc, lpContext);
+    BenchRun(&suite, L"xmalloc+xfree 64 KiB", LARGE_BLOCK_COUNT * LARGE_BLOCK_BYTE_SIZE, StaticLargeMalloc, lpContext);
+    BenchRun(&suite, L"WStrSplit", lpContext->textWStr.ulSize * sizeof(wchar_t), StaticSplit, lpContext);
+    BenchRun(&suite, L"WStrHashMapInsert", 0, StaticHashMap, lpContext);
+
+    StaticContextFree(lpContext);
+    xfree((void **) &lpContext);
+
+    const size_t ulRegressionCount = BenchSuiteFinish(&suite);
+    BenchSuiteFree(&suite);
+
+    // Intentional: Restore default.  Why?  Every block from this heap is freed.  If private, it is destroyed.
+    XMallocInit(XMALLOC_HEAP_PROCESS);
+    return ulRegressionCount;
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Intentional: One suite per heap.  Why?  Same names: Compare each line for process heap with private heap.
+    size_t ulRegressionCount = 0;
+    ulRegressionCount += StaticBenchHeap(XMALLOC_HEAP_PROCESS, L"xmalloc_bench_process");
+    ulRegressionCount += StaticBenchHeap(XMALLOC_HEAP_PRIVATE_NO_SERIALIZE, L"xmalloc_bench_private");
+
+    // Intentional: Non-zero exit.  Why?  build.bash stops (set -e) if any regression.
+    const int x = (0 == ulRegressionCount) ? 0 : 1;
+    return x;
+}
@@ -0,0 +1,195 @@
+#ifndef H_COMMON_DYN_ARR
+#define H_COMMON_DYN_ARR
+
+#include "win32.h"
+#include "xmalloc.h"
+#include <stddef.h>  // required for size_t
+#include <stdint.h>  // required for SIZE_MAX
+#include <string.h>  // required for memset()
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+
+// Type-safe dynamic array "template".  Capacity grows geometrically, so n calls to _Push() are amortised O(n).
+// Ex: In header:
+// DYN_ARR_DECLARE(ConfigEntryDynArr, struct ConfigEntry)
+// Ex: In one source file:
+// DYN_ARR_DEFINE(ConfigEntryDynArr, struct ConfigEntry, ConfigEntryMove)
+// Ex: Usage:
+// struct ConfigEntryDynArr dynArr = {0};
+// ConfigEntryDynArr_Push(&dynArr, &configEntry);
+// ... dynArr.lpElemArr[i] ...
+// ConfigEntryDynArr_Free(&dynArr);
+
+// Intentional: Same as WStrArrAppendWCharArr().  Why?  Small arrays do not re-allocate after each push.
+#define DYN_ARR_MIN_CAPACITY 8U
+
+/**
+ * Declare struct TypeName and its functions.  Each function name is TypeName + "_" + verb, e.g., ConfigEntryDynArr_Push().
+ *
+ * @param TypeName
+ *        Ex: ConfigEntryDynArr -> struct ConfigEntryDynArr
+ *
+ * @param ElemType
+ *        Ex: struct ConfigEntry
+ */
+#define DYN_ARR_DECLARE(/* identifier */ TypeName, /* type */ ElemType) \
+    struct TypeName \
+    { \
+        ElemType *lpElemArr; \
+        size_t    ulSize; \
+        size_t    ulCapacity; \
+    }; \
+    \
+    void \
+    TypeName##_AssertValid(_In_ const struct TypeName *lpDynArr); \
+    \
+    /* Free array only, not elements.  Afterwards, array is empty and may be used again. */ \
+    void \
+    TypeName##_Free(_Inout_ struct TypeName *lpDynArr); \
+    \
+    /* Ensures ulCapacity >= ulMinCapacity.  Size is unchanged.  All pointers to elements are invalid after this call. */ \
+    void \
+    TypeName##_Reserve(_Inout_ struct TypeName *lpDynArr, \
+                       _In_    const size_t     ulMinCapacity); \
+    \
+    /* Move *lpElem as new last element.  Afterwards, *lpElem is empty. */ \
+    void \
+    TypeName##_Push(_Inout_ struct TypeName *lpDynArr, \
+                    _Inout_ ElemType        *lpElem); \
+    \
+    /* Move last element to *lpElem, which must be empty.  Array must not be empty.  Capacity is unchanged. */ \
+    void \
+    TypeName##_Pop(_Inout_ struct TypeName *lpDynArr, \
+                   _Out_   ElemType        *lpElem); \
+    \
+    /* Reduce ulCapacity to ulSize, e.g., after all pushes.  If empty, array is freed. */ \
+    void \
+    TypeName##_ShrinkToFit(_Inout_ struct TypeName *lpDynArr);
+
+/**
+ * Define functions from DYN_ARR_DECLARE().  Use in exactly one source file.
+ *
+ * @param fpNullableElemMoveFunc
+ *        void (*)(ElemType *lpDestElem, ElemType *lpSrcElem): Move *lpSrcElem to empty *lpDestElem, then *lpSrcElem is empty.
+ *        If NULL, elements are moved by memcpy(): Grow with xrealloc().  Only allowed if an element never points into
+ *        itself.  Ex: struct WStr may point to its own inline buffer, so a move function is required.  See: WStrMove()
+ */
+#define DYN_ARR_DEFINE(/* identifier */ TypeName, /* type */ ElemType, /* @Nullable function */ fpNullableElemMoveFunc) \
+    void \
+    TypeName##_AssertValid(__attribute__((unused)) \
+                           _In_ const struct TypeName *lpDynArr) \
+    { \
+        assert(NULL != lpDynArr); \
+        /* Intentional: If ulCapacity is more that *half* of SIZE_MAX bytes, there is probably an unsigned wrap bug. */ \
+        assert(lpDynArr->ulCapacity <= SIZE_MAX / 2U / sizeof(ElemType)); \
+        assert(lpDynArr->ulSize <= lpDynArr->ulCapacity); \
+        assert((0 == lpDynArr->ulCapacity) == (NULL == lpDynArr->lpElemArr)); \
+    } \
+    \
+    static void \
+    Static##TypeName##Move(_Inout_ ElemType *lpDestElem, \
+                           _Inout_ ElemType *lpSrcElem) \
+    { \
+        void (*const fpNullableMoveFunc)(ElemType *, ElemType *) = (fpNullableElemMoveFunc); \
+        if (NULL == fpNullableMoveFunc) \
+        { \
+            *lpDestElem = *lpSrcElem; \
+            memset(lpSrcElem, 0, sizeof(ElemType)); \
+        } \
+        else { \
+            fpNullableMoveFunc(lpDestElem, lpSrcElem); \
+        } \
+    } \
+    \
+    static void \
+    Static##TypeName##SetCapacity(_Inout_ struct TypeName *lpDynArr, \
+                                  _In_    const size_t     ulNewCapacity) \
+    { \
+        assert(ulNewCapacity >= lpDynArr->ulSize); \
+        void (*const fpNullableMoveFunc)(ElemType *, ElemType *) = (fpNullableElemMoveFunc); \
+        \
+        if (0 == ulNewCapacity) { \
+            xfree((void **) &(lpDynArr->lpElemArr)); \
+        } \
+        else if (NULL == lpDynArr->lpElemArr) { \
+            lpDynArr->lpElemArr = xcalloc(ulNewCapacity, sizeof(ElemType)); \
+        } \
+        else if (NULL == fpNullableMoveFunc) { \
+            /* Intentional: Grow with xrealloc().  Why?  For large arrays, the heap can often grow the block in place. */ \
+            xrealloc((void **) &(lpDynArr->lpElemArr), ulNewCapacity * sizeof(ElemType)); \
+        } \
+        else { \
+            /* Intentional: Do not xrealloc().  Why?  Each element may point into itself. */ \
+            ElemType *lpNewElemArr = xcalloc(ulNewCapacity, sizeof(ElemType)); \
+            for (size_t i = 0; i < lpDynArr->ulSize; ++i) \
+            { \
+                fpNullableMoveFunc(lpNewElemArr + i, lpDynArr->lpElemArr + i); \
+            } \
+            xfree((void **) &(lpDynArr->lpElemArr)); \
+            lpDynArr->lpElemArr = lpNewElemArr; \
+        } \
+        lpDynArr->ulCapacity = ulNewCapacity; \
+    } \
+    \
+    void \
+    TypeName##_Free(_Inout_ struct TypeName *lpDynArr) \
+    { \
+        TypeName##_AssertValid(lpDynArr); \
+        \
+        xfree((void **) &(lpDynArr->lpElemArr)); \
+        lpDynArr->ulSize     = 0; \
+        lpDynArr->ulCapacity = 0; \
+    } \
+    \
+    void \
+    TypeName##_Reserve(_Inout_ struct TypeName *lpDynArr, \
+                       _In_    const size_t     ulMinCapacity) \
+    { \
+        TypeName##_AssertValid(lpDynArr); \
+        \
+        if (ulMinCapacity > lpDynArr->ulCapacity) { \
+            Static##TypeName##SetCapacity(lpDynArr, ulMinCapacity); \
+        } \
+    } \
+    \
+    void \
+    TypeName##_Push(_Inout_ struct TypeName *lpDynArr, \
+                    _Inout_ ElemType        *lpElem) \
+    { \
+        TypeName##_AssertValid(lpDynArr); \
+        assert(NULL != lpElem); \
+        \
+        if (lpDynArr->ulSize == lpDynArr->ulCapacity) \
+        { \
+            const size_t ulNewCapacity = \
+                (lpDynArr->ulCapacity < DYN_ARR_MIN_CAPACITY) ? DYN_ARR_MIN_CAPACITY : (2U * lpDynArr->ulCapacity); \
+            Static##TypeName##SetCapacity(lpDynArr, ulNewCapacity); \
+        } \
+        \
+        Static##TypeName##Move(lpDynArr->lpElemArr + lpDynArr->ulSize, lpElem); \
+        ++(lpDynArr->ulSize); \
+    } \
+    \
+    void \
+    TypeName##_Pop(_Inout_ struct TypeName *lpDynArr, \
+                   _Out_   ElemType        *lpElem) \
+    { \
+        TypeName##_AssertValid(lpDynArr); \
+        assert(lpDynArr->ulSize > 0); \
+        assert(NULL != lpElem); \
+        \
+        --(lpDynArr->ulSize); \
+        Static##TypeName##Move(lpElem, lpDynArr->lpElemArr + lpDynArr->ulSize); \
+    } \
+    \
+    void \
+    TypeName##_ShrinkToFit(_Inout_ struct TypeName *lpDynArr) \
+    { \
+        TypeName##_AssertValid(lpDynArr); \
+        \
+        if (lpDynArr->ulSize < lpDynArr->ulCapacity) { \
+            Static##TypeName##SetCapacity(lpDynArr, lpDynArr->ulSize); \
+        } \
+    }
+
+#endif  // H_COMMON_DYN_ARR
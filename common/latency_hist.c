@@ -0,0 +1,152 @@
+#include "latency_hist.h"
+#include "log.h"
+#include <string.h>  // required for memset()
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+
+_Static_assert(LATENCY_HIST_MAX_VALUE_BITS < 64U, "LATENCY_HIST_MAX_VALUE_BITS must be less than 64");
+
+#define LATENCY_HIST_MAX_VALUE ((1ULL << LATENCY_HIST_MAX_VALUE_BITS) - 1ULL)
+
+int64_t
+LatencyHistNow()
+{
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancecounter
+    LARGE_INTEGER counter = {0};
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+
+size_t
+LatencyHistBucketIndex(_In_ const uint64_t ullValue)
+{
+    const uint64_t v = (ullValue > LATENCY_HIST_MAX_VALUE) ? LATENCY_HIST_MAX_VALUE : ullValue;
+    if (v < LATENCY_HIST_SUB_BUCKET_COUNT)
+    {
+        return (size_t) v;
+    }
+    // Index of highest set bit: [LATENCY_HIST_SUB_BUCKET_BITS, LATENCY_HIST_MAX_VALUE_BITS)
+    const unsigned uHighBit = 63U - (unsigned) __builtin_clzll(v);
+    const unsigned uShift   = uHighBit - LATENCY_HIST_SUB_BUCKET_BITS;
+    // Next LATENCY_HIST_SUB_BUCKET_BITS bits below highest set bit
+    const size_t ulSubIndex = (size_t) ((v >> uShift) - LATENCY_HIST_SUB_BUCKET_COUNT);
+    const size_t ulIndex    = LATENCY_HIST_SUB_BUCKET_COUNT + (uShift * LATENCY_HIST_SUB_BUCKET_COUNT) + ulSubIndex;
+    return ulIndex;
+}
+
+uint64_t
+LatencyHistBucketLowestValue(_In_ const size_t ulIndex)
+{
+    assert(ulIndex < LATENCY_HIST_BUCKET_COUNT);
+
+    if (ulIndex < LATENCY_HIST_SUB_BUCKET_COUNT)
+    {
+        return ulIndex;
+    }
+    const size_t ulShift    = (ulIndex - LATENCY_HIST_SUB_BUCKET_COUNT) / LATENCY_HIST_SUB_BUCKET_COUNT;
+    const size_t ulSubIndex = ulIndex % LATENCY_HIST_SUB_BUCKET_COUNT;
+    const uint64_t ullLowestValue = ((uint64_t) (LATENCY_HIST_SUB_BUCKET_COUNT + ulSubIndex)) << ulShift;
+    return ullLowestValue;
+}
+
+uint64_t
+LatencyHistBucketHighestValue(_In_ const size_t ulIndex)
+{
+    assert(ulIndex < LATENCY_HIST_BUCKET_COUNT);
+
+    if (ulIndex < LATENCY_HIST_SUB_BUCKET_COUNT)
+    {
+        return ulIndex;
+    }
+    const size_t ulShift = (ulIndex - LATENCY_HIST_SUB_BUCKET_COUNT) / LATENCY_HIST_SUB_BUCKET_COUNT;
+    const uint64_t ullHighestValue = LatencyHistBucketLowestValue(ulIndex) + (1ULL << ulShift) - 1ULL;
+    return ullHighestValue;
+}
+
+void
+LatencyHistRecord(_Inout_ struct LatencyHist *lpHist,
+                  _In_    const int64_t       llValue)
+{
+    assert(NULL != lpHist);
+
+    // Intentional: Negative is impossible for QueryPerformanceCounter(), but be defensive.
+    const uint64_t ullValue = (llValue < 0) ? 0U : (uint64_t) llValue;
+    const size_t ulIndex = LatencyHistBucketIndex(ullValue);
+    ++(lpHist->ullCountArr[ulIndex]);
+    ++(lpHist->ullTotalCount);
+    if (ullValue > lpHist->ullMaxValue)
+    {
+        lpHist->ullMaxValue = ullValue;
+    }
+}
+
+void
+LatencyHistReset(_Inout_ struct LatencyHist *lpHist)
+{
+    assert(NULL != lpHist);
+
+    memset(lpHist->ullCountArr, 0, sizeof(lpHist->ullCountArr));
+    lpHist->ullTotalCount = 0U;
+    lpHist->ullMaxValue   = 0U;
+}
+
+uint64_t
+LatencyHistValueAtPercentile(_In_ const struct LatencyHist *lpHist,
+                             _In_ const double              dPercentile)
+{
+    assert(NULL != lpHist);
+    assert(dPercentile >= 0.0 && dPercentile <= 100.0);
+
+    if (0U == lpHist->ullTotalCount)
+    {
+        return 0U;
+    }
+    // Intentional: Round, not ceil().  Why?  Same as HdrHistogram: (99.9 / 100.0) * 1000 is slightly more than 999.
+    uint64_t ullTargetCount = (uint64_t) (((dPercentile / 100.0) * (double) lpHist->ullTotalCount) + 0.5);
+    if (0U == ullTargetCount)
+    {
+        ullTargetCount = 1U;
+    }
+    uint64_t ullCumulativeCount = 0U;
+    for (size_t i = 0; i < LATENCY_HIST_BUCKET_COUNT; ++i)
+    {
+        ullCumulativeCount += lpHist->ullCountArr[i];
+        if (ullCumulativeCount >= ullTargetCount)
+        {
+            const uint64_t ullHighestValue = LatencyHistBucketHighestValue(i);
+            return (ullHighestValue < lpHist->ullMaxValue) ? ullHighestValue : lpHist->ullMaxValue;
+        }
+    }
+    // Only if counts were modified directly
+    return lpHist->ullMaxValue;
+}
+
+static double
+StaticTicksToMicros(_In_ const uint64_t ullTicks,
+                    _In_ const int64_t  llCounterFrequency)
+{
+    const double dMicros = ((double) ullTicks * 1000000.0) / (double) llCounterFrequency;
+    return dMicros;
+}
+
+void
+LatencyHistLogW(_In_ FILE                     *fp,
+                _In_ const struct LatencyHist *lpHist)
+{
+    assert(NULL != fp);
+    assert(NULL != lpHist);
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancefrequency
+    // "The frequency of the performance counter is fixed at system boot and is consistent across all processors."
+    LARGE_INTEGER frequency = {0};
+    QueryPerformanceFrequency(&frequency);
+    const int64_t f = frequency.QuadPart;
+
+    LogWF(fp, L"INFO: Latency: %ls: count:%llu, p50:%.1fus, p99:%.1fus, p99.9:%.1fus, max:%.1fus\r\n",
+          lpHist->lpszName,
+          (unsigned long long) lpHist->ullTotalCount,
+          StaticTicksToMicros(LatencyHistValueAtPercentile(lpHist, 50.0), f),
+          StaticTicksToMicros(LatencyHistValueAtPercentile(lpHist, 99.0), f),
+          StaticTicksToMicros(LatencyHistValueAtPercentile(lpHist, 99.9), f),
+          StaticTicksToMicros(lpHist->ullMaxValue, f));
+}
@@ -0,0 +1,109 @@
+#ifndef H_COMMON_LATENCY_HIST
+#define H_COMMON_LATENCY_HIST
+
+#include "win32.h"
+#include <sal.h>      // required for _In_
+#include <stddef.h>   // required for size_t
+#include <stdint.h>   // required for uint64_t
+#include <stdio.h>    // required for FILE
+
+// Latency histogram, log-linear like HdrHistogram: Each power of two is split into LATENCY_HIST_SUB_BUCKET_COUNT
+// linear buckets.  Relative error of any percentile is at most 1 / LATENCY_HIST_SUB_BUCKET_COUNT (~3%).
+// Fixed size, no heap alloc: LatencyHistRecord() is a few integer ops.  Safe for a low-level keyboard hook.
+// Ref: https://github.com/HdrHistogram/HdrHistogram_c
+// <p>
+// Values are QueryPerformanceCounter() ticks, not time.  Why?  No division per record: Convert only in LatencyHistLogW().
+// Not thread-safe: One thread per histogram.
+// Ex:
+// static struct LatencyHist hist = LATENCY_HIST_INIT(L"LowLevelKeyboardProc");
+// const int64_t llStart = LatencyHistNow();
+// ... work ...
+// LatencyHistRecord(&hist, LatencyHistNow() - llStart);
+// LatencyHistLogW(stdout, &hist);
+
+#define LATENCY_HIST_SUB_BUCKET_BITS  5U
+#define LATENCY_HIST_SUB_BUCKET_COUNT (1U << LATENCY_HIST_SUB_BUCKET_BITS)
+// Larger values are recorded as (2^LATENCY_HIST_MAX_VALUE_BITS - 1).  At 10 MHz, 2^40 ticks is about 30 hours.
+#define LATENCY_HIST_MAX_VALUE_BITS   40U
+// Values [0, SUB_BUCKET_COUNT) have one bucket each.  Then each power of two up to MAX_VALUE_BITS has SUB_BUCKET_COUNT buckets.
+#define LATENCY_HIST_BUCKET_COUNT     (LATENCY_HIST_SUB_BUCKET_COUNT * (LATENCY_HIST_MAX_VALUE_BITS - LATENCY_HIST_SUB_BUCKET_BITS + 1U))
+
+struct LatencyHist
+{
+    // Ex: L"LowLevelKeyboardProc: Matched"
+    const wchar_t *lpszName;
+    // Index is from LatencyHistBucketIndex()
+    uint64_t       ullCountArr[LATENCY_HIST_BUCKET_COUNT];
+    uint64_t       ullTotalCount;
+    // Exact, not bucket value
+    uint64_t       ullMaxValue;
+};
+
+// Ctrl+Alt+Shift+F12: Log latency histograms.  Shared by passport and send_input.  See: RegisterHotKey()
+// Intentional: Same id in each app.  Why?  Ids are per thread, and each app registers only one hot key.
+#define HOT_KEY_ID_LOG_LATENCY 1
+
+// Initialiser, not compound literal.  Why?  Also valid for static storage.
+#define LATENCY_HIST_INIT(/* const wchar_t * */ lpszNameArg) \
+    {.lpszName = (lpszNameArg)}
+
+/**
+ * @return current value of QueryPerformanceCounter()
+ */
+int64_t
+LatencyHistNow();
+
+/**
+ * @return index for ullCountArr
+ *         values >= 2^LATENCY_HIST_MAX_VALUE_BITS use last index
+ */
+size_t
+LatencyHistBucketIndex(_In_ const uint64_t ullValue);
+
+/**
+ * @return lowest value recorded in this bucket
+ */
+uint64_t
+LatencyHistBucketLowestValue(_In_ const size_t ulIndex);
+
+/**
+ * @return highest value recorded in this bucket
+ */
+uint64_t
+LatencyHistBucketHighestValue(_In_ const size_t ulIndex);
+
+/**
+ * @param llValue
+ *        usually difference of two LatencyHistNow(); if negative, zero is recorded
+ */
+void
+LatencyHistRecord(_Inout_ struct LatencyHist *lpHist,
+                  _In_    const int64_t       llValue);
+
+/**
+ * Set all counts to zero.  Name is unchanged.
+ */
+void
+LatencyHistReset(_Inout_ struct LatencyHist *lpHist);
+
+/**
+ * Same as HdrHistogram: Highest value of bucket with the requested percentile, but never more than max value.
+ *
+ * @param dPercentile
+ *        [0.0, 100.0]; ex: 99.9
+ *
+ * @return zero if empty
+ */
+uint64_t
+LatencyHistValueAtPercentile(_In_ const struct LatencyHist *lpHist,
+                             _In_ const double              dPercentile);
+
+/**
+ * Log one line with LogWF(): count, p50, p99, p99.9, and max in microseconds.
+ * Ex: "INFO: Latency: LowLevelKeyboardProc: Matched: count:1742, p50:3.1us, p99:41.7us, p99.9:48.3us, max:52.6us"
+ */
+void
+LatencyHistLogW(_In_ FILE                     *fp,
+                _In_ const struct LatencyHist *lpHist);
+
+#endif  // H_COMMON_LATENCY_HIST
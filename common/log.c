@@ -1,13 +1,181 @@
 #include "log.h"
+#include "log_async.h"
+#include "log_file.h"
 #include "win32.h"
+#include "wstr.h"
 #include <assert.h>  // required for assert
 #include <stdlib.h>  // required for assert on MinGW and abs()
+#include <string.h>  // required for _wcsicmp()
 
-static void
-LogPrefix(FILE *fp)
+// Intentional: Format complete line in stack buffer, then write once.  Why?  One stream write per line, and no heap
+// allocation for most lines.
+#define LOG_BUFFER_WCHAR_ARR_LEN 512
+
+_Atomic(enum ELogLevel) g_eLogLevel = LOG_LEVEL_DEFAULT;
+
+static struct Global
+{
+    // @Nullable
+    struct LogFile *lpLogFile;
+    // Intentional: Guard against recursion.  Why?  On I/O error, LogFile functions call Win32LastError*Abort(), which
+    // calls LogWF(stderr, ...): Only write to stderr, not file.
+    bool            bIsFileWriteInProgress;
+}
+global = {0};
+
+// Index is enum ELogLevel
+static const wchar_t *LOG_LEVEL_NAME_ARR[] = {L"TRACE", L"DEBUG", L"INFO", L"WARN", L"ERROR", L"OFF"};
+_Static_assert(LOG_LEVEL_OFF + 1 == sizeof(LOG_LEVEL_NAME_ARR) / sizeof(LOG_LEVEL_NAME_ARR[0]), "LOG_LEVEL_NAME_ARR");
+
+void
+LogSetLevel(_In_ const enum ELogLevel eLevel)
+{
+    assert(eLevel >= LOG_LEVEL_TRACE && eLevel <= LOG_LEVEL_OFF);
+    // Intentional: Relaxed, not sequentially consistent.  Why?  Readers never need a fence: Other threads may log a few
+    // more or fewer lines until they see the new level.
+    atomic_store_explicit(&g_eLogLevel, eLevel, memory_order_relaxed);
+}
+
+enum ELogLevel
+LogGetLevel()
+{
+    const enum ELogLevel x = atomic_load_explicit(&g_eLogLevel, memory_order_relaxed);
+    return x;
+}
+
+const wchar_t *
+LogLevelToName(_In_ const enum ELogLevel eLevel)
+{
+    assert(eLevel >= LOG_LEVEL_TRACE && eLevel <= LOG_LEVEL_OFF);
+    const wchar_t *x = LOG_LEVEL_NAME_ARR[eLevel];
+    return x;
+}
+
+bool
+LogLevelParse(_In_  const wchar_t  *lpszName,
+              _Out_ enum ELogLevel *lpeLevel)
+{
+    assert(NULL != lpszName);
+    assert(NULL != lpeLevel);
+
+    for (int i = LOG_LEVEL_TRACE; i <= LOG_LEVEL_OFF; ++i)
+    {
+        // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/stricmp-wcsicmp-mbsicmp-stricmp-l-wcsicmp-l-mbsicmp-l?view=msvc-170
+        if (0 == _wcsicmp(LOG_LEVEL_NAME_ARR[i], lpszName))
+        {
+            *lpeLevel = (enum ELogLevel) i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @param lpszSource
+ *        for error message; ex: L"environment variable WIN32_LOG_LEVEL"
+ */
+static bool
+StaticLogLevelParseThenSet(_In_    const wchar_t *lpszName,
+                           _In_    const wchar_t *lpszSource,
+                           _Inout_ FILE          *lpErrorStream)
+{
+    enum ELogLevel eLevel = LOG_LEVEL_DEFAULT;
+    if (!LogLevelParse(lpszName, &eLevel))
+    {
+        fwprintf(lpErrorStream, L"ERROR: Invalid log level from %ls: [%ls]: Expected one of: trace, debug, info, warn, error, off\r\n",
+                 lpszSource, lpszName);
+        return false;
+    }
+    LogSetLevel(eLevel);
+    return true;
+}
+
+// See: Win32ArgvValueFunc
+static bool
+StaticLogLevelArgThenSet(_In_    const wchar_t *lpszValue,
+                         _Inout_ void          *lpContext)
+{
+    FILE *lpErrorStream = lpContext;
+    const bool x = StaticLogLevelParseThenSet(lpszValue, L"command-line arg " LOG_LEVEL_ARG_PREFIX, lpErrorStream);
+    return x;
+}
+
+bool
+LogLevelInit(_Inout_ int      *lpArgc,
+             _Inout_ wchar_t **lppArgvWCharArr,
+             _Inout_ FILE     *lpErrorStream)
+{
+    assert(NULL != lpArgc);
+    assert(NULL != lppArgvWCharArr);
+    assert(NULL != lpErrorStream);
+
+    // Intentional: Longest valid name is short.  Why?  Longer values are invalid anyway.
+    wchar_t lpValueWCharArr[16];
+    const DWORD dwValueArrLen = sizeof(lpValueWCharArr) / sizeof(lpValueWCharArr[0]);
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/processenv/nf-processenv-getenvironmentvariablew
+    const DWORD dwLen = GetEnvironmentVariableW(LOG_LEVEL_ENV_VAR_NAME,  // [in, optional]  LPCWSTR lpName
+                                                lpValueWCharArr,         // [out, optional] LPWSTR  lpBuffer
+                                                dwValueArrLen);          // [in]            DWORD   nSize
+    // Intentional: If zero, variable does not exist.  If too long, return value is required length.
+    if (dwLen >= dwValueArrLen)
+    {
+        fwprintf(lpErrorStream, L"ERROR: Invalid log level from environment variable %ls: Too long: %lu chars\r\n",
+                 LOG_LEVEL_ENV_VAR_NAME, dwLen);
+        return false;
+    }
+    if (dwLen > 0 && !StaticLogLevelParseThenSet(lpValueWCharArr, L"environment variable " LOG_LEVEL_ENV_VAR_NAME, lpErrorStream))
+    {
+        return false;
+    }
+
+    // Intentional: Each arg is parsed: Any invalid arg is an error.  Else, last arg wins.
+    const bool x = Win32ArgvRemovePrefix(lpArgc, lppArgvWCharArr, LOG_LEVEL_ARG_PREFIX, StaticLogLevelArgThenSet, lpErrorStream);
+    return x;
+}
+
+void
+LogSetFile(_In_opt_ struct LogFile *lpNullableLogFile)
+{
+    assert(!LogAsyncIsStarted());
+    if (NULL != lpNullableLogFile) {
+        LogFileAssertValid(lpNullableLogFile);
+    }
+    global.lpLogFile = lpNullableLogFile;
+}
+
+struct LogFile *
+LogGetFile()
+{
+    struct LogFile *x = global.lpLogFile;
+    return x;
+}
+
+void
+LogWriteLine(_In_ FILE          *fp,
+             _In_ const wchar_t *lpszLine,
+             _In_ const size_t   ulLen)
 {
     assert(NULL != fp);
+    assert(NULL != lpszLine);
+
+    if (NULL != global.lpLogFile && !global.bIsFileWriteInProgress)
+    {
+        global.bIsFileWriteInProgress = true;
+        LogFileWriteLine(global.lpLogFile, lpszLine, ulLen);
+        global.bIsFileWriteInProgress = false;
+
+        if (stdout == fp) {
+            return;
+        }
+    }
+    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fputs-fputws?view=msvc-170
+    fputws(lpszLine, fp);
+}
 
+void
+LogAppendPrefix(_In_    const SYSTEMTIME   *lpLocalTime,
+                _Inout_ struct WStrBuilder *lpWStrBuilder)
+{
     static BOOL bIsInitDone = FALSE;
 
     static TIME_ZONE_INFORMATION tz = {};
@@ -19,24 +187,45 @@ LogPrefix(FILE *fp)
         bIsInitDone = TRUE;
     }
 
-    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-getlocaltime
-    SYSTEMTIME dt = {};
-    GetLocalTime(&dt);
+    LogAppendPrefixWithBias(lpLocalTime, tz.Bias, lpWStrBuilder);
+}
+
+void
+LogAppendPrefixWithBias(_In_    const SYSTEMTIME   *lpLocalTime,
+                        _In_    const LONG          lBias,
+                        _Inout_ struct WStrBuilder *lpWStrBuilder)
+{
+    assert(NULL != lpLocalTime);
+    assert(NULL != lpWStrBuilder);
 
     // Japan Standard Time is UTC+09:00
     // ... that is 9 * 60 = 720 minutes
     // UTC = local time + bias
     // ... thus, JST bias will be *negative*.
 
-    const char plusMinus = (tz.Bias <= 0) ? '+' : '-';
-    const int  hours     = abs(tz.Bias) / 60;
-    const int  minutes   = abs(tz.Bias) % 60;
+    const wchar_t plusMinus = (lBias <= 0) ? L'+' : L'-';
+    const int     hours     = abs(lBias) / 60;
+    const int     minutes   = abs(lBias) % 60;
 
     // Ex: "2022-03-10 22:17:47.123 +09:00 "
-    fprintf(fp,
-            "%04hu-%02hu-%02hu %02hu:%02hu:%02hu.%03hu %c%02d:%02d ",
-            dt.wYear, dt.wMonth, dt.wDay, dt.wHour, dt.wMinute, dt.wSecond, dt.wMilliseconds,
-            plusMinus, hours, minutes);
+    __attribute__((unused))
+    const bool b = WStrBuilderTryAppendF(lpWStrBuilder,
+                                         L"%04hu-%02hu-%02hu %02hu:%02hu:%02hu.%03hu %lc%02d:%02d ",
+                                         lpLocalTime->wYear, lpLocalTime->wMonth, lpLocalTime->wDay,
+                                         lpLocalTime->wHour, lpLocalTime->wMinute, lpLocalTime->wSecond, lpLocalTime->wMilliseconds,
+                                         plusMinus, hours, minutes);
+    // Intentional: Only integers and a wchar: Cannot fail.
+    assert(b);
+}
+
+static void
+StaticLogPrefix(_Inout_ struct WStrBuilder *lpWStrBuilder)
+{
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-getlocaltime
+    SYSTEMTIME dt = {};
+    GetLocalTime(&dt);
+
+    LogAppendPrefix(&dt, lpWStrBuilder);
 }
 
 void
@@ -47,9 +236,21 @@ LogW(_In_ FILE          *fp,
     assert(NULL != fp);
     assert(NULL != lpszMsg);
 
-    LogPrefix(fp);
-    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fputs-fputws?view=msvc-170
-    fputws(lpszMsg, fp);
+    if (LogAsyncIsStarted())
+    {
+        LogAsyncPushW(fp, lpszMsg);
+        return;
+    }
+
+    wchar_t lpBufferWCharArr[LOG_BUFFER_WCHAR_ARR_LEN];
+    struct WStrBuilder sb = {0};
+    WStrBuilderInitBuffer(&sb, lpBufferWCharArr, LOG_BUFFER_WCHAR_ARR_LEN);
+
+    StaticLogPrefix(&sb);
+    WStrBuilderAppendWCharArr(&sb, lpszMsg, wcslen(lpszMsg));
+
+    LogWriteLine(fp, sb.lpWCharArr, sb.ulSize);
+    WStrBuilderFree(&sb);
 }
 
 void
@@ -58,16 +259,10 @@ LogWF(_In_ FILE          *fp,
       _In_ const wchar_t *lpszMsgFmt,
       _In_ ...)
 {
-    assert(NULL != fp);
-    assert(NULL != lpszMsgFmt);
-
-    LogPrefix(fp);
-
     // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
     va_list ap;
     va_start(ap, lpszMsgFmt);
-    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/vfprintf-vfprintf-l-vfwprintf-vfwprintf-l?view=msvc-170
-    vfwprintf(fp, lpszMsgFmt, ap);
+    LogWFV(fp, lpszMsgFmt, ap);
     va_end(ap);
 }
 
@@ -80,13 +275,34 @@ LogWFV(_In_ FILE          *fp,
     assert(NULL != fp);
     assert(NULL != lpszMsgFmt);
 
-    LogPrefix(fp);
+    if (LogAsyncIsStarted())
+    {
+        LogAsyncPushWFV(fp, lpszMsgFmt, ap);
+        return;
+    }
 
-    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
-    va_list ap_copy;
-    va_copy(ap_copy, ap);
-    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/vfprintf-vfprintf-l-vfwprintf-vfwprintf-l?view=msvc-170
-    vfwprintf(fp, lpszMsgFmt, ap_copy);
-    va_end(ap_copy);
-}
+    wchar_t lpBufferWCharArr[LOG_BUFFER_WCHAR_ARR_LEN];
+    struct WStrBuilder sb = {0};
+    WStrBuilderInitBuffer(&sb, lpBufferWCharArr, LOG_BUFFER_WCHAR_ARR_LEN);
+
+    StaticLogPrefix(&sb);
 
+    // Intentional: Do not call WStrBuilderAppendFV2().  Why?  On error, it will call LogWF(): infinite recursion.
+    if (WStrBuilderTryAppendFV(&sb, lpszMsgFmt, ap))
+    {
+        LogWriteLine(fp, sb.lpWCharArr, sb.ulSize);
+    }
+    else
+    {
+        // Intentional: Same as before: Write prefix, then let vfwprintf() fail and set errno for the caller.
+        fputws(sb.lpWCharArr, fp);
+
+        // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
+        va_list ap_copy;
+        va_copy(ap_copy, ap);
+        // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/vfprintf-vfprintf-l-vfwprintf-vfwprintf-l?view=msvc-170
+        vfwprintf(fp, lpszMsgFmt, ap_copy);
+        va_end(ap_copy);
+    }
+    WStrBuilderFree(&sb);
+}
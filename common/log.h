@@ -1,33 +1,221 @@
 #ifndef H_COMMON_LOG
 #define H_COMMON_LOG
 
-#include <sal.h>    // required for _In_
-#include <wchar.h>  // required for wchar_t
-#include <stdio.h>  // required for FILE
+#include "win32.h"  // required for SYSTEMTIME
+#include <sal.h>     // required for _In_
+#include <wchar.h>   // required for wchar_t
+#include <stdio.h>   // required for FILE
+#include <stdarg.h>  // required for va_list
+#include <stdbool.h>  // required for bool
+#include <stdatomic.h>  // required for atomic_load_explicit()
 
-#ifdef NDEBUG
-    #define DEBUG_LOGW(/* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsg) \
-        ((void) 0)
+struct WStrBuilder;
+struct LogFile;
+
+// Max length of timestamp prefix from LogAppendPrefix(), excluding final '\0' char.
+// Ex: "2022-03-10 22:17:47.123 +09:00 " is 31 chars.
+#define LOG_PREFIX_MAX_LEN 31U
 
-    #define DEBUG_LOGWF(/* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsgFmt, ...) \
-        ((void) 0)
+// Log levels: Each leveled macro below is one predictable branch on g_eLogLevel.  If disabled, args are not evaluated.
+// Level is set at startup by LogLevelInit(): environment variable LOG_LEVEL_ENV_VAR_NAME, then command-line arg
+// LOG_LEVEL_ARG_PREFIX.  Any thread may change it later with LogSetLevel().
+// Ex: passport.exe --log-level=trace C:\path\to\config.txt
+// Ex: set WIN32_LOG_LEVEL=debug
+enum ELogLevel
+{
+    // Very verbose: Each keyboard hook call or window message
+    LOG_LEVEL_TRACE = 0,
+    LOG_LEVEL_DEBUG = 1,
+    LOG_LEVEL_INFO  = 2,
+    LOG_LEVEL_WARN  = 3,
+    LOG_LEVEL_ERROR = 4,
+    // Disable all leveled macros.  Intentional: LogW(), LogWF(), and LogWFV() are never disabled.
+    LOG_LEVEL_OFF   = 5,
+};
 
-    #define DEBUG_LOGWFV(/* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsgFmt, /* va_list */ ap) \
-        ((void) 0)
+// Intentional: Same as before leveled macros: DEBUG_LOGW*() are only enabled for debug builds.
+#ifdef NDEBUG
+    #define LOG_LEVEL_DEFAULT LOG_LEVEL_INFO
 #else
-    #define DEBUG_LOGW(/* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsg) \
-        LogW(fp, lpszMsg)
+    #define LOG_LEVEL_DEFAULT LOG_LEVEL_DEBUG
+#endif  // NDEBUG
 
-    #define DEBUG_LOGWF(/* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsgFmt, ...) \
-        LogWF(fp, lpszMsgFmt, __VA_ARGS__)
+#define LOG_LEVEL_ENV_VAR_NAME L"WIN32_LOG_LEVEL"
+// Ex: L"--log-level=trace"
+#define LOG_LEVEL_ARG_PREFIX   L"--log-level="
 
-    #define DEBUG_LOGWFV(/* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsgFmt, /* va_list */ ap) \
-        LogWFV(fp, lpszMsgFmt, ap)
-#endif  // NDEBUG
+// Minimum enabled level.  Do not write directly: Use LogSetLevel().
+// Intentional: _Atomic with relaxed loads.  Why?  Any thread may call LogSetLevel().  On x86 and x64, a relaxed load is
+// a plain load: No fence on the hot path.
+extern _Atomic(enum ELogLevel) g_eLogLevel;
+
+// Ex: if (LOG_IS_ENABLED(LOG_LEVEL_TRACE)) { ... expensive ... }
+// Intentional: Hint "unlikely" only for TRACE and DEBUG.  Why?  INFO and above are usually enabled.
+// For a constant level, as in all macros below, the '?:' is folded at compile time.
+#define LOG_IS_ENABLED(/* enum ELogLevel */ eLevel) \
+    (((eLevel) <= LOG_LEVEL_DEBUG) \
+        ? __builtin_expect((eLevel) >= atomic_load_explicit(&g_eLogLevel, memory_order_relaxed), 0) \
+        : ((eLevel) >= atomic_load_explicit(&g_eLogLevel, memory_order_relaxed)))
+
+#define LEVEL_LOGW(/* enum ELogLevel */ eLevel, /* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsg) \
+    do { \
+        if (LOG_IS_ENABLED(eLevel)) { \
+            LogW((fp), (lpszMsg)); \
+        } \
+    } while (0)
+
+#define LEVEL_LOGWF(/* enum ELogLevel */ eLevel, /* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsgFmt, ...) \
+    do { \
+        if (LOG_IS_ENABLED(eLevel)) { \
+            LogWF((fp), (lpszMsgFmt), ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define LEVEL_LOGWFV(/* enum ELogLevel */ eLevel, /* FILE * */ fp, /* @EmptyStringAllowed const wchar_t * */ lpszMsgFmt, /* va_list */ ap) \
+    do { \
+        if (LOG_IS_ENABLED(eLevel)) { \
+            LogWFV((fp), (lpszMsgFmt), (ap)); \
+        } \
+    } while (0)
+
+#define TRACE_LOGW(fp, lpszMsg)            LEVEL_LOGW(LOG_LEVEL_TRACE, fp, lpszMsg)
+#define TRACE_LOGWF(fp, lpszMsgFmt, ...)   LEVEL_LOGWF(LOG_LEVEL_TRACE, fp, lpszMsgFmt, ##__VA_ARGS__)
+#define TRACE_LOGWFV(fp, lpszMsgFmt, ap)   LEVEL_LOGWFV(LOG_LEVEL_TRACE, fp, lpszMsgFmt, ap)
+
+// Intentional: Also enabled for release builds.  Why?  Debug a production problem without a new build.
+#define DEBUG_LOGW(fp, lpszMsg)            LEVEL_LOGW(LOG_LEVEL_DEBUG, fp, lpszMsg)
+#define DEBUG_LOGWF(fp, lpszMsgFmt, ...)   LEVEL_LOGWF(LOG_LEVEL_DEBUG, fp, lpszMsgFmt, ##__VA_ARGS__)
+#define DEBUG_LOGWFV(fp, lpszMsgFmt, ap)   LEVEL_LOGWFV(LOG_LEVEL_DEBUG, fp, lpszMsgFmt, ap)
+
+#define INFO_LOGW(fp, lpszMsg)             LEVEL_LOGW(LOG_LEVEL_INFO, fp, lpszMsg)
+#define INFO_LOGWF(fp, lpszMsgFmt, ...)    LEVEL_LOGWF(LOG_LEVEL_INFO, fp, lpszMsgFmt, ##__VA_ARGS__)
+#define INFO_LOGWFV(fp, lpszMsgFmt, ap)    LEVEL_LOGWFV(LOG_LEVEL_INFO, fp, lpszMsgFmt, ap)
+
+#define WARN_LOGW(fp, lpszMsg)             LEVEL_LOGW(LOG_LEVEL_WARN, fp, lpszMsg)
+#define WARN_LOGWF(fp, lpszMsgFmt, ...)    LEVEL_LOGWF(LOG_LEVEL_WARN, fp, lpszMsgFmt, ##__VA_ARGS__)
+#define WARN_LOGWFV(fp, lpszMsgFmt, ap)    LEVEL_LOGWFV(LOG_LEVEL_WARN, fp, lpszMsgFmt, ap)
+
+#define ERROR_LOGW(fp, lpszMsg)            LEVEL_LOGW(LOG_LEVEL_ERROR, fp, lpszMsg)
+#define ERROR_LOGWF(fp, lpszMsgFmt, ...)   LEVEL_LOGWF(LOG_LEVEL_ERROR, fp, lpszMsgFmt, ##__VA_ARGS__)
+#define ERROR_LOGWFV(fp, lpszMsgFmt, ap)   LEVEL_LOGWFV(LOG_LEVEL_ERROR, fp, lpszMsgFmt, ap)
+
+/**
+ * Set minimum enabled level.  Any thread may call, at any time.
+ */
+void
+LogSetLevel(_In_ const enum ELogLevel eLevel);
+
+enum ELogLevel
+LogGetLevel();
+
+/**
+ * @return upper case name; ex: L"TRACE"
+ */
+const wchar_t *
+LogLevelToName(_In_ const enum ELogLevel eLevel);
+
+/**
+ * @param lpszName
+ *        case-insensitive: L"trace", L"debug", L"info", L"warn", L"error", or L"off"
+ *
+ * @return true if lpszName is valid and *lpeLevel is set
+ */
+bool
+LogLevelParse(_In_  const wchar_t  *lpszName,
+              _Out_ enum ELogLevel *lpeLevel);
+
+/**
+ * Set level from environment variable LOG_LEVEL_ENV_VAR_NAME, if it exists.  Then set level from command-line arg
+ * LOG_LEVEL_ARG_PREFIX, if it exists, and remove it from lppArgvWCharArr.  Arg has priority: It is read last.
+ * Call once, before other command-line args are parsed.
+ * <p>
+ * Ex: LogLevelInit(&__argc, __wargv, stderr)
+ *
+ * @param lpArgc
+ *        on return, decremented for each removed arg
+ *
+ * @param lppArgvWCharArr
+ *        on return, args after each removed arg are moved left
+ *
+ * @param lpErrorStream
+ *        stream to print errors
+ *        usually 'stderr' (from <stdio.h>), but may be any valid stream
+ *
+ * @return true on success
+ *         false if a level name is invalid, and error printed to {@code lpErrorStream}
+ */
+bool
+LogLevelInit(_Inout_ int      *lpArgc,
+             _Inout_ wchar_t **lppArgvWCharArr,
+             _Inout_ FILE     *lpErrorStream);
+
+/**
+ * Set file sink for all lines: LogW(), LogWF(), LogWFV(), and async log.  See: log_file.h
+ * Lines for stdout are written only to file.  Lines for any other stream, e.g., stderr, are written to file *and* stream.
+ * Why?  Errors are still visible on console.
+ * <p>
+ * Important: Call before LogAsyncStart(), or after LogAsyncStop().  Why?  Async log background thread owns the file.
+ * If async log is not started, only one thread may log.
+ *
+ * @param lpNullableLogFile
+ *        @Nullable: NULL to remove file sink
+ *        must be open; caller still owns and must close after LogSetFile(NULL)
+ */
+void
+LogSetFile(_In_opt_ struct LogFile *lpNullableLogFile);
+
+/**
+ * @return @Nullable file sink from LogSetFile()
+ */
+struct LogFile *
+LogGetFile();
+
+/**
+ * Write one complete line, including timestamp prefix, to fp and/or file sink.  See: LogSetFile()
+ * Do not call directly: Used by LogW(), etc., and async log background thread.
+ *
+ * @param lpszLine
+ *        terminated with '\0'
+ *
+ * @param ulLen
+ *        length of lpszLine, excluding final '\0' char
+ */
+void
+LogWriteLine(_In_ FILE          *fp,
+             _In_ const wchar_t *lpszLine,
+             _In_ const size_t   ulLen);
+
+/**
+ * Append timestamp prefix, then a space.  At most LOG_PREFIX_MAX_LEN chars.
+ * Ex: "2022-03-10 22:17:47.123 +09:00 "
+ *
+ * @param lpLocalTime
+ *        usually from GetLocalTime()
+ *        Intentional: Caller provides timestamp.  Why?  Async log: Time is read by caller thread, but formatted later.
+ */
+void
+LogAppendPrefix(_In_    const SYSTEMTIME   *lpLocalTime,
+                _Inout_ struct WStrBuilder *lpWStrBuilder);
+
+/**
+ * Same as LogAppendPrefix(), but time zone is from caller, not this computer.  Ex: Decode a log file from another computer.
+ *
+ * @param lBias
+ *        minutes: UTC = local time + bias; from GetTimeZoneInformation()
+ *        ex: -540 for Japan Standard Time (UTC+09:00)
+ */
+void
+LogAppendPrefixWithBias(_In_    const SYSTEMTIME   *lpLocalTime,
+                        _In_    const LONG          lBias,
+                        _Inout_ struct WStrBuilder *lpWStrBuilder);
 
 /**
- * fprintf() timestamp, then fputws() message.  Newline must be explicitly included.
+ * Format timestamp and message, then fputws() complete line.  Newline must be explicitly included.
  * Example timestamp: "2022-03-10 22:17:47.123 +09:00 "
+ * <p>
+ * If LogSetFile() was called, also write line to file sink.  Ex: Lines for stdout only go to file.
+ * <p>
+ * If LogAsyncStart() was called, push message to async log, then return: No I/O on caller thread.  See: log_async.h
  *
  * @param fp
  *        usually stdout or stderr
@@ -42,8 +230,10 @@ LogW(_In_ FILE          *fp,
      _In_ const wchar_t *lpszMsg);
 
 /**
- * fprintf() timestamp, then vfwprintf() message.  Newline must be explicitly included.
+ * Format timestamp and message, then fputws() complete line.  Newline must be explicitly included.
  * Example timestamp: "2022-03-10 22:17:47.123 +09:00 "
+ * <p>
+ * If LogAsyncStart() was called, same as LogW(): Message is formatted on caller thread, but no I/O.
  *
  * @param fp
  *        usually stdout or stderr
@@ -63,8 +253,10 @@ LogWF(_In_ FILE          *fp,
       _In_ ...);
 
 /**
- * fprintf() timestamp, then vfwprintf() message.  Newline must be explicitly included.
+ * Format timestamp and message, then fputws() complete line.  Newline must be explicitly included.
  * Example timestamp: "2022-03-10 22:17:47.123 +09:00 "
+ * <p>
+ * If LogAsyncStart() was called, same as LogW(): Message is formatted on caller thread, but no I/O.
  *
  * @param fp
  *        usually stdout or stderr
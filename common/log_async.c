@@ -0,0 +1,693 @@
+#include "log_async.h"
+#include "log.h"
+#include "log_file.h"
+#include "wstr.h"
+#include "xmalloc.h"
+#include "win32_last_error.h"
+#include <stdatomic.h>  // required for atomic_size_t
+#include <stdint.h>     // required for intptr_t
+#include <assert.h>     // required for assert
+#include <stdlib.h>     // required for assert on MinGW and atexit()
+#include <signal.h>     // required for signal()
+
+// Max wait for background thread when ring buffer is empty.  Intentional: Not INFINITE.  Why?  Backstop for a lost wake-up.
+#define LOG_ASYNC_WAIT_MILLIS 100U
+
+// Max wait in crash handler for background thread to finish current batch.  Why?  It may be blocked: Ex: Slow disk
+#define LOG_ASYNC_CRASH_WAIT_MILLIS 1000U
+
+// Line buffer for background thread: Timestamp prefix and longest message, including final '\0' char.
+#define LOG_ASYNC_LINE_WCHAR_ARR_LEN (LOG_PREFIX_MAX_LEN + LOG_ASYNC_MSG_WCHAR_ARR_LEN)
+
+_Static_assert(0 == (LOG_ASYNC_RECORD_COUNT & (LOG_ASYNC_RECORD_COUNT - 1U)), "LOG_ASYNC_RECORD_COUNT must be a power of two");
+
+struct LogAsyncRecord
+{
+    // Bounded queue by Dmitry Vyukov: Each slot has a sequence number.
+    // If (ulSequence == position), slot is free for a producer.  If (ulSequence == position + 1), slot is ready for consumer.
+    // Ref: https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+    atomic_size_t ulSequence;
+    FILE         *fp;
+    // Intentional: Read by caller thread.  Why?  Timestamp is when the event happened, not when the line is written.
+    SYSTEMTIME    localTime;
+    wchar_t       lpMsgWCharArr[LOG_ASYNC_MSG_WCHAR_ARR_LEN];
+};
+
+static struct Global
+{
+    // @Nullable: NULL if not started
+    struct LogAsyncRecord  *lpRecordArr;
+    enum ELogAsyncOverflow  eOverflow;
+    HANDLE                  hWakeEvent;
+    HANDLE                  hThread;
+    // Crash handler must not wait for its own thread.
+    DWORD                   dwThreadId;
+    bool                    bIsAtExitDone;
+    // @Nullable
+    LPTOP_LEVEL_EXCEPTION_FILTER lpPrevExceptionFilter;
+    // Ex: SIG_DFL
+    void                  (*lpPrevSignalHandler)(int);
+    atomic_bool             bIsStarted;
+    atomic_bool             bIsStopRequested;
+    // Set by background thread before it waits.  Producer calls SetEvent() only if set: Usually, no syscall per push.
+    atomic_bool             bIsConsumerWaiting;
+    _Atomic uint64_t        ullDroppedCount;
+    _Atomic uint64_t        ullBlockedCount;
+    // Set by LogAsyncFlush() and LogAsyncStop(): Next batch also calls LogFileFlush(), not LogFileTick().
+    atomic_bool             bIsFlushRequested;
+    // Position after last record written and fflush()'ed, and, if LogSetFile(), LogFileFlush()'ed.  See: LogAsyncFlush()
+    atomic_size_t           ulWrittenPos;
+    // Owner of ulDequeuePos and file sink: Background thread, for each batch, or crash handler, until process exits.
+    atomic_bool             bIsDrainBusy;
+    // Set by crash handler: Background thread does not start another batch.
+    atomic_bool             bIsCrashDrainRequested;
+    // Background thread only.  If it crashes while set, record at ulDequeuePos is skipped.  Why?  It may be half-written.
+    bool                    bIsRecordWriteInProgress;
+    // Intentional: Not on stack.  Why?  After a stack overflow, crash handler has very little stack.
+    wchar_t                 lpCrashLineWCharArr[LOG_ASYNC_LINE_WCHAR_ARR_LEN];
+    // Intentional: Own cache line.  Why?  Every producer writes this position; background thread never does.
+    _Alignas(64)
+    atomic_size_t           ulEnqueuePos;
+    // Intentional: Own cache line.  Only owner of bIsDrainBusy reads and writes this position.
+    _Alignas(64)
+    size_t                  ulDequeuePos;
+}
+global = {0};
+
+bool
+LogAsyncIsStarted()
+{
+    const bool x = atomic_load_explicit(&global.bIsStarted, memory_order_acquire);
+    return x;
+}
+
+static struct LogAsyncRecord *
+StaticRecord(_In_ const size_t ulPos)
+{
+    struct LogAsyncRecord *x = global.lpRecordArr + (ulPos & (LOG_ASYNC_RECORD_COUNT - 1U));
+    return x;
+}
+
+/**
+ * @param lpPos
+ *        position of record, if successful
+ *
+ * @return NULL if ring buffer is full
+ */
+static struct LogAsyncRecord *
+StaticTryAcquireRecord(_Out_ size_t *lpPos)
+{
+    size_t ulPos = atomic_load_explicit(&global.ulEnqueuePos, memory_order_relaxed);
+    while (true)
+    {
+        struct LogAsyncRecord *lpRecord = StaticRecord(ulPos);
+        const size_t ulSequence = atomic_load_explicit(&(lpRecord->ulSequence), memory_order_acquire);
+        // Intentional: Signed difference.  Why?  Positions wrap.
+        const intptr_t diff = (intptr_t) (ulSequence - ulPos);
+        if (0 == diff)
+        {
+            // On failure, ulPos is updated to current value: Try again.
+            if (atomic_compare_exchange_weak_explicit(&global.ulEnqueuePos, &ulPos, ulPos + 1U,
+                                                      memory_order_relaxed, memory_order_relaxed))
+            {
+                *lpPos = ulPos;
+                return lpRecord;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Slot is still used by previous lap: Full.
+            return NULL;
+        }
+        else
+        {
+            // Another producer acquired this slot: Try again.
+            ulPos = atomic_load_explicit(&global.ulEnqueuePos, memory_order_relaxed);
+        }
+    }
+}
+
+static void
+StaticSetWakeEvent()
+{
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-setevent
+    if (FALSE == SetEvent(global.hWakeEvent))  // [in] HANDLE hEvent
+    {
+        Win32LastErrorFPutWSAbort(stderr,        // _In_ FILE          *lpStream
+                                  L"SetEvent");  // _In_ const wchar_t *lpMessage
+    }
+}
+
+static void
+StaticWakeConsumer()
+{
+    if (atomic_exchange(&global.bIsConsumerWaiting, false))
+    {
+        StaticSetWakeEvent();
+    }
+}
+
+/**
+ * Acquire a free record, per overflow policy, then set stream and timestamp.
+ *
+ * @return NULL if dropped
+ */
+static struct LogAsyncRecord *
+StaticAcquireRecord(_In_  FILE   *fp,
+                    _Out_ size_t *lpPos)
+{
+    assert(NULL != fp);
+    assert(LogAsyncIsStarted());
+
+    struct LogAsyncRecord *lpRecord = StaticTryAcquireRecord(lpPos);
+    if (NULL == lpRecord)
+    {
+        if (LOG_ASYNC_OVERFLOW_DROP == global.eOverflow)
+        {
+            atomic_fetch_add_explicit(&global.ullDroppedCount, 1U, memory_order_relaxed);
+            return NULL;
+        }
+
+        atomic_fetch_add_explicit(&global.ullBlockedCount, 1U, memory_order_relaxed);
+        do
+        {
+            // Intentional: Always wake.  Why?  Background thread may be waiting with a full ring buffer after a lost wake-up.
+            StaticSetWakeEvent();
+            // Ref: https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-switchtothread
+            SwitchToThread();
+            lpRecord = StaticTryAcquireRecord(lpPos);
+        }
+        while (NULL == lpRecord);
+    }
+
+    lpRecord->fp = fp;
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-getlocaltime
+    GetLocalTime(&(lpRecord->localTime));
+    return lpRecord;
+}
+
+static void
+StaticPublishRecord(_Inout_ struct LogAsyncRecord *lpRecord,
+                    _In_    const size_t           ulPos)
+{
+    // Intentional: Sequentially consistent, not release.  Why?  Pairs with StaticWait(): Either background thread sees
+    // this record, or this thread sees bIsConsumerWaiting.
+    atomic_store(&(lpRecord->ulSequence), ulPos + 1U);
+    StaticWakeConsumer();
+}
+
+static void
+StaticTruncate(_Inout_ wchar_t *lpMsgWCharArr)
+{
+    const size_t ulTruncatedLen = wcslen(LOG_ASYNC_TRUNCATED);
+    wmemcpy(lpMsgWCharArr + LOG_ASYNC_MSG_WCHAR_ARR_LEN - LEN_NUL_CHAR - ulTruncatedLen, LOG_ASYNC_TRUNCATED, ulTruncatedLen);
+    lpMsgWCharArr[LOG_ASYNC_MSG_WCHAR_ARR_LEN - LEN_NUL_CHAR] = L'\0';
+}
+
+void
+LogAsyncPushW(_In_ FILE          *fp,
+              // @EmptyStringAllowed
+              _In_ const wchar_t *lpszMsg)
+{
+    assert(NULL != lpszMsg);
+
+    size_t ulPos = 0;
+    // @Nullable
+    struct LogAsyncRecord *lpRecord = StaticAcquireRecord(fp, &ulPos);
+    if (NULL == lpRecord)
+    {
+        return;
+    }
+
+    const size_t ulLen = wcslen(lpszMsg);
+    if (ulLen < LOG_ASYNC_MSG_WCHAR_ARR_LEN)
+    {
+        wmemcpy(lpRecord->lpMsgWCharArr, lpszMsg, ulLen + LEN_NUL_CHAR);
+    }
+    else
+    {
+        wmemcpy(lpRecord->lpMsgWCharArr, lpszMsg, LOG_ASYNC_MSG_WCHAR_ARR_LEN);
+        StaticTruncate(lpRecord->lpMsgWCharArr);
+    }
+    StaticPublishRecord(lpRecord, ulPos);
+}
+
+void
+LogAsyncPushWFV(_In_ FILE          *fp,
+                // @EmptyStringAllowed
+                _In_ const wchar_t *lpszMsgFmt,
+                _In_ va_list        ap)
+{
+    assert(NULL != lpszMsgFmt);
+
+    size_t ulPos = 0;
+    // @Nullable
+    struct LogAsyncRecord *lpRecord = StaticAcquireRecord(fp, &ulPos);
+    if (NULL == lpRecord)
+    {
+        return;
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
+    va_list ap_copy;
+    va_copy(ap_copy, ap);
+    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/vsnprintf-vsnprintf-vsnprintf-l-vsnwprintf-vsnwprintf-l?view=msvc-170
+    // Intentional: Also handle -1 on truncation.  Why?  This is what MSVCRT _vsnwprintf() returns.
+    const int cch = vswprintf(lpRecord->lpMsgWCharArr,      // wchar_t *buffer
+                              LOG_ASYNC_MSG_WCHAR_ARR_LEN,  // size_t count
+                              lpszMsgFmt,                   // const wchar_t *format
+                              ap_copy);                     // va_list argptr
+    va_end(ap_copy);
+
+    // Intentional: On format error, also write a (partial) line.  Why?  Unlike LogWFV(), caller cannot see errno.
+    if (cch < 0 || (size_t) cch >= LOG_ASYNC_MSG_WCHAR_ARR_LEN)
+    {
+        StaticTruncate(lpRecord->lpMsgWCharArr);
+    }
+    StaticPublishRecord(lpRecord, ulPos);
+}
+
+/**
+ * Owner of bIsDrainBusy only.  Format one record, then LogWriteLine().  No heap alloc: Line buffer is large enough for any record.
+ *
+ * @param bIsStreamOnly
+ *        if true, fputws(), not LogWriteLine(): Skip file sink
+ */
+static void
+StaticWriteRecord(_In_    const struct LogAsyncRecord *lpRecord,
+                  _Inout_ wchar_t                     *lpLineWCharArr,
+                  _In_    const bool                   bIsStreamOnly)
+{
+    struct WStrBuilder sb = {0};
+    WStrBuilderInitBuffer(&sb, lpLineWCharArr, LOG_ASYNC_LINE_WCHAR_ARR_LEN);
+
+    LogAppendPrefix(&(lpRecord->localTime), &sb);
+    WStrBuilderAppendWCharArr(&sb, lpRecord->lpMsgWCharArr, wcslen(lpRecord->lpMsgWCharArr));
+    assert(sb.lpWCharArr == lpLineWCharArr);
+
+    if (bIsStreamOnly) {
+        fputws(sb.lpWCharArr, lpRecord->fp);
+    }
+    else {
+        LogWriteLine(lpRecord->fp, sb.lpWCharArr, sb.ulSize);
+    }
+    WStrBuilderFree(&sb);
+}
+
+/**
+ * Owner of bIsDrainBusy only.  Write all ready records.
+ *
+ * @return true if any record was written
+ */
+static bool
+StaticWriteReadyRecords(_Inout_ wchar_t    *lpLineWCharArr,
+                        _In_    const bool  bIsStreamOnly)
+{
+    bool bIsWritten = false;
+    while (true)
+    {
+        struct LogAsyncRecord *lpRecord = StaticRecord(global.ulDequeuePos);
+        const size_t ulSequence = atomic_load_explicit(&(lpRecord->ulSequence), memory_order_acquire);
+        if (ulSequence != global.ulDequeuePos + 1U)
+        {
+            // Empty, or next producer has not yet published.
+            break;
+        }
+
+        global.bIsRecordWriteInProgress = true;
+        StaticWriteRecord(lpRecord, lpLineWCharArr, bIsStreamOnly);
+        global.bIsRecordWriteInProgress = false;
+        // Slot is free for next lap.
+        atomic_store_explicit(&(lpRecord->ulSequence), global.ulDequeuePos + LOG_ASYNC_RECORD_COUNT, memory_order_release);
+        ++(global.ulDequeuePos);
+        bIsWritten = true;
+    }
+    return bIsWritten;
+}
+
+/**
+ * Background thread only.  Write all ready records, then fflush().  If LogSetFile(), also flush or tick file sink.
+ *
+ * @param lpReportedDroppedCount
+ *        dropped count from previous warning
+ */
+static void
+StaticDrain(_Inout_ wchar_t  *lpLineWCharArr,
+            _Inout_ uint64_t *lpReportedDroppedCount)
+{
+    const bool bIsStreamOnly = false;
+    bool bIsWritten = StaticWriteReadyRecords(lpLineWCharArr, bIsStreamOnly);
+
+    const uint64_t ullDroppedCount = atomic_load_explicit(&global.ullDroppedCount, memory_order_relaxed);
+    if (ullDroppedCount != *lpReportedDroppedCount)
+    {
+        struct LogAsyncRecord record = {.fp = stderr};
+        GetLocalTime(&(record.localTime));
+        // Intentional: Only integers: Cannot fail or truncate.
+        swprintf(record.lpMsgWCharArr, LOG_ASYNC_MSG_WCHAR_ARR_LEN,
+                 L"WARN: Async log: Ring buffer full: Dropped %llu records (total: %llu)\r\n",
+                 (unsigned long long) (ullDroppedCount - *lpReportedDroppedCount), (unsigned long long) ullDroppedCount);
+        StaticWriteRecord(&record, lpLineWCharArr, bIsStreamOnly);
+        *lpReportedDroppedCount = ullDroppedCount;
+        bIsWritten = true;
+    }
+
+    if (bIsWritten)
+    {
+        // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fflush?view=msvc-170
+        // "If stream is NULL, fflush flushes all streams opened for output"
+        // Intentional: Once per batch, not per record.  Why?  Many records, one write syscall per stream.
+        fflush(NULL);
+    }
+
+    // @Nullable
+    struct LogFile *lpLogFile = LogGetFile();
+    if (NULL == lpLogFile)
+    {
+        if (bIsWritten) {
+            atomic_store_explicit(&global.ulWrittenPos, global.ulDequeuePos, memory_order_release);
+        }
+    }
+    // Intentional: Clear flag *after* drain.  Why?  All records pushed before LogAsyncFlush() are now in file buffer.
+    else if (atomic_exchange(&global.bIsFlushRequested, false))
+    {
+        LogFileFlush(lpLogFile);
+        atomic_store_explicit(&global.ulWrittenPos, global.ulDequeuePos, memory_order_release);
+    }
+    else
+    {
+        // Intentional: Also after each wait timeout.  Why?  Buffered lines are written within flush interval, even if no
+        // more lines are logged.
+        LogFileTick(lpLogFile);
+    }
+}
+
+/**
+ * Background thread only.  Wait for next record, LogAsyncFlush(), or LogAsyncStop().
+ */
+static void
+StaticWait()
+{
+    atomic_store(&global.bIsConsumerWaiting, true);
+
+    // Intentional: Check again after flag is set.  Why?  If a producer published after StaticDrain(), but before the flag,
+    // it did not call SetEvent().
+    const struct LogAsyncRecord *lpRecord = StaticRecord(global.ulDequeuePos);
+    const bool bIsReady = (atomic_load(&(lpRecord->ulSequence)) == global.ulDequeuePos + 1U);
+    if (!bIsReady && !atomic_load(&global.bIsStopRequested))
+    {
+        // Ref: https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
+        const DWORD dwResult = WaitForSingleObject(global.hWakeEvent,      // [in] HANDLE hHandle
+                                                   LOG_ASYNC_WAIT_MILLIS);  // [in] DWORD  dwMilliseconds
+        if (WAIT_FAILED == dwResult)
+        {
+            Win32LastErrorFPutWSAbort(stderr,                                // _In_ FILE          *lpStream
+                                      L"WaitForSingleObject(hWakeEvent)");  // _In_ const wchar_t *lpMessage
+        }
+    }
+    atomic_store(&global.bIsConsumerWaiting, false);
+}
+
+/**
+ * Background thread only.
+ *
+ * @return true if now owner of bIsDrainBusy; false if crash handler is (or will be) owner
+ */
+static bool
+StaticTryBeginDrain()
+{
+    if (atomic_load(&global.bIsCrashDrainRequested)) {
+        return false;
+    }
+    bool bExpected = false;
+    const bool x = atomic_compare_exchange_strong(&global.bIsDrainBusy, &bExpected, true);
+    return x;
+}
+
+static DWORD WINAPI
+StaticLogAsyncThreadProc(__attribute__((unused))
+                         _In_ LPVOID lpParam)
+{
+    // Intentional: On stack, not heap.  Why?  This thread never calls xmalloc().  See: log_async.h
+    wchar_t lpLineWCharArr[LOG_ASYNC_LINE_WCHAR_ARR_LEN];
+    uint64_t ullReportedDroppedCount = 0;
+    while (true)
+    {
+        // Intentional: Read flag *before* drain.  Why?  LogAsyncStop() sets flag after final push: Final drain is complete.
+        const bool bIsStopRequested = atomic_load(&global.bIsStopRequested);
+        if (!StaticTryBeginDrain())
+        {
+            // Crash handler owns ring buffer until process exits.
+            if (bIsStopRequested) {
+                break;
+            }
+            // Ref: https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-sleep
+            Sleep(LOG_ASYNC_WAIT_MILLIS);
+            continue;
+        }
+        if (bIsStopRequested) {
+            // Final drain also writes file buffer.
+            atomic_store(&global.bIsFlushRequested, true);
+        }
+        StaticDrain(lpLineWCharArr, &ullReportedDroppedCount);
+        if (!bIsStopRequested) {
+            // Intentional: Wait while owner.  Why?  StaticWait() also reads ulDequeuePos.  Crash handler sets wake event.
+            StaticWait();
+        }
+        atomic_store(&global.bIsDrainBusy, false);
+        if (bIsStopRequested)
+        {
+            break;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Crash handlers only.  Wait for background thread to finish current batch, then own ring buffer until process exits.
+ *
+ * @return false if background thread is still busy after LOG_ASYNC_CRASH_WAIT_MILLIS
+ */
+static bool
+StaticCrashBeginDrain()
+{
+    atomic_store(&global.bIsCrashDrainRequested, true);
+    const ULONGLONG ullStartTickCount = GetTickCount64();
+    while (true)
+    {
+        bool bExpected = false;
+        if (atomic_compare_exchange_strong(&global.bIsDrainBusy, &bExpected, true)) {
+            return true;
+        }
+        if (GetTickCount64() - ullStartTickCount >= LOG_ASYNC_CRASH_WAIT_MILLIS) {
+            return false;
+        }
+        // Intentional: SetEvent() directly.  Why?  Never abort() from a crash handler.
+        SetEvent(global.hWakeEvent);  // [in] HANDLE hEvent
+        Sleep(1);
+    }
+}
+
+/**
+ * Crash handlers only.  Best effort: Write ready records on the crashing thread, then fflush().  No heap alloc.
+ * Intentional: File buffer is not flushed here.  Why?  Crash handlers in log_file.c run next.  See: StaticSignalHandler()
+ */
+static void
+StaticCrashDrain()
+{
+    if (!LogAsyncIsStarted()) {
+        return;
+    }
+
+    if (GetCurrentThreadId() == global.dwThreadId)
+    {
+        // Crash during a batch: This thread is already owner, but file sink state is unknown: Only write to streams.
+        if (global.bIsRecordWriteInProgress)
+        {
+            struct LogAsyncRecord *lpRecord = StaticRecord(global.ulDequeuePos);
+            atomic_store_explicit(&(lpRecord->ulSequence), global.ulDequeuePos + LOG_ASYNC_RECORD_COUNT, memory_order_release);
+            ++(global.ulDequeuePos);
+            global.bIsRecordWriteInProgress = false;
+        }
+        const bool bIsStreamOnly = true;
+        StaticWriteReadyRecords(global.lpCrashLineWCharArr, bIsStreamOnly);
+    }
+    else if (StaticCrashBeginDrain())
+    {
+        const bool bIsStreamOnly = false;
+        StaticWriteReadyRecords(global.lpCrashLineWCharArr, bIsStreamOnly);
+    }
+    // Else: Records are lost.  Why?  Background thread may be in the middle of a write: Do not tear lines.
+
+    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fflush?view=msvc-170
+    fflush(NULL);
+}
+
+// Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/signal?view=msvc-170
+// Intentional: SIGABRT.  Why?  All *Abort() functions call LogWF(), then abort(): Fatal message is the last record.
+static void
+StaticSignalHandler(_In_ const int iSignal)
+{
+    StaticCrashDrain();
+
+    // Intentional: Restore previous handler, then return.  Why?  After handler returns, abort() exits the process.
+    void (*lpPrevSignalHandler)(int) = global.lpPrevSignalHandler;
+    signal(SIGABRT, lpPrevSignalHandler);
+    if (SIG_DFL != lpPrevSignalHandler && SIG_IGN != lpPrevSignalHandler && SIG_ERR != lpPrevSignalHandler) {
+        lpPrevSignalHandler(iSignal);
+    }
+}
+
+// Ref: https://learn.microsoft.com/en-us/windows/win32/api/errhandlingapi/nf-errhandlingapi-setunhandledexceptionfilter
+static LONG WINAPI
+StaticUnhandledExceptionFilter(_In_ PEXCEPTION_POINTERS lpExceptionInfo)
+{
+    StaticCrashDrain();
+
+    if (NULL != global.lpPrevExceptionFilter) {
+        return global.lpPrevExceptionFilter(lpExceptionInfo);
+    }
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+
+void
+LogAsyncStart(_In_ const enum ELogAsyncOverflow eOverflow)
+{
+    assert(!LogAsyncIsStarted());
+    assert(LOG_ASYNC_OVERFLOW_DROP == eOverflow || LOG_ASYNC_OVERFLOW_BLOCK == eOverflow);
+
+    global.lpRecordArr = xcalloc(LOG_ASYNC_RECORD_COUNT, sizeof(struct LogAsyncRecord));
+    for (size_t i = 0; i < LOG_ASYNC_RECORD_COUNT; ++i)
+    {
+        atomic_init(&(global.lpRecordArr[i].ulSequence), i);
+    }
+    global.eOverflow = eOverflow;
+    atomic_store(&global.bIsStopRequested, false);
+    atomic_store(&global.bIsConsumerWaiting, false);
+    atomic_store(&global.bIsFlushRequested, false);
+    atomic_store(&global.bIsDrainBusy, false);
+    atomic_store(&global.bIsCrashDrainRequested, false);
+    atomic_store(&global.ulWrittenPos, 0);
+    atomic_store(&global.ulEnqueuePos, 0);
+    global.ulDequeuePos = 0;
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-createeventw
+    global.hWakeEvent = CreateEventW(NULL,    // [in, optional] LPSECURITY_ATTRIBUTES lpEventAttributes
+                                     FALSE,   // [in]           BOOL                  bManualReset
+                                     FALSE,   // [in]           BOOL                  bInitialState
+                                     NULL);   // [in, optional] LPCWSTR               lpName
+    if (NULL == global.hWakeEvent)
+    {
+        Win32LastErrorFPutWSAbort(stderr,            // _In_ FILE          *lpStream
+                                  L"CreateEventW");  // _In_ const wchar_t *lpMessage
+    }
+
+    // Intentional: Set before thread starts.  Why?  Producers may push immediately: Records wait in ring buffer.
+    atomic_store(&global.bIsStarted, true);
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-createthread
+    global.hThread = CreateThread(NULL,                       // [in, optional]  LPSECURITY_ATTRIBUTES   lpThreadAttributes
+                                  0,                          // [in]            SIZE_T                  dwStackSize
+                                  StaticLogAsyncThreadProc,   // [in]            LPTHREAD_START_ROUTINE  lpStartAddress
+                                  NULL,                       // [in, optional]  __drv_aliasesMem LPVOID lpParameter
+                                  0,                          // [in]            DWORD                   dwCreationFlags
+                                  &global.dwThreadId);        // [out, optional] LPDWORD                 lpThreadId
+    if (NULL == global.hThread)
+    {
+        Win32LastErrorFPutWSAbort(stderr,            // _In_ FILE          *lpStream
+                                  L"CreateThread");  // _In_ const wchar_t *lpMessage
+    }
+
+    if (!global.bIsAtExitDone)
+    {
+        // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/atexit?view=msvc-170
+        if (0 != atexit(LogAsyncStop))
+        {
+            Win32LastErrorFPutWSAbort(stderr,                     // _In_ FILE          *lpStream
+                                      L"atexit(LogAsyncStop)");  // _In_ const wchar_t *lpMessage
+        }
+        global.bIsAtExitDone = true;
+    }
+
+    // Intentional: Usually installed after log_file.c handlers.  Why?  Each calls previous: Ring buffer is drained first,
+    // then file buffer is written.
+    global.lpPrevSignalHandler = signal(SIGABRT, StaticSignalHandler);
+    global.lpPrevExceptionFilter = SetUnhandledExceptionFilter(StaticUnhandledExceptionFilter);  // [in] LPTOP_LEVEL_EXCEPTION_FILTER lpTopLevelExceptionFilter
+}
+
+void
+LogAsyncFlush()
+{
+    if (!LogAsyncIsStarted())
+    {
+        return;
+    }
+
+    const size_t ulEnqueuePos = atomic_load(&global.ulEnqueuePos);
+
+    // Intentional: Signed difference.  Why?  Positions wrap.
+    while ((intptr_t) (atomic_load_explicit(&global.ulWrittenPos, memory_order_acquire) - ulEnqueuePos) < 0)
+    {
+        // Intentional: Request each time.  Why?  Background thread may clear flag before the last record is published.
+        atomic_store(&global.bIsFlushRequested, true);
+        StaticSetWakeEvent();
+        // Ref: https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-sleep
+        Sleep(1);
+    }
+}
+
+void
+LogAsyncStop()
+{
+    if (!LogAsyncIsStarted())
+    {
+        return;
+    }
+
+    // Intentional: Clear first.  Why?  Later calls to LogW(), etc. from this thread write directly.
+    atomic_store(&global.bIsStarted, false);
+    // Intentional: Restore previous handlers.  Why?  Next LogAsyncStart() installs again.
+    signal(SIGABRT, global.lpPrevSignalHandler);
+    SetUnhandledExceptionFilter(global.lpPrevExceptionFilter);  // [in] LPTOP_LEVEL_EXCEPTION_FILTER lpTopLevelExceptionFilter
+    atomic_store(&global.bIsStopRequested, true);
+    StaticSetWakeEvent();
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
+    if (WAIT_FAILED == WaitForSingleObject(global.hThread,  // [in] HANDLE hHandle
+                                           INFINITE))       // [in] DWORD  dwMilliseconds
+    {
+        Win32LastErrorFPutWSAbort(stderr,                             // _In_ FILE          *lpStream
+                                  L"WaitForSingleObject(hThread)");  // _In_ const wchar_t *lpMessage
+    }
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    if (FALSE == CloseHandle(global.hThread))  // [in] HANDLE hObject
+    {
+        Win32LastErrorFPutWSAbort(stderr,                    // _In_ FILE          *lpStream
+                                  L"CloseHandle(hThread)");  // _In_ const wchar_t *lpMessage
+    }
+    global.hThread = NULL;
+
+    if (FALSE == CloseHandle(global.hWakeEvent))  // [in] HANDLE hObject
+    {
+        Win32LastErrorFPutWSAbort(stderr,                       // _In_ FILE          *lpStream
+                                  L"CloseHandle(hWakeEvent)");  // _In_ const wchar_t *lpMessage
+    }
+    global.hWakeEvent = NULL;
+
+    xfree((void **) &(global.lpRecordArr));
+}
+
+uint64_t
+LogAsyncGetDroppedCount()
+{
+    const uint64_t x = atomic_load_explicit(&global.ullDroppedCount, memory_order_relaxed);
+    return x;
+}
+
+uint64_t
+LogAsyncGetBlockedCount()
+{
+    const uint64_t x = atomic_load_explicit(&global.ullBlockedCount, memory_order_relaxed);
+    return x;
+}
@@ -0,0 +1,112 @@
+#ifndef H_COMMON_LOG_ASYNC
+#define H_COMMON_LOG_ASYNC
+
+#include "win32.h"
+#include <sal.h>     // required for _In_
+#include <wchar.h>   // required for wchar_t
+#include <stdio.h>   // required for FILE
+#include <stdarg.h>  // required for va_list
+#include <stdint.h>  // required for uint64_t
+
+// Async log: Callers push records to a lock-free ring buffer.  One background thread formats the timestamp prefix and
+// writes each line with fputws().  Afterwards, LogW(), LogWF(), and LogWFV() push records: Keyboard hooks and window
+// procedures never wait for console or file I/O.
+// <p>
+// Multi-producer, single-consumer: Any thread may push.  Each record is one slot: No heap alloc after LogAsyncStart().
+// Intentional: Background thread never calls xcalloc(), xmalloc(), etc.  Why?  XMALLOC_HEAP_PRIVATE_NO_SERIALIZE is
+// only for the thread that called XMallocInit().
+// Ex:
+// XMallocInit(XMALLOC_HEAP_PRIVATE_NO_SERIALIZE);
+// LogAsyncStart(LOG_ASYNC_OVERFLOW_DROP);  // Calls atexit(LogAsyncStop): flush on exit.
+// ... LogWF(stdout, L"INFO: ...\r\n", ...) ...
+
+// Number of slots in ring buffer.  Must be a power of two.
+#define LOG_ASYNC_RECORD_COUNT        256U
+// Max message length per record, including final '\0' char.  Longer messages are truncated: See: LOG_ASYNC_TRUNCATED
+#define LOG_ASYNC_MSG_WCHAR_ARR_LEN   512U
+// Suffix for truncated messages
+#define LOG_ASYNC_TRUNCATED           L"...\r\n"
+
+// What to do if ring buffer is full
+enum ELogAsyncOverflow
+{
+    // Default.  Do not wait: Discard the new record, then increment dropped count.  See: LogAsyncGetDroppedCount()
+    // Intentional: Default.  Why?  Windows silently removes a low-level keyboard hook that is too slow.
+    LOG_ASYNC_OVERFLOW_DROP  = 0,
+    // Spin and yield until background thread frees a slot.  Each wait increments blocked count.  No record is lost.
+    LOG_ASYNC_OVERFLOW_BLOCK = 1,
+};
+
+/**
+ * Allocate ring buffer and start background thread.  Call once, from the thread that called XMallocInit().
+ * Also calls atexit(LogAsyncStop): Records are flushed when wWinMain() returns or exit() is called.
+ * Also installs a SIGABRT handler and an unhandled exception filter: On abort() or a crash, the crashing thread writes
+ * ready records, including the fatal message from Win32LastError*Abort(), then calls the previous handler.
+ * If background thread is still busy after a short wait, these records are lost.  Why?  Never tear a line.
+ * <p>
+ * Important: Not flushed after ExitProcess() or TerminateProcess().  Call LogAsyncFlush() first.
+ */
+void
+LogAsyncStart(_In_ const enum ELogAsyncOverflow eOverflow);
+
+/**
+ * @return true if LogAsyncStart() was called, and LogAsyncStop() was not (yet) called
+ */
+bool
+LogAsyncIsStarted();
+
+/**
+ * Push one record: Timestamp from GetLocalTime() and a copy of lpszMsg.  No I/O.  No heap alloc.
+ *
+ * @param fp
+ *        stream for background thread; usually stdout or stderr
+ *
+ * @param lpszMsg
+ *        may be empty; usually ends with newline: L"\r\n"
+ *        if too long, it is truncated, then LOG_ASYNC_TRUNCATED is appended
+ */
+void
+LogAsyncPushW(_In_ FILE          *fp,
+              // @EmptyStringAllowed
+              _In_ const wchar_t *lpszMsg);
+
+/**
+ * Same as LogAsyncPushW(), but format message on caller thread directly into ring buffer slot.
+ * Intentional: Format here, not in background thread.  Why?  A va_list cannot outlive this call.
+ */
+void
+LogAsyncPushWFV(_In_ FILE          *fp,
+                // @EmptyStringAllowed
+                _In_ const wchar_t *lpszMsgFmt,
+                _In_ va_list        ap);
+
+/**
+ * Wait until all records pushed before this call are written and each stream is fflush()'ed.  If LogSetFile(), also
+ * LogFileFlush().  Any thread may call.
+ * If not started, do nothing.  Ex: Before ExitProcess()
+ */
+void
+LogAsyncFlush();
+
+/**
+ * Flush, stop background thread, then free ring buffer.  Afterwards, LogW(), etc. write on caller thread, as before.
+ * Call from the thread that called LogAsyncStart().  If not started, do nothing.
+ * <p>
+ * Important: Other threads must not push records during or after this call.
+ */
+void
+LogAsyncStop();
+
+/**
+ * @return total number of records discarded by LOG_ASYNC_OVERFLOW_DROP
+ */
+uint64_t
+LogAsyncGetDroppedCount();
+
+/**
+ * @return total number of pushes that waited for a free slot with LOG_ASYNC_OVERFLOW_BLOCK
+ */
+uint64_t
+LogAsyncGetBlockedCount();
+
+#endif  // H_COMMON_LOG_ASYNC
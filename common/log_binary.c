@@ -0,0 +1,863 @@
+#include "log_binary.h"
+#include "log.h"
+#include "wstr.h"
+#include "xmalloc.h"
+#include "win32_last_error.h"
+#include <string.h>  // required for memcpy()
+#include <wchar.h>   // required for wcslen()
+#include <wctype.h>  // required for iswdigit()
+#include <stdarg.h>  // required for va_list
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+#include <limits.h>  // required for INT_MAX
+
+_Static_assert(40U == sizeof(struct LogBinaryFileHeader), "struct LogBinaryFileHeader must not have padding");
+_Static_assert(8U == sizeof(LOG_BINARY_MAGIC) - 1U, "LOG_BINARY_MAGIC must be 8 chars");
+
+// Record prefix: enum ELogBinaryRecordType (1 byte), then uint16_t format id
+#define LOG_BINARY_RECORD_PREFIX_BYTE_SIZE 3U
+
+// 100-nanosecond intervals per second: Unit of FILETIME
+#define LOG_BINARY_FILE_TIME_PER_SECOND 10000000LL
+
+DYN_ARR_DEFINE(LogBinaryFormatDynArr, struct LogBinaryFormat, NULL)
+
+// Intentional: Never reused.  Why?  Each struct LogBinaryFormatCache is valid for exactly one open.
+static size_t ulLastOpenId = 0;
+
+static void
+StaticUnsupportedSpecAbort(_In_ const wchar_t *lpszMsgFmt,
+                           _In_ const size_t   ulOffset)
+{
+    Win32LastErrorFPrintFWAbort(stderr,                                                              // _In_ FILE          *lpStream
+                                L"LogBinary: Unsupported conversion spec at offset %zu: [%ls]",   // _In_ const wchar_t *lpMessageFormat
+                                ulOffset, lpszMsgFmt);                                            // ...
+}
+
+/**
+ * @return LOG_BINARY_ARG_INT32 or LOG_BINARY_ARG_INT64
+ */
+static enum ELogBinaryArgType
+StaticIntArgType(_In_ const size_t ulByteSize)
+{
+    const enum ELogBinaryArgType x = (8U == ulByteSize) ? LOG_BINARY_ARG_INT64 : LOG_BINARY_ARG_INT32;
+    return x;
+}
+
+/**
+ * Same as LogBinaryFormatNextSpec(), but never abort().  Why?  Decoder reads format strings from a file: Bytes may be invalid.
+ *
+ * @param lpbIsSupported
+ *        on return, false if next conversion spec is unsupported; then return value is also false
+ */
+static bool
+StaticTryNextSpec(_In_  const wchar_t              *lpszMsgFmt,
+                  _In_  const size_t                ulOffset,
+                  _Out_ struct LogBinaryFormatSpec *lpSpec,
+                  _Out_ bool                       *lpbIsSupported)
+{
+    assert(NULL != lpszMsgFmt);
+    assert(NULL != lpSpec);
+    assert(NULL != lpbIsSupported);
+
+    *lpbIsSupported = true;
+
+    // @Nullable
+    const wchar_t *lpPercent = wcschr(lpszMsgFmt + ulOffset, L'%');
+    if (NULL == lpPercent) {
+        return false;
+    }
+
+    *lpSpec = (struct LogBinaryFormatSpec) {.ulOffset = (size_t) (lpPercent - lpszMsgFmt), .ulPrecision = SIZE_MAX};
+    size_t i = lpSpec->ulOffset + 1U;
+    if (L'%' == lpszMsgFmt[i])
+    {
+        lpSpec->ulLen = 2U;
+        return true;
+    }
+
+    // Flags
+    while (L'\0' != lpszMsgFmt[i] && NULL != wcschr(L"-+ #0", lpszMsgFmt[i])) {
+        ++i;
+    }
+
+    // Width
+    if (L'*' == lpszMsgFmt[i])
+    {
+        lpSpec->eArgTypeArr[lpSpec->ulArgCount++] = LOG_BINARY_ARG_INT32;
+        ++i;
+    }
+    else while (iswdigit(lpszMsgFmt[i])) {
+        ++i;
+    }
+
+    // Precision
+    bool bIsStarPrecision = false;
+    if (L'.' == lpszMsgFmt[i])
+    {
+        ++i;
+        if (L'*' == lpszMsgFmt[i])
+        {
+            lpSpec->eArgTypeArr[lpSpec->ulArgCount++] = LOG_BINARY_ARG_INT32;
+            bIsStarPrecision = true;
+            ++i;
+        }
+        else
+        {
+            // Same as printf(): L"%.ls" is zero.  Intentional: Saturate.  Why?  Larger values are same as the max.
+            lpSpec->ulPrecision = 0;
+            for ( ; iswdigit(lpszMsgFmt[i]); ++i)
+            {
+                if (lpSpec->ulPrecision < LOG_BINARY_MAX_WSTR_LEN) {
+                    lpSpec->ulPrecision = 10U * lpSpec->ulPrecision + (size_t) (lpszMsgFmt[i] - L'0');
+                }
+            }
+            if (lpSpec->ulPrecision > LOG_BINARY_MAX_WSTR_LEN) {
+                lpSpec->ulPrecision = LOG_BINARY_MAX_WSTR_LEN;
+            }
+        }
+    }
+
+    // Length modifier: Byte size of integer arg.  Zero for none: int.  Intentional: 'h' and 'hh' are promoted to int.
+    size_t ulIntByteSize = 0;
+    bool bIsLong = false;
+    if (L'h' == lpszMsgFmt[i])
+    {
+        ++i;
+        if (L'h' == lpszMsgFmt[i]) {
+            ++i;
+        }
+    }
+    else if (L'l' == lpszMsgFmt[i])
+    {
+        ++i;
+        if (L'l' == lpszMsgFmt[i])
+        {
+            ++i;
+            ulIntByteSize = sizeof(long long);
+        }
+        else
+        {
+            // Intentional: sizeof(long).  Why?  4 bytes on Windows, but 8 bytes on Linux.
+            ulIntByteSize = sizeof(long);
+            bIsLong = true;
+        }
+    }
+    else if (L'z' == lpszMsgFmt[i] || L't' == lpszMsgFmt[i])
+    {
+        ++i;
+        ulIntByteSize = sizeof(size_t);
+    }
+    else if (L'j' == lpszMsgFmt[i])
+    {
+        ++i;
+        ulIntByteSize = sizeof(intmax_t);
+    }
+    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/format-specification-syntax-printf-and-wprintf-functions?view=msvc-170#size-prefixes-for-printf-and-wprintf-format-type-specifiers
+    else if (L'I' == lpszMsgFmt[i])
+    {
+        ++i;
+        if (0 == wcsncmp(L"64", lpszMsgFmt + i, 2U))
+        {
+            i += 2U;
+            ulIntByteSize = 8U;
+        }
+        else if (0 == wcsncmp(L"32", lpszMsgFmt + i, 2U))
+        {
+            i += 2U;
+            ulIntByteSize = 4U;
+        }
+        else {
+            ulIntByteSize = sizeof(size_t);
+        }
+    }
+    else if (L'L' == lpszMsgFmt[i])
+    {
+        // Intentional: long double is not supported.  Why?  MSVCRT and MinGW disagree on its size.
+        *lpbIsSupported = false;
+        return false;
+    }
+
+    enum ELogBinaryArgType eArgType = 0;
+    switch (lpszMsgFmt[i])
+    {
+        case L'd':
+        case L'i':
+        case L'u':
+        case L'o':
+        case L'x':
+        case L'X':
+        {
+            eArgType = StaticIntArgType((0 == ulIntByteSize) ? sizeof(int) : ulIntByteSize);
+            break;
+        }
+        case L'c':
+        {
+            // int or wint_t
+            eArgType = LOG_BINARY_ARG_INT32;
+            break;
+        }
+        case L'p':
+        {
+            eArgType = LOG_BINARY_ARG_PTR;
+            break;
+        }
+        case L'e':
+        case L'E':
+        case L'f':
+        case L'F':
+        case L'g':
+        case L'G':
+        case L'a':
+        case L'A':
+        {
+            eArgType = LOG_BINARY_ARG_DOUBLE;
+            break;
+        }
+        case L's':
+        {
+            // Intentional: Only %ls.  Why?  Plain %s is narrow or wide, depending on MinGW __USE_MINGW_ANSI_STDIO.
+            if (!bIsLong)
+            {
+                *lpbIsSupported = false;
+                return false;
+            }
+            eArgType = bIsStarPrecision ? LOG_BINARY_ARG_WSTR_STAR_PRECISION : LOG_BINARY_ARG_WSTR;
+            break;
+        }
+        default:
+        {
+            // Ex: %n or '\0' at end
+            *lpbIsSupported = false;
+            return false;
+        }
+    }
+
+    lpSpec->eArgTypeArr[lpSpec->ulArgCount++] = eArgType;
+    lpSpec->ulLen = i + 1U - lpSpec->ulOffset;
+    return true;
+}
+
+bool
+LogBinaryFormatNextSpec(_In_  const wchar_t              *lpszMsgFmt,
+                        _In_  const size_t                ulOffset,
+                        _Out_ struct LogBinaryFormatSpec *lpSpec)
+{
+    bool bIsSupported = false;
+    const bool x = StaticTryNextSpec(lpszMsgFmt, ulOffset, lpSpec, &bIsSupported);
+    if (!bIsSupported) {
+        StaticUnsupportedSpecAbort(lpszMsgFmt, lpSpec->ulOffset);
+    }
+    return x;
+}
+
+/**
+ * @return true if each conversion spec is supported
+ */
+static bool
+StaticIsFormatSupported(_In_ const wchar_t *lpszMsgFmt)
+{
+    struct LogBinaryFormatSpec spec = {0};
+    bool bIsSupported = false;
+    for (size_t ulOffset = 0; StaticTryNextSpec(lpszMsgFmt, ulOffset, &spec, &bIsSupported); ulOffset = spec.ulOffset + spec.ulLen) {
+    }
+    return bIsSupported;
+}
+
+void
+LogBinaryWriterAssertValid(_In_ const struct LogBinaryWriter *lpWriter)
+{
+    assert(NULL != lpWriter);
+    assert(INVALID_HANDLE_VALUE != lpWriter->hFile);
+    assert(NULL != lpWriter->hFile);
+    assert(lpWriter->ulOpenId > 0);
+    LogBinaryFormatDynArr_AssertValid(&(lpWriter->formatDynArr));
+    assert(NULL != lpWriter->lpBufferByteArr);
+    assert(lpWriter->ulBufferByteCapacity >= LOG_BINARY_MIN_BUFFER_BYTE_SIZE);
+    assert(lpWriter->ulBufferByteSize <= lpWriter->ulBufferByteCapacity);
+}
+
+/**
+ * Copy bytes to buffer.  If buffer is too full, first flush.
+ */
+static void
+StaticWriteBytes(_Inout_ struct LogBinaryWriter *lpWriter,
+                 _In_    const void             *lpData,
+                 _In_    const size_t            ulByteSize)
+{
+    assert(ulByteSize <= lpWriter->ulBufferByteCapacity);
+
+    if (lpWriter->ulBufferByteSize + ulByteSize > lpWriter->ulBufferByteCapacity) {
+        LogBinaryWriterFlush(lpWriter);
+    }
+    memcpy(lpWriter->lpBufferByteArr + lpWriter->ulBufferByteSize, lpData, ulByteSize);
+    lpWriter->ulBufferByteSize += ulByteSize;
+}
+
+/**
+ * Write uint16_t wchar count, then wchars.  Longer than ulMaxLen are truncated.
+ */
+static void
+StaticWriteWCharArr(_Inout_ struct LogBinaryWriter *lpWriter,
+                    _In_    const wchar_t          *lpWCharArr,
+                    _In_    const size_t            ulLen)
+{
+    assert(ulLen <= UINT16_MAX);
+
+    const uint16_t usLen = (uint16_t) ulLen;
+    StaticWriteBytes(lpWriter, &usLen, sizeof(usLen));
+
+    // Intentional: Pieces.  Why?  A format string may be larger than the buffer.
+    const size_t ulMaxPieceLen = lpWriter->ulBufferByteCapacity / sizeof(wchar_t);
+    for (size_t ulOffset = 0; ulOffset < ulLen; ulOffset += ulMaxPieceLen)
+    {
+        const size_t ulRemainLen = ulLen - ulOffset;
+        const size_t ulPieceLen = (ulRemainLen < ulMaxPieceLen) ? ulRemainLen : ulMaxPieceLen;
+        StaticWriteBytes(lpWriter, lpWCharArr + ulOffset, ulPieceLen * sizeof(wchar_t));
+    }
+}
+
+void
+LogBinaryWriterOpen(_Out_ struct LogBinaryWriter *lpWriter,
+                    _In_  const wchar_t          *lpFilePathWCharArr,
+                    _In_  const size_t            ulBufferByteSize)
+{
+    assert(NULL != lpWriter);
+    assert(NULL != lpFilePathWCharArr);
+    assert(ulBufferByteSize >= LOG_BINARY_MIN_BUFFER_BYTE_SIZE);
+    // Intentional: WriteFile() counts with DWORD.
+    assert(ulBufferByteSize <= INT_MAX);
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    const HANDLE hFile = CreateFile(lpFilePathWCharArr,     // [in] LPCWSTR lpFileName
+                                    GENERIC_WRITE,          // [in] DWORD dwDesiredAccess
+                                    // Intentional: Allow readers.  Why?  Decode a log file while it is written.
+                                    FILE_SHARE_READ,        // [in] DWORD dwShareMode
+                                    NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
+                                    CREATE_ALWAYS,          // [in] DWORD dwCreationDisposition
+                                    FILE_ATTRIBUTE_NORMAL,  // [in] DWORD dwFlagsAndAttributes
+                                    NULL);                  // [in, optional] hTemplateFile
+    if (INVALID_HANDLE_VALUE == hFile)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                                                               // _In_ FILE          *lpStream
+                                    L"CreateFile(lpFileName[%ls], GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, ...)",  // _In_ const wchar_t *lpMessageFormat
+                                    lpFilePathWCharArr);                                                                // _In_ ...
+    }
+
+    ++ulLastOpenId;
+    *lpWriter = (struct LogBinaryWriter) {
+        .hFile                = hFile,
+        .ulOpenId             = ulLastOpenId,
+        // Intentional: Not zeroed.  Why?  Bytes are always written before flush.
+        .lpBufferByteArr      = xmalloc(ulBufferByteSize),
+        .ulBufferByteCapacity = ulBufferByteSize,
+    };
+
+    struct LogBinaryFileHeader header = {0};
+    memcpy(header.lpMagicCharArr, LOG_BINARY_MAGIC, sizeof(header.lpMagicCharArr));
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancefrequency
+    LARGE_INTEGER frequency = {0};
+    QueryPerformanceFrequency(&frequency);
+    header.llCounterFrequency = frequency.QuadPart;
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancecounter
+    LARGE_INTEGER counter = {0};
+    QueryPerformanceCounter(&counter);
+    header.llCounterAtOpen = counter.QuadPart;
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-getsystemtimeasfiletime
+    FILETIME fileTime = {0};
+    GetSystemTimeAsFileTime(&fileTime);
+    header.ullUtcFileTimeAtOpen = (((uint64_t) fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime;
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/timezoneapi/nf-timezoneapi-gettimezoneinformation
+    TIME_ZONE_INFORMATION tz = {0};
+    __attribute__((unused))
+    const DWORD dw = GetTimeZoneInformation(&tz);
+    header.lTimeZoneBias = tz.Bias;
+
+    StaticWriteBytes(lpWriter, &header, sizeof(header));
+    LogBinaryWriterAssertValid(lpWriter);
+}
+
+static void
+StaticRegisterFormat(_Inout_ struct LogBinaryWriter      *lpWriter,
+                     _Inout_ struct LogBinaryFormatCache *lpFormatCache,
+                     _In_    const wchar_t               *lpszMsgFmt)
+{
+    if (lpWriter->formatDynArr.ulSize > UINT16_MAX)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                        // _In_ FILE          *lpStream
+                                    L"LogBinary: Too many formats: Max is %u",    // _In_ const wchar_t *lpMessageFormat
+                                    (unsigned) UINT16_MAX + 1U);                  // ...
+    }
+
+    struct LogBinaryFormat format = {.lpszMsgFmt = lpszMsgFmt};
+    struct LogBinaryFormatSpec spec = {0};
+    for (size_t ulOffset = 0; LogBinaryFormatNextSpec(lpszMsgFmt, ulOffset, &spec); ulOffset = spec.ulOffset + spec.ulLen)
+    {
+        for (size_t i = 0; i < spec.ulArgCount; ++i)
+        {
+            if (format.ulArgCount == LOG_BINARY_MAX_ARG_COUNT)
+            {
+                Win32LastErrorFPrintFWAbort(stderr,                                                   // _In_ FILE          *lpStream
+                                            L"LogBinary: Too many args: Max is %u: [%ls]",           // _In_ const wchar_t *lpMessageFormat
+                                            (unsigned) LOG_BINARY_MAX_ARG_COUNT, lpszMsgFmt);       // ...
+            }
+            format.ucArgTypeArr[format.ulArgCount] = (unsigned char) spec.eArgTypeArr[i];
+            format.usMaxLenArr[format.ulArgCount] =
+                (uint16_t) ((SIZE_MAX == spec.ulPrecision) ? LOG_BINARY_MAX_WSTR_LEN : spec.ulPrecision);
+            ++(format.ulArgCount);
+        }
+    }
+
+    const size_t ulLen = wcslen(lpszMsgFmt);
+    if (ulLen > UINT16_MAX)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                      // _In_ FILE          *lpStream
+                                    L"LogBinary: Format is too long: %zu chars",  // _In_ const wchar_t *lpMessageFormat
+                                    ulLen);                                      // ...
+    }
+
+    const uint16_t usFormatId = (uint16_t) lpWriter->formatDynArr.ulSize;
+    LogBinaryFormatDynArr_Push(&(lpWriter->formatDynArr), &format);
+
+    unsigned char lpPrefixByteArr[LOG_BINARY_RECORD_PREFIX_BYTE_SIZE] = {LOG_BINARY_RECORD_FORMAT};
+    memcpy(lpPrefixByteArr + 1U, &usFormatId, sizeof(usFormatId));
+    StaticWriteBytes(lpWriter, lpPrefixByteArr, sizeof(lpPrefixByteArr));
+    StaticWriteWCharArr(lpWriter, lpszMsgFmt, ulLen);
+
+    lpFormatCache->ulOpenId   = lpWriter->ulOpenId;
+    lpFormatCache->usFormatId = usFormatId;
+}
+
+void
+LogBinaryWriterWriteF(_Inout_ struct LogBinaryWriter      *lpWriter,
+                      _Inout_ struct LogBinaryFormatCache *lpFormatCache,
+                      _In_    const wchar_t               *lpszMsgFmt,
+                      _In_    ...)
+{
+    LogBinaryWriterAssertValid(lpWriter);
+    assert(NULL != lpFormatCache);
+    assert(NULL != lpszMsgFmt);
+
+    if (lpFormatCache->ulOpenId != lpWriter->ulOpenId) {
+        StaticRegisterFormat(lpWriter, lpFormatCache, lpszMsgFmt);
+    }
+    const struct LogBinaryFormat *lpFormat = lpWriter->formatDynArr.lpElemArr + lpFormatCache->usFormatId;
+    // Important: One format per call site.
+    assert(lpFormat->lpszMsgFmt == lpszMsgFmt);
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancecounter
+    LARGE_INTEGER counter = {0};
+    QueryPerformanceCounter(&counter);
+
+    unsigned char lpPrefixByteArr[LOG_BINARY_RECORD_PREFIX_BYTE_SIZE + sizeof(int64_t)] = {LOG_BINARY_RECORD_EVENT};
+    memcpy(lpPrefixByteArr + 1U, &(lpFormatCache->usFormatId), sizeof(uint16_t));
+    memcpy(lpPrefixByteArr + LOG_BINARY_RECORD_PREFIX_BYTE_SIZE, &(counter.QuadPart), sizeof(int64_t));
+    StaticWriteBytes(lpWriter, lpPrefixByteArr, sizeof(lpPrefixByteArr));
+
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
+    va_list ap;
+    va_start(ap, lpszMsgFmt);
+    // Precision for LOG_BINARY_ARG_WSTR_STAR_PRECISION: Always the previous arg.
+    int iPrevInt32 = 0;
+    for (size_t i = 0; i < lpFormat->ulArgCount; ++i)
+    {
+        switch ((enum ELogBinaryArgType) lpFormat->ucArgTypeArr[i])
+        {
+            case LOG_BINARY_ARG_INT32:
+            {
+                const int32_t x = va_arg(ap, int);
+                StaticWriteBytes(lpWriter, &x, sizeof(x));
+                iPrevInt32 = x;
+                break;
+            }
+            case LOG_BINARY_ARG_INT64:
+            {
+                const int64_t x = va_arg(ap, long long);
+                StaticWriteBytes(lpWriter, &x, sizeof(x));
+                break;
+            }
+            case LOG_BINARY_ARG_DOUBLE:
+            {
+                const double x = va_arg(ap, double);
+                StaticWriteBytes(lpWriter, &x, sizeof(x));
+                break;
+            }
+            case LOG_BINARY_ARG_PTR:
+            {
+                const uint64_t x = (uintptr_t) va_arg(ap, void *);
+                StaticWriteBytes(lpWriter, &x, sizeof(x));
+                break;
+            }
+            case LOG_BINARY_ARG_WSTR:
+            case LOG_BINARY_ARG_WSTR_STAR_PRECISION:
+            {
+                // @Nullable
+                const wchar_t *lpsz = va_arg(ap, const wchar_t *);
+                if (NULL == lpsz) {
+                    lpsz = L"(null)";
+                }
+                // Ex: 5 for L"%.5ls"
+                size_t ulMaxLen = lpFormat->usMaxLenArr[i];
+                // Intentional: Negative precision is same as none.
+                if (LOG_BINARY_ARG_WSTR_STAR_PRECISION == lpFormat->ucArgTypeArr[i] && iPrevInt32 >= 0 && (size_t) iPrevInt32 < ulMaxLen) {
+                    ulMaxLen = (size_t) iPrevInt32;
+                }
+                // Intentional: wcsnlen(), not wcslen().  Why?  With precision, lpsz need not be terminated.  Ex: struct WStrView
+                StaticWriteWCharArr(lpWriter, lpsz, wcsnlen(lpsz, ulMaxLen));
+                break;
+            }
+        }
+    }
+    va_end(ap);
+}
+
+void
+LogBinaryWriterFlush(_Inout_ struct LogBinaryWriter *lpWriter)
+{
+    LogBinaryWriterAssertValid(lpWriter);
+
+    if (0 == lpWriter->ulBufferByteSize) {
+        return;
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-writefile
+    DWORD numberOfBytesWritten = 0;
+    if (!WriteFile(lpWriter->hFile,                     // [in] HANDLE hFile
+                   lpWriter->lpBufferByteArr,           // [in] LPCVOID lpBuffer
+                   (DWORD) lpWriter->ulBufferByteSize,  // [in] DWORD nNumberOfBytesToWrite
+                   &numberOfBytesWritten,               // [out/opt] LPDWORD lpNumberOfBytesWritten
+                   NULL))                               // [in/out/opt] LPOVERLAPPED lpOverlapped
+    {
+        Win32LastErrorFPutWSAbort(stderr,                   // _In_ FILE          *lpStream
+                                  L"LogBinary: WriteFile");  // _In_ const wchar_t *lpMessage
+    }
+    if (numberOfBytesWritten != lpWriter->ulBufferByteSize)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                                      // _In_ FILE          *lpStream
+                                    L"LogBinary: WriteFile: Partial write: %lu of %zd bytes",   // _In_ const wchar_t *lpMessageFormat
+                                    numberOfBytesWritten, lpWriter->ulBufferByteSize);          // _In_ ...
+    }
+    lpWriter->ulBufferByteSize = 0;
+}
+
+void
+LogBinaryWriterClose(_Inout_ struct LogBinaryWriter *lpWriter)
+{
+    assert(NULL != lpWriter);
+
+    if (NULL != lpWriter->hFile && INVALID_HANDLE_VALUE != lpWriter->hFile)
+    {
+        LogBinaryWriterFlush(lpWriter);
+
+        if (!CloseHandle(lpWriter->hFile))
+        {
+            Win32LastErrorFPutWSAbort(stderr,                     // _In_ FILE          *lpStream
+                                      L"LogBinary: CloseHandle");  // _In_ const wchar_t *lpMessage
+        }
+    }
+    LogBinaryFormatDynArr_Free(&(lpWriter->formatDynArr));
+    xfree((void **) &(lpWriter->lpBufferByteArr));
+    *lpWriter = (struct LogBinaryWriter) {0};
+}
+
+// Decoder: Format id is index.
+DYN_ARR_DECLARE(LogBinaryFormatWStrDynArr, struct WStr)
+DYN_ARR_DEFINE(LogBinaryFormatWStrDynArr, struct WStr, WStrMove)
+
+struct LogBinaryReader
+{
+    const unsigned char *lpByteArr;
+    size_t               ulByteSize;
+    size_t               ulOffset;
+};
+
+/**
+ * @return false if fewer than ulByteSize bytes remain
+ */
+static bool
+StaticReadBytes(_Inout_ struct LogBinaryReader *lpReader,
+                _Out_   void                   *lpData,
+                _In_    const size_t            ulByteSize)
+{
+    if (lpReader->ulByteSize - lpReader->ulOffset < ulByteSize) {
+        return false;
+    }
+    // Intentional: memcpy().  Why?  Data is not aligned.
+    memcpy(lpData, lpReader->lpByteArr + lpReader->ulOffset, ulByteSize);
+    lpReader->ulOffset += ulByteSize;
+    return true;
+}
+
+/**
+ * Read uint16_t wchar count, then wchars, then append final '\0' char.
+ *
+ * @param ulMaxLen
+ *        excluding final '\0' char
+ */
+static bool
+StaticReadWCharArr(_Inout_ struct LogBinaryReader *lpReader,
+                   _Out_   wchar_t                *lpWCharArr,
+                   _In_    const size_t            ulMaxLen,
+                   _Out_   size_t                 *lpLen)
+{
+    uint16_t usLen = 0;
+    if (!StaticReadBytes(lpReader, &usLen, sizeof(usLen)) || usLen > ulMaxLen
+        || !StaticReadBytes(lpReader, lpWCharArr, usLen * sizeof(wchar_t)))
+    {
+        return false;
+    }
+    lpWCharArr[usLen] = L'\0';
+    *lpLen = usLen;
+    return true;
+}
+
+/**
+ * Convert counter to local time, per file header.
+ */
+static void
+StaticLocalTime(_In_  const struct LogBinaryFileHeader *lpHeader,
+                _In_  const int64_t                     llCounter,
+                _Out_ SYSTEMTIME                       *lpLocalTime)
+{
+    const int64_t llDelta     = llCounter - lpHeader->llCounterAtOpen;
+    const int64_t llFrequency = lpHeader->llCounterFrequency;
+    // Intentional: Split.  Why?  (llDelta * LOG_BINARY_FILE_TIME_PER_SECOND) may overflow.
+    const int64_t llDeltaFileTime = (llDelta / llFrequency) * LOG_BINARY_FILE_TIME_PER_SECOND
+                                    + ((llDelta % llFrequency) * LOG_BINARY_FILE_TIME_PER_SECOND) / llFrequency;
+    // UTC = local time + bias
+    const int64_t llBiasFileTime = ((int64_t) lpHeader->lTimeZoneBias) * 60 * LOG_BINARY_FILE_TIME_PER_SECOND;
+    const uint64_t ullLocalFileTime = lpHeader->ullUtcFileTimeAtOpen + llDeltaFileTime - llBiasFileTime;
+
+    const FILETIME fileTime = {
+        .dwLowDateTime  = (DWORD) ullLocalFileTime,
+        .dwHighDateTime = (DWORD) (ullLocalFileTime >> 32),
+    };
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/timezoneapi/nf-timezoneapi-filetimetosystemtime
+    if (!FileTimeToSystemTime(&fileTime,     // [in]  const FILETIME *lpFileTime
+                              lpLocalTime))  // [out] LPSYSTEMTIME   lpSystemTime
+    {
+        Win32LastErrorFPutWSAbort(stderr,                    // _In_ FILE          *lpStream
+                                  L"FileTimeToSystemTime");  // _In_ const wchar_t *lpMessage
+    }
+}
+
+// Intentional: Macro, not function.  Why?  Value type differs per case.  Args before value are '*' width and precision.
+#define LOG_BINARY_TRY_APPEND_F(lpWStrBuilder, lpSpecWCharArr, ulArgCount, iStarArr, value) \
+    ((1U == (ulArgCount)) ? WStrBuilderTryAppendF((lpWStrBuilder), (lpSpecWCharArr), (value)) \
+     : (2U == (ulArgCount)) ? WStrBuilderTryAppendF((lpWStrBuilder), (lpSpecWCharArr), (iStarArr)[0], (value)) \
+     : WStrBuilderTryAppendF((lpWStrBuilder), (lpSpecWCharArr), (iStarArr)[0], (iStarArr)[1], (value)))
+
+/**
+ * Read args of one event, then append formatted message.  Each conversion spec is formatted separately.
+ *
+ * @return false if bytes are truncated, or a conversion spec is unsupported
+ */
+static bool
+StaticDecodeEvent(_Inout_ struct LogBinaryReader *lpReader,
+                  _In_    const wchar_t          *lpszMsgFmt,
+                  _Inout_ struct WStrBuilder     *lpWStrBuilder)
+{
+    struct LogBinaryFormatSpec spec = {0};
+    bool bIsSupported = false;
+    size_t ulOffset = 0;
+    for ( ; StaticTryNextSpec(lpszMsgFmt, ulOffset, &spec, &bIsSupported); ulOffset = spec.ulOffset + spec.ulLen)
+    {
+        WStrBuilderAppendWCharArr(lpWStrBuilder, lpszMsgFmt + ulOffset, spec.ulOffset - ulOffset);
+        if (0 == spec.ulArgCount)
+        {
+            // L"%%"
+            WStrBuilderAppendWCharArr(lpWStrBuilder, L"%", 1U);
+            continue;
+        }
+
+        // Ex: L"%-5d" or L"%.*ls"
+        wchar_t lpSpecWCharArr[32];
+        if (spec.ulLen >= sizeof(lpSpecWCharArr) / sizeof(lpSpecWCharArr[0])) {
+            return false;
+        }
+        wmemcpy(lpSpecWCharArr, lpszMsgFmt + spec.ulOffset, spec.ulLen);
+        lpSpecWCharArr[spec.ulLen] = L'\0';
+
+        int32_t iStarArr[2] = {0};
+        for (size_t i = 0; i + 1U < spec.ulArgCount; ++i)
+        {
+            if (!StaticReadBytes(lpReader, iStarArr + i, sizeof(int32_t))) {
+                return false;
+            }
+        }
+
+        bool bIsAppended = false;
+        switch (spec.eArgTypeArr[spec.ulArgCount - 1U])
+        {
+            case LOG_BINARY_ARG_INT32:
+            {
+                int32_t x = 0;
+                if (!StaticReadBytes(lpReader, &x, sizeof(x))) {
+                    return false;
+                }
+                bIsAppended = LOG_BINARY_TRY_APPEND_F(lpWStrBuilder, lpSpecWCharArr, spec.ulArgCount, iStarArr, (int) x);
+                break;
+            }
+            case LOG_BINARY_ARG_INT64:
+            {
+                int64_t x = 0;
+                if (!StaticReadBytes(lpReader, &x, sizeof(x))) {
+                    return false;
+                }
+                bIsAppended = LOG_BINARY_TRY_APPEND_F(lpWStrBuilder, lpSpecWCharArr, spec.ulArgCount, iStarArr, (long long) x);
+                break;
+            }
+            case LOG_BINARY_ARG_DOUBLE:
+            {
+                double x = 0;
+                if (!StaticReadBytes(lpReader, &x, sizeof(x))) {
+                    return false;
+                }
+                bIsAppended = LOG_BINARY_TRY_APPEND_F(lpWStrBuilder, lpSpecWCharArr, spec.ulArgCount, iStarArr, x);
+                break;
+            }
+            case LOG_BINARY_ARG_PTR:
+            {
+                uint64_t x = 0;
+                if (!StaticReadBytes(lpReader, &x, sizeof(x))) {
+                    return false;
+                }
+                bIsAppended = LOG_BINARY_TRY_APPEND_F(lpWStrBuilder, lpSpecWCharArr, spec.ulArgCount, iStarArr, (void *) (uintptr_t) x);
+                break;
+            }
+            case LOG_BINARY_ARG_WSTR:
+            case LOG_BINARY_ARG_WSTR_STAR_PRECISION:
+            {
+                wchar_t lpWCharArr[LOG_BINARY_MAX_WSTR_LEN + LEN_NUL_CHAR];
+                size_t ulLen = 0;
+                if (!StaticReadWCharArr(lpReader, lpWCharArr, LOG_BINARY_MAX_WSTR_LEN, &ulLen)) {
+                    return false;
+                }
+                bIsAppended = LOG_BINARY_TRY_APPEND_F(lpWStrBuilder, lpSpecWCharArr, spec.ulArgCount, iStarArr, lpWCharArr);
+                break;
+            }
+        }
+        if (!bIsAppended) {
+            return false;
+        }
+    }
+    if (!bIsSupported) {
+        return false;
+    }
+    WStrBuilderAppendWCharArr(lpWStrBuilder, lpszMsgFmt + ulOffset, wcslen(lpszMsgFmt + ulOffset));
+    return true;
+}
+
+bool
+LogBinaryDecode(_In_    const unsigned char *lpByteArr,
+                _In_    const size_t         ulByteSize,
+                _Inout_ FILE                *lpOutputStream,
+                _Inout_ FILE                *lpErrorStream)
+{
+    assert(NULL != lpByteArr || 0 == ulByteSize);
+    assert(NULL != lpOutputStream);
+    assert(NULL != lpErrorStream);
+
+    struct LogBinaryReader reader = {.lpByteArr = lpByteArr, .ulByteSize = ulByteSize};
+
+    struct LogBinaryFileHeader header = {0};
+    if (!StaticReadBytes(&reader, &header, sizeof(header))
+        || 0 != memcmp(LOG_BINARY_MAGIC, header.lpMagicCharArr, sizeof(header.lpMagicCharArr))
+        || header.llCounterFrequency <= 0)
+    {
+        fwprintf(lpErrorStream, L"LogBinaryDecode: Invalid file header\r\n");
+        return false;
+    }
+
+    struct LogBinaryFormatWStrDynArr formatDynArr = {0};
+    wchar_t lpBufferWCharArr[1024];
+    struct WStrBuilder sb = {0};
+    WStrBuilderInitBuffer(&sb, lpBufferWCharArr, sizeof(lpBufferWCharArr) / sizeof(lpBufferWCharArr[0]));
+
+    // @Nullable
+    const wchar_t *lpszError = NULL;
+    size_t ulRecordOffset = 0;
+    while (NULL == lpszError && reader.ulOffset < reader.ulByteSize)
+    {
+        ulRecordOffset = reader.ulOffset;
+        unsigned char ucRecordType = 0;
+        uint16_t usFormatId = 0;
+        if (!StaticReadBytes(&reader, &ucRecordType, sizeof(ucRecordType)) || !StaticReadBytes(&reader, &usFormatId, sizeof(usFormatId)))
+        {
+            lpszError = L"Truncated record";
+        }
+        else if (LOG_BINARY_RECORD_FORMAT == ucRecordType)
+        {
+            // Intentional: Ids are in order of first use.  Why?  Index of format is its id.
+            uint16_t usLen = 0;
+            if (usFormatId != formatDynArr.ulSize) {
+                lpszError = L"Format id is out of order";
+            }
+            else if (!StaticReadBytes(&reader, &usLen, sizeof(usLen)) || reader.ulByteSize - reader.ulOffset < usLen * sizeof(wchar_t)) {
+                lpszError = L"Truncated format";
+            }
+            else
+            {
+                // Intentional: Copy.  Why?  wchars in file are not aligned.
+                wchar_t *lpWCharArr = xcalloc(usLen + LEN_NUL_CHAR, sizeof(wchar_t));
+                StaticReadBytes(&reader, lpWCharArr, usLen * sizeof(wchar_t));
+                // Intentional: Check once per format, not per event.  Why?  Error offset is this record.
+                if (!StaticIsFormatSupported(lpWCharArr)) {
+                    lpszError = L"Unsupported conversion spec in format";
+                }
+                else
+                {
+                    struct WStr formatWStr = {0};
+                    WStrCopyWCharArr(&formatWStr, lpWCharArr, usLen);
+                    LogBinaryFormatWStrDynArr_Push(&formatDynArr, &formatWStr);
+                }
+                xfree((void **) &lpWCharArr);
+            }
+        }
+        else if (LOG_BINARY_RECORD_EVENT == ucRecordType)
+        {
+            int64_t llCounter = 0;
+            if (usFormatId >= formatDynArr.ulSize) {
+                lpszError = L"Unknown format id";
+            }
+            else if (!StaticReadBytes(&reader, &llCounter, sizeof(llCounter))) {
+                lpszError = L"Truncated event";
+            }
+            else
+            {
+                SYSTEMTIME localTime = {0};
+                StaticLocalTime(&header, llCounter, &localTime);
+                WStrBuilderClear(&sb);
+                LogAppendPrefixWithBias(&localTime, header.lTimeZoneBias, &sb);
+                if (!StaticDecodeEvent(&reader, formatDynArr.lpElemArr[usFormatId].lpWCharArr, &sb)) {
+                    lpszError = L"Truncated event args";
+                }
+                else
+                {
+                    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fputs-fputws?view=msvc-170
+                    fputws(sb.lpWCharArr, lpOutputStream);
+                }
+            }
+        }
+        else {
+            lpszError = L"Unknown record type";
+        }
+    }
+
+    if (NULL != lpszError) {
+        fwprintf(lpErrorStream, L"LogBinaryDecode: %ls at offset %zu of %zu bytes\r\n", lpszError, ulRecordOffset, ulByteSize);
+    }
+
+    for (size_t i = 0; i < formatDynArr.ulSize; ++i) {
+        WStrFree(formatDynArr.lpElemArr + i);
+    }
+    LogBinaryFormatWStrDynArr_Free(&formatDynArr);
+    WStrBuilderFree(&sb);
+
+    const bool x = (NULL == lpszError);
+    return x;
+}
@@ -0,0 +1,211 @@
+#ifndef H_COMMON_LOG_BINARY
+#define H_COMMON_LOG_BINARY
+
+#include "win32.h"
+#include "dyn_arr.h"
+#include <sal.h>     // required for _In_
+#include <stddef.h>  // required for size_t
+#include <stdint.h>  // required for uint16_t
+#include <stdio.h>   // required for FILE
+
+// Binary log: Deferred formatting for hot paths.  Each call appends a timestamp counter, a format id, and the raw args
+// to a buffer: No printf, no clock-to-text.  Text is rendered later, by LogBinaryDecode(), the same as LogWF().
+// See: tool/log_binary_decode.c
+// Not thread-safe: One writer per thread.  Format strings must be literals: Only the pointer is kept.
+// Intentional: Not (yet) used by keyboard hooks in passport and send_input.  Why?  They log with LogWF() to the async
+// ring buffer: No I/O on the hook thread, and lines are readable without a decoder.  See: bench/log_binary_bench.c
+// Ex:
+// struct LogBinaryWriter writer = {0};
+// LogBinaryWriterOpen(&writer, L"passport.binlog", LOG_BINARY_DEFAULT_BUFFER_BYTE_SIZE);
+// LOG_BINARY_WF(&writer, L"INFO: vkCode:%u, flags:0x%x\r\n", info->vkCode, info->flags);
+// LogBinaryWriterClose(&writer);
+//
+// File format: All integers are little-endian, and not aligned.
+// struct LogBinaryFileHeader, then zero or more records.  Each record starts with one byte: enum ELogBinaryRecordType
+// LOG_BINARY_RECORD_FORMAT: uint16_t format id, uint16_t wchar count, then wchars of format (no '\0')
+// LOG_BINARY_RECORD_EVENT:  uint16_t format id, int64_t QueryPerformanceCounter(), then args, per format.
+//                           Integers are 4 or 8 bytes, doubles are 8 bytes, pointers are 8 bytes.
+//                           Each %ls is uint16_t wchar count, then wchars (no '\0').
+
+#define LOG_BINARY_MAGIC                    "WLOGBIN1"
+#define LOG_BINARY_DEFAULT_BUFFER_BYTE_SIZE (64U * 1024U)
+// Intentional: Larger than longest arg.  Why?  Each arg is copied to buffer in one piece.
+#define LOG_BINARY_MIN_BUFFER_BYTE_SIZE     (4U * 1024U)
+// Max args per format, including '*' width and precision
+#define LOG_BINARY_MAX_ARG_COUNT            16U
+// Longer %ls args are truncated.
+#define LOG_BINARY_MAX_WSTR_LEN             1024U
+
+struct LogBinaryFileHeader
+{
+    // LOG_BINARY_MAGIC without final '\0' char
+    char     lpMagicCharArr[8];
+    // From QueryPerformanceFrequency(): Counts per second
+    int64_t  llCounterFrequency;
+    // From QueryPerformanceCounter() at open
+    int64_t  llCounterAtOpen;
+    // From GetSystemTimeAsFileTime() at open: UTC in 100-nanosecond intervals since 1601-01-01
+    uint64_t ullUtcFileTimeAtOpen;
+    // From GetTimeZoneInformation() at open.  Minutes: UTC = local time + bias
+    int32_t  lTimeZoneBias;
+    uint32_t ulReserved;
+};
+
+enum ELogBinaryRecordType
+{
+    LOG_BINARY_RECORD_FORMAT = 1,
+    LOG_BINARY_RECORD_EVENT  = 2,
+};
+
+enum ELogBinaryArgType
+{
+    // int, unsigned, and wint_t; also '*' width and precision
+    LOG_BINARY_ARG_INT32  = 1,
+    // long long, size_t, etc.
+    LOG_BINARY_ARG_INT64  = 2,
+    LOG_BINARY_ARG_DOUBLE = 3,
+    LOG_BINARY_ARG_PTR    = 4,
+    // const wchar_t *: %ls; with literal precision, ex: %.5ls, need not be terminated
+    LOG_BINARY_ARG_WSTR   = 5,
+    // const wchar_t *: %.*ls; length is at most previous '*' precision arg, so need not be terminated
+    LOG_BINARY_ARG_WSTR_STAR_PRECISION = 6,
+};
+
+// One conversion spec in a format string.  Ex: L"%-5d" or L"%.*ls"
+struct LogBinaryFormatSpec
+{
+    // Offset of '%'
+    size_t                 ulOffset;
+    // Including '%' and conversion char.  Ex: 4 for L"%-5d"
+    size_t                 ulLen;
+    // '*' width, '*' precision, then value.  Empty for L"%%".
+    enum ELogBinaryArgType eArgTypeArr[3];
+    size_t                 ulArgCount;
+    // Literal precision, at most LOG_BINARY_MAX_WSTR_LEN.  Ex: 5 for L"%.5ls"  SIZE_MAX if none or '*'.
+    size_t                 ulPrecision;
+};
+
+struct LogBinaryFormat
+{
+    // Format string literal from caller.  Not copied.
+    const wchar_t *lpszMsgFmt;
+    unsigned char  ucArgTypeArr[LOG_BINARY_MAX_ARG_COUNT];
+    // Max wchars to read for each LOG_BINARY_ARG_WSTR: Literal precision or LOG_BINARY_MAX_WSTR_LEN.  Else unused.
+    uint16_t       usMaxLenArr[LOG_BINARY_MAX_ARG_COUNT];
+    size_t         ulArgCount;
+};
+
+DYN_ARR_DECLARE(LogBinaryFormatDynArr, struct LogBinaryFormat)
+
+struct LogBinaryWriter
+{
+    HANDLE         hFile;
+    // Unique for each open.  Why?  Cached format ids are only valid for one file.  See: struct LogBinaryFormatCache
+    size_t         ulOpenId;
+    // Index is format id
+    struct LogBinaryFormatDynArr formatDynArr;
+    // Bytes not yet written
+    unsigned char *lpBufferByteArr;
+    size_t         ulBufferByteSize;
+    size_t         ulBufferByteCapacity;
+};
+
+// Format id for one call site.  See: LOG_BINARY_WF()
+struct LogBinaryFormatCache
+{
+    // Zero if never registered
+    size_t   ulOpenId;
+    uint16_t usFormatId;
+};
+
+/**
+ * Append one event.  First call for each writer also appends format record.
+ *
+ * @param lpWriter
+ *        struct LogBinaryWriter *
+ *
+ * @param lpszMsgFmt
+ *        string literal; same as LogWF(), but plain %s, %n, and %Lf are not allowed (abort())
+ *        ex: L"INFO: vkCode:%u\r\n"
+ */
+#define LOG_BINARY_WF(/* struct LogBinaryWriter * */ lpWriter, /* const wchar_t * */ lpszMsgFmt, ...) \
+    do { \
+        static struct LogBinaryFormatCache formatCache = {0}; \
+        LogBinaryWriterWriteF((lpWriter), &formatCache, (lpszMsgFmt), ##__VA_ARGS__); \
+    } while (0)
+
+/**
+ * Find next conversion spec.  On unsupported spec, abort() is called: A bug at the call site.
+ * Intentional: LogBinaryDecode() never calls abort() for an unsupported spec.  Why?  Format is from a file.
+ *
+ * @param ulOffset
+ *        offset in lpszMsgFmt to start search
+ *
+ * @return false if no more conversion specs
+ */
+bool
+LogBinaryFormatNextSpec(_In_  const wchar_t              *lpszMsgFmt,
+                        _In_  const size_t                ulOffset,
+                        _Out_ struct LogBinaryFormatSpec *lpSpec);
+
+void
+LogBinaryWriterAssertValid(_In_ const struct LogBinaryWriter *lpWriter);
+
+/**
+ * Create new file or truncate existing file, then write file header.  On error, abort() is called.
+ *
+ * @param ulBufferByteSize
+ *        usually LOG_BINARY_DEFAULT_BUFFER_BYTE_SIZE
+ *        must be at least LOG_BINARY_MIN_BUFFER_BYTE_SIZE
+ */
+void
+LogBinaryWriterOpen(_Out_ struct LogBinaryWriter *lpWriter,
+                    _In_  const wchar_t          *lpFilePathWCharArr,
+                    _In_  const size_t            ulBufferByteSize);
+
+/**
+ * Do not call directly: Use LOG_BINARY_WF().  Args are copied to buffer; when buffer is full, it is written to file.
+ */
+void
+LogBinaryWriterWriteF(_Inout_ struct LogBinaryWriter      *lpWriter,
+                      _Inout_ struct LogBinaryFormatCache *lpFormatCache,
+                      _In_    const wchar_t               *lpszMsgFmt,
+                      _In_    ...);
+
+/**
+ * Write buffer to file with WriteFile().  On error, abort() is called.
+ */
+void
+LogBinaryWriterFlush(_Inout_ struct LogBinaryWriter *lpWriter);
+
+/**
+ * Call LogBinaryWriterFlush(), then close file and free buffer.  Safe to call for zero-initialised lpWriter.
+ */
+void
+LogBinaryWriterClose(_Inout_ struct LogBinaryWriter *lpWriter);
+
+/**
+ * Render all records as text lines, the same as LogWF(): "2022-03-10 22:17:47.123 +09:00 " + message.
+ * Time zone is from file header, not this computer.
+ *
+ * @param lpByteArr
+ *        all bytes of file, including header
+ *
+ * @param lpOutputStream
+ *        usually stdout
+ *
+ * @param lpErrorStream
+ *        usually stderr
+ *
+ * @return true on success
+ *         false if bytes are invalid, e.g., unsupported conversion spec in a format record, or truncated, e.g., after
+ *         a crash; all lines before error are written,
+ *         then error is printed to lpErrorStream
+ */
+bool
+LogBinaryDecode(_In_    const unsigned char *lpByteArr,
+                _In_    const size_t         ulByteSize,
+                _Inout_ FILE                *lpOutputStream,
+                _Inout_ FILE                *lpErrorStream);
+
+#endif  // H_COMMON_LOG_BINARY
@@ -0,0 +1,672 @@
+#include "log_file.h"
+#include "log.h"
+#include "wstr_utf8.h"
+#include "xmalloc.h"
+#include "win32_last_error.h"
+#include <string.h>  // required for memmove()
+#include <wchar.h>   // required for wcslen()
+#include <signal.h>  // required for signal()
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW and atexit()
+#include <limits.h>  // required for INT_MAX
+
+// Ex: L".999"  See: LOG_FILE_MAX_RETENTION_COUNT
+#define LOG_FILE_ROTATE_SUFFIX_MAX_LEN 4U
+
+// U+FFFD REPLACEMENT CHARACTER as UTF-8.  Written for each unpaired surrogate.
+#define LOG_FILE_REPLACEMENT_CHAR_UTF8 "\xEF\xBF\xBD"
+
+_Static_assert(sizeof(LOG_FILE_REPLACEMENT_CHAR_UTF8) - 1U <= WSTR_UTF8_MAX_BYTES_PER_WCHAR,
+               "LOG_FILE_REPLACEMENT_CHAR_UTF8 must fit in space for one wchar");
+
+static struct Global
+{
+    // Open files for crash-safe flush.  NULL if slot is free.
+    struct LogFile               *lpLogFileArr[LOG_FILE_MAX_OPEN_COUNT];
+    bool                          bIsCrashHandlerInstalled;
+    // @Nullable
+    LPTOP_LEVEL_EXCEPTION_FILTER  lpPrevExceptionFilter;
+    // Ex: SIG_DFL
+    void                        (*lpPrevSignalHandler)(int);
+}
+global = {0};
+
+void
+LogFileAssertValid(_In_ const struct LogFile *lpLogFile)
+{
+    assert(NULL != lpLogFile);
+    assert(NULL != lpLogFile->hFile && INVALID_HANDLE_VALUE != lpLogFile->hFile);
+    assert(lpLogFile->config.lpFilePathWCharArr == lpLogFile->lpFilePathWCharArr);
+    assert(NULL != lpLogFile->lpRotateFromPathWCharArr);
+    assert(NULL != lpLogFile->lpRotateToPathWCharArr);
+    assert(NULL != lpLogFile->lpBufferCharArr);
+    assert(lpLogFile->ulBufferByteSize <= lpLogFile->config.ulBufferByteSize);
+}
+
+/**
+ * Each public function that changes buffer or file is one write: Crash handlers skip a file during a write.
+ */
+static void
+StaticBeginWrite(_Inout_ struct LogFile *lpLogFile)
+{
+    atomic_store(&(lpLogFile->bIsWriteInProgress), true);
+}
+
+static void
+StaticEndWrite(_Inout_ struct LogFile *lpLogFile)
+{
+    atomic_store(&(lpLogFile->bIsWriteInProgress), false);
+}
+
+/**
+ * Crash handlers and exit() only.  Best effort: Errors are ignored.  Why?  Process is already dying.
+ * <p>
+ * Intentional: Skip a file during a write, on any thread.  Why?  Buffer size may not match bytes: A line could be torn
+ * or written twice.  Usually, writer is the async log background thread: Its crash handler waits first.  See: log_async.h
+ */
+static void
+StaticCrashFlushAll()
+{
+    for (size_t i = 0; i < LOG_FILE_MAX_OPEN_COUNT; ++i)
+    {
+        struct LogFile *lpLogFile = global.lpLogFileArr[i];
+        bool bExpected = false;
+        if (NULL != lpLogFile
+            && atomic_compare_exchange_strong(&(lpLogFile->bIsWriteInProgress), &bExpected, true))
+        {
+            if (lpLogFile->ulBufferByteSize > 0)
+            {
+                // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-writefile
+                DWORD numberOfBytesWritten = 0;
+                WriteFile(lpLogFile->hFile,                     // [in] HANDLE hFile
+                          lpLogFile->lpBufferCharArr,           // [in] LPCVOID lpBuffer
+                          (DWORD) lpLogFile->ulBufferByteSize,  // [in] DWORD nNumberOfBytesToWrite
+                          &numberOfBytesWritten,                // [out/opt] LPDWORD lpNumberOfBytesWritten
+                          NULL);                                // [in/out/opt] LPOVERLAPPED lpOverlapped
+                lpLogFile->ulBufferByteSize = 0;
+            }
+            StaticEndWrite(lpLogFile);
+        }
+    }
+}
+
+// Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/signal?view=msvc-170
+// Intentional: SIGABRT.  Why?  All *Abort() functions in this repo call abort().
+static void
+StaticSignalHandler(_In_ const int iSignal)
+{
+    StaticCrashFlushAll();
+
+    // Intentional: Restore previous handler, then return.  Why?  After handler returns, abort() exits the process.
+    void (*lpPrevSignalHandler)(int) = global.lpPrevSignalHandler;
+    signal(SIGABRT, lpPrevSignalHandler);
+    if (SIG_DFL != lpPrevSignalHandler && SIG_IGN != lpPrevSignalHandler && SIG_ERR != lpPrevSignalHandler) {
+        lpPrevSignalHandler(iSignal);
+    }
+}
+
+// Ref: https://learn.microsoft.com/en-us/windows/win32/api/errhandlingapi/nf-errhandlingapi-setunhandledexceptionfilter
+// Ex: Access violation or stack overflow
+static LONG WINAPI
+StaticUnhandledExceptionFilter(_In_ PEXCEPTION_POINTERS lpExceptionInfo)
+{
+    StaticCrashFlushAll();
+
+    if (NULL != global.lpPrevExceptionFilter) {
+        return global.lpPrevExceptionFilter(lpExceptionInfo);
+    }
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+
+static void
+StaticRegister(_In_ struct LogFile *lpLogFile)
+{
+    if (!global.bIsCrashHandlerInstalled)
+    {
+        global.lpPrevSignalHandler = signal(SIGABRT, StaticSignalHandler);
+        global.lpPrevExceptionFilter = SetUnhandledExceptionFilter(StaticUnhandledExceptionFilter);  // [in] LPTOP_LEVEL_EXCEPTION_FILTER lpTopLevelExceptionFilter
+        // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/atexit?view=msvc-170
+        // Intentional: Usually registered before atexit(LogAsyncStop).  Why?  Handlers run in reverse: Async log first.
+        if (0 != atexit(StaticCrashFlushAll))
+        {
+            Win32LastErrorFPutWSAbort(stderr,                   // _In_ FILE          *lpStream
+                                      L"LogFile: atexit");      // _In_ const wchar_t *lpMessage
+        }
+        global.bIsCrashHandlerInstalled = true;
+    }
+
+    for (size_t i = 0; i < LOG_FILE_MAX_OPEN_COUNT; ++i)
+    {
+        if (NULL == global.lpLogFileArr[i])
+        {
+            global.lpLogFileArr[i] = lpLogFile;
+            return;
+        }
+    }
+    Win32LastErrorFPrintFWAbort(stderr,                                                  // _In_ FILE          *lpStream
+                                L"LogFile: Too many open files: Max: %u: Path: [%ls]",  // _In_ const wchar_t *lpMessageFormat
+                                LOG_FILE_MAX_OPEN_COUNT, lpLogFile->lpFilePathWCharArr);  // _In_ ...
+}
+
+static void
+StaticUnregister(_In_ const struct LogFile *lpLogFile)
+{
+    for (size_t i = 0; i < LOG_FILE_MAX_OPEN_COUNT; ++i)
+    {
+        if (lpLogFile == global.lpLogFileArr[i])
+        {
+            global.lpLogFileArr[i] = NULL;
+            return;
+        }
+    }
+}
+
+/**
+ * @param dwCreationDisposition
+ *        OPEN_ALWAYS: append, or CREATE_ALWAYS: truncate
+ */
+static void
+StaticOpenHandle(_Inout_ struct LogFile *lpLogFile,
+                 _In_    const DWORD     dwCreationDisposition)
+{
+    assert(OPEN_ALWAYS == dwCreationDisposition || CREATE_ALWAYS == dwCreationDisposition);
+
+    // Intentional: FILE_APPEND_DATA, not GENERIC_WRITE.  Why?  Each WriteFile() appends: Never overwrite if another
+    // process also appends.  FILE_READ_ATTRIBUTES is required for GetFileSizeEx().
+    const DWORD dwDesiredAccess =
+        ((CREATE_ALWAYS == dwCreationDisposition) ? GENERIC_WRITE : FILE_APPEND_DATA) | FILE_READ_ATTRIBUTES;
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    const HANDLE hFile = CreateFile(lpLogFile->lpFilePathWCharArr,  // [in] LPCWSTR lpFileName
+                                    dwDesiredAccess,                // [in] DWORD dwDesiredAccess
+                                    // Intentional: Allow readers, and rename by another process.  Why?  Tail the log
+                                    // file, or move it away, while it is written.
+                                    FILE_SHARE_READ | FILE_SHARE_DELETE,  // [in] DWORD dwShareMode
+                                    NULL,                           // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
+                                    dwCreationDisposition,          // [in] DWORD dwCreationDisposition
+                                    FILE_ATTRIBUTE_NORMAL,          // [in] DWORD dwFlagsAndAttributes
+                                    NULL);                          // [in, optional] hTemplateFile
+    if (INVALID_HANDLE_VALUE == hFile)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                                                // _In_ FILE          *lpStream
+                                    L"LogFile: CreateFile(lpFileName[%ls], 0x%lx, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, %lu, ...)",  // _In_ const wchar_t *lpMessageFormat
+                                    lpLogFile->lpFilePathWCharArr, dwDesiredAccess, dwCreationDisposition);  // _In_ ...
+    }
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getfilesizeex
+    LARGE_INTEGER fileSize = {0};
+    if (!GetFileSizeEx(hFile,       // [in]  HANDLE         hFile
+                       &fileSize))  // [out] PLARGE_INTEGER lpFileSize
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                  // _In_ FILE          *lpStream
+                                    L"LogFile: GetFileSizeEx(hFile[%ls])",  // _In_ const wchar_t *lpMessageFormat
+                                    lpLogFile->lpFilePathWCharArr);          // _In_ ...
+    }
+
+    lpLogFile->hFile = hFile;
+    lpLogFile->ullFileByteSize = (uint64_t) fileSize.QuadPart;
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-gettickcount64
+    lpLogFile->ullOpenTickCount = GetTickCount64();
+}
+
+static void
+StaticCloseHandle(_Inout_ struct LogFile *lpLogFile)
+{
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    if (!CloseHandle(lpLogFile->hFile))
+    {
+        Win32LastErrorFPutWSAbort(stderr,                   // _In_ FILE          *lpStream
+                                  L"LogFile: CloseHandle");  // _In_ const wchar_t *lpMessage
+    }
+    lpLogFile->hFile = NULL;
+}
+
+void
+LogFileOpen(_Out_ struct LogFile             *lpLogFile,
+            _In_  const struct LogFileConfig *lpConfig)
+{
+    assert(NULL != lpLogFile);
+    assert(NULL != lpConfig);
+    assert(NULL != lpConfig->lpFilePathWCharArr);
+    assert(lpConfig->ulBufferByteSize >= LOG_FILE_MIN_BUFFER_BYTE_SIZE);
+    // Intentional: WriteFile() counts with DWORD.
+    assert(lpConfig->ulBufferByteSize <= INT_MAX);
+    assert(lpConfig->ulFlushThresholdByteSize <= lpConfig->ulBufferByteSize);
+    assert(lpConfig->uRetentionCount <= LOG_FILE_MAX_RETENTION_COUNT);
+
+    const size_t ulFilePathLen = wcslen(lpConfig->lpFilePathWCharArr);
+    const size_t ulRotatePathByteSize = (ulFilePathLen + LOG_FILE_ROTATE_SUFFIX_MAX_LEN + LEN_NUL_CHAR) * sizeof(wchar_t);
+
+    *lpLogFile = (struct LogFile) {
+        .config                   = *lpConfig,
+        .lpFilePathWCharArr       = xmalloc((ulFilePathLen + LEN_NUL_CHAR) * sizeof(wchar_t)),
+        .ulFilePathLen            = ulFilePathLen,
+        .lpRotateFromPathWCharArr = xmalloc(ulRotatePathByteSize),
+        .lpRotateToPathWCharArr   = xmalloc(ulRotatePathByteSize),
+        // Intentional: Not zeroed.  Why?  Bytes are always encoded before flush.
+        .lpBufferCharArr          = xmalloc(lpConfig->ulBufferByteSize),
+    };
+    wmemcpy(lpLogFile->lpFilePathWCharArr, lpConfig->lpFilePathWCharArr, ulFilePathLen + LEN_NUL_CHAR);
+    lpLogFile->config.lpFilePathWCharArr = lpLogFile->lpFilePathWCharArr;
+
+    StaticOpenHandle(lpLogFile, OPEN_ALWAYS);
+    StaticRegister(lpLogFile);
+    LogFileAssertValid(lpLogFile);
+}
+
+static void
+StaticWriteFile(_Inout_ struct LogFile *lpLogFile,
+                _In_    const char     *lpCharArr,
+                _In_    const size_t    ulByteSize)
+{
+    if (0 == ulByteSize) {
+        return;
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-writefile
+    DWORD numberOfBytesWritten = 0;
+    if (!WriteFile(lpLogFile->hFile,       // [in] HANDLE hFile
+                   lpCharArr,              // [in] LPCVOID lpBuffer
+                   (DWORD) ulByteSize,     // [in] DWORD nNumberOfBytesToWrite
+                   &numberOfBytesWritten,  // [out/opt] LPDWORD lpNumberOfBytesWritten
+                   NULL))                  // [in/out/opt] LPOVERLAPPED lpOverlapped
+    {
+        Win32LastErrorFPutWSAbort(stderr,                 // _In_ FILE          *lpStream
+                                  L"LogFile: WriteFile");  // _In_ const wchar_t *lpMessage
+    }
+    if (numberOfBytesWritten != ulByteSize)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                                    // _In_ FILE          *lpStream
+                                    L"LogFile: WriteFile: Partial write: %lu of %zd bytes",   // _In_ const wchar_t *lpMessageFormat
+                                    numberOfBytesWritten, ulByteSize);                        // _In_ ...
+    }
+}
+
+static void
+StaticFlush(_Inout_ struct LogFile *lpLogFile)
+{
+    StaticWriteFile(lpLogFile, lpLogFile->lpBufferCharArr, lpLogFile->ulBufferByteSize);
+    lpLogFile->ulBufferByteSize = 0;
+}
+
+void
+LogFileFlush(_Inout_ struct LogFile *lpLogFile)
+{
+    LogFileAssertValid(lpLogFile);
+
+    StaticBeginWrite(lpLogFile);
+    StaticFlush(lpLogFile);
+    StaticEndWrite(lpLogFile);
+}
+
+void
+LogFileSync(_Inout_ struct LogFile *lpLogFile)
+{
+    LogFileFlush(lpLogFile);
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-flushfilebuffers
+    if (!FlushFileBuffers(lpLogFile->hFile))  // [in] HANDLE hFile
+    {
+        Win32LastErrorFPutWSAbort(stderr,                        // _In_ FILE          *lpStream
+                                  L"LogFile: FlushFileBuffers");  // _In_ const wchar_t *lpMessage
+    }
+}
+
+/**
+ * @param uIndex
+ *        zero for current file; else rotated file: "path.uIndex"
+ */
+static void
+StaticRotatePath(_In_  const struct LogFile *lpLogFile,
+                 _In_  const unsigned        uIndex,
+                 _Out_ wchar_t              *lpDestWCharArr)
+{
+    wmemcpy(lpDestWCharArr, lpLogFile->lpFilePathWCharArr, lpLogFile->ulFilePathLen + LEN_NUL_CHAR);
+    if (uIndex > 0)
+    {
+        // Intentional: Only an integer: Cannot fail or truncate.
+        swprintf(lpDestWCharArr + lpLogFile->ulFilePathLen, LOG_FILE_ROTATE_SUFFIX_MAX_LEN + LEN_NUL_CHAR, L".%u", uIndex);
+    }
+}
+
+/**
+ * @return true if moved, or lpFromPathWCharArr does not exist
+ *         false if error, and warning printed to stderr
+ */
+static bool
+StaticMoveFile(_In_ const wchar_t *lpFromPathWCharArr,
+               _In_ const wchar_t *lpToPathWCharArr)
+{
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-movefileexw
+    if (MoveFileExW(lpFromPathWCharArr,          // [in]           LPCWSTR lpExistingFileName
+                    lpToPathWCharArr,            // [in, optional] LPCWSTR lpNewFileName
+                    MOVEFILE_REPLACE_EXISTING))  // [in]           DWORD   dwFlags
+    {
+        return true;
+    }
+    const DWORD dwLastError = GetLastError();
+    if (ERROR_FILE_NOT_FOUND == dwLastError) {
+        return true;
+    }
+    // Intentional: fwprintf(), not LogWF().  Why?  LogWF() may write to this file: See: LogSetFile()
+    fwprintf(stderr, L"WARN: LogFile: MoveFileExW(%ls, %ls): GetLastError: %lu\r\n",
+             lpFromPathWCharArr, lpToPathWCharArr, dwLastError);
+    return false;
+}
+
+/**
+ * Close current file, shift rotated files, then open a new file.  Caller must write older buffered bytes first:
+ * Buffer may already have bytes for new file.
+ * <p>
+ * Intentional: Rename errors are not fatal.  Why?  Another process may have a rotated file open: Ex: A text editor
+ * If current file cannot be renamed, it is opened again for append: Rotation is tried again after the next size or age limit.
+ */
+static void
+StaticRotateNow(_Inout_ struct LogFile *lpLogFile)
+{
+    StaticCloseHandle(lpLogFile);
+
+    DWORD dwCreationDisposition = OPEN_ALWAYS;
+    if (0 == lpLogFile->config.uRetentionCount)
+    {
+        dwCreationDisposition = CREATE_ALWAYS;
+    }
+    else
+    {
+        // Oldest is replaced by MoveFileExW(MOVEFILE_REPLACE_EXISTING).
+        for (unsigned i = lpLogFile->config.uRetentionCount - 1U; i >= 1U; --i)
+        {
+            StaticRotatePath(lpLogFile, i, lpLogFile->lpRotateFromPathWCharArr);
+            StaticRotatePath(lpLogFile, i + 1U, lpLogFile->lpRotateToPathWCharArr);
+            StaticMoveFile(lpLogFile->lpRotateFromPathWCharArr, lpLogFile->lpRotateToPathWCharArr);
+        }
+        StaticRotatePath(lpLogFile, 1U, lpLogFile->lpRotateToPathWCharArr);
+        if (StaticMoveFile(lpLogFile->lpFilePathWCharArr, lpLogFile->lpRotateToPathWCharArr)) {
+            dwCreationDisposition = CREATE_ALWAYS;
+        }
+    }
+
+    StaticOpenHandle(lpLogFile, dwCreationDisposition);
+    if (OPEN_ALWAYS == dwCreationDisposition)
+    {
+        // Intentional: Reset size.  Why?  Else, each line would try to rotate again.
+        lpLogFile->ullFileByteSize = 0;
+    }
+    ++(lpLogFile->ulRotateCount);
+}
+
+static void
+StaticRotate(_Inout_ struct LogFile *lpLogFile)
+{
+    StaticFlush(lpLogFile);
+    StaticRotateNow(lpLogFile);
+}
+
+void
+LogFileRotate(_Inout_ struct LogFile *lpLogFile)
+{
+    LogFileAssertValid(lpLogFile);
+
+    StaticBeginWrite(lpLogFile);
+    StaticRotate(lpLogFile);
+    StaticEndWrite(lpLogFile);
+}
+
+static void
+StaticRotateIfTooOld(_Inout_ struct LogFile *lpLogFile,
+                     _In_    const ULONGLONG ullTickCount)
+{
+    if (0 == lpLogFile->config.dwMaxFileAgeMillis) {
+        return;
+    }
+    if (0 == lpLogFile->ullFileByteSize)
+    {
+        // Intentional: Never rotate an empty file.  Age starts at first line.
+        lpLogFile->ullOpenTickCount = ullTickCount;
+    }
+    else if (ullTickCount - lpLogFile->ullOpenTickCount >= lpLogFile->config.dwMaxFileAgeMillis)
+    {
+        StaticRotate(lpLogFile);
+    }
+}
+
+static void
+StaticFlushIfDue(_Inout_ struct LogFile *lpLogFile,
+                 _In_    const ULONGLONG ullTickCount)
+{
+    if (0 == lpLogFile->ulBufferByteSize) {
+        return;
+    }
+    const struct LogFileConfig *lpConfig = &(lpLogFile->config);
+    if ((lpConfig->ulFlushThresholdByteSize > 0 && lpLogFile->ulBufferByteSize >= lpConfig->ulFlushThresholdByteSize)
+        || (lpConfig->dwFlushIntervalMillis > 0
+            && ullTickCount - lpLogFile->ullFirstBufferedTickCount >= lpConfig->dwFlushIntervalMillis))
+    {
+        StaticFlush(lpLogFile);
+    }
+}
+
+/**
+ * Encode to end of buffer.  Caller must ensure capacity for (WSTR_UTF8_MAX_BYTES_PER_WCHAR * ulLen) bytes.
+ */
+static void
+StaticEncode(_Inout_ struct LogFile *lpLogFile,
+             _In_    const wchar_t  *lpWCharArr,
+             _In_    const size_t    ulLen,
+             _In_    const ULONGLONG ullTickCount)
+{
+    assert(lpLogFile->ulBufferByteSize + WSTR_UTF8_MAX_BYTES_PER_WCHAR * ulLen <= lpLogFile->config.ulBufferByteSize);
+
+    if (0 == lpLogFile->ulBufferByteSize) {
+        lpLogFile->ullFirstBufferedTickCount = ullTickCount;
+    }
+
+    size_t ulOffset = 0;
+    while (true)
+    {
+        size_t ulDestByteSize = 0;
+        size_t ulInvalidOffset = 0;
+        const bool bIsValid = WStrUtf8Encode(lpWCharArr + ulOffset,                                     // _In_  const wchar_t *lpWCharArr
+                                             ulLen - ulOffset,                                          // _In_  const size_t   ulSize
+                                             lpLogFile->lpBufferCharArr + lpLogFile->ulBufferByteSize,  // _Out_ char          *lpDestCharArr
+                                             &ulDestByteSize,                                           // _Out_ size_t        *lpulDestByteSize
+                                             &ulInvalidOffset);                                         // _Out_ size_t        *lpulInvalidOffset
+        lpLogFile->ulBufferByteSize += ulDestByteSize;
+        if (bIsValid) {
+            break;
+        }
+        // Intentional: Replace, not abort().  Why?  A log line may include any text from another process: Ex: Window title
+        const size_t ulReplacementByteSize = sizeof(LOG_FILE_REPLACEMENT_CHAR_UTF8) - 1U;
+        memcpy(lpLogFile->lpBufferCharArr + lpLogFile->ulBufferByteSize, LOG_FILE_REPLACEMENT_CHAR_UTF8, ulReplacementByteSize);
+        lpLogFile->ulBufferByteSize += ulReplacementByteSize;
+        ulOffset += ulInvalidOffset + 1U;
+    }
+}
+
+/**
+ * @param ulLineByteSize
+ *        encoded size of next line
+ */
+static bool
+StaticIsTooLarge(_In_ const struct LogFile *lpLogFile,
+                 _In_ const size_t          ulLineByteSize)
+{
+    const uint64_t ullMaxFileByteSize = lpLogFile->config.ullMaxFileByteSize;
+    const bool x = (ullMaxFileByteSize > 0
+                    // Intentional: Never rotate an empty file.  Why?  Line is larger than max file size.
+                    && lpLogFile->ullFileByteSize > 0
+                    && lpLogFile->ullFileByteSize + ulLineByteSize > ullMaxFileByteSize);
+    return x;
+}
+
+// Intentional: At least two wchars per chunk.  Why?  StaticWriteLongLine() may back off one wchar for a surrogate pair.
+_Static_assert(LOG_FILE_MIN_BUFFER_BYTE_SIZE >= 2U * WSTR_UTF8_MAX_BYTES_PER_WCHAR, "LOG_FILE_MIN_BUFFER_BYTE_SIZE");
+
+/**
+ * Line is too long to encode at once: Write in pieces.
+ */
+static void
+StaticWriteLongLine(_Inout_ struct LogFile *lpLogFile,
+                    _In_    const wchar_t  *lpWCharArr,
+                    _In_    const size_t    ulLen,
+                    _In_    const ULONGLONG ullTickCount)
+{
+    // Intentional: Upper bound of encoded size.  Why?  Exact size is only known after encode, but buffer is too small.
+    if (StaticIsTooLarge(lpLogFile, WSTR_UTF8_MAX_BYTES_PER_WCHAR * ulLen)) {
+        StaticRotate(lpLogFile);
+    }
+
+    const size_t ulMaxChunkLen = lpLogFile->config.ulBufferByteSize / WSTR_UTF8_MAX_BYTES_PER_WCHAR;
+    size_t ulOffset = 0;
+    while (ulOffset < ulLen)
+    {
+        StaticFlush(lpLogFile);
+
+        size_t ulChunkLen = ulLen - ulOffset;
+        if (ulChunkLen > ulMaxChunkLen)
+        {
+            ulChunkLen = ulMaxChunkLen;
+            // Intentional: Do not split a surrogate pair.  Why?  Each half would be replaced with U+FFFD.
+            const unsigned lastWChar = (unsigned) lpWCharArr[ulOffset + ulChunkLen - 1U];
+            if (lastWChar >= 0xD800U && lastWChar <= 0xDBFFU) {
+                --ulChunkLen;
+            }
+        }
+        // Else loop never ends.  Never true: See _Static_assert for LOG_FILE_MIN_BUFFER_BYTE_SIZE.
+        assert(ulChunkLen > 0);
+        StaticEncode(lpLogFile, lpWCharArr + ulOffset, ulChunkLen, ullTickCount);
+        lpLogFile->ullFileByteSize += lpLogFile->ulBufferByteSize;
+        ulOffset += ulChunkLen;
+    }
+}
+
+void
+LogFileWriteLine(_Inout_ struct LogFile *lpLogFile,
+                 _In_    const wchar_t  *lpWCharArr,
+                 _In_    const size_t    ulLen)
+{
+    LogFileAssertValid(lpLogFile);
+    assert(NULL != lpWCharArr || 0 == ulLen);
+
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-gettickcount64
+    // Intentional: GetTickCount64(), not GetLocalTime().  Why?  Cheap, and never jumps when clock is adjusted.
+    const ULONGLONG ullTickCount = GetTickCount64();
+    StaticBeginWrite(lpLogFile);
+    StaticRotateIfTooOld(lpLogFile, ullTickCount);
+
+    const size_t ulMaxLineByteSize = WSTR_UTF8_MAX_BYTES_PER_WCHAR * ulLen;
+    if (ulMaxLineByteSize > lpLogFile->config.ulBufferByteSize)
+    {
+        StaticWriteLongLine(lpLogFile, lpWCharArr, ulLen, ullTickCount);
+    }
+    else
+    {
+        if (lpLogFile->ulBufferByteSize + ulMaxLineByteSize > lpLogFile->config.ulBufferByteSize) {
+            StaticFlush(lpLogFile);
+        }
+        const size_t ulLineOffset = lpLogFile->ulBufferByteSize;
+        StaticEncode(lpLogFile, lpWCharArr, ulLen, ullTickCount);
+        const size_t ulLineByteSize = lpLogFile->ulBufferByteSize - ulLineOffset;
+
+        if (StaticIsTooLarge(lpLogFile, ulLineByteSize))
+        {
+            // Intentional: Older lines to current file, then this line to new file.  Why?  Exact max file size.
+            StaticWriteFile(lpLogFile, lpLogFile->lpBufferCharArr, ulLineOffset);
+            memmove(lpLogFile->lpBufferCharArr, lpLogFile->lpBufferCharArr + ulLineOffset, ulLineByteSize);
+            lpLogFile->ulBufferByteSize = ulLineByteSize;
+            StaticRotateNow(lpLogFile);
+        }
+        lpLogFile->ullFileByteSize += ulLineByteSize;
+    }
+    StaticFlushIfDue(lpLogFile, ullTickCount);
+    StaticEndWrite(lpLogFile);
+}
+
+void
+LogFileTick(_Inout_ struct LogFile *lpLogFile)
+{
+    LogFileAssertValid(lpLogFile);
+
+    const ULONGLONG ullTickCount = GetTickCount64();
+    StaticBeginWrite(lpLogFile);
+    StaticRotateIfTooOld(lpLogFile, ullTickCount);
+    StaticFlushIfDue(lpLogFile, ullTickCount);
+    StaticEndWrite(lpLogFile);
+}
+
+void
+LogFileClose(_Inout_ struct LogFile *lpLogFile)
+{
+    assert(NULL != lpLogFile);
+
+    if (NULL != lpLogFile->hFile && INVALID_HANDLE_VALUE != lpLogFile->hFile)
+    {
+        LogFileFlush(lpLogFile);
+        // Intentional: Unregister first.  Why?  Crash handlers must never see a closed handle or freed buffer.
+        StaticUnregister(lpLogFile);
+        StaticCloseHandle(lpLogFile);
+    }
+    xfree((void **) &(lpLogFile->lpFilePathWCharArr));
+    xfree((void **) &(lpLogFile->lpRotateFromPathWCharArr));
+    xfree((void **) &(lpLogFile->lpRotateToPathWCharArr));
+    xfree((void **) &(lpLogFile->lpBufferCharArr));
+    *lpLogFile = (struct LogFile) {0};
+}
+
+struct LogFileArg
+{
+    // @Nullable
+    const wchar_t *lpszNullableFilePath;
+    FILE          *lpErrorStream;
+};
+
+// See: Win32ArgvValueFunc
+static bool
+StaticLogFileArg(_In_    const wchar_t *lpszValue,
+                 _Inout_ void          *lpContext)
+{
+    struct LogFileArg *lpArg = lpContext;
+    if (NULL != lpArg->lpszNullableFilePath)
+    {
+        fwprintf(lpArg->lpErrorStream, L"ERROR: Found multiple command-line args %ls\r\n", LOG_FILE_ARG_PREFIX);
+        return false;
+    }
+    if (L'\0' == lpszValue[0])
+    {
+        fwprintf(lpArg->lpErrorStream, L"ERROR: Empty path for command-line arg %ls\r\n", LOG_FILE_ARG_PREFIX);
+        return false;
+    }
+    lpArg->lpszNullableFilePath = lpszValue;
+    return true;
+}
+
+bool
+LogFileInit(_Inout_ int            *lpArgc,
+            _Inout_ wchar_t       **lppArgvWCharArr,
+            _Out_   struct LogFile *lpLogFile,
+            _Inout_ FILE           *lpErrorStream)
+{
+    assert(NULL != lpArgc);
+    assert(NULL != lppArgvWCharArr);
+    assert(NULL != lpLogFile);
+    assert(NULL != lpErrorStream);
+
+    struct LogFileArg arg = {.lpErrorStream = lpErrorStream};
+    if (!Win32ArgvRemovePrefix(lpArgc, lppArgvWCharArr, LOG_FILE_ARG_PREFIX, StaticLogFileArg, &arg)) {
+        return false;
+    }
+    if (NULL == arg.lpszNullableFilePath) {
+        return true;
+    }
+
+    LogFileOpen(lpLogFile, &(struct LogFileConfig) {
+        .lpFilePathWCharArr       = arg.lpszNullableFilePath,
+        .ulBufferByteSize         = LOG_FILE_DEFAULT_BUFFER_BYTE_SIZE,
+        .ulFlushThresholdByteSize = LOG_FILE_DEFAULT_FLUSH_THRESHOLD_BYTE_SIZE,
+        .dwFlushIntervalMillis    = LOG_FILE_DEFAULT_FLUSH_INTERVAL_MILLIS,
+        .ullMaxFileByteSize       = LOG_FILE_DEFAULT_MAX_FILE_BYTE_SIZE,
+        .uRetentionCount          = LOG_FILE_DEFAULT_RETENTION_COUNT,
+    });
+    LogSetFile(lpLogFile);
+    return true;
+}
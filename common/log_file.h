@@ -0,0 +1,188 @@
+#ifndef H_COMMON_LOG_FILE
+#define H_COMMON_LOG_FILE
+
+#include "win32.h"
+#include <sal.h>      // required for _In_
+#include <stddef.h>   // required for size_t
+#include <stdint.h>   // required for uint64_t
+#include <stdbool.h>  // required for bool
+#include <wchar.h>    // required for wchar_t
+#include <stdio.h>    // required for FILE
+#include <stdatomic.h>  // required for atomic_bool
+
+// File log sink: Lines are UTF-8 encoded into one large buffer, then written with WriteFile() when the buffer reaches a
+// threshold or is older than an interval.  Disk I/O is a few large writes, not one per line.
+// Rotation: When the next line would exceed the max file size, or the file is older than the max age, current file is
+// renamed: "passport.log" -> "passport.log.1" -> "passport.log.2" ... and the oldest above the retention count is deleted.
+// Disk use is bounded by: max file size * (1 + retention count).
+// <p>
+// Crash flush: Each open file is registered.  On exit(), abort() (SIGABRT), or an unhandled exception, buffered bytes of
+// each open file are written before the process exits.  Best effort, not a guarantee:
+// - A file in the middle of a write, on any thread, is skipped.  Why?  Its buffer may be inconsistent.
+// - Lines still in the async log ring buffer are only written if its crash handler ran first: LogAsyncStart() after
+//   LogFileOpen(), as in LogFileInit().  See: log_async.h
+// - Not after ExitProcess() or TerminateProcess().
+// <p>
+// Not thread-safe: One thread per file.  After open, no heap alloc: Safe for the async log background thread.
+// See: LogSetFile() in log.h
+// Ex:
+// struct LogFile logFile = {0};
+// LogFileOpen(&logFile, &(struct LogFileConfig) {
+//     .lpFilePathWCharArr       = L"passport.log",
+//     .ulBufferByteSize         = LOG_FILE_DEFAULT_BUFFER_BYTE_SIZE,
+//     .ulFlushThresholdByteSize = LOG_FILE_DEFAULT_FLUSH_THRESHOLD_BYTE_SIZE,
+//     .dwFlushIntervalMillis    = LOG_FILE_DEFAULT_FLUSH_INTERVAL_MILLIS,
+//     .ullMaxFileByteSize       = LOG_FILE_DEFAULT_MAX_FILE_BYTE_SIZE,
+//     .uRetentionCount          = LOG_FILE_DEFAULT_RETENTION_COUNT,
+// });
+// LogFileWriteLine(&logFile, L"INFO: abc\r\n", 11);
+// LogFileClose(&logFile);
+
+#define LOG_FILE_DEFAULT_BUFFER_BYTE_SIZE          (256U * 1024U)
+#define LOG_FILE_DEFAULT_FLUSH_THRESHOLD_BYTE_SIZE (64U * 1024U)
+#define LOG_FILE_DEFAULT_FLUSH_INTERVAL_MILLIS     1000U
+#define LOG_FILE_DEFAULT_MAX_FILE_BYTE_SIZE        (16ULL * 1024U * 1024U)
+#define LOG_FILE_DEFAULT_RETENTION_COUNT           5U
+// Intentional: Larger than one UTF-8 encoded wchar.  Why?  Longer lines are written in pieces.
+#define LOG_FILE_MIN_BUFFER_BYTE_SIZE              (4U * 1024U)
+// Max rotated files: Suffix is at most ".999"
+#define LOG_FILE_MAX_RETENTION_COUNT               999U
+// Ex: L"--log-file=C:\\path\\to\\passport.log"  See: LogFileInit()
+#define LOG_FILE_ARG_PREFIX                        L"--log-file="
+// Max files open at same time.  Why?  Crash handler uses a fixed array: No heap alloc.
+#define LOG_FILE_MAX_OPEN_COUNT                    8U
+
+struct LogFileConfig
+{
+    // Copied by LogFileOpen()
+    const wchar_t *lpFilePathWCharArr;
+    // At least LOG_FILE_MIN_BUFFER_BYTE_SIZE; usually LOG_FILE_DEFAULT_BUFFER_BYTE_SIZE
+    size_t         ulBufferByteSize;
+    // Write buffer when it has at least this many bytes.  Zero: Only when full.
+    size_t         ulFlushThresholdByteSize;
+    // Write buffer when oldest buffered line is older.  Zero: Never.  See: LogFileTick()
+    DWORD          dwFlushIntervalMillis;
+    // Rotate before a line would exceed this size.  Zero: No limit.
+    // Intentional: A single line larger than this is never split across files.
+    uint64_t       ullMaxFileByteSize;
+    // Rotate when file was opened or rotated longer ago.  Zero: Never.
+    DWORD          dwMaxFileAgeMillis;
+    // Max rotated files to keep: "path.1" (newest) to "path.N" (oldest).  Zero: Truncate current file on rotate.
+    unsigned       uRetentionCount;
+};
+
+struct LogFile
+{
+    HANDLE                hFile;
+    struct LogFileConfig  config;
+    // Copy of config.lpFilePathWCharArr; config.lpFilePathWCharArr points here.
+    wchar_t              *lpFilePathWCharArr;
+    size_t                ulFilePathLen;
+    // Two scratch paths for rotation: "path.N"  Why?  No heap alloc after open.
+    wchar_t              *lpRotateFromPathWCharArr;
+    wchar_t              *lpRotateToPathWCharArr;
+    // UTF-8 bytes not yet written
+    char                 *lpBufferCharArr;
+    size_t                ulBufferByteSize;
+    // Size of current file, including buffered bytes
+    uint64_t              ullFileByteSize;
+    // From GetTickCount64() when file was opened or last rotated, or when first line was added to empty file
+    ULONGLONG             ullOpenTickCount;
+    // From GetTickCount64() when buffer was last empty, then one line was added
+    ULONGLONG             ullFirstBufferedTickCount;
+    // Number of rotations since open
+    size_t                ulRotateCount;
+    // Set during each LogFileWriteLine(), LogFileFlush(), etc.  Crash handlers skip this file while set.
+    atomic_bool           bIsWriteInProgress;
+};
+
+/**
+ * If command-line arg LOG_FILE_ARG_PREFIX exists, remove it from lppArgvWCharArr, call LogFileOpen() with default
+ * config, then LogSetFile().  Call once, before LogAsyncStart() and before other command-line args are parsed.
+ * <p>
+ * Ex: LogFileInit(&__argc, __wargv, &logFile, stderr)
+ *
+ * @param lpArgc
+ *        on return, decremented for each removed arg
+ *
+ * @param lppArgvWCharArr
+ *        on return, args after each removed arg are moved left
+ *
+ * @param lpLogFile
+ *        opened only if arg exists; must live until exit.  Why?  Crash handlers and exit() write its buffer.
+ *
+ * @param lpErrorStream
+ *        stream to print errors
+ *        usually 'stderr' (from <stdio.h>), but may be any valid stream
+ *
+ * @return true if arg does not exist, or file is open
+ *         false if path is empty or arg is repeated, and error printed to {@code lpErrorStream}
+ */
+bool
+LogFileInit(_Inout_ int            *lpArgc,
+            _Inout_ wchar_t       **lppArgvWCharArr,
+            _Out_   struct LogFile *lpLogFile,
+            _Inout_ FILE           *lpErrorStream);
+
+void
+LogFileAssertValid(_In_ const struct LogFile *lpLogFile);
+
+/**
+ * Open file for append, or create a new file, then register for crash-safe flush.  On error, abort() is called.
+ * <p>
+ * Intentional: Append, not truncate.  Why?  A restart does not erase the last session.  Size limit still applies.
+ *
+ * @param lpConfig
+ *        copied; see struct LogFileConfig
+ */
+void
+LogFileOpen(_Out_ struct LogFile             *lpLogFile,
+            _In_  const struct LogFileConfig *lpConfig);
+
+/**
+ * Encode one line as UTF-8 and append to buffer.  If needed, rotate first, then write buffer, per config.
+ * An unpaired surrogate is written as U+FFFD.  No heap alloc.  On I/O error, abort() is called.
+ *
+ * @param lpWCharArr
+ *        complete line; usually ends with newline: L"\r\n"
+ *        need not be terminated with '\0'
+ */
+void
+LogFileWriteLine(_Inout_ struct LogFile *lpLogFile,
+                 _In_    const wchar_t  *lpWCharArr,
+                 _In_    const size_t    ulLen);
+
+/**
+ * Rotate or write buffer if config.dwMaxFileAgeMillis or config.dwFlushIntervalMillis has elapsed.
+ * LogFileWriteLine() also checks, but only when called.  Call periodically if lines may be rare: Ex: From a timer
+ * Intentional: Async log background thread calls this after each batch and each wait timeout.  See: LogSetFile()
+ */
+void
+LogFileTick(_Inout_ struct LogFile *lpLogFile);
+
+/**
+ * Write buffer to file with WriteFile().  On error, abort() is called.
+ * Important: Data is given to the OS, but may not be on disk.  See: LogFileSync()
+ */
+void
+LogFileFlush(_Inout_ struct LogFile *lpLogFile);
+
+/**
+ * Call LogFileFlush(), then FlushFileBuffers(): Data is on disk, even if the OS crashes.  Slow: Do not call per line.
+ */
+void
+LogFileSync(_Inout_ struct LogFile *lpLogFile);
+
+/**
+ * Call LogFileFlush(), then rotate now.  On error, abort() is called.
+ */
+void
+LogFileRotate(_Inout_ struct LogFile *lpLogFile);
+
+/**
+ * Call LogFileFlush(), then close file, unregister, and free.  Safe to call for zero-initialised lpLogFile.
+ */
+void
+LogFileClose(_Inout_ struct LogFile *lpLogFile);
+
+#endif  // H_COMMON_LOG_FILE
@@ -0,0 +1,122 @@
+#include "dyn_arr.h"
+#include "wstr.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <assert.h>   // required for assert()
+
+// Intentional: No move function.  Why?  int never points into itself: Grow with xrealloc().
+DYN_ARR_DECLARE(IntDynArr, int)
+DYN_ARR_DEFINE(IntDynArr, int, NULL)
+
+// Intentional: Move function.  Why?  struct WStr may point to its own inline buffer.
+DYN_ARR_DECLARE(WStrDynArr, struct WStr)
+DYN_ARR_DEFINE(WStrDynArr, struct WStr, WStrMove)
+
+static void
+TestIntDynArr(_In_ const size_t ulCount)
+{
+    printf("TestIntDynArr: %zu\n", ulCount);
+
+    struct IntDynArr dynArr = {0};
+    for (size_t i = 0; i < ulCount; ++i)
+    {
+        int x = (int) i;
+        IntDynArr_Push(&dynArr, &x);
+        assert(0 == x);
+        assert(i + 1U == dynArr.ulSize);
+        // Geometric growth
+        assert(dynArr.ulCapacity < DYN_ARR_MIN_CAPACITY + 2U * dynArr.ulSize);
+    }
+    for (size_t i = 0; i < ulCount; ++i)
+    {
+        assert((int) i == dynArr.lpElemArr[i]);
+    }
+
+    IntDynArr_ShrinkToFit(&dynArr);
+    assert(ulCount == dynArr.ulCapacity);
+
+    for (size_t i = ulCount; i > 0; --i)
+    {
+        int x = -1;
+        IntDynArr_Pop(&dynArr, &x);
+        assert((int) (i - 1U) == x);
+    }
+    assert(0 == dynArr.ulSize);
+
+    // Empty: Array is freed.
+    IntDynArr_ShrinkToFit(&dynArr);
+    assert(NULL == dynArr.lpElemArr);
+    assert(0 == dynArr.ulCapacity);
+
+    IntDynArr_Reserve(&dynArr, 100U);
+    assert(100U == dynArr.ulCapacity);
+    assert(0 == dynArr.ulSize);
+    IntDynArr_Reserve(&dynArr, 10U);
+    assert(100U == dynArr.ulCapacity);
+
+    IntDynArr_Free(&dynArr);
+    assert(NULL == dynArr.lpElemArr);
+    assert(0 == dynArr.ulSize);
+    assert(0 == dynArr.ulCapacity);
+}
+
+static void
+TestWStrDynArr(_In_ const size_t ulCount)
+{
+    printf("TestWStrDynArr: %zu\n", ulCount);
+
+    struct WStrDynArr dynArr = {0};
+    for (size_t i = 0; i < ulCount; ++i)
+    {
+        // Even: small string (inline buffer).  Odd: heap buffer.
+        struct WStr wstr = {0};
+        WStrSPrintF(&wstr, (0 == i % 2U) ? L"%zu" : L"abcdefghijklmnopqrstuvwxyz-%zu", i);
+        WStrDynArr_Push(&dynArr, &wstr);
+        assert(0 == wstr.ulSize);
+    }
+
+    // After each re-allocation, every small string must point to its *own* inline buffer.
+    for (size_t i = 0; i < ulCount; ++i)
+    {
+        struct WStr *lpWStr = dynArr.lpElemArr + i;
+        if (0 == i % 2U) {
+            assert(WStrIsSmall(lpWStr));
+        }
+        struct WStr expectedWStr = {0};
+        WStrSPrintF(&expectedWStr, (0 == i % 2U) ? L"%zu" : L"abcdefghijklmnopqrstuvwxyz-%zu", i);
+        assert(0 == WStrCompare(&expectedWStr, lpWStr));
+        WStrFree(&expectedWStr);
+    }
+
+    WStrDynArr_ShrinkToFit(&dynArr);
+    assert(ulCount == dynArr.ulCapacity);
+
+    while (dynArr.ulSize > 0)
+    {
+        struct WStr wstr = {0};
+        WStrDynArr_Pop(&dynArr, &wstr);
+        WStrFree(&wstr);
+    }
+    WStrDynArr_Free(&dynArr);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestIntDynArr(1);
+    TestIntDynArr(8);
+    TestIntDynArr(9);
+    TestIntDynArr(1000);
+
+    TestWStrDynArr(1);
+    TestWStrDynArr(9);
+    TestWStrDynArr(1000);
+    return 0;
+}
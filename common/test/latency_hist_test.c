@@ -0,0 +1,133 @@
+#include "latency_hist.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <assert.h>   // required for assert()
+
+static void
+TestLatencyHistBucketIndex()
+{
+    printf("TestLatencyHistBucketIndex\n");
+
+    // One bucket per value
+    for (uint64_t v = 0; v < LATENCY_HIST_SUB_BUCKET_COUNT; ++v)
+    {
+        const size_t i = LatencyHistBucketIndex(v);
+        assert(v == i);
+        assert(v == LatencyHistBucketLowestValue(i));
+        assert(v == LatencyHistBucketHighestValue(i));
+    }
+    // Exhaustive for small values, then each power of two, +/- 1
+    size_t ulPrevIndex = LatencyHistBucketIndex(0U);
+    for (uint64_t v = 1; v < 100000; ++v)
+    {
+        const size_t i = LatencyHistBucketIndex(v);
+        assert(i == ulPrevIndex || i == ulPrevIndex + 1U);
+        assert(LatencyHistBucketLowestValue(i) <= v);
+        assert(v <= LatencyHistBucketHighestValue(i));
+        ulPrevIndex = i;
+    }
+    for (unsigned b = LATENCY_HIST_SUB_BUCKET_BITS; b < LATENCY_HIST_MAX_VALUE_BITS; ++b)
+    {
+        const uint64_t ullArr[] = {(1ULL << b) - 1U, 1ULL << b, (1ULL << b) + 1U};
+        for (size_t k = 0; k < sizeof(ullArr) / sizeof(ullArr[0]); ++k)
+        {
+            const uint64_t v = ullArr[k];
+            const size_t i = LatencyHistBucketIndex(v);
+            assert(i < LATENCY_HIST_BUCKET_COUNT);
+            const uint64_t ullLowestValue  = LatencyHistBucketLowestValue(i);
+            const uint64_t ullHighestValue = LatencyHistBucketHighestValue(i);
+            assert(ullLowestValue <= v && v <= ullHighestValue);
+            // Relative error
+            assert((ullHighestValue - ullLowestValue) * LATENCY_HIST_SUB_BUCKET_COUNT <= ullLowestValue);
+        }
+    }
+    // Clamp
+    assert(LATENCY_HIST_BUCKET_COUNT - 1U == LatencyHistBucketIndex((1ULL << LATENCY_HIST_MAX_VALUE_BITS) - 1U));
+    assert(LATENCY_HIST_BUCKET_COUNT - 1U == LatencyHistBucketIndex(1ULL << LATENCY_HIST_MAX_VALUE_BITS));
+    assert(LATENCY_HIST_BUCKET_COUNT - 1U == LatencyHistBucketIndex(UINT64_MAX));
+}
+
+static void
+TestLatencyHistEmpty()
+{
+    printf("TestLatencyHistEmpty\n");
+
+    struct LatencyHist hist = LATENCY_HIST_INIT(L"Empty");
+    assert(0U == LatencyHistValueAtPercentile(&hist, 50.0));
+    assert(0U == LatencyHistValueAtPercentile(&hist, 100.0));
+    LatencyHistLogW(stdout, &hist);
+}
+
+static void
+TestLatencyHistValueAtPercentile()
+{
+    printf("TestLatencyHistValueAtPercentile\n");
+
+    struct LatencyHist hist = LATENCY_HIST_INIT(L"Test");
+    // Intentional: Descending.  Why?  Order must not matter.
+    for (int64_t v = 10000; v >= 1; --v)
+    {
+        LatencyHistRecord(&hist, v);
+    }
+    assert(10000U == hist.ullTotalCount);
+    assert(10000U == hist.ullMaxValue);
+
+    const double dPercentileArr[] = {1.0, 50.0, 90.0, 99.0, 99.9};
+    for (size_t i = 0; i < sizeof(dPercentileArr) / sizeof(dPercentileArr[0]); ++i)
+    {
+        // Exact: Value v is the v/100 percentile
+        const uint64_t ullExpected = (uint64_t) (dPercentileArr[i] * 100.0);
+        const uint64_t ullActual   = LatencyHistValueAtPercentile(&hist, dPercentileArr[i]);
+        assert(ullActual >= ullExpected);
+        assert((ullActual - ullExpected) * LATENCY_HIST_SUB_BUCKET_COUNT <= ullExpected);
+    }
+    // Never more than max
+    assert(10000U == LatencyHistValueAtPercentile(&hist, 100.0));
+    LatencyHistLogW(stdout, &hist);
+
+    // Negative is zero
+    LatencyHistRecord(&hist, -1);
+    assert(1U == hist.ullCountArr[0]);
+
+    LatencyHistReset(&hist);
+    assert(0U == hist.ullTotalCount);
+    assert(0U == hist.ullMaxValue);
+    assert(0U == hist.ullCountArr[LatencyHistBucketIndex(5000U)]);
+    assert(0U == LatencyHistValueAtPercentile(&hist, 99.0));
+}
+
+static void
+TestLatencyHistOutlier()
+{
+    printf("TestLatencyHistOutlier\n");
+
+    struct LatencyHist hist = LATENCY_HIST_INIT(L"Outlier");
+    for (unsigned i = 0; i < 999U; ++i)
+    {
+        LatencyHistRecord(&hist, 7);
+    }
+    LatencyHistRecord(&hist, 123456789);
+    assert(7U == LatencyHistValueAtPercentile(&hist, 50.0));
+    assert(7U == LatencyHistValueAtPercentile(&hist, 99.9));
+    assert(123456789U == LatencyHistValueAtPercentile(&hist, 99.95));
+    assert(123456789U == hist.ullMaxValue);
+
+    const int64_t llStart = LatencyHistNow();
+    const int64_t llEnd   = LatencyHistNow();
+    assert(llEnd >= llStart);
+}
+
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestLatencyHistBucketIndex();
+    TestLatencyHistEmpty();
+    TestLatencyHistValueAtPercentile();
+    TestLatencyHistOutlier();
+    return 0;
+}
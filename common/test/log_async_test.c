@@ -0,0 +1,234 @@
+#include "log_async.h"
+#include "log.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <wchar.h>    // required for wcslen()
+#include <assert.h>   // required for assert()
+#include <signal.h>   // required for signal()
+#include <setjmp.h>   // required for setjmp()
+#include <stdlib.h>   // required for abort()
+
+// Timestamp prefix, longest message, and extra space to detect a long line
+#define TEST_LINE_WCHAR_ARR_LEN (LOG_PREFIX_MAX_LEN + LOG_ASYNC_MSG_WCHAR_ARR_LEN + 16U)
+
+struct ProducerContext
+{
+    FILE     *fp;
+    unsigned  uThreadIndex;
+    unsigned  uCount;
+};
+
+static DWORD WINAPI
+StaticProducerThreadProc(_In_ LPVOID lpParam)
+{
+    const struct ProducerContext *lpContext = lpParam;
+    for (unsigned i = 0; i < lpContext->uCount; ++i)
+    {
+        LogWF(lpContext->fp, L"INFO: %u:%u\r\n", lpContext->uThreadIndex, i);
+    }
+    return 0;
+}
+
+/**
+ * Read all lines from fp.  Each thread's lines must be in order.
+ *
+ * @return number of lines
+ */
+static unsigned
+StaticAssertLines(_In_ FILE           *fp,
+                  _In_ const unsigned  uThreadCount,
+                  _In_ const bool      bIsGapAllowed)
+{
+    rewind(fp);
+
+    unsigned uNextIndexArr[16] = {0};
+    assert(uThreadCount <= sizeof(uNextIndexArr) / sizeof(uNextIndexArr[0]));
+
+    unsigned uLineCount = 0;
+    wchar_t lpLineWCharArr[TEST_LINE_WCHAR_ARR_LEN];
+    while (NULL != fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fp))
+    {
+        // Ex: "2022-03-10 22:17:47.123 +09:00 INFO: 3:17\r\n"
+        assert(wcslen(lpLineWCharArr) > LOG_PREFIX_MAX_LEN);
+        assert(L' ' == lpLineWCharArr[LOG_PREFIX_MAX_LEN - 1U]);
+        unsigned uThreadIndex = 0;
+        unsigned uIndex = 0;
+        const int n = swscanf(lpLineWCharArr + LOG_PREFIX_MAX_LEN, L"INFO: %u:%u", &uThreadIndex, &uIndex);
+        assert(2 == n);
+        assert(uThreadIndex < uThreadCount);
+        if (bIsGapAllowed) {
+            assert(uIndex >= uNextIndexArr[uThreadIndex]);
+        }
+        else {
+            assert(uIndex == uNextIndexArr[uThreadIndex]);
+        }
+        uNextIndexArr[uThreadIndex] = uIndex + 1U;
+        ++uLineCount;
+    }
+    return uLineCount;
+}
+
+static void
+TestLogAsyncBlock(_In_ const unsigned uThreadCount,
+                  _In_ const unsigned uCountPerThread)
+{
+    printf("TestLogAsyncBlock: uThreadCount:%u, uCountPerThread:%u\n", uThreadCount, uCountPerThread);
+
+    FILE *fp = tmpfile();
+    assert(NULL != fp);
+    const uint64_t ullDroppedCount = LogAsyncGetDroppedCount();
+
+    LogAsyncStart(LOG_ASYNC_OVERFLOW_BLOCK);
+    assert(LogAsyncIsStarted());
+
+    struct ProducerContext contextArr[16] = {0};
+    HANDLE hThreadArr[16] = {0};
+    assert(uThreadCount <= sizeof(hThreadArr) / sizeof(hThreadArr[0]));
+    for (unsigned i = 0; i < uThreadCount; ++i)
+    {
+        contextArr[i] = (struct ProducerContext) {.fp = fp, .uThreadIndex = i, .uCount = uCountPerThread};
+        hThreadArr[i] = CreateThread(NULL, 0, StaticProducerThreadProc, contextArr + i, 0, NULL);
+        assert(NULL != hThreadArr[i]);
+    }
+    for (unsigned i = 0; i < uThreadCount; ++i)
+    {
+        WaitForSingleObject(hThreadArr[i], INFINITE);
+        CloseHandle(hThreadArr[i]);
+    }
+
+    LogAsyncFlush();
+    LogAsyncStop();
+    assert(!LogAsyncIsStarted());
+    // Intentional: No record is lost.
+    assert(ullDroppedCount == LogAsyncGetDroppedCount());
+
+    const bool bIsGapAllowed = false;
+    const unsigned uLineCount = StaticAssertLines(fp, uThreadCount, bIsGapAllowed);
+    assert(uThreadCount * uCountPerThread == uLineCount);
+    fclose(fp);
+}
+
+static void
+TestLogAsyncDrop(_In_ const unsigned uCount)
+{
+    printf("TestLogAsyncDrop: uCount:%u\n", uCount);
+
+    FILE *fp = tmpfile();
+    assert(NULL != fp);
+    const uint64_t ullDroppedCount = LogAsyncGetDroppedCount();
+
+    LogAsyncStart(LOG_ASYNC_OVERFLOW_DROP);
+    struct ProducerContext context = {.fp = fp, .uThreadIndex = 0, .uCount = uCount};
+    StaticProducerThreadProc(&context);
+    // Flush on stop
+    LogAsyncStop();
+
+    const uint64_t ullNewDroppedCount = LogAsyncGetDroppedCount() - ullDroppedCount;
+    printf("Dropped %llu records\n", (unsigned long long) ullNewDroppedCount);
+
+    const bool bIsGapAllowed = true;
+    const unsigned uLineCount = StaticAssertLines(fp, 1U, bIsGapAllowed);
+    assert(uCount == uLineCount + ullNewDroppedCount);
+    fclose(fp);
+}
+
+static void
+TestLogAsyncTruncate()
+{
+    printf("TestLogAsyncTruncate\n");
+
+    FILE *fp = tmpfile();
+    assert(NULL != fp);
+
+    wchar_t lpMsgWCharArr[2U * LOG_ASYNC_MSG_WCHAR_ARR_LEN];
+    wmemset(lpMsgWCharArr, L'x', sizeof(lpMsgWCharArr) / sizeof(lpMsgWCharArr[0]) - 1U);
+    lpMsgWCharArr[sizeof(lpMsgWCharArr) / sizeof(lpMsgWCharArr[0]) - 1U] = L'\0';
+
+    LogAsyncStart(LOG_ASYNC_OVERFLOW_BLOCK);
+    LogW(fp, lpMsgWCharArr);
+    LogWF(fp, L"%ls", lpMsgWCharArr);
+    LogAsyncStop();
+
+    // After stop: Write on caller thread, as before.
+    LogW(fp, L"INFO: After stop\r\n");
+    fflush(fp);
+
+    rewind(fp);
+    const size_t ulTruncatedLen = wcslen(LOG_ASYNC_TRUNCATED);
+    wchar_t lpLineWCharArr[TEST_LINE_WCHAR_ARR_LEN];
+    for (int i = 0; i < 2; ++i)
+    {
+        assert(NULL != fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fp));
+        const size_t ulLen = wcslen(lpLineWCharArr);
+        assert(LOG_PREFIX_MAX_LEN + LOG_ASYNC_MSG_WCHAR_ARR_LEN - LEN_NUL_CHAR == ulLen);
+        assert(0 == wcscmp(LOG_ASYNC_TRUNCATED, lpLineWCharArr + ulLen - ulTruncatedLen));
+        assert(L'x' == lpLineWCharArr[ulLen - ulTruncatedLen - 1U]);
+    }
+    assert(NULL != fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fp));
+    assert(0 == wcscmp(L"INFO: After stop\r\n", lpLineWCharArr + LOG_PREFIX_MAX_LEN));
+    assert(NULL == fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fp));
+    fclose(fp);
+}
+
+static jmp_buf g_abortJmpBuf;
+
+static void
+StaticTestAbortSignalHandler(__attribute__((unused))
+                             _In_ const int iSignal)
+{
+    // Intentional: Do not return.  Why?  After handler returns, abort() exits the process.
+    longjmp(g_abortJmpBuf, 1);
+}
+
+static void
+TestLogAsyncAbort(_In_ const unsigned uCount)
+{
+    printf("TestLogAsyncAbort: uCount:%u\n", uCount);
+
+    FILE *fp = tmpfile();
+    assert(NULL != fp);
+
+    // Intentional: Before LogAsyncStart().  Why?  Crash handler in log_async.c calls previous handler.
+    void (*lpPrevSignalHandler)(int) = signal(SIGABRT, StaticTestAbortSignalHandler);
+    LogAsyncStart(LOG_ASYNC_OVERFLOW_BLOCK);
+    struct ProducerContext context = {.fp = fp, .uThreadIndex = 0, .uCount = uCount};
+    StaticProducerThreadProc(&context);
+    if (0 == setjmp(g_abortJmpBuf))
+    {
+        // Same as Win32LastError*Abort(): LogWF(), then abort()
+        LogWF(fp, L"INFO: 0:%u\r\n", uCount);
+        abort();
+    }
+
+    // Intentional: Before LogAsyncStop().  Why?  Crash handler, not final drain, must write all records.
+    const bool bIsGapAllowed = false;
+    const unsigned uLineCount = StaticAssertLines(fp, 1U, bIsGapAllowed);
+    assert(uCount + 1U == uLineCount);
+
+    // Restores this test's handler
+    LogAsyncStop();
+    signal(SIGABRT, lpPrevSignalHandler);
+    fclose(fp);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestLogAsyncBlock(1, 1);
+    TestLogAsyncBlock(1, 10U * LOG_ASYNC_RECORD_COUNT);
+    TestLogAsyncBlock(4, 10U * LOG_ASYNC_RECORD_COUNT);
+
+    TestLogAsyncDrop(1);
+    TestLogAsyncDrop(10U * LOG_ASYNC_RECORD_COUNT);
+
+    TestLogAsyncTruncate();
+    TestLogAsyncAbort(10U * LOG_ASYNC_RECORD_COUNT);
+    return 0;
+}
@@ -0,0 +1,345 @@
+#include "log_binary.h"
+#include "log.h"
+#include "wstr_file_map.h"
+#include "win32_file.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <wchar.h>    // required for wcslen()
+#include <string.h>   // required for memcmp()
+#include <assert.h>   // required for assert()
+
+static const wchar_t *TEST_FILE_PATH = L"TestLogBinary.binlog";
+
+#define TEST_LINE_WCHAR_ARR_LEN (LOG_PREFIX_MAX_LEN + 4U * LOG_BINARY_MAX_WSTR_LEN)
+
+static void
+TestLogBinaryFormatNextSpec(_In_ const wchar_t *lpszMsgFmt,
+                            _In_ const size_t   ulExpectedOffset,
+                            _In_ const size_t   ulExpectedLen,
+                            _In_ const size_t   ulExpectedArgCount,
+                            _In_ const enum ELogBinaryArgType eExpectedLastArgType)
+{
+    printf("TestLogBinaryFormatNextSpec: [%ls]\n", lpszMsgFmt);
+
+    struct LogBinaryFormatSpec spec = {0};
+    assert(LogBinaryFormatNextSpec(lpszMsgFmt, 0, &spec));
+    assert(ulExpectedOffset == spec.ulOffset);
+    assert(ulExpectedLen == spec.ulLen);
+    assert(ulExpectedArgCount == spec.ulArgCount);
+    if (ulExpectedArgCount > 0) {
+        assert(eExpectedLastArgType == spec.eArgTypeArr[spec.ulArgCount - 1U]);
+    }
+    assert(!LogBinaryFormatNextSpec(lpszMsgFmt, spec.ulOffset + spec.ulLen, &spec));
+}
+
+/**
+ * Intentional: One call site for many writers.  Why?  Format must be registered again after each open.
+ */
+static void
+StaticWriteEvent(_Inout_ struct LogBinaryWriter *lpWriter,
+                 _In_    const unsigned          uIndex)
+{
+    LOG_BINARY_WF(lpWriter, L"INFO: uIndex:%u\r\n", uIndex);
+}
+
+/**
+ * Decode TEST_FILE_PATH, then compare each message, excluding timestamp prefix, to lpszExpectedArr.
+ *
+ * @param ulByteSize
+ *        SIZE_MAX for all bytes; else decode only first bytes, e.g., to test a truncated file
+ *
+ * @return result of LogBinaryDecode()
+ */
+static bool
+StaticDecodeThenAssert(_In_ const size_t          ulByteSize,
+                       _In_ const wchar_t *const *lpszExpectedArr,
+                       _In_ const size_t          ulExpectedCount)
+{
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, TEST_FILE_PATH, CP_UTF8);
+    assert(0 == fileMap.ulBOMSize);
+
+    FILE *fpOutput = tmpfile();
+    assert(NULL != fpOutput);
+    FILE *fpError = tmpfile();
+    assert(NULL != fpError);
+
+    const size_t ulDecodeByteSize = (SIZE_MAX == ulByteSize) ? fileMap.ulByteSize : ulByteSize;
+    assert(ulDecodeByteSize <= fileMap.ulByteSize);
+    const bool bResult = LogBinaryDecode((const unsigned char *) fileMap.lpCharArr, ulDecodeByteSize, fpOutput, fpError);
+    WStrFileMapClose(&fileMap);
+
+    rewind(fpOutput);
+    wchar_t lpLineWCharArr[TEST_LINE_WCHAR_ARR_LEN];
+    for (size_t i = 0; i < ulExpectedCount; ++i)
+    {
+        assert(NULL != fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fpOutput));
+        // Ex: "2022-03-10 22:17:47.123 +09:00 INFO: ..."
+        assert(wcslen(lpLineWCharArr) >= LOG_PREFIX_MAX_LEN);
+        assert(L' ' == lpLineWCharArr[LOG_PREFIX_MAX_LEN - 1U]);
+        if (0 != wcscmp(lpszExpectedArr[i], lpLineWCharArr + LOG_PREFIX_MAX_LEN))
+        {
+            printf("Line %zd: [%ls] != [%ls]\n", i, lpszExpectedArr[i], lpLineWCharArr + LOG_PREFIX_MAX_LEN);
+        }
+        assert(0 == wcscmp(lpszExpectedArr[i], lpLineWCharArr + LOG_PREFIX_MAX_LEN));
+    }
+    assert(NULL == fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fpOutput));
+
+    // Intentional: Error is printed only if result is false.
+    rewind(fpError);
+    assert(bResult == (NULL == fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fpError)));
+
+    fclose(fpError);
+    fclose(fpOutput);
+    return bResult;
+}
+
+static void
+TestLogBinaryDecode(_In_ const size_t ulBufferByteSize)
+{
+    printf("TestLogBinaryDecode: ulBufferByteSize:%zd\n", ulBufferByteSize);
+
+    static const wchar_t *lpszMsgFmt =
+        L"INFO: %d|%08X|%o|%hd|%lld|%zu|%5.2f|%g|%p|%c|%ls|%-8ls|%.*ls|%*d|%%\r\n";
+
+    struct WStr longWStr = {0};
+    WStrAlloc(&longWStr, 2U * LOG_BINARY_MAX_WSTR_LEN);
+    wmemset(longWStr.lpWCharArr, L'x', longWStr.ulSize);
+
+    enum { TEST_COUNT = 3 };
+    const wchar_t *lpszArgArr[TEST_COUNT] = {L"", L"abc", longWStr.lpWCharArr};
+    wchar_t lpExpectedWCharArr[TEST_COUNT][TEST_LINE_WCHAR_ARR_LEN];
+    const wchar_t *lpszExpectedArr[TEST_COUNT];
+
+    struct LogBinaryWriter writer = {0};
+    LogBinaryWriterOpen(&writer, TEST_FILE_PATH, ulBufferByteSize);
+    for (size_t i = 0; i < TEST_COUNT; ++i)
+    {
+        const int iValue = -17 * (int) i;
+        const unsigned uValue = 0xBEEFU + (unsigned) i;
+        const long long llValue = -1234567890123LL * (long long) i;
+        const double dValue = 3.14159 * (double) i;
+        void *lpPtr = lpszArgArr + i;
+        // Intentional: Not terminated at precision.  Why?  %.*ls must not read past precision.
+        const wchar_t lpPrecisionWCharArr[4] = {L'w', L'x', L'y', L'z'};
+        const int iPrecision = (int) i + 1;
+
+        // Intentional: LOG_BINARY_MAX_ARG_COUNT args.  Same args for both.  Why?  Binary log must render the same as vswprintf().
+#define TEST_ARGS iValue, uValue, uValue, (short) iValue, llValue, (size_t) uValue, dValue, dValue, lpPtr, L'A' + (int) i, lpszArgArr[i], \
+                  lpszArgArr[i], iPrecision, lpPrecisionWCharArr, (int) i + 3, iValue
+
+        LOG_BINARY_WF(&writer, lpszMsgFmt, TEST_ARGS);
+        // Intentional: Long %ls args are truncated.  All wchars are 'x': Any LOG_BINARY_MAX_WSTR_LEN wchars are the same.
+        const wchar_t *lpszArg = lpszArgArr[i];
+        if (wcslen(lpszArg) > LOG_BINARY_MAX_WSTR_LEN)
+        {
+            lpszArgArr[i] = lpszArg + longWStr.ulSize - LOG_BINARY_MAX_WSTR_LEN;
+        }
+        const int iLen = swprintf(lpExpectedWCharArr[i], TEST_LINE_WCHAR_ARR_LEN, lpszMsgFmt, TEST_ARGS);
+#undef TEST_ARGS
+        assert(iLen > 0);
+        lpszArgArr[i] = lpszArg;
+        lpszExpectedArr[i] = lpExpectedWCharArr[i];
+    }
+    LogBinaryWriterClose(&writer);
+
+    assert(StaticDecodeThenAssert(SIZE_MAX, lpszExpectedArr, TEST_COUNT));
+    WStrFree(&longWStr);
+}
+
+static void
+TestLogBinaryReopen(_In_ const unsigned uCount)
+{
+    printf("TestLogBinaryReopen: uCount:%u\n", uCount);
+
+    wchar_t lpExpectedWCharArr[64];
+    swprintf(lpExpectedWCharArr, sizeof(lpExpectedWCharArr) / sizeof(lpExpectedWCharArr[0]),
+             L"INFO: uIndex:%u\r\n", uCount);
+    const wchar_t *lpszExpectedArr[1] = {lpExpectedWCharArr};
+
+    for (int i = 0; i < 2; ++i)
+    {
+        struct LogBinaryWriter writer = {0};
+        LogBinaryWriterOpen(&writer, TEST_FILE_PATH, LOG_BINARY_MIN_BUFFER_BYTE_SIZE);
+        StaticWriteEvent(&writer, uCount);
+        assert(1U == writer.formatDynArr.ulSize);
+        LogBinaryWriterClose(&writer);
+
+        assert(StaticDecodeThenAssert(SIZE_MAX, lpszExpectedArr, 1U));
+    }
+}
+
+/**
+ * Many events with small buffer: Records are split across many flushes.
+ */
+static void
+TestLogBinaryManyEvents(_In_ const unsigned uCount)
+{
+    printf("TestLogBinaryManyEvents: uCount:%u\n", uCount);
+
+    struct LogBinaryWriter writer = {0};
+    LogBinaryWriterOpen(&writer, TEST_FILE_PATH, LOG_BINARY_MIN_BUFFER_BYTE_SIZE);
+    for (unsigned i = 0; i < uCount; ++i) {
+        StaticWriteEvent(&writer, i);
+    }
+    LogBinaryWriterClose(&writer);
+
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, TEST_FILE_PATH, CP_UTF8);
+    FILE *fpOutput = tmpfile();
+    assert(NULL != fpOutput);
+    assert(LogBinaryDecode((const unsigned char *) fileMap.lpCharArr, fileMap.ulByteSize, fpOutput, stderr));
+    WStrFileMapClose(&fileMap);
+
+    rewind(fpOutput);
+    wchar_t lpLineWCharArr[TEST_LINE_WCHAR_ARR_LEN];
+    unsigned uLineCount = 0;
+    while (NULL != fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fpOutput))
+    {
+        unsigned uIndex = 0;
+        assert(1 == swscanf(lpLineWCharArr + LOG_PREFIX_MAX_LEN, L"INFO: uIndex:%u", &uIndex));
+        assert(uLineCount == uIndex);
+        ++uLineCount;
+    }
+    assert(uCount == uLineCount);
+    fclose(fpOutput);
+}
+
+/**
+ * Ex: After a crash, last record is incomplete.  All lines before error must be written.
+ */
+static void
+TestLogBinaryTruncated()
+{
+    printf("TestLogBinaryTruncated\n");
+
+    struct LogBinaryWriter writer = {0};
+    LogBinaryWriterOpen(&writer, TEST_FILE_PATH, LOG_BINARY_MIN_BUFFER_BYTE_SIZE);
+    StaticWriteEvent(&writer, 1);
+    StaticWriteEvent(&writer, 2);
+    LogBinaryWriterClose(&writer);
+
+    const wchar_t *lpszExpectedArr[2] = {L"INFO: uIndex:1\r\n", L"INFO: uIndex:2\r\n"};
+    // Header only
+    assert(StaticDecodeThenAssert(sizeof(struct LogBinaryFileHeader), lpszExpectedArr, 0));
+    // Header is incomplete
+    assert(!StaticDecodeThenAssert(sizeof(struct LogBinaryFileHeader) - 1U, lpszExpectedArr, 0));
+
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, TEST_FILE_PATH, CP_UTF8);
+    const size_t ulByteSize = fileMap.ulByteSize;
+    WStrFileMapClose(&fileMap);
+
+    // Each event is: type (1), format id (2), counter (8), then uint32 arg (4) = 15 bytes
+    for (size_t i = 1; i < 15U; ++i) {
+        assert(!StaticDecodeThenAssert(ulByteSize - i, lpszExpectedArr, 1U));
+    }
+    assert(StaticDecodeThenAssert(ulByteSize, lpszExpectedArr, 2U));
+}
+
+static void
+TestLogBinaryLiteralPrecision()
+{
+    printf("TestLogBinaryLiteralPrecision\n");
+
+    // Intentional: Not terminated.  Why?  Literal precision, like '*' precision, must not read past precision.  Ex: struct WStrView
+    const wchar_t lpWCharArr[4] = {L'w', L'x', L'y', L'z'};
+
+    struct LogBinaryWriter writer = {0};
+    LogBinaryWriterOpen(&writer, TEST_FILE_PATH, LOG_BINARY_MIN_BUFFER_BYTE_SIZE);
+    LOG_BINARY_WF(&writer, L"INFO: [%.2ls] [%.ls] [%5.3ls] [%-6.4ls]\r\n", lpWCharArr, lpWCharArr, lpWCharArr, lpWCharArr);
+    LogBinaryWriterClose(&writer);
+
+    const wchar_t *lpszExpectedArr[1] = {L"INFO: [wx] [] [  wxy] [wxyz  ]\r\n"};
+    assert(StaticDecodeThenAssert(SIZE_MAX, lpszExpectedArr, 1U));
+}
+
+/**
+ * Ex: File is corrupt, or from a newer writer.  Decoder must return false, not abort().
+ */
+static void
+TestLogBinaryUnsupportedFormat(_In_ const wchar_t replacementWChar)
+{
+    printf("TestLogBinaryUnsupportedFormat: [%%%lc]\n", replacementWChar);
+
+    struct LogBinaryWriter writer = {0};
+    LogBinaryWriterOpen(&writer, TEST_FILE_PATH, LOG_BINARY_MIN_BUFFER_BYTE_SIZE);
+    StaticWriteEvent(&writer, 1);
+    LogBinaryWriterClose(&writer);
+
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, TEST_FILE_PATH, CP_UTF8);
+    unsigned char lpByteArr[256];
+    assert(fileMap.ulByteSize <= sizeof(lpByteArr));
+    const size_t ulByteSize = fileMap.ulByteSize;
+    memcpy(lpByteArr, fileMap.lpCharArr, ulByteSize);
+    WStrFileMapClose(&fileMap);
+
+    // Replace L"%u" in format record.  Intentional: memcmp(), not wcsstr().  Why?  wchars in file are not aligned.
+    const wchar_t lpFindWCharArr[2] = {L'%', L'u'};
+    bool bIsFound = false;
+    for (size_t i = sizeof(struct LogBinaryFileHeader); i + sizeof(lpFindWCharArr) <= ulByteSize; ++i)
+    {
+        if (0 == memcmp(lpByteArr + i, lpFindWCharArr, sizeof(lpFindWCharArr)))
+        {
+            memcpy(lpByteArr + i + sizeof(wchar_t), &replacementWChar, sizeof(wchar_t));
+            bIsFound = true;
+            break;
+        }
+    }
+    assert(bIsFound);
+
+    FILE *fpOutput = tmpfile();
+    assert(NULL != fpOutput);
+    FILE *fpError = tmpfile();
+    assert(NULL != fpError);
+    assert(!LogBinaryDecode(lpByteArr, ulByteSize, fpOutput, fpError));
+
+    wchar_t lpLineWCharArr[TEST_LINE_WCHAR_ARR_LEN];
+    rewind(fpOutput);
+    assert(NULL == fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fpOutput));
+    rewind(fpError);
+    assert(NULL != fgetws(lpLineWCharArr, TEST_LINE_WCHAR_ARR_LEN, fpError));
+    assert(NULL != wcsstr(lpLineWCharArr, L"Unsupported conversion spec"));
+
+    fclose(fpError);
+    fclose(fpOutput);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestLogBinaryFormatNextSpec(L"abc %% def", 4, 2, 0, 0);
+    TestLogBinaryFormatNextSpec(L"%d", 0, 2, 1, LOG_BINARY_ARG_INT32);
+    TestLogBinaryFormatNextSpec(L"x:%-08lld!", 2, 7, 1, LOG_BINARY_ARG_INT64);
+    TestLogBinaryFormatNextSpec(L"%zu", 0, 3, 1, sizeof(size_t) == 8U ? LOG_BINARY_ARG_INT64 : LOG_BINARY_ARG_INT32);
+    TestLogBinaryFormatNextSpec(L"%I64x", 0, 5, 1, LOG_BINARY_ARG_INT64);
+    TestLogBinaryFormatNextSpec(L"%*.*f", 0, 5, 3, LOG_BINARY_ARG_DOUBLE);
+    TestLogBinaryFormatNextSpec(L"%p", 0, 2, 1, LOG_BINARY_ARG_PTR);
+    TestLogBinaryFormatNextSpec(L"[%ls]", 1, 3, 1, LOG_BINARY_ARG_WSTR);
+    TestLogBinaryFormatNextSpec(L"[%.*ls]", 1, 5, 2, LOG_BINARY_ARG_WSTR_STAR_PRECISION);
+    TestLogBinaryFormatNextSpec(L"[%.5ls]", 1, 5, 1, LOG_BINARY_ARG_WSTR);
+
+    TestLogBinaryDecode(LOG_BINARY_MIN_BUFFER_BYTE_SIZE);
+    TestLogBinaryDecode(LOG_BINARY_DEFAULT_BUFFER_BYTE_SIZE);
+
+    TestLogBinaryLiteralPrecision();
+    TestLogBinaryReopen(7);
+    TestLogBinaryManyEvents(1);
+    TestLogBinaryManyEvents(10000);
+    TestLogBinaryTruncated();
+    // Ex: %n, plain %s, and '\0' at end
+    TestLogBinaryUnsupportedFormat(L'n');
+    TestLogBinaryUnsupportedFormat(L's');
+    TestLogBinaryUnsupportedFormat(L'\0');
+
+    Win32FileDelete(TEST_FILE_PATH);
+    return 0;
+}
@@ -0,0 +1,391 @@
+#include "log_file.h"
+#include "log.h"
+#include "log_async.h"
+#include "wstr.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <wchar.h>    // required for wcslen()
+#include <assert.h>   // required for assert()
+
+static const wchar_t *TEST_FILE_PATH   = L"TestLogFile.log";
+static const wchar_t *TEST_FILE_PATH_1 = L"TestLogFile.log.1";
+static const wchar_t *TEST_FILE_PATH_2 = L"TestLogFile.log.2";
+static const wchar_t *TEST_FILE_PATH_3 = L"TestLogFile.log.3";
+
+static void
+StaticDeleteFiles()
+{
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+    DeleteFile(TEST_FILE_PATH_1);
+    DeleteFile(TEST_FILE_PATH_2);
+    DeleteFile(TEST_FILE_PATH_3);
+}
+
+/**
+ * @return -1 if file does not exist
+ */
+static long long
+StaticGetFileByteSize(_In_ const wchar_t *lpFilePathWCharArr)
+{
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    const HANDLE hFile = CreateFile(lpFilePathWCharArr,     // [in] LPCWSTR lpFileName
+                                    GENERIC_READ,           // [in] DWORD dwDesiredAccess
+                                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,  // [in] DWORD dwShareMode
+                                    NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
+                                    OPEN_EXISTING,          // [in] DWORD dwCreationDisposition
+                                    FILE_ATTRIBUTE_NORMAL,  // [in] DWORD dwFlagsAndAttributes
+                                    NULL);                  // [in, optional] hTemplateFile
+    if (INVALID_HANDLE_VALUE == hFile) {
+        return -1;
+    }
+    LARGE_INTEGER fileSize = {0};
+    assert(GetFileSizeEx(hFile, &fileSize));
+    assert(CloseHandle(hFile));
+    return fileSize.QuadPart;
+}
+
+static void
+StaticAssertFile(_In_ const wchar_t *lpFilePathWCharArr,
+                 _In_ const wchar_t *lpszExpected)
+{
+    struct WStr inputWStr = {};
+    WStrFileRead(lpFilePathWCharArr, CP_UTF8, &inputWStr);
+    const size_t ulExpectedSize = wcslen(lpszExpected);
+    if (inputWStr.ulSize != ulExpectedSize || 0 != wmemcmp(lpszExpected, inputWStr.lpWCharArr, ulExpectedSize))
+    {
+        printf("%ls: Expected [%ls], but found [%.*ls]\n",
+               lpFilePathWCharArr, lpszExpected, (int) inputWStr.ulSize, inputWStr.lpWCharArr);
+    }
+    assert(inputWStr.ulSize == ulExpectedSize);
+    assert(0 == wmemcmp(lpszExpected, inputWStr.lpWCharArr, ulExpectedSize));
+    WStrFree(&inputWStr);
+}
+
+static void
+StaticWriteLine(_Inout_ struct LogFile *lpLogFile,
+                _In_    const wchar_t  *lpszLine)
+{
+    LogFileWriteLine(lpLogFile, lpszLine, wcslen(lpszLine));
+}
+
+static void
+TestLogFileFlushThreshold()
+{
+    printf("TestLogFileFlushThreshold\n");
+    StaticDeleteFiles();
+
+    struct LogFile logFile = {0};
+    LogFileOpen(&logFile, &(struct LogFileConfig) {
+        .lpFilePathWCharArr       = TEST_FILE_PATH,
+        .ulBufferByteSize         = LOG_FILE_MIN_BUFFER_BYTE_SIZE,
+        .ulFlushThresholdByteSize = 20U,
+    });
+    // 10 bytes
+    StaticWriteLine(&logFile, L"abcdefgh\r\n");
+    assert(10U == logFile.ulBufferByteSize);
+    assert(0 == StaticGetFileByteSize(TEST_FILE_PATH));
+
+    StaticWriteLine(&logFile, L"ijklmnop\r\n");
+    assert(0 == logFile.ulBufferByteSize);
+    assert(20 == StaticGetFileByteSize(TEST_FILE_PATH));
+
+    StaticWriteLine(&logFile, L"qrstuvwx\r\n");
+    assert(20 == StaticGetFileByteSize(TEST_FILE_PATH));
+    LogFileClose(&logFile);
+    assert(NULL == logFile.hFile);
+
+    StaticAssertFile(TEST_FILE_PATH, L"abcdefgh\r\nijklmnop\r\nqrstuvwx\r\n");
+    // Intentional: Safe to call twice.
+    LogFileClose(&logFile);
+    StaticDeleteFiles();
+}
+
+static void
+TestLogFileFlushInterval()
+{
+    printf("TestLogFileFlushInterval\n");
+    StaticDeleteFiles();
+
+    struct LogFile logFile = {0};
+    LogFileOpen(&logFile, &(struct LogFileConfig) {
+        .lpFilePathWCharArr    = TEST_FILE_PATH,
+        .ulBufferByteSize      = LOG_FILE_MIN_BUFFER_BYTE_SIZE,
+        .dwFlushIntervalMillis = 20U,
+    });
+    StaticWriteLine(&logFile, L"abc\r\n");
+    LogFileTick(&logFile);
+    assert(0 == StaticGetFileByteSize(TEST_FILE_PATH));
+
+    Sleep(40U);
+    LogFileTick(&logFile);
+    assert(5 == StaticGetFileByteSize(TEST_FILE_PATH));
+    LogFileClose(&logFile);
+    StaticDeleteFiles();
+}
+
+static void
+TestLogFileRotateBySize(_In_ const unsigned  uRetentionCount,
+                        _In_ const wchar_t  *lpszExpected,
+                        _In_ const wchar_t  *lpszExpected1,
+                        _In_ const wchar_t  *lpszExpected2)
+{
+    printf("TestLogFileRotateBySize: uRetentionCount:%u\n", uRetentionCount);
+    StaticDeleteFiles();
+
+    struct LogFile logFile = {0};
+    LogFileOpen(&logFile, &(struct LogFileConfig) {
+        .lpFilePathWCharArr = TEST_FILE_PATH,
+        .ulBufferByteSize   = LOG_FILE_MIN_BUFFER_BYTE_SIZE,
+        // Three lines per file
+        .ullMaxFileByteSize = 20U,
+        .uRetentionCount    = uRetentionCount,
+    });
+    // Each line is 6 bytes: "line0\n"
+    for (unsigned i = 0; i < 10U; ++i)
+    {
+        wchar_t lpLineWCharArr[16];
+        swprintf(lpLineWCharArr, sizeof(lpLineWCharArr) / sizeof(lpLineWCharArr[0]), L"line%u\n", i);
+        StaticWriteLine(&logFile, lpLineWCharArr);
+        assert(logFile.ullFileByteSize <= 20U);
+    }
+    assert(3U == logFile.ulRotateCount);
+    LogFileClose(&logFile);
+
+    StaticAssertFile(TEST_FILE_PATH, lpszExpected);
+    if (NULL == lpszExpected1) {
+        assert(-1 == StaticGetFileByteSize(TEST_FILE_PATH_1));
+    }
+    else {
+        StaticAssertFile(TEST_FILE_PATH_1, lpszExpected1);
+    }
+    if (NULL == lpszExpected2) {
+        assert(-1 == StaticGetFileByteSize(TEST_FILE_PATH_2));
+    }
+    else {
+        StaticAssertFile(TEST_FILE_PATH_2, lpszExpected2);
+    }
+    assert(-1 == StaticGetFileByteSize(TEST_FILE_PATH_3));
+    StaticDeleteFiles();
+}
+
+static void
+TestLogFileRotateByAge()
+{
+    printf("TestLogFileRotateByAge\n");
+    StaticDeleteFiles();
+
+    struct LogFile logFile = {0};
+    LogFileOpen(&logFile, &(struct LogFileConfig) {
+        .lpFilePathWCharArr = TEST_FILE_PATH,
+        .ulBufferByteSize   = LOG_FILE_MIN_BUFFER_BYTE_SIZE,
+        .dwMaxFileAgeMillis = 20U,
+        .uRetentionCount    = 1U,
+    });
+    // Intentional: Empty file is never rotated.
+    Sleep(40U);
+    LogFileTick(&logFile);
+    assert(0U == logFile.ulRotateCount);
+
+    StaticWriteLine(&logFile, L"abc\n");
+    Sleep(40U);
+    LogFileTick(&logFile);
+    assert(1U == logFile.ulRotateCount);
+    StaticWriteLine(&logFile, L"def\n");
+    LogFileClose(&logFile);
+
+    StaticAssertFile(TEST_FILE_PATH, L"def\n");
+    StaticAssertFile(TEST_FILE_PATH_1, L"abc\n");
+    StaticDeleteFiles();
+}
+
+static void
+TestLogFileReopenAppend()
+{
+    printf("TestLogFileReopenAppend\n");
+    StaticDeleteFiles();
+
+    const struct LogFileConfig config = {
+        .lpFilePathWCharArr = TEST_FILE_PATH,
+        .ulBufferByteSize   = LOG_FILE_DEFAULT_BUFFER_BYTE_SIZE,
+        .ullMaxFileByteSize = 1000U,
+        .uRetentionCount    = 1U,
+    };
+    struct LogFile logFile = {0};
+    LogFileOpen(&logFile, &config);
+    StaticWriteLine(&logFile, L"abc\n");
+    LogFileSync(&logFile);
+    LogFileClose(&logFile);
+
+    LogFileOpen(&logFile, &config);
+    assert(4U == logFile.ullFileByteSize);
+    StaticWriteLine(&logFile, L"def\n");
+    LogFileClose(&logFile);
+
+    StaticAssertFile(TEST_FILE_PATH, L"abc\ndef\n");
+    StaticDeleteFiles();
+}
+
+static void
+TestLogFileEncode()
+{
+    printf("TestLogFileEncode\n");
+    StaticDeleteFiles();
+
+    struct LogFile logFile = {0};
+    LogFileOpen(&logFile, &(struct LogFileConfig) {
+        .lpFilePathWCharArr = TEST_FILE_PATH,
+        .ulBufferByteSize   = LOG_FILE_MIN_BUFFER_BYTE_SIZE,
+    });
+    // Unpaired surrogate is replaced with U+FFFD.
+    const wchar_t lpInvalidWCharArr[] = {L'a', (wchar_t) 0xD800U, L'b', L'\n'};
+    LogFileWriteLine(&logFile, lpInvalidWCharArr, sizeof(lpInvalidWCharArr) / sizeof(lpInvalidWCharArr[0]));
+    assert(6U == logFile.ulBufferByteSize);
+
+    // Intentional: Longer than buffer.  Why?  Line is written in pieces.  Each U+00E9 is 2 bytes.
+    wchar_t lpLongWCharArr[3000];
+    const size_t ulLongLen = sizeof(lpLongWCharArr) / sizeof(lpLongWCharArr[0]) - 1U;
+    wmemset(lpLongWCharArr, (wchar_t) 0x00E9U, ulLongLen - 1U);
+    lpLongWCharArr[ulLongLen - 1U] = L'\n';
+    lpLongWCharArr[ulLongLen] = L'\0';
+    assert(2U * ulLongLen > LOG_FILE_MIN_BUFFER_BYTE_SIZE);
+    LogFileWriteLine(&logFile, lpLongWCharArr, ulLongLen);
+    assert(6U + 2U * ulLongLen - 1U == logFile.ullFileByteSize);
+    LogFileClose(&logFile);
+
+    wchar_t lpExpectedWCharArr[3010];
+    swprintf(lpExpectedWCharArr, sizeof(lpExpectedWCharArr) / sizeof(lpExpectedWCharArr[0]), L"a%lcb\n%ls", (wchar_t) 0xFFFDU, lpLongWCharArr);
+    StaticAssertFile(TEST_FILE_PATH, lpExpectedWCharArr);
+    StaticDeleteFiles();
+}
+
+/**
+ * @return number of lines in file
+ */
+static size_t
+StaticCountLines(_In_ const wchar_t *lpFilePathWCharArr)
+{
+    struct WStr inputWStr = {};
+    WStrFileRead(lpFilePathWCharArr, CP_UTF8, &inputWStr);
+    size_t ulCount = 0;
+    for (size_t i = 0; i < inputWStr.ulSize; ++i)
+    {
+        if (L'\n' == inputWStr.lpWCharArr[i]) {
+            ++ulCount;
+        }
+    }
+    WStrFree(&inputWStr);
+    return ulCount;
+}
+
+static void
+TestLogSetFile(_In_ const bool bIsAsync)
+{
+    printf("TestLogSetFile: bIsAsync:%d\n", bIsAsync);
+    StaticDeleteFiles();
+
+    struct LogFile logFile = {0};
+    LogFileOpen(&logFile, &(struct LogFileConfig) {
+        .lpFilePathWCharArr    = TEST_FILE_PATH,
+        .ulBufferByteSize      = LOG_FILE_DEFAULT_BUFFER_BYTE_SIZE,
+        // Intentional: Never flush by policy.  Why?  Only LogAsyncFlush() and LogAsyncStop() write the file.
+        .dwFlushIntervalMillis = 0,
+    });
+    LogSetFile(&logFile);
+    assert(&logFile == LogGetFile());
+    if (bIsAsync) {
+        LogAsyncStart(LOG_ASYNC_OVERFLOW_BLOCK);
+    }
+
+    const unsigned uCount = 1000U;
+    for (unsigned i = 0; i < uCount; ++i) {
+        LogWF(stdout, L"INFO: %u\r\n", i);
+    }
+    if (bIsAsync)
+    {
+        LogAsyncFlush();
+        assert(uCount == StaticCountLines(TEST_FILE_PATH));
+        LogAsyncStop();
+    }
+    else
+    {
+        LogFileFlush(&logFile);
+        assert(uCount == StaticCountLines(TEST_FILE_PATH));
+    }
+
+    LogSetFile(NULL);
+    assert(NULL == LogGetFile());
+    LogFileClose(&logFile);
+    StaticDeleteFiles();
+}
+
+static void
+TestLogFileInit()
+{
+    printf("TestLogFileInit\n");
+    StaticDeleteFiles();
+
+    FILE *fpError = tmpfile();
+    assert(NULL != fpError);
+    struct LogFile logFile = {0};
+    {
+        wchar_t *lpszArgvArr[] = {L"app.exe", L"config.txt", NULL};
+        int iArgc = 2;
+        assert(LogFileInit(&iArgc, lpszArgvArr, &logFile, fpError));
+        assert(2 == iArgc);
+        assert(NULL == logFile.hFile);
+        assert(NULL == LogGetFile());
+    }
+    {
+        wchar_t *lpszArgvArr[] = {L"app.exe", L"--log-file=", L"config.txt", NULL};
+        int iArgc = 3;
+        assert(!LogFileInit(&iArgc, lpszArgvArr, &logFile, fpError));
+        assert(2 == iArgc);
+        assert(NULL == LogGetFile());
+    }
+    {
+        wchar_t *lpszArgvArr[] = {L"app.exe", L"--log-file=TestLogFile.log", L"--log-file=TestLogFile.log", NULL};
+        int iArgc = 3;
+        assert(!LogFileInit(&iArgc, lpszArgvArr, &logFile, fpError));
+        assert(1 == iArgc);
+        assert(NULL == lpszArgvArr[1]);
+        assert(NULL == LogGetFile());
+    }
+    {
+        wchar_t *lpszArgvArr[] = {L"app.exe", L"--log-file=TestLogFile.log", L"config.txt", NULL};
+        int iArgc = 3;
+        assert(LogFileInit(&iArgc, lpszArgvArr, &logFile, fpError));
+        assert(2 == iArgc);
+        assert(0 == wcscmp(L"config.txt", lpszArgvArr[1]));
+        assert(NULL == lpszArgvArr[2]);
+        assert(&logFile == LogGetFile());
+        assert(0 == wcscmp(TEST_FILE_PATH, logFile.lpFilePathWCharArr));
+    }
+    LogSetFile(NULL);
+    LogFileClose(&logFile);
+    fclose(fpError);
+    StaticDeleteFiles();
+}
+
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestLogFileFlushThreshold();
+    TestLogFileFlushInterval();
+    // Lines 0-2, 3-5, 6-8, then 9
+    TestLogFileRotateBySize(2U, L"line9\n", L"line6\nline7\nline8\n", L"line3\nline4\nline5\n");
+    TestLogFileRotateBySize(1U, L"line9\n", L"line6\nline7\nline8\n", NULL);
+    TestLogFileRotateBySize(0U, L"line9\n", NULL, NULL);
+    TestLogFileRotateByAge();
+    TestLogFileReopenAppend();
+    TestLogFileEncode();
+    TestLogSetFile(false);
+    TestLogSetFile(true);
+    TestLogFileInit();
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include "log.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <wchar.h>    // required for wcscmp()
+#include <assert.h>   // required for assert()
+
+static void
+TestLogLevelParse(_In_ const wchar_t        *lpszName,
+                  _In_ const bool            bExpectedResult,
+                  _In_ const enum ELogLevel  eExpectedLevel)
+{
+    printf("TestLogLevelParse: [%ls]\n", lpszName);
+
+    enum ELogLevel eLevel = LOG_LEVEL_OFF;
+    assert(bExpectedResult == LogLevelParse(lpszName, &eLevel));
+    if (bExpectedResult)
+    {
+        assert(eExpectedLevel == eLevel);
+        assert(0 == _wcsicmp(lpszName, LogLevelToName(eLevel)));
+    }
+}
+
+static void
+TestLogLevelInit(_In_ const int             iArgc,
+                 _In_ const wchar_t *const *lpszArgvArr,
+                 _In_ const bool            bExpectedResult,
+                 _In_ const enum ELogLevel  eExpectedLevel,
+                 _In_ const int             iExpectedArgc)
+{
+    printf("TestLogLevelInit: iArgc:%d\n", iArgc);
+
+    // Intentional: Copy.  Why?  LogLevelInit() removes args.
+    wchar_t *lpszArgvCopyArr[8] = {0};
+    assert(iArgc < (int) (sizeof(lpszArgvCopyArr) / sizeof(lpszArgvCopyArr[0])));
+    for (int i = 0; i < iArgc; ++i) {
+        lpszArgvCopyArr[i] = (wchar_t *) lpszArgvArr[i];
+    }
+
+    FILE *fpError = tmpfile();
+    assert(NULL != fpError);
+
+    LogSetLevel(LOG_LEVEL_DEFAULT);
+    int iArgcCopy = iArgc;
+    assert(bExpectedResult == LogLevelInit(&iArgcCopy, lpszArgvCopyArr, fpError));
+    assert(eExpectedLevel == LogGetLevel());
+    assert(iExpectedArgc == iArgcCopy);
+    assert(NULL == lpszArgvCopyArr[iArgcCopy]);
+    for (int i = 0; i < iArgcCopy; ++i) {
+        assert(0 != wcsncmp(LOG_LEVEL_ARG_PREFIX, lpszArgvCopyArr[i], wcslen(LOG_LEVEL_ARG_PREFIX)));
+    }
+
+    // Intentional: Error is printed only if result is false.
+    wchar_t lpLineWCharArr[256];
+    rewind(fpError);
+    assert(bExpectedResult == (NULL == fgetws(lpLineWCharArr, sizeof(lpLineWCharArr) / sizeof(lpLineWCharArr[0]), fpError)));
+    fclose(fpError);
+}
+
+static void
+TestLogLevelMacros()
+{
+    printf("TestLogLevelMacros\n");
+
+    FILE *fp = tmpfile();
+    assert(NULL != fp);
+
+    int iEvalCount = 0;
+    LogSetLevel(LOG_LEVEL_INFO);
+    // Intentional: Disabled: Args are not evaluated.
+    TRACE_LOGWF(fp, L"TRACE: %d\r\n", ++iEvalCount);
+    DEBUG_LOGWF(fp, L"DEBUG: %d\r\n", ++iEvalCount);
+    assert(0 == iEvalCount);
+    INFO_LOGWF(fp, L"INFO: %d\r\n", ++iEvalCount);
+    WARN_LOGW(fp, L"WARN\r\n");
+    ERROR_LOGW(fp, L"ERROR\r\n");
+    assert(1 == iEvalCount);
+
+    LogSetLevel(LOG_LEVEL_OFF);
+    ERROR_LOGW(fp, L"OFF\r\n");
+    LogSetLevel(LOG_LEVEL_TRACE);
+    TRACE_LOGW(fp, L"TRACE\r\n");
+    LogSetLevel(LOG_LEVEL_DEFAULT);
+    fflush(fp);
+
+    const wchar_t *lpszExpectedArr[] = {L"INFO: 1\r\n", L"WARN\r\n", L"ERROR\r\n", L"TRACE\r\n"};
+    const size_t ulExpectedCount = sizeof(lpszExpectedArr) / sizeof(lpszExpectedArr[0]);
+    rewind(fp);
+    wchar_t lpLineWCharArr[256];
+    for (size_t i = 0; i < ulExpectedCount; ++i)
+    {
+        assert(NULL != fgetws(lpLineWCharArr, sizeof(lpLineWCharArr) / sizeof(lpLineWCharArr[0]), fp));
+        assert(0 == wcscmp(lpszExpectedArr[i], lpLineWCharArr + LOG_PREFIX_MAX_LEN));
+    }
+    assert(NULL == fgetws(lpLineWCharArr, sizeof(lpLineWCharArr) / sizeof(lpLineWCharArr[0]), fp));
+    fclose(fp);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    assert(LOG_LEVEL_DEFAULT == LogGetLevel());
+
+    TestLogLevelParse(L"trace", true, LOG_LEVEL_TRACE);
+    TestLogLevelParse(L"DEBUG", true, LOG_LEVEL_DEBUG);
+    TestLogLevelParse(L"Info", true, LOG_LEVEL_INFO);
+    TestLogLevelParse(L"warn", true, LOG_LEVEL_WARN);
+    TestLogLevelParse(L"error", true, LOG_LEVEL_ERROR);
+    TestLogLevelParse(L"off", true, LOG_LEVEL_OFF);
+    TestLogLevelParse(L"", false, 0);
+    TestLogLevelParse(L"verbose", false, 0);
+    TestLogLevelParse(L"info ", false, 0);
+
+    // Intentional: Test does not set environment variable LOG_LEVEL_ENV_VAR_NAME.
+    {
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"config.txt"};
+        TestLogLevelInit(2, lpszArgvArr, true, LOG_LEVEL_DEFAULT, 2);
+    }
+    {
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"--log-level=trace", L"config.txt"};
+        TestLogLevelInit(3, lpszArgvArr, true, LOG_LEVEL_TRACE, 2);
+    }
+    {
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"config.txt", L"--log-level=warn"};
+        TestLogLevelInit(3, lpszArgvArr, true, LOG_LEVEL_WARN, 2);
+    }
+    {
+        // Last arg wins
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"--log-level=trace", L"--log-level=off"};
+        TestLogLevelInit(3, lpszArgvArr, true, LOG_LEVEL_OFF, 1);
+    }
+    {
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"--log-level=loud", L"config.txt"};
+        TestLogLevelInit(3, lpszArgvArr, false, LOG_LEVEL_DEFAULT, 2);
+    }
+    {
+        // Each arg is parsed: Invalid earlier arg is an error, even if last arg is valid.
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"--log-level=bogus", L"--log-level=info"};
+        TestLogLevelInit(3, lpszArgvArr, false, LOG_LEVEL_DEFAULT, 1);
+    }
+
+    TestLogLevelMacros();
+    return 0;
+}
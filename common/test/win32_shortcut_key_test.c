@@ -109,6 +109,12 @@ int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The ope
     TestWin32ShortcutKeyTryParseWStr(L"LCtrl+LShift+Alt+0x50",
                                      &((const struct Win32ShortcutKey) { .eKeyModifiers = 0, .dwVkCode = 0 }),
                                      L"Failed to parse shortcut key [LCtrl+LShift+Alt+0x50]: Shortcut key modifier [Alt] is not supported: Please use [LAlt] or [RAlt]");
+    TestWin32ShortcutKeyTryParseWStr(L"LCtrl+lctrl+0x50",
+                                     &((const struct Win32ShortcutKey) { .eKeyModifiers = 0, .dwVkCode = 0 }),
+                                     L"Failed to parse shortcut key [LCtrl+lctrl+0x50]: Multiple LCtrl modifiers are not allowed");
+    TestWin32ShortcutKeyTryParseWStr(L"LCtrl+Win+0x50",
+                                     &((const struct Win32ShortcutKey) { .eKeyModifiers = 0, .dwVkCode = 0 }),
+                                     L"Failed to parse shortcut key [LCtrl+Win+0x50]: Unknown modifier: [Win]");
     TestWin32ShortcutKeyTryParseWStr(L"LCtrl+LShift+LAlt",
                                      &((const struct Win32ShortcutKey) { .eKeyModifiers = 0, .dwVkCode = 0 }),
                                      L"Failed to parse shortcut key [LCtrl+LShift+LAlt]: Failed to parse virtual key code [LAlt]: Expected hexidecimal integer, e.g., 0x50");
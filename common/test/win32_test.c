@@ -0,0 +1,202 @@
+#include "win32.h"
+#include <stdio.h>   // required for printf()
+#include <wchar.h>   // required for wcscmp(), wcsncmp(), wcslen()
+#include <assert.h>  // required for assert()
+
+static void
+TestWin32MsgToText()
+{
+    printf("TestWin32MsgToText\n");
+
+    assert(0 == wcscmp(L"WM_NULL", Win32MsgToText(WM_NULL)));
+    assert(0 == wcscmp(L"WM_PAINT", Win32MsgToText(WM_PAINT)));
+    assert(0 == wcscmp(L"WM_MOUSEMOVE", Win32MsgToText(WM_MOUSEMOVE)));
+    assert(0 == wcscmp(L"WM_DPICHANGED", Win32MsgToText(0x02E0)));
+    // First name, not alias
+    assert(0 == wcscmp(L"WM_WININICHANGE", Win32MsgToText(WM_SETTINGCHANGE)));
+    assert(0 == wcscmp(L"WM_RASDIALEVENT", Win32MsgToText(52429)));
+    // Unknown: Before first, between, and after last
+    assert(0 == wcscmp(L"???", Win32MsgToText(4)));
+    assert(0 == wcscmp(L"???", Win32MsgToText(WM_APP + 1)));
+    assert(0 == wcscmp(L"???", Win32MsgToText(0xFFFFFFFF)));
+}
+
+static void
+TestWin32MsgFromText()
+{
+    printf("TestWin32MsgFromText\n");
+
+    UINT uMsg = 0;
+    assert(Win32MsgFromText(L"WM_KEYDOWN", &uMsg));
+    assert(WM_KEYDOWN == uMsg);
+    // Alias
+    assert(Win32MsgFromText(L"WM_USER", &uMsg));
+    assert(WM_USER == uMsg);
+    assert(Win32MsgFromText(L"WM_SETTINGCHANGE", &uMsg));
+    assert(WM_SETTINGCHANGE == uMsg);
+
+    uMsg = 123U;
+    assert(!Win32MsgFromText(L"WM_XYZ", &uMsg));
+    assert(!Win32MsgFromText(L"wm_keydown", &uMsg));
+    assert(!Win32MsgFromText(L"", &uMsg));
+    assert(123U == uMsg);
+
+    // Round trip for each known message: Also checks table is sorted.  Why?  Else binary search misses some.
+    size_t ulCount = 0;
+    for (UINT u = 0; u <= 0xFFFFU; ++u)
+    {
+        const wchar_t *lpszName = Win32MsgToText(u);
+        if (0 != wcscmp(L"???", lpszName))
+        {
+            ++ulCount;
+            assert(Win32MsgFromText(lpszName, &uMsg));
+            assert(u == uMsg);
+        }
+    }
+    assert(ulCount > 700U);
+}
+
+static void
+TestWin32MsgToCategories()
+{
+    printf("TestWin32MsgToCategories\n");
+
+    assert(WIN32_MSG_CATEGORY_MOUSE == Win32MsgToCategories(WM_MOUSEMOVE));
+    assert((WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE) == Win32MsgToCategories(WM_NCMOUSEMOVE));
+    assert(WIN32_MSG_CATEGORY_KEYBOARD == Win32MsgToCategories(WM_KEYUP));
+    assert(WIN32_MSG_CATEGORY_PAINT == Win32MsgToCategories(WM_PAINT));
+    assert(WIN32_MSG_CATEGORY_TIMER == Win32MsgToCategories(WM_TIMER));
+    assert(WIN32_MSG_CATEGORY_WINDOW == Win32MsgToCategories(WM_SIZE));
+    assert(WIN32_MSG_CATEGORY_NOTIFY == Win32MsgToCategories(WM_COMMAND));
+    assert(WIN32_MSG_CATEGORY_CONTROL == Win32MsgToCategories(LB_GETCURSEL));
+    assert(WIN32_MSG_CATEGORY_OTHER == Win32MsgToCategories(WM_APP + 1));
+
+    // Each known message has at least one category
+    for (UINT u = 0; u <= 0xFFFFU; ++u)
+    {
+        const enum EWin32MsgCategory e = Win32MsgToCategories(u);
+        assert(0 != e);
+        assert(e == (e & WIN32_MSG_CATEGORY_ALL));
+    }
+}
+
+static void
+TestWin32MsgCategoriesFromText(_In_ const wchar_t                *lpszCsv,
+                               _In_ const bool                    bExpectedResult,
+                               _In_ const enum EWin32MsgCategory  eExpectedCategories)
+{
+    printf("TestWin32MsgCategoriesFromText: [%ls]\n", lpszCsv);
+
+    enum EWin32MsgCategory e = WIN32_MSG_CATEGORY_TIMER;
+    assert(bExpectedResult == Win32MsgCategoriesFromText(lpszCsv, &e));
+    assert(eExpectedCategories == e);
+}
+
+struct TestArgvValues
+{
+    int            iCallCount;
+    // @Nullable
+    const wchar_t *lpszNullableLastValue;
+};
+
+// See: Win32ArgvValueFunc
+static bool
+TestArgvValue(_In_    const wchar_t *lpszValue,
+              _Inout_ void          *lpContext)
+{
+    struct TestArgvValues *lpValues = lpContext;
+    ++(lpValues->iCallCount);
+    lpValues->lpszNullableLastValue = lpszValue;
+    const bool x = (0 != wcscmp(L"bad", lpszValue));
+    return x;
+}
+
+static void
+TestWin32ArgvRemovePrefix(_In_ const int       iArgc,
+                          _In_ const wchar_t **lpszArgvArr,
+                          _In_ const bool      bExpectedResult,
+                          _In_ const int       iExpectedCallCount,
+                          _In_ const wchar_t  *lpszNullableExpectedLastValue,
+                          _In_ const int       iExpectedArgc)
+{
+    printf("TestWin32ArgvRemovePrefix: iArgc:%d\n", iArgc);
+
+    // Intentional: Copy.  Why?  Win32ArgvRemovePrefix() removes args.
+    wchar_t *lpszArgvCopyArr[8] = {0};
+    assert(iArgc < (int) (sizeof(lpszArgvCopyArr) / sizeof(lpszArgvCopyArr[0])));
+    for (int i = 0; i < iArgc; ++i) {
+        lpszArgvCopyArr[i] = (wchar_t *) lpszArgvArr[i];
+    }
+
+    int iArgcCopy = iArgc;
+    struct TestArgvValues values = {0};
+    assert(bExpectedResult == Win32ArgvRemovePrefix(&iArgcCopy, lpszArgvCopyArr, L"--abc=", TestArgvValue, &values));
+    assert(iExpectedArgc == iArgcCopy);
+    assert(iExpectedCallCount == values.iCallCount);
+    if (NULL == lpszNullableExpectedLastValue) {
+        assert(NULL == values.lpszNullableLastValue);
+    }
+    else {
+        assert(0 == wcscmp(lpszNullableExpectedLastValue, values.lpszNullableLastValue));
+    }
+    // Other args keep their order.
+    int iDestIndex = 0;
+    for (int i = 0; i < iArgc; ++i)
+    {
+        if (0 == i || 0 != wcsncmp(L"--abc=", lpszArgvArr[i], wcslen(L"--abc=")))
+        {
+            assert(lpszArgvArr[i] == lpszArgvCopyArr[iDestIndex]);
+            ++iDestIndex;
+        }
+    }
+    assert(iExpectedArgc == iDestIndex);
+    assert(NULL == lpszArgvCopyArr[iArgcCopy]);
+}
+
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestWin32MsgToText();
+    TestWin32MsgFromText();
+    TestWin32MsgToCategories();
+    TestWin32MsgCategoriesFromText(L"mouse", true, WIN32_MSG_CATEGORY_MOUSE);
+    TestWin32MsgCategoriesFromText(L"keyboard,window", true, WIN32_MSG_CATEGORY_KEYBOARD | WIN32_MSG_CATEGORY_WINDOW);
+    TestWin32MsgCategoriesFromText(L"all", true, WIN32_MSG_CATEGORY_ALL);
+    TestWin32MsgCategoriesFromText(L"all,-mouse,-timer", true,
+                                   WIN32_MSG_CATEGORY_ALL & ~(WIN32_MSG_CATEGORY_MOUSE | WIN32_MSG_CATEGORY_TIMER));
+    // Left to right
+    TestWin32MsgCategoriesFromText(L"-mouse,mouse", true, WIN32_MSG_CATEGORY_MOUSE);
+    TestWin32MsgCategoriesFromText(L"-all", true, 0);
+    // Invalid: Unchanged
+    TestWin32MsgCategoriesFromText(L"", false, WIN32_MSG_CATEGORY_TIMER);
+    TestWin32MsgCategoriesFromText(L"mouse,", false, WIN32_MSG_CATEGORY_TIMER);
+    TestWin32MsgCategoriesFromText(L"mouse,,paint", false, WIN32_MSG_CATEGORY_TIMER);
+    TestWin32MsgCategoriesFromText(L"Mouse", false, WIN32_MSG_CATEGORY_TIMER);
+    TestWin32MsgCategoriesFromText(L"mouses", false, WIN32_MSG_CATEGORY_TIMER);
+    TestWin32MsgCategoriesFromText(L"-", false, WIN32_MSG_CATEGORY_TIMER);
+    {
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"config.txt"};
+        TestWin32ArgvRemovePrefix(2, lpszArgvArr, true, 0, NULL, 2);
+    }
+    {
+        // First arg is path to executable: Never removed.
+        const wchar_t *lpszArgvArr[] = {L"--abc=exe", L"--abc=", L"config.txt"};
+        TestWin32ArgvRemovePrefix(3, lpszArgvArr, true, 1, L"", 2);
+    }
+    {
+        // Each value, left to right
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"--abc=1", L"config.txt", L"--abc", L"--abc=2"};
+        TestWin32ArgvRemovePrefix(5, lpszArgvArr, true, 2, L"2", 3);
+    }
+    {
+        // Invalid earlier value: Later args are still removed, but not passed to callback.
+        const wchar_t *lpszArgvArr[] = {L"app.exe", L"--abc=bad", L"config.txt", L"--abc=2"};
+        TestWin32ArgvRemovePrefix(4, lpszArgvArr, false, 1, L"bad", 2);
+    }
+    return 0;
+}
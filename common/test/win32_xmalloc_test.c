@@ -0,0 +1,114 @@
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <string.h>   // required for memset()
+#include <assert.h>   // required for assert()
+
+static void
+TestXMallocHeap(_In_ const enum EXMallocHeap eHeap)
+{
+    printf("TestXMallocHeap: %d\n", (int) eHeap);
+
+    XMallocInit(eHeap);
+
+    unsigned char *lpByteArr = xcalloc(100, sizeof(unsigned char));
+    for (size_t i = 0; i < 100; ++i)
+    {
+        assert(0 == lpByteArr[i]);
+        lpByteArr[i] = (unsigned char) i;
+    }
+
+    // New bytes are zeroed.  Old bytes are unchanged.
+    xrealloc((void **) &lpByteArr, 1000);
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        assert(((i < 100) ? i : 0) == lpByteArr[i]);
+    }
+    xfree((void **) &lpByteArr);
+    assert(NULL == lpByteArr);
+
+    // Not zeroed: Only check block is writable.
+    unsigned char *lpBufferArr = xmalloc(4096);
+    memset(lpBufferArr, 0xAB, 4096);
+    assert(0xAB == lpBufferArr[4095]);
+    xfree((void **) &lpBufferArr);
+
+    // Intentional: Restore default.  Why?  Every block from this heap is freed, and private heap is destroyed.
+    XMallocInit(XMALLOC_HEAP_PROCESS);
+}
+
+// Build with: XMALLOC_STATS=1 ./build.bash
+#ifdef XMALLOC_STATS
+
+static void
+TestXMallocStatsCallocReallocFree()
+{
+    printf("TestXMallocStatsCallocReallocFree\n");
+
+    struct XMallocStats before = {0};
+    XMallocStatsGet(&before);
+
+    // 10 bytes -> histogram bucket for 8-15 bytes
+    char *lpCharArr = xcalloc(10, sizeof(char));
+    struct XMallocStats after = {0};
+    XMallocStatsGet(&after);
+    assert(before.ulCallocCount + 1U == after.ulCallocCount);
+    assert(before.ulTotalByteSize + 10U == after.ulTotalByteSize);
+    assert(before.ulLiveByteSize + 10U <= after.ulLiveByteSize);
+    assert(after.ulLiveByteSize <= after.ulPeakByteSize);
+    assert(before.ulHistogramArr[3] + 1U == after.ulHistogramArr[3]);
+
+    // 1000 bytes -> histogram bucket for 512-1023 bytes
+    xrealloc((void **) &lpCharArr, 1000U);
+    XMallocStatsGet(&after);
+    assert(before.ulReallocCount + 1U == after.ulReallocCount);
+    assert(before.ulTotalByteSize + 1010U == after.ulTotalByteSize);
+    assert(before.ulLiveByteSize + 1000U <= after.ulLiveByteSize);
+    assert(before.ulHistogramArr[9] + 1U == after.ulHistogramArr[9]);
+
+    xfree((void **) &lpCharArr);
+    assert(NULL == lpCharArr);
+    XMallocStatsGet(&after);
+    assert(before.ulFreeCount + 1U == after.ulFreeCount);
+    assert(before.ulLiveByteSize == after.ulLiveByteSize);
+    assert(before.ulLiveByteSize + 1000U <= after.ulPeakByteSize);
+
+    // Intentional: xfree(NULL) is not counted.
+    xfree((void **) &lpCharArr);
+    XMallocStatsGet(&before);
+    assert(before.ulFreeCount == after.ulFreeCount);
+}
+
+static void
+TestXMallocStatsFPrint()
+{
+    printf("TestXMallocStatsFPrint\n");
+
+    void *lpData = xcalloc(3, 7);
+    XMallocStatsFPrint(stdout, "TestXMallocStatsFPrint");
+    xfree(&lpData);
+}
+
+#endif  // XMALLOC_STATS
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestXMallocHeap(XMALLOC_HEAP_PROCESS);
+    TestXMallocHeap(XMALLOC_HEAP_PRIVATE_NO_SERIALIZE);
+
+#ifdef XMALLOC_STATS
+    TestXMallocStatsCallocReallocFree();
+    TestXMallocStatsFPrint();
+#else
+    printf("Skip: Build with XMALLOC_STATS to test instrumentation\n");
+#endif  // XMALLOC_STATS
+    return 0;
+}
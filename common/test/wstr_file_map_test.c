@@ -0,0 +1,173 @@
+#include "wstr_file_map.h"
+#include "win32_last_error.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <string.h>   // required for strlen()
+#include <assert.h>   // required for assert()
+
+static const wchar_t *TEST_FILE_PATH = L"TestWStrFileMap.txt";
+
+static void
+StaticWriteFile(_In_ const char   *lpCharArr,
+                _In_ const size_t  ulSize)
+{
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    const HANDLE hWriteFile = CreateFile(TEST_FILE_PATH,         // [in] LPCWSTR lpFileName
+                                         GENERIC_WRITE,          // [in] DWORD dwDesiredAccess
+                                         0,                      // [in] DWORD dwShareMode
+                                         NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
+                                         CREATE_ALWAYS,          // [in] DWORD dwCreationDisposition
+                                         FILE_ATTRIBUTE_NORMAL,  // [in] DWORD dwFlagsAndAttributes
+                                         NULL);                  // [in, optional] hTemplateFile
+    if (INVALID_HANDLE_VALUE == hWriteFile)
+    {
+        Win32LastErrorFPutWSAbort(stderr,  // _In_ FILE          *lpStream
+                                  L"CreateFile(TEST_FILE_PATH, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL)");  // _In_ const wchar_t *lpMessage
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-writefile
+    DWORD dwNumberOfBytesWritten = 0;
+    if (!WriteFile(hWriteFile, lpCharArr, ulSize, &dwNumberOfBytesWritten, NULL))
+    {
+        Win32LastErrorFPutWSAbort(stderr,         // _In_ FILE          *lpStream
+                                  L"WriteFile");  // _In_ const wchar_t *lpMessage
+    }
+    assert(ulSize == dwNumberOfBytesWritten);
+
+    if (!CloseHandle(hWriteFile))
+    {
+        Win32LastErrorFPutWSAbort(stderr,                       // _In_ FILE          *lpStream
+                                  L"CloseHandle(hWriteFile)");  // _In_ const wchar_t *lpMessage
+    }
+}
+
+static void
+StaticAssertLines(_In_ const wchar_t **lppExpectedLineArr,
+                  _In_ const size_t    ulExpectedLineCount)
+{
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, TEST_FILE_PATH, CP_UTF8);
+
+    size_t ulLineCount = 0;
+    struct WStrView lineWStrView = {0};
+    while (WStrFileMapNextLine(&fileMap, &lineWStrView))
+    {
+        assert(ulLineCount < ulExpectedLineCount);
+        assert(ulLineCount == fileMap.ulLineIndex);
+
+        const wchar_t *lpExpectedLine = lppExpectedLineArr[ulLineCount];
+        const size_t ulExpectedSize = wcslen(lpExpectedLine);
+        if (ulExpectedSize != lineWStrView.ulSize
+            || 0 != wmemcmp(lpExpectedLine, lineWStrView.lpWCharArr, ulExpectedSize))
+        {
+            printf("line %zd: [%ls] != [%.*ls]\r\n",
+                   ulLineCount, lpExpectedLine, (int) lineWStrView.ulSize, lineWStrView.lpWCharArr);
+        }
+        assert(ulExpectedSize == lineWStrView.ulSize);
+        assert(0 == wmemcmp(lpExpectedLine, lineWStrView.lpWCharArr, ulExpectedSize));
+        ++ulLineCount;
+    }
+    assert(ulExpectedLineCount == ulLineCount);
+    // Intentional: Call again after end of file.
+    assert(false == WStrFileMapNextLine(&fileMap, &lineWStrView));
+
+    WStrFileMapClose(&fileMap);
+}
+
+/**
+ * Write lpCharArr to file, then compare mapped bytes, lines, and full decode with WStrFileRead().
+ */
+static void
+TestWStrFileMap(_In_ const char     *lpCharArr,
+                _In_ const size_t    ulExpectedBOMSize,
+                _In_ const wchar_t **lppExpectedLineArr,
+                _In_ const size_t    ulExpectedLineCount)
+{
+    const size_t ulByteSize = strlen(lpCharArr);
+    printf("TestWStrFileMap: [%zd bytes] -> %zd lines\r\n", ulByteSize, ulExpectedLineCount);
+
+    StaticWriteFile(lpCharArr, ulByteSize);
+
+    // Raw bytes are zero-copy view of file.
+    {
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, TEST_FILE_PATH, CP_UTF8);
+    assert(ulByteSize == fileMap.ulByteSize);
+    assert(ulExpectedBOMSize == fileMap.ulBOMSize);
+    assert(0 == ulByteSize || 0 == memcmp(lpCharArr, fileMap.lpCharArr, ulByteSize));
+
+    struct WStr decodeWStr = {0};
+    WStrFileMapDecode(&fileMap, &decodeWStr);
+    WStrFileMapClose(&fileMap);
+
+    struct WStr readWStr = {0};
+    WStrFileRead(TEST_FILE_PATH, CP_UTF8, &readWStr);
+    assert(readWStr.ulSize == decodeWStr.ulSize);
+    assert(0 == readWStr.ulSize || 0 == wmemcmp(readWStr.lpWCharArr, decodeWStr.lpWCharArr, readWStr.ulSize));
+    WStrFree(&readWStr);
+    WStrFree(&decodeWStr);
+    }
+
+    StaticAssertLines(lppExpectedLineArr, ulExpectedLineCount);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+}
+
+static void
+TestWStrFileMapOpen2MissingFile()
+{
+    printf("TestWStrFileMapOpen2MissingFile\r\n");
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+
+    struct WStrFileMap fileMap = {0};
+    assert(false == WStrFileMapOpen2(&fileMap, TEST_FILE_PATH, CP_UTF8, stdout));
+    // Intentional: Safe to close after failed open.
+    WStrFileMapClose(&fileMap);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestWStrFileMap("", 0, NULL, 0);
+    {
+    const wchar_t *lppExpectedLineArr[] = {L"abc"};
+    TestWStrFileMap("abc", 0, lppExpectedLineArr, 1);
+    TestWStrFileMap("abc\n", 0, lppExpectedLineArr, 1);
+    TestWStrFileMap("abc\r\n", 0, lppExpectedLineArr, 1);
+    // UTF-8 BOM (byte order mark) is skipped
+    TestWStrFileMap("\xEF\xBB\xBF" "abc\r\n", 3, lppExpectedLineArr, 1);
+    }
+    // Only UTF-8 BOM
+    TestWStrFileMap("\xEF\xBB\xBF", 3, NULL, 0);
+    {
+    const wchar_t *lppExpectedLineArr[] = {L""};
+    TestWStrFileMap("\r\n", 0, lppExpectedLineArr, 1);
+    }
+    {
+    // Like WStrSplitNewLine(): Final "\r" without "\n" is not a line terminator.
+    const wchar_t *lppExpectedLineArr[] = {L"abc\r"};
+    TestWStrFileMap("abc\r", 0, lppExpectedLineArr, 1);
+    }
+    {
+    const wchar_t *lppExpectedLineArr[] = {L"abc", L"def", L"", L"", L"ghi"};
+    TestWStrFileMap("abc\r\ndef\n\r\n\nghi", 0, lppExpectedLineArr, 5);
+    }
+    {
+    // Each kanji is 3 bytes in UTF-8.  U+1F600 is 4 bytes in UTF-8 and a surrogate pair in UTF-16.
+    const wchar_t *lppExpectedLineArr[] = {L"東京", L"a大阪b", L"\U0001F600", L"x\U0001F600\U0001F600"};
+    TestWStrFileMap("東京\r\na大阪b\r\n\U0001F600\r\nx\U0001F600\U0001F600", 0, lppExpectedLineArr, 4);
+    }
+
+    TestWStrFileMapOpen2MissingFile();
+    return 0;
+}
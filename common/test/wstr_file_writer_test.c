@@ -0,0 +1,208 @@
+#include "wstr_file_writer.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <assert.h>   // required for assert()
+
+static const wchar_t *TEST_FILE_PATH = L"TestWStrFileWriter.txt";
+
+static void
+StaticAssertFile(_In_ const UINT     codePage,
+                 _In_ const wchar_t *lpExpectedWCharArr,
+                 _In_ const size_t   ulExpectedSize)
+{
+    struct WStr inputWStr = {};
+    WStrFileRead(TEST_FILE_PATH, codePage, &inputWStr);
+    if (inputWStr.ulSize != ulExpectedSize)
+    {
+        printf("inputWStr.ulSize != ulExpectedSize: %zd != %zd\n", inputWStr.ulSize, ulExpectedSize);
+    }
+    assert(inputWStr.ulSize == ulExpectedSize);
+    assert(0 == ulExpectedSize || 0 == wmemcmp(lpExpectedWCharArr, inputWStr.lpWCharArr, ulExpectedSize));
+    WStrFree(&inputWStr);
+}
+
+/**
+ * Write lpWCharArr in pieces of ulPieceSize wchars.  Why?  Surrogate pairs and line terminators are split across calls.
+ */
+static void
+StaticWriteThenAssert(_In_ const size_t   ulBufferByteSize,
+                      _In_ const size_t   ulPieceSize,
+                      _In_ const wchar_t *lpWCharArr,
+                      _In_ const size_t   ulSize,
+                      _In_ const size_t   ulExpectedByteSize)
+{
+    struct WStrFileWriter writer = {0};
+    WStrFileWriterOpen(&writer, TEST_FILE_PATH, CP_UTF8, WSTR_FILE_WRITER_MODE_TRUNCATE, ulBufferByteSize);
+    for (size_t ulOffset = 0; ulOffset < ulSize; ulOffset += ulPieceSize)
+    {
+        const size_t ulRemainSize = ulSize - ulOffset;
+        WStrFileWriterWriteWCharArr(&writer, lpWCharArr + ulOffset, (ulPieceSize < ulRemainSize) ? ulPieceSize : ulRemainSize);
+        assert(writer.ulBufferByteSize <= ulBufferByteSize);
+    }
+    assert(ulExpectedByteSize == writer.ulTotalByteSize);
+    WStrFileWriterClose(&writer);
+
+    StaticAssertFile(CP_UTF8, lpWCharArr, ulSize);
+}
+
+static void
+TestWStrFileWriterWrite(_In_ const wchar_t *lpWCharArr,
+                        _In_ const size_t   ulExpectedByteSize)
+{
+    printf("TestWStrFileWriterWrite: [%zd]\n", wcslen(lpWCharArr));
+
+    const size_t ulSize = wcslen(lpWCharArr);
+    // Intentional: Iterate over small buffer sizes.  Why?  Force flush inside every possible surrogate pair and multi-byte char.
+    for (size_t ulBufferByteSize = WSTR_FILE_WRITER_MIN_BUFFER_BYTE_SIZE; ulBufferByteSize <= 16U; ++ulBufferByteSize)
+    {
+        for (size_t ulPieceSize = 1; ulPieceSize <= 3U; ++ulPieceSize)
+        {
+            StaticWriteThenAssert(ulBufferByteSize, ulPieceSize, lpWCharArr, ulSize, ulExpectedByteSize);
+        }
+        StaticWriteThenAssert(ulBufferByteSize, ulSize + 1U, lpWCharArr, ulSize, ulExpectedByteSize);
+    }
+    StaticWriteThenAssert(WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE, ulSize + 1U, lpWCharArr, ulSize, ulExpectedByteSize);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+}
+
+static void
+TestWStrFileWriterWriteLong(_In_ const size_t ulSize)
+{
+    printf("TestWStrFileWriterWriteLong: [%zd]\n", ulSize);
+
+    wchar_t *lpWCharArr = xcalloc(ulSize + 1U, sizeof(wchar_t));
+    size_t ulExpectedByteSize = 0;
+    for (size_t i = 0; i < ulSize; ++i)
+    {
+        // Mix of 1-byte and 3-byte UTF-8
+        if (0 == i % 7U)
+        {
+            lpWCharArr[i] = L'東';
+            ulExpectedByteSize += 3U;
+        }
+        else
+        {
+            lpWCharArr[i] = L'a' + (i % 26U);
+            ulExpectedByteSize += 1U;
+        }
+    }
+    StaticWriteThenAssert(WSTR_FILE_WRITER_MIN_BUFFER_BYTE_SIZE, ulSize, lpWCharArr, ulSize, ulExpectedByteSize);
+    StaticWriteThenAssert(WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE, ulSize, lpWCharArr, ulSize, ulExpectedByteSize);
+    StaticWriteThenAssert(WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE, 1000U, lpWCharArr, ulSize, ulExpectedByteSize);
+    xfree((void **) &lpWCharArr);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+}
+
+static void
+TestWStrFileWriterAppend()
+{
+    printf("TestWStrFileWriterAppend\n");
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+
+    struct WStrFileWriter writer = {0};
+    // Intentional: Append to missing file.  Why?  File is created.
+    WStrFileWriterOpen(&writer, TEST_FILE_PATH, CP_UTF8, WSTR_FILE_WRITER_MODE_APPEND, WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE);
+    WStrFileWriterWriteWCharArr(&writer, L"abc\r\n", 5);
+    WStrFileWriterClose(&writer);
+    StaticAssertFile(CP_UTF8, L"abc\r\n", 5);
+
+    WStrFileWriterOpen(&writer, TEST_FILE_PATH, CP_UTF8, WSTR_FILE_WRITER_MODE_APPEND, WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE);
+    WStrFileWriterWriteWCharArr(&writer, L"東京\r\n", 4);
+    WStrFileWriterClose(&writer);
+    StaticAssertFile(CP_UTF8, L"abc\r\n東京\r\n", 9);
+
+    WStrFileWriterOpen(&writer, TEST_FILE_PATH, CP_UTF8, WSTR_FILE_WRITER_MODE_TRUNCATE, WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE);
+    WStrFileWriterWriteWCharArr(&writer, L"def", 3);
+    WStrFileWriterClose(&writer);
+    StaticAssertFile(CP_UTF8, L"def", 3);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+}
+
+static void
+TestWStrFileWriterFlushAndSync()
+{
+    printf("TestWStrFileWriterFlushAndSync\n");
+
+    struct WStrFileWriter writer = {0};
+    WStrFileWriterOpen(&writer, TEST_FILE_PATH, CP_UTF8, WSTR_FILE_WRITER_MODE_TRUNCATE, WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE);
+    // Intentional: Flush and sync empty buffer.
+    WStrFileWriterFlush(&writer);
+    WStrFileWriterSync(&writer);
+
+    WStrFileWriterWriteWCharArr(&writer, L"abc", 3);
+    assert(3 == writer.ulBufferByteSize);
+    WStrFileWriterFlush(&writer);
+    assert(0 == writer.ulBufferByteSize);
+    assert(3 == writer.ulTotalByteSize);
+
+    WStrFileWriterWriteWCharArr(&writer, L"def", 3);
+    WStrFileWriterSync(&writer);
+    assert(0 == writer.ulBufferByteSize);
+    assert(6 == writer.ulTotalByteSize);
+    WStrFileWriterClose(&writer);
+    StaticAssertFile(CP_UTF8, L"abcdef", 6);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+}
+
+static void
+TestWStrFileWriterCodePage1252()
+{
+    printf("TestWStrFileWriterCodePage1252\n");
+
+    struct WStrFileWriter writer = {0};
+    WStrFileWriterOpen(&writer, TEST_FILE_PATH, 1252, WSTR_FILE_WRITER_MODE_TRUNCATE, WSTR_FILE_WRITER_MIN_BUFFER_BYTE_SIZE);
+    WStrFileWriterWriteWCharArr(&writer, L"abc\r\ndefghijklmnop", 18);
+    assert(18 == writer.ulTotalByteSize);
+    WStrFileWriterClose(&writer);
+    StaticAssertFile(1252, L"abc\r\ndefghijklmnop", 18);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+}
+
+static void
+TestWStrFileWriterOpen2MissingDir()
+{
+    printf("TestWStrFileWriterOpen2MissingDir\n");
+
+    struct WStrFileWriter writer = {0};
+    assert(!WStrFileWriterOpen2(&writer, L"NoSuchDir/TestWStrFileWriter.txt", CP_UTF8, WSTR_FILE_WRITER_MODE_TRUNCATE,
+                                WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE, stdout));
+    // Intentional: Safe to close zero-initialised writer.
+    WStrFileWriterClose(&writer);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestWStrFileWriterWrite(L"", 0);
+    TestWStrFileWriterWrite(L"abc", 3);
+    TestWStrFileWriterWrite(L"abc\r\ndef\r\n", 10);
+    TestWStrFileWriterWrite(L"abc東京def", 12);  // each kanji is 3 bytes in UTF-8
+    TestWStrFileWriterWrite(L"a\U0001F600b\U0001F600\U0001F600", 14);  // each emoji is 4 bytes in UTF-8
+    TestWStrFileWriterWriteLong(1000);
+    TestWStrFileWriterWriteLong(64U * 1024U + 7U);
+    TestWStrFileWriterAppend();
+    TestWStrFileWriterFlushAndSync();
+    TestWStrFileWriterCodePage1252();
+    TestWStrFileWriterOpen2MissingDir();
+    return 0;
+}
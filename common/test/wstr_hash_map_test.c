@@ -0,0 +1,192 @@
+#include "wstr_hash_map.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <assert.h>   // required for assert()
+
+static unsigned long long ullRandomState = 0x9E3779B97F4A7C15ULL;
+
+// Ref: https://en.wikipedia.org/wiki/Xorshift
+static unsigned
+StaticRandom(_In_ const unsigned ulExclusiveMax)
+{
+    ullRandomState ^= ullRandomState << 13;
+    ullRandomState ^= ullRandomState >> 7;
+    ullRandomState ^= ullRandomState << 17;
+    const unsigned x = (unsigned) (ullRandomState % ulExclusiveMax);
+    return x;
+}
+
+static void
+StaticAssertFind(_In_ const struct WStrHashMap *lpMap,
+                 _In_ const wchar_t            *lpKeyWCharArr,
+                 _In_ void                     *lpNullableExpectedValue)
+{
+    void *lpNullableValue = NULL;
+    assert(WStrHashMapFind(lpMap, lpKeyWCharArr, wcslen(lpKeyWCharArr), &lpNullableValue));
+    assert(lpNullableExpectedValue == lpNullableValue);
+}
+
+static void
+StaticAssertNotFound(_In_ const struct WStrHashMap *lpMap,
+                     _In_ const wchar_t            *lpKeyWCharArr)
+{
+    // Intentional: Non-NULL.  Why?  Output value is only set if found.
+    void *lpNullableValue = (void *) lpMap;
+    assert(!WStrHashMapFind(lpMap, lpKeyWCharArr, wcslen(lpKeyWCharArr), &lpNullableValue));
+    assert((void *) lpMap == lpNullableValue);
+}
+
+static void
+TestWStrHashMapEmpty()
+{
+    printf("TestWStrHashMapEmpty\n");
+
+    struct WStrHashMap map = {0};
+    WStrHashMapAssertValid(&map);
+    StaticAssertNotFound(&map, L"abc");
+    assert(!WStrHashMapErase(&map, L"abc", 3));
+
+    // Intentional: Empty key is a valid key.
+    assert(WStrHashMapInsert(&map, NULL, 0, &map));
+    StaticAssertFind(&map, L"", &map);
+    assert(!WStrHashMapInsert(&map, L"", 0, NULL));
+    assert(1 == map.ulSize);
+    assert(WStrHashMapErase(&map, L"", 0));
+    assert(0 == map.ulSize);
+    StaticAssertNotFound(&map, L"");
+
+    WStrHashMapFree(&map);
+    // Intentional: Free twice.  Why?  After free, map is empty and may be reused.
+    WStrHashMapFree(&map);
+}
+
+static void
+TestWStrHashMapInsertFindErase()
+{
+    printf("TestWStrHashMapInsertFindErase\n");
+
+    int a = 1, b = 2;
+    struct WStrHashMap map = {0};
+    assert(WStrHashMapInsert(&map, L"LCtrl", 5, &a));
+    assert(WStrHashMapInsert(&map, L"RCtrl", 5, &b));
+    // Intentional: NULL value is a valid value.
+    assert(WStrHashMapInsert(&map, L"LAlt", 4, NULL));
+    // Key already exists: Map is unchanged.
+    assert(!WStrHashMapInsert(&map, L"LCtrl", 5, &b));
+    assert(3 == map.ulSize);
+
+    StaticAssertFind(&map, L"LCtrl", &a);
+    StaticAssertFind(&map, L"RCtrl", &b);
+    StaticAssertFind(&map, L"LAlt", NULL);
+    // Case-sensitive
+    StaticAssertNotFound(&map, L"lctrl");
+    // Prefix is different key
+    assert(!WStrHashMapFind(&map, L"LCtrl", 4, &(void *) {NULL}));
+
+    assert(WStrHashMapErase(&map, L"LCtrl", 5));
+    assert(!WStrHashMapErase(&map, L"LCtrl", 5));
+    StaticAssertNotFound(&map, L"LCtrl");
+    StaticAssertFind(&map, L"RCtrl", &b);
+    assert(2 == map.ulSize);
+
+    WStrHashMapFree(&map);
+}
+
+static void
+TestWStrHashMapIgnoreCase()
+{
+    printf("TestWStrHashMapIgnoreCase\n");
+
+    int a = 1;
+    struct WStrHashMap map = {.bIgnoreCase = true};
+    assert(WStrHashMapInsert(&map, L"LShift", 6, &a));
+    StaticAssertFind(&map, L"LShift", &a);
+    StaticAssertFind(&map, L"lshift", &a);
+    StaticAssertFind(&map, L"LSHIFT", &a);
+    assert(!WStrHashMapInsert(&map, L"lShIfT", 6, NULL));
+    StaticAssertNotFound(&map, L"RShift");
+    assert(WStrHashMapErase(&map, L"LSHIFT", 6));
+    assert(0 == map.ulSize);
+
+    WStrHashMapFree(&map);
+    assert(map.bIgnoreCase);
+}
+
+/**
+ * Differential test: Random inserts and erases must match a simple presence array.
+ * Intentional: Many erases.  Why?  Backward shift must keep every remaining key reachable.
+ */
+static void
+TestWStrHashMapRandom(_In_ const size_t ulKeyCount,
+                      _In_ const size_t ulOpCount)
+{
+    printf("TestWStrHashMapRandom: %zd keys, %zd ops\n", ulKeyCount, ulOpCount);
+
+    struct WStr *lpKeyWStrArr = xcalloc(ulKeyCount, sizeof(struct WStr));
+    bool *lpIsPresentArr = xcalloc(ulKeyCount, sizeof(bool));
+    for (size_t i = 0; i < ulKeyCount; ++i)
+    {
+        // Mix of short and long keys
+        WStrSPrintF(lpKeyWStrArr + i, (0 == i % 3U) ? L"k%zd" : L"some.longer.key.%zd", i);
+    }
+
+    struct WStrHashMap map = {0};
+    size_t ulExpectedSize = 0;
+    for (size_t ulOp = 0; ulOp < ulOpCount; ++ulOp)
+    {
+        const size_t i = StaticRandom(ulKeyCount);
+        const struct WStr *lpKeyWStr = lpKeyWStrArr + i;
+        void *lpValue = lpKeyWStrArr + i;
+        // Intentional: Insert more often than erase.  Why?  Table must grow while keys are erased.
+        if (StaticRandom(3) > 0)
+        {
+            const bool bIsNew = WStrHashMapInsert(&map, lpKeyWStr->lpWCharArr, lpKeyWStr->ulSize, lpValue);
+            assert(bIsNew == !lpIsPresentArr[i]);
+            ulExpectedSize += bIsNew ? 1U : 0U;
+            lpIsPresentArr[i] = true;
+        }
+        else
+        {
+            const bool bIsErased = WStrHashMapErase(&map, lpKeyWStr->lpWCharArr, lpKeyWStr->ulSize);
+            assert(bIsErased == lpIsPresentArr[i]);
+            ulExpectedSize -= bIsErased ? 1U : 0U;
+            lpIsPresentArr[i] = false;
+        }
+        assert(ulExpectedSize == map.ulSize);
+    }
+    WStrHashMapAssertValid(&map);
+
+    for (size_t i = 0; i < ulKeyCount; ++i)
+    {
+        if (lpIsPresentArr[i]) {
+            StaticAssertFind(&map, lpKeyWStrArr[i].lpWCharArr, lpKeyWStrArr + i);
+        }
+        else {
+            StaticAssertNotFound(&map, lpKeyWStrArr[i].lpWCharArr);
+        }
+        WStrFree(lpKeyWStrArr + i);
+    }
+
+    WStrHashMapFree(&map);
+    xfree((void **) &lpIsPresentArr);
+    xfree((void **) &lpKeyWStrArr);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestWStrHashMapEmpty();
+    TestWStrHashMapInsertFindErase();
+    TestWStrHashMapIgnoreCase();
+    TestWStrHashMapRandom(10, 1000);
+    TestWStrHashMapRandom(1000, 100000);
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include "wstr_intern.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <assert.h>   // required for assert()
+
+static void
+StaticAssertInterned(_In_ const struct WStrInterned *lpInterned,
+                     _In_ const wchar_t             *lpExpectedWCharArr)
+{
+    assert(NULL != lpInterned);
+    const size_t ulExpectedSize = wcslen(lpExpectedWCharArr);
+    assert(ulExpectedSize == lpInterned->wstr.ulSize);
+    // Always terminated with '\0'
+    assert(0 == wcscmp(lpExpectedWCharArr, lpInterned->wstr.lpWCharArr));
+    assert(WStrHashWCharArr(lpExpectedWCharArr, ulExpectedSize) == lpInterned->ulHash);
+    // Intentional: Same rule as WStr.  Why?  Short strings use inline buffer, even in intern block.
+    assert((ulExpectedSize < WSTR_SMALL_CAPACITY) == WStrIsSmall(&(lpInterned->wstr)));
+    assert(WSTR_ALLOC_ARENA == lpInterned->wstr.eAlloc);
+}
+
+static void
+TestWStrHashWCharArr()
+{
+    printf("TestWStrHashWCharArr\n");
+
+    // FNV-1a: Empty input is offset basis.
+    assert((size_t) 14695981039346656037ULL == WStrHashWCharArr(NULL, 0));
+    assert(WStrHashWCharArr(L"abc", 3) == WStrHashWCharArr(L"abcdef", 3));
+    assert(WStrHashWCharArr(L"abc", 3) != WStrHashWCharArr(L"acb", 3));
+    assert(WStrHashWCharArr(L"abc", 3) != WStrHashWCharArr(L"abc", 2));
+}
+
+static void
+TestWStrInternEmpty()
+{
+    printf("TestWStrInternEmpty\n");
+
+    struct WStrIntern intern = {0};
+    WStrInternAssertValid(&intern);
+    assert(NULL == WStrInternFindWCharArr(&intern, L"abc", 3));
+    assert(0 == WStrInternGetHeapByteSize(&intern));
+
+    const struct WStrInterned *lpInterned = WStrInternWCharArr(&intern, NULL, 0);
+    StaticAssertInterned(lpInterned, L"");
+    assert(lpInterned == WStrInternWCharArr(&intern, L"", 0));
+    assert(lpInterned == WStrInternWStr(&intern, &WSTR_FROM_LITERAL(L"")));
+    assert(1 == intern.ulSize);
+
+    WStrInternFree(&intern);
+    // Intentional: Free twice.  Why?  After free, intern is empty and may be reused.
+    WStrInternFree(&intern);
+}
+
+static void
+TestWStrInternSameInstance(_In_ const wchar_t *lpWCharArr)
+{
+    printf("TestWStrInternSameInstance: [%ls]\n", lpWCharArr);
+
+    struct WStrIntern intern = {0};
+    const size_t ulSize = wcslen(lpWCharArr);
+    const struct WStrInterned *lpInterned = WStrInternWCharArr(&intern, lpWCharArr, ulSize);
+    StaticAssertInterned(lpInterned, lpWCharArr);
+    assert(lpInterned->wstr.lpWCharArr != lpWCharArr);
+
+    struct WStr copyWStr = {0};
+    WStrCopyWCharArr(&copyWStr, lpWCharArr, ulSize);
+    assert(lpInterned == WStrInternWStr(&intern, &copyWStr));
+    const struct WStrView wstrView = WSTR_VIEW_FROM_WSTR(&copyWStr);
+    assert(lpInterned == WStrInternWStrView(&intern, &wstrView));
+    assert(lpInterned == WStrInternFindWCharArr(&intern, lpWCharArr, ulSize));
+    WStrFree(&copyWStr);
+
+    // Prefix is different string
+    if (ulSize > 0)
+    {
+        assert(NULL == WStrInternFindWCharArr(&intern, lpWCharArr, ulSize - 1U));
+        const struct WStrInterned *lpPrefixInterned = WStrInternWCharArr(&intern, lpWCharArr, ulSize - 1U);
+        assert(lpPrefixInterned != lpInterned);
+        assert(ulSize - 1U == lpPrefixInterned->wstr.ulSize);
+        assert(2 == intern.ulSize);
+    }
+
+    WStrInternFree(&intern);
+}
+
+static void
+TestWStrInternMany(_In_ const size_t ulDistinctCount)
+{
+    printf("TestWStrInternMany: %zd\n", ulDistinctCount);
+
+    struct WStrIntern intern = {0};
+    const struct WStrInterned **lppInternedArr = xcalloc(ulDistinctCount, sizeof(lppInternedArr[0]));
+
+    // Intentional: Mix of short (inline) and long (block) strings.  Why?  Both layouts in same block.
+    for (size_t ulRound = 0; ulRound < 3U; ++ulRound)
+    {
+        for (size_t i = 0; i < ulDistinctCount; ++i)
+        {
+            struct WStr wstr = {0};
+            WStrSPrintF(&wstr, (0 == i % 2U) ? L"user%zd" : L"very.long.username.%zd@example.com", i);
+            const struct WStrInterned *lpInterned = WStrInternWStr(&intern, &wstr);
+            if (0 == ulRound) {
+                lppInternedArr[i] = lpInterned;
+            }
+            else {
+                // Intentional: Pointer is stable after table grows.
+                assert(lppInternedArr[i] == lpInterned);
+            }
+            StaticAssertInterned(lpInterned, wstr.lpWCharArr);
+            WStrFree(&wstr);
+        }
+        assert(ulDistinctCount == intern.ulSize);
+        WStrInternAssertValid(&intern);
+    }
+    assert(WStrInternGetHeapByteSize(&intern) > ulDistinctCount * sizeof(struct WStrInterned));
+
+    xfree((void **) &lppInternedArr);
+    WStrInternFree(&intern);
+}
+
+static void
+TestWStrInternLongerThanBlock()
+{
+    printf("TestWStrInternLongerThanBlock\n");
+
+    const size_t ulSize = WSTR_INTERN_BLOCK_BYTE_SIZE;  // as wchars, so bytes are larger than one block
+    wchar_t *lpWCharArr = xcalloc(ulSize + 1U, sizeof(wchar_t));
+    wmemset(lpWCharArr, L'x', ulSize);
+
+    struct WStrIntern intern = {0};
+    const struct WStrInterned *lpSmallInterned = WStrInternWCharArr(&intern, L"abc", 3);
+    const struct WStrInterned *lpInterned = WStrInternWCharArr(&intern, lpWCharArr, ulSize);
+    StaticAssertInterned(lpInterned, lpWCharArr);
+    // Intentional: Next small string after a large block.
+    const struct WStrInterned *lpSmallInterned2 = WStrInternWCharArr(&intern, L"def", 3);
+    StaticAssertInterned(lpSmallInterned, L"abc");
+    StaticAssertInterned(lpSmallInterned2, L"def");
+    assert(lpInterned == WStrInternWCharArr(&intern, lpWCharArr, ulSize));
+
+    WStrInternFree(&intern);
+    xfree((void **) &lpWCharArr);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestWStrHashWCharArr();
+    TestWStrInternEmpty();
+    TestWStrInternSameInstance(L"a");
+    TestWStrInternSameInstance(L"LCtrl");
+    TestWStrInternSameInstance(L"abcdefghijklmno");   // WSTR_SMALL_CAPACITY - 1
+    TestWStrInternSameInstance(L"abcdefghijklmnop");  // WSTR_SMALL_CAPACITY
+    TestWStrInternSameInstance(L"東京都新宿区西新宿二丁目八番一号");
+    TestWStrInternMany(10);
+    TestWStrInternMany(50000);
+    TestWStrInternLongerThanBlock();
+    return 0;
+}
@@ -0,0 +1,189 @@
+#include "wstr_line_reader.h"
+#include "win32_last_error.h"
+#include "xmalloc.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <string.h>   // required for strlen()
+#include <assert.h>   // required for assert()
+
+static const wchar_t *TEST_FILE_PATH = L"TestWStrLineReader.txt";
+
+static void
+StaticWriteFile(_In_ const char   *lpCharArr,
+                _In_ const size_t  ulSize)
+{
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    const HANDLE hWriteFile = CreateFile(TEST_FILE_PATH,         // [in] LPCWSTR lpFileName
+                                         GENERIC_WRITE,          // [in] DWORD dwDesiredAccess
+                                         0,                      // [in] DWORD dwShareMode
+                                         NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
+                                         CREATE_ALWAYS,          // [in] DWORD dwCreationDisposition
+                                         FILE_ATTRIBUTE_NORMAL,  // [in] DWORD dwFlagsAndAttributes
+                                         NULL);                  // [in, optional] hTemplateFile
+    if (INVALID_HANDLE_VALUE == hWriteFile)
+    {
+        Win32LastErrorFPutWSAbort(stderr,  // _In_ FILE          *lpStream
+                                  L"CreateFile(TEST_FILE_PATH, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL)");  // _In_ const wchar_t *lpMessage
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-writefile
+    DWORD dwNumberOfBytesWritten = 0;
+    if (!WriteFile(hWriteFile, lpCharArr, ulSize, &dwNumberOfBytesWritten, NULL))
+    {
+        Win32LastErrorFPutWSAbort(stderr,         // _In_ FILE          *lpStream
+                                  L"WriteFile");  // _In_ const wchar_t *lpMessage
+    }
+    assert(ulSize == dwNumberOfBytesWritten);
+
+    if (!CloseHandle(hWriteFile))
+    {
+        Win32LastErrorFPutWSAbort(stderr,                       // _In_ FILE          *lpStream
+                                  L"CloseHandle(hWriteFile)");  // _In_ const wchar_t *lpMessage
+    }
+}
+
+static void
+StaticAssertLines(_In_ const size_t    ulChunkByteSize,
+                  _In_ const wchar_t **lppExpectedLineArr,
+                  _In_ const size_t    ulExpectedLineCount)
+{
+    struct WStrLineReader reader = {0};
+    WStrLineReaderOpen(&reader, TEST_FILE_PATH, CP_UTF8, ulChunkByteSize);
+
+    size_t ulLineCount = 0;
+    struct WStrView lineWStrView = {0};
+    while (WStrLineReaderNext(&reader, &lineWStrView))
+    {
+        assert(ulLineCount < ulExpectedLineCount);
+        assert(ulLineCount == reader.ulLineIndex);
+
+        const wchar_t *lpExpectedLine = lppExpectedLineArr[ulLineCount];
+        const size_t ulExpectedSize = wcslen(lpExpectedLine);
+        if (ulExpectedSize != lineWStrView.ulSize
+            || 0 != wmemcmp(lpExpectedLine, lineWStrView.lpWCharArr, ulExpectedSize))
+        {
+            printf("ulChunkByteSize: %zd: line %zd: [%ls] != [%.*ls]\r\n",
+                   ulChunkByteSize, ulLineCount, lpExpectedLine, (int) lineWStrView.ulSize, lineWStrView.lpWCharArr);
+        }
+        assert(ulExpectedSize == lineWStrView.ulSize);
+        assert(0 == wmemcmp(lpExpectedLine, lineWStrView.lpWCharArr, ulExpectedSize));
+        ++ulLineCount;
+    }
+    assert(ulExpectedLineCount == ulLineCount);
+    // Intentional: Call again after end of file.
+    assert(false == WStrLineReaderNext(&reader, &lineWStrView));
+
+    WStrLineReaderClose(&reader);
+}
+
+/**
+ * Write lpCharArr to file, then read lines with each small chunk size and default chunk size.
+ * Why?  Small chunks split lines, "\r\n", and UTF-8 sequences at every possible position.
+ */
+static void
+TestWStrLineReader(_In_ const char     *lpCharArr,
+                   _In_ const wchar_t **lppExpectedLineArr,
+                   _In_ const size_t    ulExpectedLineCount)
+{
+    printf("TestWStrLineReader: [%zd bytes] -> %zd lines\r\n", strlen(lpCharArr), ulExpectedLineCount);
+
+    StaticWriteFile(lpCharArr, strlen(lpCharArr));
+
+    for (size_t ulChunkByteSize = WSTR_LINE_READER_MIN_CHUNK_BYTE_SIZE; ulChunkByteSize <= 16; ++ulChunkByteSize)
+    {
+        StaticAssertLines(ulChunkByteSize, lppExpectedLineArr, ulExpectedLineCount);
+    }
+    StaticAssertLines(WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE, lppExpectedLineArr, ulExpectedLineCount);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+}
+
+static void
+TestWStrLineReaderLongLine(_In_ const size_t ulLineSize)
+{
+    printf("TestWStrLineReaderLongLine: %zd\r\n", ulLineSize);
+
+    char *lpCharArr = xcalloc(2U * (ulLineSize + 2U) + LEN_NUL_CHAR, sizeof(char));
+    wchar_t *lpLineWCharArr = xcalloc(ulLineSize + LEN_NUL_CHAR, sizeof(wchar_t));
+    size_t ulOffset = 0;
+    for (size_t ulLine = 0; ulLine < 2; ++ulLine)
+    {
+        for (size_t i = 0; i < ulLineSize; ++i)
+        {
+            lpCharArr[ulOffset++] = 'a' + (i % 26);
+            lpLineWCharArr[i] = L'a' + (i % 26);
+        }
+        lpCharArr[ulOffset++] = '\r';
+        lpCharArr[ulOffset++] = '\n';
+    }
+
+    const wchar_t *lppExpectedLineArr[] = {lpLineWCharArr, lpLineWCharArr};
+    TestWStrLineReader(lpCharArr, lppExpectedLineArr, 2);
+
+    xfree((void **) &lpLineWCharArr);
+    xfree((void **) &lpCharArr);
+}
+
+static void
+TestWStrLineReaderOpen2UnsupportedCodePage()
+{
+    printf("TestWStrLineReaderOpen2UnsupportedCodePage\r\n");
+
+    StaticWriteFile("abc", 3);
+
+    struct WStrLineReader reader = {0};
+    // 932: Shift-JIS is multi-byte
+    assert(false == WStrLineReaderOpen2(&reader, TEST_FILE_PATH, 932, WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE, stdout));
+    // Intentional: Safe to close after failed open.
+    WStrLineReaderClose(&reader);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(TEST_FILE_PATH);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestWStrLineReader("", NULL, 0);
+    {
+    const wchar_t *lppExpectedLineArr[] = {L"abc"};
+    TestWStrLineReader("abc", lppExpectedLineArr, 1);
+    TestWStrLineReader("abc\n", lppExpectedLineArr, 1);
+    TestWStrLineReader("abc\r\n", lppExpectedLineArr, 1);
+    // UTF-8 BOM (byte order mark) is skipped
+    TestWStrLineReader("\xEF\xBB\xBF" "abc\r\n", lppExpectedLineArr, 1);
+    }
+    {
+    const wchar_t *lppExpectedLineArr[] = {L""};
+    TestWStrLineReader("\r\n", lppExpectedLineArr, 1);
+    }
+    {
+    // Like WStrSplitNewLine(): Final "\r" without "\n" is not a line terminator.
+    const wchar_t *lppExpectedLineArr[] = {L"abc\r"};
+    TestWStrLineReader("abc\r", lppExpectedLineArr, 1);
+    }
+    {
+    const wchar_t *lppExpectedLineArr[] = {L"abc", L"def", L"", L"", L"ghi"};
+    TestWStrLineReader("abc\r\ndef\n\r\n\nghi", lppExpectedLineArr, 5);
+    }
+    {
+    // Each kanji is 3 bytes in UTF-8.  U+1F600 is 4 bytes in UTF-8 and a surrogate pair in UTF-16.
+    const wchar_t *lppExpectedLineArr[] = {L"東京", L"a大阪b", L"\U0001F600", L"x\U0001F600\U0001F600"};
+    TestWStrLineReader("東京\r\na大阪b\r\n\U0001F600\r\nx\U0001F600\U0001F600", lppExpectedLineArr, 4);
+    }
+
+    TestWStrLineReaderLongLine(1000);
+    // Intentional: Longer than default chunk.
+    TestWStrLineReaderLongLine(WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE + 7U);
+
+    TestWStrLineReaderOpen2UnsupportedCodePage();
+    return 0;
+}
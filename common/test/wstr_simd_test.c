@@ -0,0 +1,179 @@
+#include "wstr_simd.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <wctype.h>   // required for iswspace()
+#include <assert.h>   // required for assert()
+
+// Differential test: Each SIMD level must match simple reference implementations on random inputs.
+
+#define MAX_TEXT_SIZE 200U
+#define ITERATION_COUNT 20000U
+
+// Intentional: Small alphabet.  Why?  Random text must often contain matches, whitespace, and non-ASCII wchars.
+static const wchar_t ALPHABET_WCHAR_ARR[] = {
+    L'a', L'b', L'|', L':', L' ', L'\t', L'\r', L'\n', L'\v', L'\f', L'~', L'\0',
+    0x001C,  // FILE SEPARATOR: Not printable ASCII, so must call iswspace()
+    0x0085,  // NEXT LINE (NEL)
+    0x00A0,  // NO-BREAK SPACE
+    0x3000,  // IDEOGRAPHIC SPACE
+    0x6771,  // 東
+    0xFFFF,  // Intentional: Max unsigned 16-bit value.  Why?  Catch signed compare bugs.
+};
+
+static unsigned long long ullRandomState = 0x9E3779B97F4A7C15ULL;
+
+// Ref: https://en.wikipedia.org/wiki/Xorshift
+static unsigned
+StaticRandom(_In_ const unsigned ulExclusiveMax)
+{
+    ullRandomState ^= ullRandomState << 13;
+    ullRandomState ^= ullRandomState >> 7;
+    ullRandomState ^= ullRandomState << 17;
+    const unsigned x = (unsigned) (ullRandomState % ulExclusiveMax);
+    return x;
+}
+
+static void
+StaticRandomWCharArr(_Out_ wchar_t      *lpWCharArr,
+                     _In_  const size_t  ulSize)
+{
+    const unsigned ulAlphabetSize = sizeof(ALPHABET_WCHAR_ARR) / sizeof(ALPHABET_WCHAR_ARR[0]);
+    // Intentional: Sometimes use only first few wchars.  Why?  Long runs of whitespace or repeated wchars.
+    const unsigned ulMax = (0 == StaticRandom(4)) ? 3U : ulAlphabetSize;
+    for (size_t i = 0; i < ulSize; ++i)
+    {
+        lpWCharArr[i] = ALPHABET_WCHAR_ARR[StaticRandom(ulMax)];
+    }
+}
+
+static const wchar_t *
+RefFindWCharArr(_In_ const wchar_t *lpWCharArr,
+                _In_ const size_t   ulSize,
+                _In_ const wchar_t *lpNeedleWCharArr,
+                _In_ const size_t   ulNeedleSize)
+{
+    for (size_t i = 0; i + ulNeedleSize <= ulSize; ++i)
+    {
+        size_t j = 0;
+        while (j < ulNeedleSize && lpWCharArr[i + j] == lpNeedleWCharArr[j])
+        {
+            ++j;
+        }
+        if (ulNeedleSize == j) {
+            return lpWCharArr + i;
+        }
+    }
+    return NULL;
+}
+
+static size_t
+RefSpanSpace(_In_ const wchar_t *lpWCharArr,
+             _In_ const size_t   ulSize)
+{
+    size_t i = 0;
+    while (i < ulSize && iswspace(lpWCharArr[i]))
+    {
+        ++i;
+    }
+    return i;
+}
+
+static size_t
+RefRSpanSpace(_In_ const wchar_t *lpWCharArr,
+              _In_ const size_t   ulSize)
+{
+    size_t ulCount = 0;
+    while (ulCount < ulSize && iswspace(lpWCharArr[ulSize - 1U - ulCount]))
+    {
+        ++ulCount;
+    }
+    return ulCount;
+}
+
+static size_t
+RefMismatch(_In_ const wchar_t *lpLeftWCharArr,
+            _In_ const wchar_t *lpRightWCharArr,
+            _In_ const size_t   ulSize)
+{
+    size_t i = 0;
+    while (i < ulSize && lpLeftWCharArr[i] == lpRightWCharArr[i])
+    {
+        ++i;
+    }
+    return i;
+}
+
+static void
+TestWStrSimdLevel(_In_ const enum EWStrSimdLevel eLevel)
+{
+    printf("TestWStrSimdLevel: %d\n", eLevel);
+
+    WStrSimdSetLevel(eLevel);
+    assert(eLevel == WStrSimdGetLevel());
+
+    wchar_t lpTextWCharArr[MAX_TEXT_SIZE];
+    wchar_t lpOtherWCharArr[MAX_TEXT_SIZE];
+
+    for (size_t ulIteration = 0; ulIteration < ITERATION_COUNT; ++ulIteration)
+    {
+        const size_t ulSize = StaticRandom(MAX_TEXT_SIZE);
+        StaticRandomWCharArr(lpTextWCharArr, ulSize);
+
+        // Intentional: Needle from text (usually found) or random (usually not found).
+        const size_t ulNeedleSize = 1U + StaticRandom(5);
+        wchar_t lpNeedleWCharArr[5];
+        if (ulNeedleSize <= ulSize && 0 == StaticRandom(2))
+        {
+            const size_t ulOffset = StaticRandom(ulSize - ulNeedleSize + 1U);
+            for (size_t i = 0; i < ulNeedleSize; ++i)
+            {
+                lpNeedleWCharArr[i] = lpTextWCharArr[ulOffset + i];
+            }
+        }
+        else {
+            StaticRandomWCharArr(lpNeedleWCharArr, ulNeedleSize);
+        }
+
+        assert(RefFindWCharArr(lpTextWCharArr, ulSize, lpNeedleWCharArr, 1)
+               == WStrSimdFindWChar(lpTextWCharArr, ulSize, lpNeedleWCharArr[0]));
+
+        assert(RefFindWCharArr(lpTextWCharArr, ulSize, lpNeedleWCharArr, ulNeedleSize)
+               == WStrSimdFindWCharArr(lpTextWCharArr, ulSize, lpNeedleWCharArr, ulNeedleSize));
+
+        assert(RefSpanSpace(lpTextWCharArr, ulSize) == WStrSimdSpanSpace(lpTextWCharArr, ulSize));
+        assert(RefRSpanSpace(lpTextWCharArr, ulSize) == WStrSimdRSpanSpace(lpTextWCharArr, ulSize));
+
+        // Intentional: Copy, then change one wchar (or none).
+        for (size_t i = 0; i < ulSize; ++i)
+        {
+            lpOtherWCharArr[i] = lpTextWCharArr[i];
+        }
+        if (ulSize > 0 && 0 != StaticRandom(4))
+        {
+            lpOtherWCharArr[StaticRandom(ulSize)] = ALPHABET_WCHAR_ARR[StaticRandom(sizeof(ALPHABET_WCHAR_ARR) / sizeof(ALPHABET_WCHAR_ARR[0]))];
+        }
+        assert(RefMismatch(lpTextWCharArr, lpOtherWCharArr, ulSize) == WStrSimdMismatch(lpTextWCharArr, lpOtherWCharArr, ulSize));
+    }
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    const enum EWStrSimdLevel eMaxLevel = WStrSimdGetMaxLevel();
+    printf("WStrSimdGetMaxLevel: %d\n", eMaxLevel);
+
+    for (int eLevel = WSTR_SIMD_LEVEL_SCALAR; eLevel <= (int) eMaxLevel; ++eLevel)
+    {
+        TestWStrSimdLevel((enum EWStrSimdLevel) eLevel);
+    }
+
+    WStrSimdSetLevel(eMaxLevel);
+    return 0;
+}
@@ -81,6 +81,14 @@ static void TestWStrTrimSpace(_In_ const wchar_t           *lpWStrTrimSpaceFuncN
     TestWStrFree(&wstr);
 }
 
+/**
+ * Same as WStrTrimSpace(), but a different function pointer.  Why?  WStrSplit() must call it after split, not fuse it.
+ */
+static void StaticTrimSpaceNotFused(_Inout_ struct WStr *lpWStr)
+{
+    WStrTrimSpace(lpWStr);
+}
+
 static void TestWStrSplit(_In_ wchar_t                 *lpWCharArr,
                           _In_ wchar_t                 *lpDelim,
                           _In_ const int                iMinTokenCount,
@@ -144,6 +152,260 @@ static void TestWStrSplitNewLine(_In_ wchar_t                 *lpWCharArr,
     TestWStrArrFree(&wstrArr);
 }
 
+static void AssertWStrViewArrEqual(_In_ const struct WStrViewArr *lpWStrViewArr,
+                                   _In_ const wchar_t           **lppExpectedTokenArr,
+                                   _In_ const size_t              ulExpectedTokenCount)
+{
+    assert(ulExpectedTokenCount == lpWStrViewArr->ulSize);
+    for (size_t i = 0; i < ulExpectedTokenCount; ++i)
+    {
+        const struct WStrView *lpWStrView = lpWStrViewArr->lpWStrViewArr + i;
+        const size_t ulExpectedSize = wcslen(lppExpectedTokenArr[i]);
+        assert(ulExpectedSize == lpWStrView->ulSize);
+        if (0 == ulExpectedSize)
+        {
+            assert(NULL == lpWStrView->lpWCharArr);
+        }
+        else {
+            assert(0 == wmemcmp(lppExpectedTokenArr[i], lpWStrView->lpWCharArr, ulExpectedSize));
+        }
+    }
+}
+
+static void AssertWStrArrArenaEqual(_In_ const struct WStrArr  *lpWStrArr,
+                                   _In_ const wchar_t        **lppExpectedTokenArr,
+                                   _In_ const size_t           ulExpectedTokenCount)
+{
+    assert(ulExpectedTokenCount == lpWStrArr->ulSize);
+    assert(NULL != lpWStrArr->lpNullableArenaWCharArr);
+
+    // Intentional: Each token is terminated with '\0' and immediately follows the previous token in the arena.
+    const wchar_t *lpIter = lpWStrArr->lpNullableArenaWCharArr;
+    for (size_t i = 0; i < ulExpectedTokenCount; ++i)
+    {
+        const struct WStr *lpWStr = lpWStrArr->lpWStrArr + i;
+        assert(lpIter == lpWStr->lpWCharArr);
+        // Intentional: Never WSTR_ALLOC_HEAP.  Why?  WStrFree() on an element must not xfree() into the arena.
+        assert(WSTR_ALLOC_ARENA == lpWStr->eAlloc);
+        assert(wcslen(lppExpectedTokenArr[i]) == lpWStr->ulSize);
+        assert(0 == wcscmp(lppExpectedTokenArr[i], lpWStr->lpWCharArr));
+        lpIter += lpWStr->ulSize + 1U;
+    }
+}
+
+static void TestWStrSplitView(_In_ const wchar_t              *lpWCharArr,
+                              _In_ const wchar_t              *lpDelim,
+                              _In_ const int                   iMinTokenCount,
+                              _In_ const int                   iMaxTokenCount,
+                              _In_ const WStrViewConsumerFunc  fpNullableWStrViewConsumerFunc,
+                              _In_ const wchar_t             **lppExpectedTokenArr,
+                              _In_ const size_t                ulExpectedTokenCount)
+{
+    printf("TestWStrSplitView: [%ls][%ls][min:%d,max:%d] -> (%zd)", lpWCharArr, lpDelim, iMinTokenCount, iMaxTokenCount, ulExpectedTokenCount);
+    for (size_t i = 0; i < ulExpectedTokenCount; ++i)
+    {
+        printf("[%ls]", lppExpectedTokenArr[i]);
+    }
+    printf("\r\n");
+
+    struct WStrViewSplitOptions options = {.iMinTokenCount                 = iMinTokenCount,
+                                           .iMaxTokenCount                 = iMaxTokenCount,
+                                           .fpNullableWStrViewConsumerFunc = fpNullableWStrViewConsumerFunc};
+
+    const struct WStrView textWStrView = {.lpWCharArr = lpWCharArr, .ulSize = wcslen(lpWCharArr)};
+    const struct WStrView delimWStrView = {.lpWCharArr = lpDelim, .ulSize = wcslen(lpDelim)};
+    struct WStrViewArr wstrViewArr = {};
+    WStrSplitView(&textWStrView, &delimWStrView, &options, &wstrViewArr);
+
+    AssertWStrViewArrEqual(&wstrViewArr, lppExpectedTokenArr, ulExpectedTokenCount);
+
+    struct WStrArr wstrArr = {};
+    WStrArrCopyWStrViewArrArena(&wstrArr, &wstrViewArr);
+    AssertWStrArrArenaEqual(&wstrArr, lppExpectedTokenArr, ulExpectedTokenCount);
+    TestWStrArrFree(&wstrArr);
+
+    WStrViewArrFree(&wstrViewArr);
+    assert(NULL == wstrViewArr.lpWStrViewArr);
+    assert(0 == wstrViewArr.ulSize);
+
+    // Same tokens, but array of views is from arena.  Split twice: Previous array is not freed.
+    struct XArena arena = {};
+    for (int i = 0; i < 2; ++i)
+    {
+        WStrSplitViewXArena(&textWStrView, &delimWStrView, &options, &arena, &wstrViewArr);
+        AssertWStrViewArrEqual(&wstrViewArr, lppExpectedTokenArr, ulExpectedTokenCount);
+    }
+    XArenaFree(&arena);
+}
+
+static void TestWStrSplitNewLineView(_In_ const wchar_t  *lpWCharArr,
+                                     _In_ const wchar_t **lppExpectedLineArr,
+                                     _In_ const size_t    ulExpectedLineCount)
+{
+    printf("TestWStrSplitNewLineView: [%ls] -> (%zd)\r\n", lpWCharArr, ulExpectedLineCount);
+
+    struct WStrViewSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                           .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+
+    const struct WStrView textWStrView = {.lpWCharArr = lpWCharArr, .ulSize = wcslen(lpWCharArr)};
+    struct WStrViewArr wstrViewArr = {};
+    WStrSplitNewLineView(&textWStrView, &options, &wstrViewArr);
+
+    AssertWStrViewArrEqual(&wstrViewArr, lppExpectedLineArr, ulExpectedLineCount);
+    WStrViewArrFree(&wstrViewArr);
+}
+
+static void TestWStrSplitArena(_In_ const wchar_t              *lpWCharArr,
+                               _In_ const wchar_t              *lpDelim,
+                               _In_ const int                   iMaxTokenCount,
+                               _In_ const WStrViewConsumerFunc  fpNullableWStrViewConsumerFunc,
+                               _In_ const wchar_t             **lppExpectedTokenArr,
+                               _In_ const size_t                ulExpectedTokenCount)
+{
+    printf("TestWStrSplitArena: [%ls][%ls][max:%d] -> (%zd)\r\n", lpWCharArr, lpDelim, iMaxTokenCount, ulExpectedTokenCount);
+
+    struct WStrViewSplitOptions options = {.iMinTokenCount                 = UNLIMITED_MIN_TOKEN_COUNT,
+                                           .iMaxTokenCount                 = iMaxTokenCount,
+                                           .fpNullableWStrViewConsumerFunc = fpNullableWStrViewConsumerFunc};
+
+    struct WStr textWStr = {};
+    WStrCopyWCharArr(&textWStr, lpWCharArr, wcslen(lpWCharArr));
+    const struct WStr delimWStr = {.lpWCharArr = (wchar_t *) lpDelim, .ulSize = wcslen(lpDelim)};
+    struct WStrArr wstrArr = {};
+    WStrSplitArena(&textWStr, &delimWStr, &options, &wstrArr);
+
+    // Intentional: Free text first.  Why?  Unlike views, tokens are copied into arena.
+    TestWStrFree(&textWStr);
+    AssertWStrArrArenaEqual(&wstrArr, lppExpectedTokenArr, ulExpectedTokenCount);
+
+    TestWStrArrFree(&wstrArr);
+    assert(NULL == wstrArr.lpNullableArenaWCharArr);
+}
+
+static void TestWStrSplitNewLineArena(_In_ const wchar_t  *lpWCharArr,
+                                      _In_ const wchar_t **lppExpectedLineArr,
+                                      _In_ const size_t    ulExpectedLineCount)
+{
+    printf("TestWStrSplitNewLineArena: [%ls] -> (%zd)\r\n", lpWCharArr, ulExpectedLineCount);
+
+    struct WStrViewSplitOptions options = {.iMinTokenCount = UNLIMITED_MIN_TOKEN_COUNT,
+                                           .iMaxTokenCount = UNLIMITED_MAX_TOKEN_COUNT};
+
+    const struct WStr textWStr = {.lpWCharArr = (wchar_t *) lpWCharArr, .ulSize = wcslen(lpWCharArr)};
+    struct WStrArr wstrArr = {};
+    WStrSplitNewLineArena(&textWStr, &options, &wstrArr);
+
+    AssertWStrArrArenaEqual(&wstrArr, lppExpectedLineArr, ulExpectedLineCount);
+    TestWStrArrFree(&wstrArr);
+}
+
+static void TestWStrViewTrimSpace(_In_ const wchar_t              *lpFuncName,
+                                  _In_ const WStrViewConsumerFunc  fpWStrViewConsumerFunc,
+                                  _In_ const wchar_t              *lpWCharArr,
+                                  _In_ const wchar_t              *lpExpectedWCharArr)
+{
+    printf("TestWStrViewTrimSpace: %ls([%ls]) -> [%ls]\r\n", lpFuncName, lpWCharArr, lpExpectedWCharArr);
+
+    struct WStrView wstrView = {.lpWCharArr = lpWCharArr, .ulSize = wcslen(lpWCharArr)};
+    fpWStrViewConsumerFunc(&wstrView);
+
+    const size_t ulExpectedSize = wcslen(lpExpectedWCharArr);
+    assert(ulExpectedSize == wstrView.ulSize);
+    if (0 == ulExpectedSize)
+    {
+        assert(NULL == wstrView.lpWCharArr);
+    }
+    else {
+        // Intentional: Views never copy, so result must point into the original wchar_t array.
+        assert(wstrView.lpWCharArr >= lpWCharArr);
+        assert(0 == wmemcmp(lpExpectedWCharArr, wstrView.lpWCharArr, ulExpectedSize));
+    }
+}
+
+static void TestWStrViewCompare(_In_ const wchar_t *lpLeftWCharArr,
+                                _In_ const size_t   ulLeftSize,
+                                _In_ const wchar_t *lpRightWCharArr,
+                                _In_ const int      iExpectedSign,
+                                _In_ const int      iExpectedSignI)
+{
+    printf("TestWStrViewCompare: [%.*ls] vs [%ls] -> %d, %d\r\n", (int) ulLeftSize, lpLeftWCharArr, lpRightWCharArr, iExpectedSign, iExpectedSignI);
+
+    const struct WStrView leftWStrView = {.lpWCharArr = lpLeftWCharArr, .ulSize = ulLeftSize};
+    const struct WStrView rightWStrView = {.lpWCharArr = lpRightWCharArr, .ulSize = wcslen(lpRightWCharArr)};
+
+    const int cmp = WStrViewCompare(&leftWStrView, &rightWStrView);
+    assert(iExpectedSign == (cmp > 0) - (cmp < 0));
+
+    const int cmpI = WStrViewCompareI(&leftWStrView, &rightWStrView);
+    assert(iExpectedSignI == (cmpI > 0) - (cmpI < 0));
+}
+
+static void TestWStrCopyWStrView(_In_ const wchar_t *lpWCharArr,
+                                 _In_ const size_t   ulSize)
+{
+    printf("TestWStrCopyWStrView: [%.*ls]\r\n", (int) ulSize, lpWCharArr);
+
+    const struct WStrView wstrView = {.lpWCharArr = (0 == ulSize ? NULL : lpWCharArr), .ulSize = ulSize};
+    struct WStr wstr = {};
+    WStrCopyWStrView(&wstr, &wstrView);
+
+    assert(ulSize == wstr.ulSize);
+    if (ulSize > 0)
+    {
+        assert(0 == wmemcmp(lpWCharArr, wstr.lpWCharArr, ulSize));
+        assert(L'\0' == wstr.lpWCharArr[ulSize]);
+    }
+    TestWStrFree(&wstr);
+
+    // Arena: Always terminated with '\0', even if empty.  Free only forgets pointer.
+    struct XArena arena = {};
+    WStrCopyWStrViewXArena(&wstr, &wstrView, &arena);
+    assert(WSTR_ALLOC_ARENA == wstr.eAlloc);
+    assert(ulSize == wstr.ulSize);
+    assert(0 == wmemcmp(lpWCharArr, wstr.lpWCharArr, ulSize));
+    assert(L'\0' == wstr.lpWCharArr[ulSize]);
+
+    // Write + Malloc: Replace with new owned buffer.  Arena wchars are never written.
+    const wchar_t *lpArenaWCharArr = wstr.lpWCharArr;
+    WStrSPrintF(&wstr, L"[%ls]", lpArenaWCharArr);
+    assert(WSTR_ALLOC_HEAP == wstr.eAlloc);
+    assert(ulSize + 2U == wstr.ulSize);
+    assert(ulSize == wcslen(lpArenaWCharArr));
+    TestWStrFree(&wstr);
+
+    WStrCopyWStrViewXArena(&wstr, &wstrView, &arena);
+    TestWStrFree(&wstr);
+    assert(WSTR_ALLOC_HEAP == wstr.eAlloc);
+    XArenaFree(&arena);
+}
+
+static void TestWStrArrAppendWCharArr(_In_ const size_t ulCount)
+{
+    printf("TestWStrArrAppendWCharArr(%zd)\r\n", ulCount);
+
+    // Intentional: Mix of small (inline) and large (heap) strings.  Why?  Both must survive growth.
+    const wchar_t *lpSmall = L"abc";
+    const wchar_t *lpLarge = L"abcdefghijklmnopqrstuvwxyz";
+
+    struct WStrArr wstrArr = {};
+    for (size_t i = 0; i < ulCount; ++i)
+    {
+        const wchar_t *lpWCharArr = (0 == i % 2) ? lpSmall : lpLarge;
+        WStrArrAppendWCharArr(&wstrArr, lpWCharArr, wcslen(lpWCharArr));
+        assert(1U + i == wstrArr.ulSize);
+        assert(wstrArr.ulSize <= wstrArr.ulCapacity);
+    }
+
+    for (size_t i = 0; i < ulCount; ++i)
+    {
+        const wchar_t *lpWCharArr = (0 == i % 2) ? lpSmall : lpLarge;
+        assert(0 == wcscmp(lpWCharArr, wstrArr.lpWStrArr[i].lpWCharArr));
+    }
+
+    TestWStrArrFree(&wstrArr);
+    assert(0 == wstrArr.ulCapacity);
+}
+
 static void TestWStrJoin(_In_ const wchar_t **lppTokenArr,
                          _In_ const size_t    ulTokenCount,
                          _In_ wchar_t        *lpDelim,
@@ -279,6 +541,40 @@ static void TestWStrFileWriteAndRead(_In_ wchar_t      *lpWCharArr,
     DeleteFile(lpFilePath);
 }
 
+static void TestWStrFileAppend(_In_ const wchar_t *lpWCharArr,
+                               _In_ const wchar_t *lpWCharArr2)
+{
+    printf("TestWStrFileAppend: [%ls][%ls]\r\n", lpWCharArr, lpWCharArr2);
+
+    const UINT codePage = CP_UTF8;
+
+    const wchar_t *lpFilePath = L"TestWStr.txt";
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(lpFilePath);
+
+    // Intentional: First append creates file.
+    const struct WStr outputWStrText = {.lpWCharArr = (wchar_t *) lpWCharArr, .ulSize = wcslen(lpWCharArr)};
+    WStrFileAppend(lpFilePath, codePage, &outputWStrText);
+    const struct WStr outputWStrText2 = {.lpWCharArr = (wchar_t *) lpWCharArr2, .ulSize = wcslen(lpWCharArr2)};
+    WStrFileAppend(lpFilePath, codePage, &outputWStrText2);
+
+    struct WStr expectedWStr = {};
+    WStrConcat(&expectedWStr, &outputWStrText, &outputWStrText2);
+
+    struct WStr inputWStrText = {};
+    WStrFileRead(lpFilePath, codePage, &inputWStrText);
+
+    assert(expectedWStr.ulSize == inputWStrText.ulSize);
+    assert(0 == expectedWStr.ulSize || 0 == wmemcmp(expectedWStr.lpWCharArr, inputWStrText.lpWCharArr, expectedWStr.ulSize));
+
+    WStrFree(&inputWStrText);
+    WStrFree(&expectedWStr);
+
+    // Intentional: Ignore return value (BOOL)
+    DeleteFile(lpFilePath);
+}
+
 static void TestWStrArrCopyWCharArrArr(_In_ const wchar_t **lppTokenArr,
                                        _In_ const size_t    ulTokenCount)
 {
@@ -388,6 +684,99 @@ static void TestWStrSPrintFV(const wchar_t *lpExpectedDestWCharArr,
     WStrFree(&destWStr);
 }
 
+/**
+ * @param ulBufferLen
+ *        zero for no initial buffer; else initial buffer length, including final '\0' char
+ */
+static void TestWStrBuilder(_In_ const size_t ulBufferLen,
+                            _In_ const size_t ulCount)
+{
+    printf("TestWStrBuilder(ulBufferLen:%zd, ulCount:%zd)\r\n", ulBufferLen, ulCount);
+
+    wchar_t lpBufferWCharArr[64];
+    assert(ulBufferLen <= sizeof(lpBufferWCharArr) / sizeof(lpBufferWCharArr[0]));
+
+    struct WStrBuilder sb = {0};
+    if (ulBufferLen > 0) {
+        WStrBuilderInitBuffer(&sb, lpBufferWCharArr, ulBufferLen);
+    }
+
+    // Intentional: Mix of append functions.  Why?  All must survive growth from initial buffer to heap.
+    const struct WStr abcWStr = WSTR_FROM_LITERAL(L"abc");
+    for (size_t i = 0; i < ulCount; ++i)
+    {
+        switch (i % 3)
+        {
+            case 0: WStrBuilderAppendWStr(&sb, &abcWStr); break;
+            case 1: WStrBuilderAppendWCharArr(&sb, L"de", 2); break;
+            case 2: WStrBuilderAppendF(&sb, L"%zd|", i % 10); break;
+        }
+        WStrBuilderAssertValid(&sb);
+    }
+
+    wchar_t lpExpectedWCharArr[4096] = {0};
+    size_t ulExpectedSize = 0;
+    for (size_t i = 0; i < ulCount; ++i)
+    {
+        const int cch = swprintf(lpExpectedWCharArr + ulExpectedSize,
+                                 (sizeof(lpExpectedWCharArr) / sizeof(lpExpectedWCharArr[0])) - ulExpectedSize,
+                                 (0 == i % 3) ? L"abc" : (1 == i % 3) ? L"de" : L"%zd|", i % 10);
+        assert(cch >= 0);
+        ulExpectedSize += (size_t) cch;
+    }
+    assert(ulExpectedSize == sb.ulSize);
+    if (ulExpectedSize > 0) {
+        assert(0 == wcscmp(lpExpectedWCharArr, sb.lpWCharArr));
+    }
+
+    const wchar_t *lpBuilderWCharArr = sb.lpWCharArr;
+    const bool bIsHeap = (NULL != lpBuilderWCharArr && lpBuilderWCharArr != lpBufferWCharArr);
+
+    struct WStr wstr = {0};
+    WStrBuilderMoveToWStr(&sb, &wstr);
+    assert(NULL == sb.lpWCharArr);
+    assert(0 == sb.ulSize);
+    assert(0 == sb.ulCapacity);
+    assert(ulExpectedSize == wstr.ulSize);
+    if (ulExpectedSize > 0) {
+        assert(0 == wcscmp(lpExpectedWCharArr, wstr.lpWCharArr));
+    }
+    if (bIsHeap && ulExpectedSize >= WSTR_SMALL_CAPACITY)
+    {
+        // Intentional: Heap buffer is transferred, not copied.
+        assert(lpBuilderWCharArr == wstr.lpWCharArr);
+    }
+    TestWStrFree(&wstr);
+}
+
+static void TestWStrBuilderAppendFLarge(_In_ const size_t ulWidth)
+{
+    printf("TestWStrBuilderAppendFLarge(%zd)\r\n", ulWidth);
+
+    wchar_t lpBufferWCharArr[8];
+    struct WStrBuilder sb = {0};
+    WStrBuilderInitBuffer(&sb, lpBufferWCharArr, sizeof(lpBufferWCharArr) / sizeof(lpBufferWCharArr[0]));
+
+    WStrBuilderAppendF(&sb, L"abc");
+    // Intentional: Result does not fit in spare capacity.  Why?  Must grow, then format again.
+    WStrBuilderAppendF(&sb, L"%*d", (int) ulWidth, 7);
+    assert(3U + ulWidth == sb.ulSize);
+    assert(0 == wmemcmp(L"abc", sb.lpWCharArr, 3));
+    for (size_t i = 3; i < 2U + ulWidth; ++i)
+    {
+        assert(L' ' == sb.lpWCharArr[i]);
+    }
+    assert(L'7' == sb.lpWCharArr[2U + ulWidth]);
+    assert(L'\0' == sb.lpWCharArr[3U + ulWidth]);
+
+    struct WStr wstr = {0};
+    WStrSPrintF(&wstr, L"abc%*d", (int) ulWidth, 7);
+    assert(0 == wcscmp(sb.lpWCharArr, wstr.lpWCharArr));
+
+    WStrBuilderFree(&sb);
+    TestWStrFree(&wstr);
+}
+
 static void TestWStrCompareEqual(const wchar_t *lpNullableLeftWCharArr,
                                  const wchar_t *lpNullableRightWCharArr)
 {
@@ -421,6 +810,128 @@ static void TestWStrCompareGreater(const wchar_t *lpNullableLeftWCharArr,
     AssertGreater("%d", "cmp", cmp, "expectedCmp", expectedCmp);
 }
 
+static void TestWStrAllocHeap(_In_ const wchar_t *lpWCharArr)
+{
+    printf("TestWStrAllocHeap: [%ls]\r\n", lpWCharArr);
+
+    const size_t ulSize = wcslen(lpWCharArr);
+    // Read + Write + Malloc
+    struct WStr wstr = {0};
+    assert(WSTR_ALLOC_HEAP == wstr.eAlloc);
+    WStrSPrintF(&wstr, L"%ls", lpWCharArr);
+    assert(WSTR_ALLOC_HEAP == wstr.eAlloc);
+    assert(ulSize == wstr.ulSize);
+    assert(0 == wcscmp(lpWCharArr, wstr.lpWCharArr));
+    assert((ulSize < WSTR_SMALL_CAPACITY) == WStrIsSmall(&wstr));
+
+    // Free
+    TestWStrFree(&wstr);
+    assert(WSTR_ALLOC_HEAP == wstr.eAlloc);
+}
+
+static void TestWStrAllocLiteral(_In_ const wchar_t *lpNullableWCharArr)
+{
+    printf("TestWStrAllocLiteral: [%ls]\r\n", (NULL == lpNullableWCharArr ? L"" : lpNullableWCharArr));
+
+    // Read
+    const struct WStr literalWStr = WSTR_FROM_VALUE(lpNullableWCharArr);
+    assert(WSTR_ALLOC_LITERAL == literalWStr.eAlloc);
+    assert(lpNullableWCharArr == literalWStr.lpWCharArr);
+
+    // Write + Malloc: Replace with new owned buffer.  Literal is never written.
+    struct WStr wstr = WSTR_FROM_VALUE(lpNullableWCharArr);
+    WStrSPrintF(&wstr, L"[%ls]", literalWStr.ulSize > 0 ? literalWStr.lpWCharArr : L"");
+    assert(WSTR_ALLOC_HEAP == wstr.eAlloc);
+    assert(lpNullableWCharArr != wstr.lpWCharArr);
+    assert(literalWStr.ulSize + 2U == wstr.ulSize);
+    TestWStrFree(&wstr);
+
+    // Write in place is never allowed, even if result is shorter, e.g., trim.
+    struct WStr wstr2 = WSTR_FROM_VALUE(lpNullableWCharArr);
+    WStrTrimSpace(&wstr2);
+    if (wstr2.ulSize < literalWStr.ulSize)
+    {
+        assert(WSTR_ALLOC_HEAP == wstr2.eAlloc);
+        // Literal is unchanged
+        assert(literalWStr.ulSize == wcslen(lpNullableWCharArr));
+    }
+    TestWStrFree(&wstr2);
+
+    // Free: Only forget pointer.  Never free literal.
+    struct WStr wstr3 = WSTR_FROM_VALUE(lpNullableWCharArr);
+    TestWStrFree(&wstr3);
+    assert(WSTR_ALLOC_HEAP == wstr3.eAlloc);
+}
+
+static void TestWStrAllocStack(_In_ const size_t   ulBufferLen,
+                               _In_ const wchar_t *lpWCharArr)
+{
+    printf("TestWStrAllocStack: %zd: [%ls]\r\n", ulBufferLen, lpWCharArr);
+
+    const size_t ulSize = wcslen(lpWCharArr);
+    const bool bIsFit = (ulSize < ulBufferLen);
+
+    wchar_t lpBufferWCharArr[32];
+    assert(ulBufferLen <= sizeof(lpBufferWCharArr) / sizeof(lpBufferWCharArr[0]));
+    struct WStr wstr = {0};
+    WStrInitStackBuffer(&wstr, lpBufferWCharArr, ulBufferLen);
+    assert(WSTR_ALLOC_STACK == wstr.eAlloc);
+    assert(lpBufferWCharArr == wstr.lpWCharArr);
+    assert(0 == wstr.ulSize);
+    assert(L'\0' == wstr.lpWCharArr[0]);
+
+    // Write: In place if fits.  Malloc: Only if not fit.
+    WStrCopyWCharArr(&wstr, lpWCharArr, ulSize);
+    assert(ulSize == wstr.ulSize);
+    assert(bIsFit == (lpBufferWCharArr == wstr.lpWCharArr));
+    assert((bIsFit ? WSTR_ALLOC_STACK : WSTR_ALLOC_HEAP) == wstr.eAlloc);
+    assert(0 == wcscmp(lpWCharArr, wstr.lpWCharArr));
+    TestWStrFree(&wstr);
+    assert(WSTR_ALLOC_HEAP == wstr.eAlloc);
+
+    // Same for WStrSPrintF(): Format directly into stack buffer.
+    WStrInitStackBuffer(&wstr, lpBufferWCharArr, ulBufferLen);
+    WStrSPrintF(&wstr, L"%ls", lpWCharArr);
+    assert(bIsFit == (lpBufferWCharArr == wstr.lpWCharArr));
+    assert(0 == wcscmp(lpWCharArr, wstr.lpWCharArr));
+    TestWStrFree(&wstr);
+
+    // Same for WStrMove(): Copy into stack buffer, then free source.
+    WStrInitStackBuffer(&wstr, lpBufferWCharArr, ulBufferLen);
+    struct WStr heapWStr = {0};
+    WStrCopyWCharArr(&heapWStr, lpWCharArr, ulSize);
+    WStrMove(&wstr, &heapWStr);
+    assert(bIsFit == (lpBufferWCharArr == wstr.lpWCharArr));
+    assert(0 == wcscmp(lpWCharArr, wstr.lpWCharArr));
+    assert(NULL == heapWStr.lpWCharArr);
+    assert(WSTR_ALLOC_HEAP == heapWStr.eAlloc);
+    TestWStrFree(&wstr);
+
+    // Trim in place
+    if (bIsFit)
+    {
+        WStrInitStackBuffer(&wstr, lpBufferWCharArr, ulBufferLen);
+        WStrCopyWCharArr(&wstr, lpWCharArr, ulSize);
+        WStrTrimSpace(&wstr);
+        assert(WSTR_ALLOC_STACK == wstr.eAlloc);
+        assert(lpBufferWCharArr == wstr.lpWCharArr);
+        assert(L'\0' == wstr.lpWCharArr[wstr.ulSize]);
+
+        // Move from stack: Same buffer.  No copy.
+        struct WStr wstr2 = {0};
+        WStrMove(&wstr2, &wstr);
+        assert(WSTR_ALLOC_STACK == wstr2.eAlloc);
+        assert(lpBufferWCharArr == wstr2.lpWCharArr);
+        assert(ulBufferLen == wstr2.ulStackCapacity);
+        assert(NULL == wstr.lpWCharArr);
+        assert(WSTR_ALLOC_HEAP == wstr.eAlloc);
+
+        // Free: Only forget pointer.  Never free stack buffer.
+        TestWStrFree(&wstr2);
+        assert(WSTR_ALLOC_HEAP == wstr2.eAlloc);
+    }
+}
+
 // Ref: https://stackoverflow.com/a/13872211/257299
 // Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
 int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
@@ -485,6 +996,29 @@ int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The ope
 
     const wchar_t *lppExpectedOutputArr4[] = {L"a|bc|def"};
     TestWStrSplit(L"a|bc|def", L"~", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr4, sizeof(lppExpectedOutputArr4) / sizeof(lppExpectedOutputArr4[0]));
+
+    const wchar_t *lppExpectedOutputArr5[] = {L""};
+    TestWStrSplit(L"", L"|", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr5, sizeof(lppExpectedOutputArr5) / sizeof(lppExpectedOutputArr5[0]));
+
+    const wchar_t *lppExpectedOutputArr6[] = {L"a", L""};
+    TestWStrSplit(L"a|", L"|", UNLIMITED_MIN_TOKEN_COUNT, 2, NULL, lppExpectedOutputArr6, sizeof(lppExpectedOutputArr6) / sizeof(lppExpectedOutputArr6[0]));
+    }
+
+    // TestWStrSplit(): Fused trim, and same results from a consumer that is not fused
+    {
+    const wchar_t *lppExpectedOutputArr[] = {L"a", L"", L"b c", L"very long token with spaces", L""};
+    TestWStrSplit(L" a |  | b c\t|   very long token with spaces   |  ", L"|", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, WStrTrimSpace, lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+    TestWStrSplit(L" a |  | b c\t|   very long token with spaces   |  ", L"|", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, StaticTrimSpaceNotFused, lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+
+    const wchar_t *lppExpectedOutputArr2[] = {L"a ", L"", L"東京 "};
+    TestWStrSplit(L" a |  |\u3000東京 ", L"|", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, WStrLTrimSpace, lppExpectedOutputArr2, sizeof(lppExpectedOutputArr2) / sizeof(lppExpectedOutputArr2[0]));
+
+    const wchar_t *lppExpectedOutputArr3[] = {L" a", L"", L"\u3000東京"};
+    TestWStrSplit(L" a |  |\u3000東京 ", L"|", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, WStrRTrimSpace, lppExpectedOutputArr3, sizeof(lppExpectedOutputArr3) / sizeof(lppExpectedOutputArr3[0]));
+
+    // Intentional: Last token is not split, but is still trimmed.
+    const wchar_t *lppExpectedOutputArr4[] = {L"a", L"b | c"};
+    TestWStrSplit(L" a | b | c ", L"|", UNLIMITED_MIN_TOKEN_COUNT, 2, WStrTrimSpace, lppExpectedOutputArr4, sizeof(lppExpectedOutputArr4) / sizeof(lppExpectedOutputArr4[0]));
     }
 
     // TestWStrSplitNewLine(): Windows newline (\r\n)
@@ -500,6 +1034,11 @@ int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The ope
 
     const wchar_t *lppExpectedOutputArr4[] = {L"abc"};
     TestWStrSplitNewLine(L"abc", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr4, sizeof(lppExpectedOutputArr4) / sizeof(lppExpectedOutputArr4[0]));
+    TestWStrSplitNewLine(L"abc\r\n", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr4, sizeof(lppExpectedOutputArr4) / sizeof(lppExpectedOutputArr4[0]));
+
+    const wchar_t *lppExpectedOutputArr5[] = {L""};
+    TestWStrSplitNewLine(L"\r\n", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr5, sizeof(lppExpectedOutputArr5) / sizeof(lppExpectedOutputArr5[0]));
+    TestWStrSplitNewLine(L"", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr5, sizeof(lppExpectedOutputArr5) / sizeof(lppExpectedOutputArr5[0]));
     }
 
     // TestWStrSplitNewLine(): UNIX newline (\n)
@@ -514,6 +1053,9 @@ int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The ope
     TestWStrSplitNewLine(L"a\nbc\ndef", UNLIMITED_MIN_TOKEN_COUNT, 2, NULL, lppExpectedOutputArr3, sizeof(lppExpectedOutputArr3) / sizeof(lppExpectedOutputArr3[0]));
     }
 
+    TestWStrArrAppendWCharArr(1);
+    TestWStrArrAppendWCharArr(1000);
+
     {
     const wchar_t *lppTokenArr[] = {L"a", L"bc", L"def"};
     TestWStrJoin(lppTokenArr, sizeof(lppTokenArr) / sizeof(lppTokenArr[0]), L", ", L"a, bc, def");
@@ -566,6 +1108,10 @@ int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The ope
     TestWStrFileWriteAndRead(L"abc\r\ndef", 8);
     TestWStrFileWriteAndRead(L"abc東京def", 12);  // each kanji is 3 bytes in UTF-8
 
+    TestWStrFileAppend(L"", L"");
+    TestWStrFileAppend(L"abc\r\n", L"def\r\n");
+    TestWStrFileAppend(L"abc東京", L"def");
+
     {
     TestWStrArrCopyWCharArrArr((const wchar_t **) NULL, 0UL);
 
@@ -722,6 +1268,18 @@ int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The ope
     TestWStrSPrintFV(L"abc123def", L"%ls", L"L\"abc123def\"", L"abc123def");
     TestWStrSPrintFV(L"abc123def", L"%ls%ls%ls", L"L\"abc\", L\"123\", L\"def\"", L"abc", L"123", L"def");
 
+    TestWStrBuilder(0, 0);
+    TestWStrBuilder(0, 1);
+    TestWStrBuilder(0, 1000);
+    TestWStrBuilder(2, 0);
+    TestWStrBuilder(2, 1);
+    TestWStrBuilder(64, 3);
+    TestWStrBuilder(64, 1000);
+
+    TestWStrBuilderAppendFLarge(10);
+    TestWStrBuilderAppendFLarge(300);
+    TestWStrBuilderAppendFLarge(10000);
+
     TestWStrCompareEqual(NULL, NULL);
     TestWStrCompareEqual(L"", NULL);
     TestWStrCompareEqual(L"", L"");
@@ -738,6 +1296,104 @@ int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The ope
     TestWStrCompareGreater(L" ", L"");
     TestWStrCompareGreater(L"abcd", L"abc");
 
+    // TestWStrSplitView(): Same cases as TestWStrSplit()
+    {
+    const wchar_t *lppExpectedOutputArr[] = {L"a", L"bc", L"def"};
+    TestWStrSplitView(L"a|bc|def", L"|", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+
+    TestWStrSplitView(L"a::bc::def", L"::", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+
+    TestWStrSplitView(L" a | bc |  def ", L"|", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, WStrViewTrimSpace, lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+
+    const wchar_t *lppExpectedOutputArr2[] = {L"", L"", L"a", L"bc", L"", L"", L"def", L"", L""};
+    TestWStrSplitView(L"||a|bc|||def||", L"|", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr2, sizeof(lppExpectedOutputArr2) / sizeof(lppExpectedOutputArr2[0]));
+
+    const wchar_t *lppExpectedOutputArr3[] = {L"a", L"bc|def"};
+    TestWStrSplitView(L"a|bc|def", L"|", UNLIMITED_MIN_TOKEN_COUNT, 2, NULL, lppExpectedOutputArr3, sizeof(lppExpectedOutputArr3) / sizeof(lppExpectedOutputArr3[0]));
+
+    const wchar_t *lppExpectedOutputArr4[] = {L"a|bc|def"};
+    TestWStrSplitView(L"a|bc|def", L"~", UNLIMITED_MIN_TOKEN_COUNT, UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr4, sizeof(lppExpectedOutputArr4) / sizeof(lppExpectedOutputArr4[0]));
+    }
+
+    // TestWStrSplitNewLineView()
+    {
+    const wchar_t *lppExpectedOutputArr[] = {L"a", L"bc", L"def"};
+    TestWStrSplitNewLineView(L"a\r\nbc\r\ndef", lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+    TestWStrSplitNewLineView(L"a\nbc\ndef\n", lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+
+    const wchar_t *lppExpectedOutputArr2[] = {L"", L"", L"a", L"bc", L"", L"", L"def", L""};
+    TestWStrSplitNewLineView(L"\r\n\r\na\r\nbc\r\n\r\n\r\ndef\r\n\r\n", lppExpectedOutputArr2, sizeof(lppExpectedOutputArr2) / sizeof(lppExpectedOutputArr2[0]));
+    }
+
+    // TestWStrSplitArena()
+    {
+    const wchar_t *lppExpectedOutputArr[] = {L"a", L"bc", L"def"};
+    TestWStrSplitArena(L"a|bc|def", L"|", UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+
+    TestWStrSplitArena(L" a | bc |  def ", L"|", UNLIMITED_MAX_TOKEN_COUNT, WStrViewTrimSpace, lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+
+    const wchar_t *lppExpectedOutputArr2[] = {L"", L"", L"a", L"bc", L"", L"", L"def", L"", L""};
+    TestWStrSplitArena(L"||a|bc|||def||", L"|", UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr2, sizeof(lppExpectedOutputArr2) / sizeof(lppExpectedOutputArr2[0]));
+
+    const wchar_t *lppExpectedOutputArr3[] = {L"a", L"bc|def"};
+    TestWStrSplitArena(L"a|bc|def", L"|", 2, NULL, lppExpectedOutputArr3, sizeof(lppExpectedOutputArr3) / sizeof(lppExpectedOutputArr3[0]));
+
+    const wchar_t *lppExpectedOutputArr4[] = {L""};
+    TestWStrSplitArena(L"", L"|", UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr4, sizeof(lppExpectedOutputArr4) / sizeof(lppExpectedOutputArr4[0]));
+
+    const wchar_t *lppExpectedOutputArr5[] = {L"abcdefghijklmnopqrstuvwxyz", L"", L"0123456789abcdefghijklmnopqrstuvwxyz"};
+    TestWStrSplitArena(L"abcdefghijklmnopqrstuvwxyz::::0123456789abcdefghijklmnopqrstuvwxyz", L"::", UNLIMITED_MAX_TOKEN_COUNT, NULL, lppExpectedOutputArr5, sizeof(lppExpectedOutputArr5) / sizeof(lppExpectedOutputArr5[0]));
+    }
+
+    // TestWStrSplitNewLineArena()
+    {
+    const wchar_t *lppExpectedOutputArr[] = {L"a", L"bc", L"def"};
+    TestWStrSplitNewLineArena(L"a\r\nbc\r\ndef", lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+    TestWStrSplitNewLineArena(L"a\nbc\ndef\n", lppExpectedOutputArr, sizeof(lppExpectedOutputArr) / sizeof(lppExpectedOutputArr[0]));
+
+    const wchar_t *lppExpectedOutputArr2[] = {L"", L"", L"a", L"bc", L"", L"", L"def", L""};
+    TestWStrSplitNewLineArena(L"\r\n\r\na\r\nbc\r\n\r\n\r\ndef\r\n\r\n", lppExpectedOutputArr2, sizeof(lppExpectedOutputArr2) / sizeof(lppExpectedOutputArr2[0]));
+    }
+
+    TestWStrViewTrimSpace(L"WStrViewTrimSpace", WStrViewTrimSpace, L"  abc def  123  \r\n", L"abc def  123");
+    TestWStrViewTrimSpace(L"WStrViewTrimSpace", WStrViewTrimSpace, L"abc def  123", L"abc def  123");
+    TestWStrViewTrimSpace(L"WStrViewTrimSpace", WStrViewTrimSpace, L" \v\t\r\n ", L"");
+    TestWStrViewTrimSpace(L"WStrViewTrimSpace", WStrViewTrimSpace, L"", L"");
+    TestWStrViewTrimSpace(L"WStrViewLTrimSpace", WStrViewLTrimSpace, L"  abc def  123  ", L"abc def  123  ");
+    TestWStrViewTrimSpace(L"WStrViewLTrimSpace", WStrViewLTrimSpace, L"  ", L"");
+    TestWStrViewTrimSpace(L"WStrViewRTrimSpace", WStrViewRTrimSpace, L"  abc def  123  ", L"  abc def  123");
+    TestWStrViewTrimSpace(L"WStrViewRTrimSpace", WStrViewRTrimSpace, L"  ", L"");
+
+    // Left side is *not* terminated with '\0' at ulLeftSize
+    TestWStrViewCompare(L"abcdef", 3, L"abc", 0, 0);
+    TestWStrViewCompare(L"abcdef", 3, L"ABC", 1, 0);
+    TestWStrViewCompare(L"abcdef", 2, L"abc", -1, -1);
+    TestWStrViewCompare(L"abcdef", 4, L"abc", 1, 1);
+    TestWStrViewCompare(L"", 0, L"", 0, 0);
+    TestWStrViewCompare(L"", 0, L"a", -1, -1);
+
+    TestWStrCopyWStrView(L"abcdef", 3);
+    TestWStrCopyWStrView(L"abcdefghijklmnopqrstuvwxyz", 20);
+    TestWStrCopyWStrView(L"", 0);
+
+    TestWStrAllocHeap(L"");
+    TestWStrAllocHeap(L"abc");
+    TestWStrAllocHeap(L"abcdefghijklmnopqrstuvwxyz");
+
+    TestWStrAllocLiteral(NULL);
+    TestWStrAllocLiteral(L"");
+    TestWStrAllocLiteral(L"abc123");
+    TestWStrAllocLiteral(L"  abc123  ");
+    TestWStrAllocLiteral(L"    ");
+    TestWStrAllocLiteral(L"abcdefghijklmnopqrstuvwxyz0123456789");
+
+    TestWStrAllocStack(1, L"");
+    TestWStrAllocStack(1, L"a");
+    TestWStrAllocStack(4, L"abc");
+    TestWStrAllocStack(4, L"abcd");
+    TestWStrAllocStack(32, L"  abcdefghijklmnopqrstuvwxyz  ");
+    TestWStrAllocStack(8, L"  abcdefghijklmnopqrstuvwxyz  ");
+
     return 0;
 }
 
@@ -0,0 +1,260 @@
+#include "wstr_utf8.h"
+#include "wstr_simd.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <string.h>   // required for memcmp()
+#include <assert.h>   // required for assert()
+
+// Differential test: Each SIMD level must match MultiByteToWideChar() and WideCharToMultiByte() on random inputs.
+
+#define MAX_TEXT_SIZE 100U
+#define ITERATION_COUNT 20000U
+
+// Intentional: Boundary bytes of Table 3-7.  Why?  Random bytes must often be almost valid UTF-8.
+// Ref: https://www.unicode.org/versions/latest/ch03.pdf ("Table 3-7. Well-Formed UTF-8 Byte Sequences")
+static const unsigned char BYTE_ALPHABET_ARR[] = {
+    0x00, 'a', '\n', 0x7F,
+    0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF,  // continuation bytes
+    0xC0, 0xC1, 0xC2, 0xDF,              // 2-byte lead (C0, C1 are always overlong)
+    0xE0, 0xE1, 0xEC, 0xED, 0xEE, 0xEF,  // 3-byte lead (E0: overlong check; ED: surrogate check)
+    0xF0, 0xF1, 0xF3, 0xF4, 0xF5, 0xFF,  // 4-byte lead (F4: max U+10FFFF; F5-FF: always invalid)
+};
+
+// Intentional: Include unpaired and reversed surrogates.
+static const unsigned WCHAR_ALPHABET_ARR[] = {
+    0x0000, 0x0061, 0x007F, 0x0080, 0x07FF, 0x0800, 0x6771, 0xD7FF,
+    0xD800, 0xDBFF, 0xDC00, 0xDFFF,  // surrogates
+    0xE000, 0xFFFD, 0xFFFF,
+};
+
+static unsigned long long ullRandomState = 0x9E3779B97F4A7C15ULL;
+
+// Ref: https://en.wikipedia.org/wiki/Xorshift
+static unsigned
+StaticRandom(_In_ const unsigned ulExclusiveMax)
+{
+    ullRandomState ^= ullRandomState << 13;
+    ullRandomState ^= ullRandomState >> 7;
+    ullRandomState ^= ullRandomState << 17;
+    const unsigned x = (unsigned) (ullRandomState % ulExclusiveMax);
+    return x;
+}
+
+/**
+ * Mix of long ASCII runs (SIMD fast path), valid UTF-8 for random code points, and random boundary bytes.
+ */
+static size_t
+StaticRandomUtf8(_Out_ char         *lpCharArr,
+                 _In_  const size_t  ulMaxSize)
+{
+    const bool bIsMostlyValid = (0 != StaticRandom(4));
+    size_t ulSize = 0;
+    while (ulSize + 4U <= ulMaxSize)
+    {
+        const unsigned ulKind = StaticRandom(8);
+        if (ulKind < 4)
+        {
+            lpCharArr[ulSize++] = 'a' + StaticRandom(26);
+        }
+        else if (ulKind < 7 || bIsMostlyValid)
+        {
+            wchar_t lpWCharArr[2] = {0};
+            size_t ulWCharSize = 1;
+            const unsigned ulCodePoint = 0x80U + StaticRandom(0x10FFFFU - 0x80U);
+            if (ulCodePoint >= 0xD800U && ulCodePoint <= 0xDFFFU) {
+                continue;
+            }
+#if 2 == __SIZEOF_WCHAR_T__
+            if (ulCodePoint >= 0x10000U)
+            {
+                lpWCharArr[0] = (wchar_t) (0xD800U + ((ulCodePoint - 0x10000U) >> 10));
+                lpWCharArr[1] = (wchar_t) (0xDC00U + ((ulCodePoint - 0x10000U) & 0x3FFU));
+                ulWCharSize = 2;
+            }
+            else
+#endif
+            {
+                lpWCharArr[0] = (wchar_t) ulCodePoint;
+            }
+            size_t ulByteSize = 0;
+            size_t ulInvalidOffset = 0;
+            const bool bIsValid = WStrUtf8Encode(lpWCharArr, ulWCharSize, lpCharArr + ulSize, &ulByteSize, &ulInvalidOffset);
+            assert(bIsValid);
+            ulSize += ulByteSize;
+        }
+        else
+        {
+            lpCharArr[ulSize++] = (char) BYTE_ALPHABET_ARR[StaticRandom(sizeof(BYTE_ALPHABET_ARR))];
+        }
+    }
+    // Intentional: Sometimes truncate.  Why?  Incomplete sequence at end.
+    if (ulSize > 0 && 0 == StaticRandom(4)) {
+        --ulSize;
+    }
+    return ulSize;
+}
+
+static size_t
+StaticRandomWCharArr(_Out_ wchar_t      *lpWCharArr,
+                     _In_  const size_t  ulMaxSize)
+{
+    const size_t ulSize = StaticRandom(ulMaxSize + 1U);
+    // Intentional: Sometimes mostly ASCII.  Why?  SIMD fast path.
+    const bool bIsMostlyAscii = (0 == StaticRandom(2));
+    for (size_t i = 0; i < ulSize; ++i)
+    {
+        if (bIsMostlyAscii && 0 != StaticRandom(20)) {
+            lpWCharArr[i] = L'a' + StaticRandom(26);
+        }
+        else {
+            lpWCharArr[i] = (wchar_t) WCHAR_ALPHABET_ARR[StaticRandom(sizeof(WCHAR_ALPHABET_ARR) / sizeof(WCHAR_ALPHABET_ARR[0]))];
+        }
+    }
+    return ulSize;
+}
+
+static void
+StaticAssertDecode(_In_ const char   *lpCharArr,
+                   _In_ const size_t  ulByteSize)
+{
+    wchar_t lpExpectedWCharArr[MAX_TEXT_SIZE];
+    wchar_t lpActualWCharArr[MAX_TEXT_SIZE];
+
+    // Note: MultiByteToWideChar() fails if cbMultiByte is zero.
+    const int iExpectedSize = (0 == ulByteSize) ? 0
+        : MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, lpCharArr, (int) ulByteSize, lpExpectedWCharArr, MAX_TEXT_SIZE);
+    const bool bExpectedIsValid = (0 == ulByteSize || iExpectedSize > 0);
+
+    size_t ulActualSize = 0;
+    size_t ulInvalidByteOffset = 0;
+    const bool bActualIsValid = WStrUtf8Decode(lpCharArr, ulByteSize, lpActualWCharArr, &ulActualSize, &ulInvalidByteOffset);
+
+    if (bExpectedIsValid != bActualIsValid)
+    {
+        fprintf(stderr, "WStrUtf8Decode: bExpectedIsValid: %d != bActualIsValid: %d, ulInvalidByteOffset: %zd, bytes:",
+               bExpectedIsValid, bActualIsValid, ulInvalidByteOffset);
+        for (size_t i = 0; i < ulByteSize; ++i)
+        {
+            fprintf(stderr, " %02X", (unsigned char) lpCharArr[i]);
+        }
+        fprintf(stderr, "\n");
+    }
+    assert(bExpectedIsValid == bActualIsValid);
+    if (bActualIsValid)
+    {
+        assert((size_t) iExpectedSize == ulActualSize);
+        assert(0 == memcmp(lpExpectedWCharArr, lpActualWCharArr, ulActualSize * sizeof(wchar_t)));
+    }
+    else {
+        assert(ulInvalidByteOffset < ulByteSize);
+    }
+}
+
+static void
+StaticAssertEncode(_In_ const wchar_t *lpWCharArr,
+                   _In_ const size_t   ulSize)
+{
+    char lpExpectedCharArr[WSTR_UTF8_MAX_BYTES_PER_WCHAR * MAX_TEXT_SIZE];
+    char lpActualCharArr[WSTR_UTF8_MAX_BYTES_PER_WCHAR * MAX_TEXT_SIZE];
+
+    // Note: WideCharToMultiByte() fails if cchWideChar is zero.
+    const int iExpectedSize = (0 == ulSize) ? 0
+        : WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, lpWCharArr, (int) ulSize,
+                              lpExpectedCharArr, sizeof(lpExpectedCharArr), NULL, NULL);
+    const bool bExpectedIsValid = (0 == ulSize || iExpectedSize > 0);
+
+    size_t ulActualSize = 0;
+    size_t ulInvalidOffset = 0;
+    const bool bActualIsValid = WStrUtf8Encode(lpWCharArr, ulSize, lpActualCharArr, &ulActualSize, &ulInvalidOffset);
+
+    if (bExpectedIsValid != bActualIsValid)
+    {
+        fprintf(stderr, "WStrUtf8Encode: bExpectedIsValid: %d != bActualIsValid: %d, ulInvalidOffset: %zd, wchars:",
+               bExpectedIsValid, bActualIsValid, ulInvalidOffset);
+        for (size_t i = 0; i < ulSize; ++i)
+        {
+            fprintf(stderr, " %04X", (unsigned) lpWCharArr[i]);
+        }
+        fprintf(stderr, "\n");
+    }
+    assert(bExpectedIsValid == bActualIsValid);
+    if (bActualIsValid)
+    {
+        assert((size_t) iExpectedSize == ulActualSize);
+        assert(0 == memcmp(lpExpectedCharArr, lpActualCharArr, ulActualSize));
+    }
+    else {
+        assert(ulInvalidOffset < ulSize);
+    }
+}
+
+static void
+TestWStrUtf8Level(_In_ const enum EWStrSimdLevel eLevel)
+{
+    printf("TestWStrUtf8Level: %d\n", eLevel);
+
+    WStrSimdSetLevel(eLevel);
+    assert(eLevel == WStrSimdGetLevel());
+
+    for (size_t ulIteration = 0; ulIteration < ITERATION_COUNT; ++ulIteration)
+    {
+        char lpCharArr[MAX_TEXT_SIZE];
+        const size_t ulByteSize = StaticRandomUtf8(lpCharArr, StaticRandom(MAX_TEXT_SIZE + 1U));
+        StaticAssertDecode(lpCharArr, ulByteSize);
+
+        wchar_t lpWCharArr[MAX_TEXT_SIZE];
+        const size_t ulSize = StaticRandomWCharArr(lpWCharArr, MAX_TEXT_SIZE);
+        StaticAssertEncode(lpWCharArr, ulSize);
+    }
+}
+
+static void
+TestWStrUtf8Decode(_In_ const char    *lpCharArr,
+                   _In_ const bool     bExpectedIsValid,
+                   _In_ const wchar_t *lpExpectedWCharArr)
+{
+    printf("TestWStrUtf8Decode: [%s]\n", lpCharArr);
+
+    const size_t ulByteSize = strlen(lpCharArr);
+    wchar_t lpWCharArr[MAX_TEXT_SIZE];
+    size_t ulSize = 0;
+    size_t ulInvalidByteOffset = 0;
+    assert(bExpectedIsValid == WStrUtf8Decode(lpCharArr, ulByteSize, lpWCharArr, &ulSize, &ulInvalidByteOffset));
+    if (bExpectedIsValid)
+    {
+        assert(wcslen(lpExpectedWCharArr) == ulSize);
+        assert(0 == wmemcmp(lpExpectedWCharArr, lpWCharArr, ulSize));
+    }
+    StaticAssertDecode(lpCharArr, ulByteSize);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestWStrUtf8Decode("", true, L"");
+    TestWStrUtf8Decode("abcdefghijklmnopqrstuvwxyz0123456789", true, L"abcdefghijklmnopqrstuvwxyz0123456789");
+    TestWStrUtf8Decode("abc東京def", true, L"abc東京def");
+    TestWStrUtf8Decode("\xF0\x9F\x98\x80", true, L"\U0001F600");
+    TestWStrUtf8Decode("\xC0\x80", false, NULL);          // overlong NUL
+    TestWStrUtf8Decode("\xE0\x80\xAF", false, NULL);      // overlong '/'
+    TestWStrUtf8Decode("\xED\xA0\x80", false, NULL);      // surrogate U+D800
+    TestWStrUtf8Decode("\xF4\x90\x80\x80", false, NULL);  // U+110000
+    TestWStrUtf8Decode("abc\xE6\x9D", false, NULL);       // truncated
+    TestWStrUtf8Decode("\x80", false, NULL);              // continuation without lead
+
+    const enum EWStrSimdLevel eMaxLevel = WStrSimdGetMaxLevel();
+    for (int eLevel = WSTR_SIMD_LEVEL_SCALAR; eLevel <= (int) eMaxLevel; ++eLevel)
+    {
+        TestWStrUtf8Level((enum EWStrSimdLevel) eLevel);
+    }
+
+    WStrSimdSetLevel(eMaxLevel);
+    return 0;
+}
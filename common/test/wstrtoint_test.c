@@ -25,6 +25,24 @@ static void TestWStrTryParseToUInt8(_In_ wchar_t       *lpWCharArr,
     }
 }
 
+static void TestWStrViewTryParseToUInt8(_In_ const wchar_t *lpWCharArr,
+                                        _In_ const size_t   ulSize,
+                                        _In_ const int      base,
+                                        _In_ const BOOL     bExpectedResult,
+                                        _In_ const uint8_t  ucExpectedResult)
+{
+    printf("TestWStrViewTryParseToUInt8: [%.*ls][%d] -> %d/%hhu\n", (int) ulSize, lpWCharArr, base, bExpectedResult, ucExpectedResult);
+
+    // Intentional: View is *not* terminated with '\0' at ulSize.
+    const struct WStrView wstrView = {.lpWCharArr = lpWCharArr, .ulSize = ulSize};
+    uint8_t ucResult = 0;
+    const BOOL bResult = WStrViewTryParseToUInt8(&wstrView, base, &ucResult, stderr, L"ERROR: Failed to parse text [%.*ls] as uint8_t", (int) ulSize, lpWCharArr);
+    assert(bExpectedResult == bResult);
+    if (bResult) {
+        assert(ucExpectedResult == ucResult);
+    }
+}
+
 // Ref: https://stackoverflow.com/a/13872211/257299
 // Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
 int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
@@ -58,6 +76,12 @@ int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The ope
     TestWStrTryParseToUInt8(L"0x17", 16, TRUE, (uint8_t) 0x17);
     TestWStrTryParseToUInt8(L"0X17", 16, TRUE, (uint8_t) 0x17);
 
+    TestWStrViewTryParseToUInt8(L"17|abc", 2, 10, TRUE, (uint8_t) 17);
+    TestWStrViewTryParseToUInt8(L"255|abc", 3, 10, TRUE, (uint8_t) 255);
+    TestWStrViewTryParseToUInt8(L"2556", 3, 10, TRUE, (uint8_t) 255);
+    TestWStrViewTryParseToUInt8(L"256|abc", 3, 10, FALSE, 0);
+    TestWStrViewTryParseToUInt8(L"0x17|abc", 4, 16, TRUE, (uint8_t) 0x17);
+
     return 0;
 }
 
@@ -0,0 +1,113 @@
+#include "xarena.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for printf()
+#include <stdint.h>   // required for uintptr_t
+#include <string.h>   // required for memset()
+#include <assert.h>   // required for assert()
+
+static void
+StaticAssertAligned(_In_ const void *lpData)
+{
+    assert(0 == ((uintptr_t) lpData) % XARENA_ALIGN);
+}
+
+static void
+TestXArenaCalloc(_In_ const size_t ulChunkByteSize,
+                 _In_ const size_t ulCount,
+                 _In_ const size_t ulByteSize)
+{
+    printf("TestXArenaCalloc: ulChunkByteSize:%zu, ulCount:%zu, ulByteSize:%zu\n", ulChunkByteSize, ulCount, ulByteSize);
+
+    struct XArena arena = {.ulChunkByteSize = ulChunkByteSize};
+    // Intentional: Two rounds.  Why?  Second round reuses chunks after reset: Bytes must be zeroed again.
+    for (int iRound = 0; iRound < 2; ++iRound)
+    {
+        unsigned char *lpPrevByteArr = NULL;
+        for (size_t i = 0; i < ulCount; ++i)
+        {
+            unsigned char *lpByteArr = XArenaCalloc(&arena, ulByteSize, sizeof(unsigned char));
+            StaticAssertAligned(lpByteArr);
+            assert(lpPrevByteArr != lpByteArr);
+            for (size_t j = 0; j < ulByteSize; ++j)
+            {
+                assert(0 == lpByteArr[j]);
+            }
+            // Overwrite to find overlap with next block
+            memset(lpByteArr, 0xAB, ulByteSize);
+            lpPrevByteArr = lpByteArr;
+        }
+        XArenaReset(&arena);
+    }
+    XArenaFree(&arena);
+    assert(NULL == arena.lpFirstChunk);
+    assert(NULL == arena.lpCurrentChunk);
+    assert(ulChunkByteSize == arena.ulChunkByteSize);
+}
+
+static void
+TestXArenaMark()
+{
+    printf("TestXArenaMark\n");
+
+    struct XArena arena = {.ulChunkByteSize = 256U};
+    void *lpFirst = XArenaMalloc(&arena, 10U);
+
+    struct XArenaMark mark = {0};
+    XArenaGetMark(&arena, &mark);
+
+    void *lpSecond = XArenaMalloc(&arena, 10U);
+    assert(lpFirst != lpSecond);
+    // Many chunks after mark
+    for (size_t i = 0; i < 100; ++i)
+    {
+        XArenaMalloc(&arena, 100U);
+    }
+    struct XArenaChunk *lpChunk = arena.lpCurrentChunk;
+
+    // Same address after reset: Space after mark is reused.
+    XArenaResetToMark(&arena, &mark);
+    void *lpSecond2 = XArenaMalloc(&arena, 10U);
+    assert(lpSecond == lpSecond2);
+
+    // No new chunks: Chunks after mark are reused.
+    for (size_t i = 0; i < 100; ++i)
+    {
+        XArenaMalloc(&arena, 100U);
+    }
+    assert(lpChunk == arena.lpCurrentChunk);
+
+    // Oversize block: Own chunk
+    unsigned char *lpLargeByteArr = XArenaCalloc(&arena, 1000U, sizeof(unsigned char));
+    StaticAssertAligned(lpLargeByteArr);
+    assert(1000U <= arena.lpCurrentChunk->ulByteSize);
+    memset(lpLargeByteArr, 0xAB, 1000U);
+
+    XArenaReset(&arena);
+    void *lpFirst2 = XArenaMalloc(&arena, 10U);
+    assert(lpFirst == lpFirst2);
+
+    XArenaFree(&arena);
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    TestXArenaCalloc(0, 1, 1);
+    TestXArenaCalloc(0, 1000, 0);
+    TestXArenaCalloc(0, 1000, 7);
+    TestXArenaCalloc(0, 1000, 100);
+    TestXArenaCalloc(64U, 100, 1);
+    TestXArenaCalloc(64U, 100, 63);
+    TestXArenaCalloc(64U, 100, 65);
+    TestXArenaCalloc(64U, 100, 1000);
+
+    TestXArenaMark();
+    return 0;
+}
@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+
+COMMON_DIR_PATH='..'
+source "$(dirname "$0")/$COMMON_DIR_PATH/bashlib"
+
+main()
+{
+    local this_script_abs_dir_path
+    this_script_abs_dir_path="$(dirname "$(readlink --canonicalize "$0")")"
+
+    bashlib_log_and_run_cmd \
+        cd "$this_script_abs_dir_path"
+
+    bashlib_log_and_run_cmd \
+        rm --force *.o *.exe
+
+    bashlib_log_and_run_cmd \
+        ../build.bash
+
+    local csrc
+    for csrc in *.c
+    do
+        local bname
+        # Ex: "log_binary_decode.c" -> "log_binary_decode"
+        bname="$(basename "$csrc" '.c')"
+        build "$bname"
+    done
+
+    bashlib_log_and_run_cmd \
+        cd -
+}
+
+build()
+{
+    # Ex: "log_binary_decode"
+    local tool_module="$1" ; shift
+
+    local is_release=$BASHLIB_TRUE
+
+    # Note: -iquote is more specific than -I
+    bashlib_log_and_run_gcc_cmd_if_necessary \
+        $is_release "$tool_module.c" "$tool_module.o" -iquote "$COMMON_DIR_PATH"
+
+    bashlib_log_and_run_gcc_cmd \
+        $is_release \
+        -o "$tool_module.exe" \
+        "$COMMON_DIR_PATH/"*.o \
+        "$tool_module.o" \
+        -lgdi32 -lole32
+
+    bashlib_log_and_run_cmd \
+        ls -l "$tool_module.exe"
+}
+
+main "$@"
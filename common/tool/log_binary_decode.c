@@ -0,0 +1,48 @@
+#include "log_binary.h"
+#include "wstr_file_map.h"
+#include <windows.h>  // required for wWinMain()
+#include <stdio.h>    // required for fwprintf()
+#include <wchar.h>    // required for wcscmp()
+
+// Render a binary log file as text lines.  See: log_binary.h
+// Ex: log_binary_decode.exe passport.binlog > passport.log
+
+static void
+StaticShowHelp()
+{
+    fwprintf(stderr, L"\r\n");
+    fwprintf(stderr, L"Usage: log_binary_decode.exe BINARY_LOG_FILE_PATH\r\n");
+    fwprintf(stderr, L"Write all records as text lines to stdout.  Errors, e.g., a truncated last record, are written to stderr.\r\n");
+    fwprintf(stderr, L"\r\n");
+}
+
+// Ref: https://stackoverflow.com/a/13872211/257299
+// Ref: https://docs.microsoft.com/en-us/windows/win32/learnwin32/winmain--the-application-entry-point
+int WINAPI wWinMain(__attribute__((unused)) HINSTANCE hInstance,      // The operating system uses this value to identify the executable (EXE) when it is loaded in memory.
+                    __attribute__((unused)) HINSTANCE hPrevInstance,  // ... has no meaning. It was used in 16-bit Windows, but is now always zero.
+                    __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
+                    __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/set-error-mode?view=msvc-170
+    _set_error_mode(_OUT_TO_STDERR);  // assert to STDERR
+
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/argc-argv-wargv?view=msvc-170
+    if (2 != __argc || 0 == wcscmp(L"-h", __wargv[1]) || 0 == wcscmp(L"--help", __wargv[1]))
+    {
+        StaticShowHelp();
+        return 1;
+    }
+
+    struct WStrFileMap fileMap = {0};
+    // Intentional: Code page is ignored.  Why?  No bytes are decoded by WStrFileMap.
+    if (!WStrFileMapOpen2(&fileMap, __wargv[1], CP_UTF8, stderr))
+    {
+        return 1;
+    }
+
+    const bool bResult = LogBinaryDecode((const unsigned char *) fileMap.lpCharArr, fileMap.ulByteSize, stdout, stderr);
+    WStrFileMapClose(&fileMap);
+
+    const int x = bResult ? 0 : 1;
+    return x;
+}
@@ -1,1058 +1,1288 @@
 #include "win32.h"
+#include <wchar.h>   // required for wcscmp(), wcschr(), wcsncmp()
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
 
 // Ref: https://wiki.winehq.org/List_Of_Windows_Messages
+// Important: Sorted by uMsg.  For same uMsg, first is name for Win32MsgToText(), then aliases for Win32MsgFromText().
+// Intentional: Table, not switch.  Why?  Same data gives name, category, and reverse lookup.
+static const struct Win32Msg WIN32_MSG_ARR[] = {
+    {    0, L"WM_NULL",                       WIN32_MSG_CATEGORY_OTHER},
+    {    1, L"WM_CREATE",                     WIN32_MSG_CATEGORY_WINDOW},
+    {    2, L"WM_DESTROY",                    WIN32_MSG_CATEGORY_WINDOW},
+    {    3, L"WM_MOVE",                       WIN32_MSG_CATEGORY_WINDOW},
+    {    5, L"WM_SIZE",                       WIN32_MSG_CATEGORY_WINDOW},
+    {    6, L"WM_ACTIVATE",                   WIN32_MSG_CATEGORY_WINDOW},
+    {    7, L"WM_SETFOCUS",                   WIN32_MSG_CATEGORY_WINDOW},
+    {    8, L"WM_KILLFOCUS",                  WIN32_MSG_CATEGORY_WINDOW},
+    {   10, L"WM_ENABLE",                     WIN32_MSG_CATEGORY_WINDOW},
+    {   11, L"WM_SETREDRAW",                  WIN32_MSG_CATEGORY_PAINT},
+    {   12, L"WM_SETTEXT",                    WIN32_MSG_CATEGORY_WINDOW},
+    {   13, L"WM_GETTEXT",                    WIN32_MSG_CATEGORY_WINDOW},
+    {   14, L"WM_GETTEXTLENGTH",              WIN32_MSG_CATEGORY_WINDOW},
+    {   15, L"WM_PAINT",                      WIN32_MSG_CATEGORY_PAINT},
+    {   16, L"WM_CLOSE",                      WIN32_MSG_CATEGORY_WINDOW},
+    {   17, L"WM_QUERYENDSESSION",            WIN32_MSG_CATEGORY_SYSTEM},
+    {   18, L"WM_QUIT",                       WIN32_MSG_CATEGORY_WINDOW},
+    {   19, L"WM_QUERYOPEN",                  WIN32_MSG_CATEGORY_WINDOW},
+    {   20, L"WM_ERASEBKGND",                 WIN32_MSG_CATEGORY_PAINT},
+    {   21, L"WM_SYSCOLORCHANGE",             WIN32_MSG_CATEGORY_SYSTEM},
+    {   22, L"WM_ENDSESSION",                 WIN32_MSG_CATEGORY_SYSTEM},
+    {   24, L"WM_SHOWWINDOW",                 WIN32_MSG_CATEGORY_WINDOW},
+    {   25, L"WM_CTLCOLOR",                   WIN32_MSG_CATEGORY_PAINT},
+    {   26, L"WM_WININICHANGE",               WIN32_MSG_CATEGORY_SYSTEM},
+    {   26, L"WM_SETTINGCHANGE",              WIN32_MSG_CATEGORY_SYSTEM},  // Alias
+    {   27, L"WM_DEVMODECHANGE",              WIN32_MSG_CATEGORY_SYSTEM},
+    {   28, L"WM_ACTIVATEAPP",                WIN32_MSG_CATEGORY_WINDOW},
+    {   29, L"WM_FONTCHANGE",                 WIN32_MSG_CATEGORY_SYSTEM},
+    {   30, L"WM_TIMECHANGE",                 WIN32_MSG_CATEGORY_SYSTEM},
+    {   31, L"WM_CANCELMODE",                 WIN32_MSG_CATEGORY_WINDOW},
+    {   32, L"WM_SETCURSOR",                  WIN32_MSG_CATEGORY_MOUSE},
+    {   33, L"WM_MOUSEACTIVATE",              WIN32_MSG_CATEGORY_WINDOW | WIN32_MSG_CATEGORY_MOUSE},
+    {   34, L"WM_CHILDACTIVATE",              WIN32_MSG_CATEGORY_WINDOW},
+    {   35, L"WM_QUEUESYNC",                  WIN32_MSG_CATEGORY_OTHER},
+    {   36, L"WM_GETMINMAXINFO",              WIN32_MSG_CATEGORY_WINDOW},
+    {   38, L"WM_PAINTICON",                  WIN32_MSG_CATEGORY_PAINT},
+    {   39, L"WM_ICONERASEBKGND",             WIN32_MSG_CATEGORY_PAINT},
+    {   40, L"WM_NEXTDLGCTL",                 WIN32_MSG_CATEGORY_WINDOW},
+    {   42, L"WM_SPOOLERSTATUS",              WIN32_MSG_CATEGORY_SYSTEM},
+    {   43, L"WM_DRAWITEM",                   WIN32_MSG_CATEGORY_PAINT},
+    {   44, L"WM_MEASUREITEM",                WIN32_MSG_CATEGORY_PAINT},
+    {   45, L"WM_DELETEITEM",                 WIN32_MSG_CATEGORY_NOTIFY},
+    {   46, L"WM_VKEYTOITEM",                 WIN32_MSG_CATEGORY_KEYBOARD},
+    {   47, L"WM_CHARTOITEM",                 WIN32_MSG_CATEGORY_KEYBOARD},
+    {   48, L"WM_SETFONT",                    WIN32_MSG_CATEGORY_WINDOW},
+    {   49, L"WM_GETFONT",                    WIN32_MSG_CATEGORY_WINDOW},
+    {   50, L"WM_SETHOTKEY",                  WIN32_MSG_CATEGORY_KEYBOARD},
+    {   51, L"WM_GETHOTKEY",                  WIN32_MSG_CATEGORY_KEYBOARD},
+    {   55, L"WM_QUERYDRAGICON",              WIN32_MSG_CATEGORY_WINDOW},
+    {   57, L"WM_COMPAREITEM",                WIN32_MSG_CATEGORY_NOTIFY},
+    {   61, L"WM_GETOBJECT",                  WIN32_MSG_CATEGORY_OTHER},
+    {   65, L"WM_COMPACTING",                 WIN32_MSG_CATEGORY_SYSTEM},
+    {   68, L"WM_COMMNOTIFY",                 WIN32_MSG_CATEGORY_OTHER},
+    {   70, L"WM_WINDOWPOSCHANGING",          WIN32_MSG_CATEGORY_WINDOW},
+    {   71, L"WM_WINDOWPOSCHANGED",           WIN32_MSG_CATEGORY_WINDOW},
+    {   72, L"WM_POWER",                      WIN32_MSG_CATEGORY_SYSTEM},
+    {   73, L"WM_COPYGLOBALDATA",             WIN32_MSG_CATEGORY_OTHER},
+    {   74, L"WM_COPYDATA",                   WIN32_MSG_CATEGORY_OTHER},
+    {   75, L"WM_CANCELJOURNAL",              WIN32_MSG_CATEGORY_OTHER},
+    {   78, L"WM_NOTIFY",                     WIN32_MSG_CATEGORY_NOTIFY},
+    {   80, L"WM_INPUTLANGCHANGEREQUEST",     WIN32_MSG_CATEGORY_KEYBOARD},
+    {   81, L"WM_INPUTLANGCHANGE",            WIN32_MSG_CATEGORY_KEYBOARD},
+    {   82, L"WM_TCARD",                      WIN32_MSG_CATEGORY_OTHER},
+    {   83, L"WM_HELP",                       WIN32_MSG_CATEGORY_OTHER},
+    {   84, L"WM_USERCHANGED",                WIN32_MSG_CATEGORY_SYSTEM},
+    {   85, L"WM_NOTIFYFORMAT",               WIN32_MSG_CATEGORY_NOTIFY},
+    {  123, L"WM_CONTEXTMENU",                WIN32_MSG_CATEGORY_MENU},
+    {  124, L"WM_STYLECHANGING",              WIN32_MSG_CATEGORY_WINDOW},
+    {  125, L"WM_STYLECHANGED",               WIN32_MSG_CATEGORY_WINDOW},
+    {  126, L"WM_DISPLAYCHANGE",              WIN32_MSG_CATEGORY_SYSTEM},
+    {  127, L"WM_GETICON",                    WIN32_MSG_CATEGORY_WINDOW},
+    {  128, L"WM_SETICON",                    WIN32_MSG_CATEGORY_WINDOW},
+    {  129, L"WM_NCCREATE",                   WIN32_MSG_CATEGORY_WINDOW | WIN32_MSG_CATEGORY_NONCLIENT},
+    {  130, L"WM_NCDESTROY",                  WIN32_MSG_CATEGORY_WINDOW | WIN32_MSG_CATEGORY_NONCLIENT},
+    {  131, L"WM_NCCALCSIZE",                 WIN32_MSG_CATEGORY_WINDOW | WIN32_MSG_CATEGORY_NONCLIENT},
+    {  132, L"WM_NCHITTEST",                  WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  133, L"WM_NCPAINT",                    WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_PAINT},
+    {  134, L"WM_NCACTIVATE",                 WIN32_MSG_CATEGORY_WINDOW | WIN32_MSG_CATEGORY_NONCLIENT},
+    {  135, L"WM_GETDLGCODE",                 WIN32_MSG_CATEGORY_KEYBOARD},
+    {  136, L"WM_SYNCPAINT",                  WIN32_MSG_CATEGORY_PAINT},
+    {  160, L"WM_NCMOUSEMOVE",                WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  161, L"WM_NCLBUTTONDOWN",              WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  162, L"WM_NCLBUTTONUP",                WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  163, L"WM_NCLBUTTONDBLCLK",            WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  164, L"WM_NCRBUTTONDOWN",              WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  165, L"WM_NCRBUTTONUP",                WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  166, L"WM_NCRBUTTONDBLCLK",            WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  167, L"WM_NCMBUTTONDOWN",              WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  168, L"WM_NCMBUTTONUP",                WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  169, L"WM_NCMBUTTONDBLCLK",            WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  171, L"WM_NCXBUTTONDOWN",              WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  172, L"WM_NCXBUTTONUP",                WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  173, L"WM_NCXBUTTONDBLCLK",            WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  176, L"EM_GETSEL",                     WIN32_MSG_CATEGORY_CONTROL},
+    {  177, L"EM_SETSEL",                     WIN32_MSG_CATEGORY_CONTROL},
+    {  178, L"EM_GETRECT",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  179, L"EM_SETRECT",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  180, L"EM_SETRECTNP",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  181, L"EM_SCROLL",                     WIN32_MSG_CATEGORY_CONTROL},
+    {  182, L"EM_LINESCROLL",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  183, L"EM_SCROLLCARET",                WIN32_MSG_CATEGORY_CONTROL},
+    {  185, L"EM_GETMODIFY",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  187, L"EM_SETMODIFY",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  188, L"EM_GETLINECOUNT",               WIN32_MSG_CATEGORY_CONTROL},
+    {  189, L"EM_LINEINDEX",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  190, L"EM_SETHANDLE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  191, L"EM_GETHANDLE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  192, L"EM_GETTHUMB",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  193, L"EM_LINELENGTH",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  194, L"EM_REPLACESEL",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  195, L"EM_SETFONT",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  196, L"EM_GETLINE",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  197, L"EM_LIMITTEXT",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  197, L"EM_SETLIMITTEXT",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    {  198, L"EM_CANUNDO",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  199, L"EM_UNDO",                       WIN32_MSG_CATEGORY_CONTROL},
+    {  200, L"EM_FMTLINES",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  201, L"EM_LINEFROMCHAR",               WIN32_MSG_CATEGORY_CONTROL},
+    {  202, L"EM_SETWORDBREAK",               WIN32_MSG_CATEGORY_CONTROL},
+    {  203, L"EM_SETTABSTOPS",                WIN32_MSG_CATEGORY_CONTROL},
+    {  204, L"EM_SETPASSWORDCHAR",            WIN32_MSG_CATEGORY_CONTROL},
+    {  205, L"EM_EMPTYUNDOBUFFER",            WIN32_MSG_CATEGORY_CONTROL},
+    {  206, L"EM_GETFIRSTVISIBLELINE",        WIN32_MSG_CATEGORY_CONTROL},
+    {  207, L"EM_SETREADONLY",                WIN32_MSG_CATEGORY_CONTROL},
+    {  209, L"EM_SETWORDBREAKPROC",           WIN32_MSG_CATEGORY_CONTROL},
+    {  209, L"EM_GETWORDBREAKPROC",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    {  210, L"EM_GETPASSWORDCHAR",            WIN32_MSG_CATEGORY_CONTROL},
+    {  211, L"EM_SETMARGINS",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  212, L"EM_GETMARGINS",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  213, L"EM_GETLIMITTEXT",               WIN32_MSG_CATEGORY_CONTROL},
+    {  214, L"EM_POSFROMCHAR",                WIN32_MSG_CATEGORY_CONTROL},
+    {  215, L"EM_CHARFROMPOS",                WIN32_MSG_CATEGORY_CONTROL},
+    {  216, L"EM_SETIMESTATUS",               WIN32_MSG_CATEGORY_CONTROL},
+    {  217, L"EM_GETIMESTATUS",               WIN32_MSG_CATEGORY_CONTROL},
+    {  224, L"SBM_SETPOS",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  225, L"SBM_GETPOS",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  226, L"SBM_SETRANGE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  227, L"SBM_GETRANGE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  228, L"SBM_ENABLE_ARROWS",             WIN32_MSG_CATEGORY_CONTROL},
+    {  230, L"SBM_SETRANGEREDRAW",            WIN32_MSG_CATEGORY_CONTROL},
+    {  233, L"SBM_SETSCROLLINFO",             WIN32_MSG_CATEGORY_CONTROL},
+    {  234, L"SBM_GETSCROLLINFO",             WIN32_MSG_CATEGORY_CONTROL},
+    {  235, L"SBM_GETSCROLLBARINFO",          WIN32_MSG_CATEGORY_CONTROL},
+    {  240, L"BM_GETCHECK",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  241, L"BM_SETCHECK",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  242, L"BM_GETSTATE",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  243, L"BM_SETSTATE",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  244, L"BM_SETSTYLE",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  245, L"BM_CLICK",                      WIN32_MSG_CATEGORY_CONTROL},
+    {  246, L"BM_GETIMAGE",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  247, L"BM_SETIMAGE",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  248, L"BM_SETDONTCLICK",               WIN32_MSG_CATEGORY_CONTROL},
+    {  255, L"WM_INPUT",                      WIN32_MSG_CATEGORY_MOUSE | WIN32_MSG_CATEGORY_KEYBOARD},
+    {  256, L"WM_KEYDOWN",                    WIN32_MSG_CATEGORY_KEYBOARD},
+    {  256, L"WM_KEYFIRST",                   WIN32_MSG_CATEGORY_KEYBOARD},  // Alias
+    {  257, L"WM_KEYUP",                      WIN32_MSG_CATEGORY_KEYBOARD},
+    {  258, L"WM_CHAR",                       WIN32_MSG_CATEGORY_KEYBOARD},
+    {  259, L"WM_DEADCHAR",                   WIN32_MSG_CATEGORY_KEYBOARD},
+    {  260, L"WM_SYSKEYDOWN",                 WIN32_MSG_CATEGORY_KEYBOARD},
+    {  261, L"WM_SYSKEYUP",                   WIN32_MSG_CATEGORY_KEYBOARD},
+    {  262, L"WM_SYSCHAR",                    WIN32_MSG_CATEGORY_KEYBOARD},
+    {  263, L"WM_SYSDEADCHAR",                WIN32_MSG_CATEGORY_KEYBOARD},
+    {  265, L"WM_UNICHAR",                    WIN32_MSG_CATEGORY_KEYBOARD},
+    {  265, L"WM_WNT_CONVERTREQUESTEX",       WIN32_MSG_CATEGORY_IME},  // Alias
+    {  266, L"WM_CONVERTREQUEST",             WIN32_MSG_CATEGORY_IME},
+    {  267, L"WM_CONVERTRESULT",              WIN32_MSG_CATEGORY_IME},
+    {  268, L"WM_INTERIM",                    WIN32_MSG_CATEGORY_IME},
+    {  269, L"WM_IME_STARTCOMPOSITION",       WIN32_MSG_CATEGORY_IME},
+    {  270, L"WM_IME_ENDCOMPOSITION",         WIN32_MSG_CATEGORY_IME},
+    {  271, L"WM_IME_COMPOSITION",            WIN32_MSG_CATEGORY_IME},
+    {  271, L"WM_IME_KEYLAST",                WIN32_MSG_CATEGORY_IME},  // Alias
+    {  272, L"WM_INITDIALOG",                 WIN32_MSG_CATEGORY_WINDOW},
+    {  273, L"WM_COMMAND",                    WIN32_MSG_CATEGORY_NOTIFY},
+    {  274, L"WM_SYSCOMMAND",                 WIN32_MSG_CATEGORY_MENU},
+    {  275, L"WM_TIMER",                      WIN32_MSG_CATEGORY_TIMER},
+    {  276, L"WM_HSCROLL",                    WIN32_MSG_CATEGORY_NOTIFY},
+    {  277, L"WM_VSCROLL",                    WIN32_MSG_CATEGORY_NOTIFY},
+    {  278, L"WM_INITMENU",                   WIN32_MSG_CATEGORY_MENU},
+    {  279, L"WM_INITMENUPOPUP",              WIN32_MSG_CATEGORY_MENU},
+    {  280, L"WM_SYSTIMER",                   WIN32_MSG_CATEGORY_TIMER},
+    {  287, L"WM_MENUSELECT",                 WIN32_MSG_CATEGORY_MENU},
+    {  288, L"WM_MENUCHAR",                   WIN32_MSG_CATEGORY_MENU},
+    {  289, L"WM_ENTERIDLE",                  WIN32_MSG_CATEGORY_MENU},
+    {  290, L"WM_MENURBUTTONUP",              WIN32_MSG_CATEGORY_MENU},
+    {  291, L"WM_MENUDRAG",                   WIN32_MSG_CATEGORY_MENU},
+    {  292, L"WM_MENUGETOBJECT",              WIN32_MSG_CATEGORY_MENU},
+    {  293, L"WM_UNINITMENUPOPUP",            WIN32_MSG_CATEGORY_MENU},
+    {  294, L"WM_MENUCOMMAND",                WIN32_MSG_CATEGORY_MENU},
+    {  295, L"WM_CHANGEUISTATE",              WIN32_MSG_CATEGORY_WINDOW},
+    {  296, L"WM_UPDATEUISTATE",              WIN32_MSG_CATEGORY_WINDOW},
+    {  297, L"WM_QUERYUISTATE",               WIN32_MSG_CATEGORY_WINDOW},
+    {  305, L"WM_LBTRACKPOINT",               WIN32_MSG_CATEGORY_MOUSE},
+    {  306, L"WM_CTLCOLORMSGBOX",             WIN32_MSG_CATEGORY_PAINT},
+    {  307, L"WM_CTLCOLOREDIT",               WIN32_MSG_CATEGORY_PAINT},
+    {  308, L"WM_CTLCOLORLISTBOX",            WIN32_MSG_CATEGORY_PAINT},
+    {  309, L"WM_CTLCOLORBTN",                WIN32_MSG_CATEGORY_PAINT},
+    {  310, L"WM_CTLCOLORDLG",                WIN32_MSG_CATEGORY_PAINT},
+    {  311, L"WM_CTLCOLORSCROLLBAR",          WIN32_MSG_CATEGORY_PAINT},
+    {  312, L"WM_CTLCOLORSTATIC",             WIN32_MSG_CATEGORY_PAINT},
+    {  320, L"CB_GETEDITSEL",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  321, L"CB_LIMITTEXT",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  322, L"CB_SETEDITSEL",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  323, L"CB_ADDSTRING",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  324, L"CB_DELETESTRING",               WIN32_MSG_CATEGORY_CONTROL},
+    {  325, L"CB_DIR",                        WIN32_MSG_CATEGORY_CONTROL},
+    {  326, L"CB_GETCOUNT",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  327, L"CB_GETCURSEL",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  328, L"CB_GETLBTEXT",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  329, L"CB_GETLBTEXTLEN",               WIN32_MSG_CATEGORY_CONTROL},
+    {  330, L"CB_INSERTSTRING",               WIN32_MSG_CATEGORY_CONTROL},
+    {  331, L"CB_RESETCONTENT",               WIN32_MSG_CATEGORY_CONTROL},
+    {  332, L"CB_FINDSTRING",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  333, L"CB_SELECTSTRING",               WIN32_MSG_CATEGORY_CONTROL},
+    {  334, L"CB_SETCURSEL",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  335, L"CB_SHOWDROPDOWN",               WIN32_MSG_CATEGORY_CONTROL},
+    {  336, L"CB_GETITEMDATA",                WIN32_MSG_CATEGORY_CONTROL},
+    {  337, L"CB_SETITEMDATA",                WIN32_MSG_CATEGORY_CONTROL},
+    {  338, L"CB_GETDROPPEDCONTROLRECT",      WIN32_MSG_CATEGORY_CONTROL},
+    {  339, L"CB_SETITEMHEIGHT",              WIN32_MSG_CATEGORY_CONTROL},
+    {  340, L"CB_GETITEMHEIGHT",              WIN32_MSG_CATEGORY_CONTROL},
+    {  341, L"CB_SETEXTENDEDUI",              WIN32_MSG_CATEGORY_CONTROL},
+    {  342, L"CB_GETEXTENDEDUI",              WIN32_MSG_CATEGORY_CONTROL},
+    {  343, L"CB_GETDROPPEDSTATE",            WIN32_MSG_CATEGORY_CONTROL},
+    {  344, L"CB_FINDSTRINGEXACT",            WIN32_MSG_CATEGORY_CONTROL},
+    {  345, L"CB_SETLOCALE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  346, L"CB_GETLOCALE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  347, L"CB_GETTOPINDEX",                WIN32_MSG_CATEGORY_CONTROL},
+    {  348, L"CB_SETTOPINDEX",                WIN32_MSG_CATEGORY_CONTROL},
+    {  349, L"CB_GETHORIZONTALEXTENT",        WIN32_MSG_CATEGORY_CONTROL},
+    {  350, L"CB_SETHORIZONTALEXTENT",        WIN32_MSG_CATEGORY_CONTROL},
+    {  351, L"CB_GETDROPPEDWIDTH",            WIN32_MSG_CATEGORY_CONTROL},
+    {  352, L"CB_SETDROPPEDWIDTH",            WIN32_MSG_CATEGORY_CONTROL},
+    {  353, L"CB_INITSTORAGE",                WIN32_MSG_CATEGORY_CONTROL},
+    {  355, L"CB_MULTIPLEADDSTRING",          WIN32_MSG_CATEGORY_CONTROL},
+    {  356, L"CB_GETCOMBOBOXINFO",            WIN32_MSG_CATEGORY_CONTROL},
+    {  357, L"CB_MSGMAX",                     WIN32_MSG_CATEGORY_CONTROL},
+    {  368, L"STM_SETICON",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  369, L"STM_GETICON",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  370, L"STM_SETIMAGE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  371, L"STM_GETIMAGE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  384, L"LB_ADDSTRING",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  385, L"LB_INSERTSTRING",               WIN32_MSG_CATEGORY_CONTROL},
+    {  386, L"LB_DELETESTRING",               WIN32_MSG_CATEGORY_CONTROL},
+    {  387, L"LB_SELITEMRANGEEX",             WIN32_MSG_CATEGORY_CONTROL},
+    {  388, L"LB_RESETCONTENT",               WIN32_MSG_CATEGORY_CONTROL},
+    {  389, L"LB_SETSEL",                     WIN32_MSG_CATEGORY_CONTROL},
+    {  390, L"LB_SETCURSEL",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  391, L"LB_GETSEL",                     WIN32_MSG_CATEGORY_CONTROL},
+    {  392, L"LB_GETCURSEL",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  393, L"LB_GETTEXT",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  394, L"LB_GETTEXTLEN",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  395, L"LB_GETCOUNT",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  396, L"LB_SELECTSTRING",               WIN32_MSG_CATEGORY_CONTROL},
+    {  397, L"LB_DIR",                        WIN32_MSG_CATEGORY_CONTROL},
+    {  398, L"LB_GETTOPINDEX",                WIN32_MSG_CATEGORY_CONTROL},
+    {  399, L"LB_FINDSTRING",                 WIN32_MSG_CATEGORY_CONTROL},
+    {  400, L"LB_GETSELCOUNT",                WIN32_MSG_CATEGORY_CONTROL},
+    {  401, L"LB_GETSELITEMS",                WIN32_MSG_CATEGORY_CONTROL},
+    {  402, L"LB_SETTABSTOPS",                WIN32_MSG_CATEGORY_CONTROL},
+    {  403, L"LB_GETHORIZONTALEXTENT",        WIN32_MSG_CATEGORY_CONTROL},
+    {  404, L"LB_SETHORIZONTALEXTENT",        WIN32_MSG_CATEGORY_CONTROL},
+    {  405, L"LB_SETCOLUMNWIDTH",             WIN32_MSG_CATEGORY_CONTROL},
+    {  406, L"LB_ADDFILE",                    WIN32_MSG_CATEGORY_CONTROL},
+    {  407, L"LB_SETTOPINDEX",                WIN32_MSG_CATEGORY_CONTROL},
+    {  408, L"LB_GETITEMRECT",                WIN32_MSG_CATEGORY_CONTROL},
+    {  409, L"LB_GETITEMDATA",                WIN32_MSG_CATEGORY_CONTROL},
+    {  410, L"LB_SETITEMDATA",                WIN32_MSG_CATEGORY_CONTROL},
+    {  411, L"LB_SELITEMRANGE",               WIN32_MSG_CATEGORY_CONTROL},
+    {  412, L"LB_SETANCHORINDEX",             WIN32_MSG_CATEGORY_CONTROL},
+    {  413, L"LB_GETANCHORINDEX",             WIN32_MSG_CATEGORY_CONTROL},
+    {  414, L"LB_SETCARETINDEX",              WIN32_MSG_CATEGORY_CONTROL},
+    {  415, L"LB_GETCARETINDEX",              WIN32_MSG_CATEGORY_CONTROL},
+    {  416, L"LB_SETITEMHEIGHT",              WIN32_MSG_CATEGORY_CONTROL},
+    {  417, L"LB_GETITEMHEIGHT",              WIN32_MSG_CATEGORY_CONTROL},
+    {  418, L"LB_FINDSTRINGEXACT",            WIN32_MSG_CATEGORY_CONTROL},
+    {  421, L"LB_SETLOCALE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  422, L"LB_GETLOCALE",                  WIN32_MSG_CATEGORY_CONTROL},
+    {  423, L"LB_SETCOUNT",                   WIN32_MSG_CATEGORY_CONTROL},
+    {  424, L"LB_INITSTORAGE",                WIN32_MSG_CATEGORY_CONTROL},
+    {  425, L"LB_ITEMFROMPOINT",              WIN32_MSG_CATEGORY_CONTROL},
+    {  433, L"LB_MULTIPLEADDSTRING",          WIN32_MSG_CATEGORY_CONTROL},
+    {  434, L"LB_GETLISTBOXINFO",             WIN32_MSG_CATEGORY_CONTROL},
+    {  512, L"WM_MOUSEMOVE",                  WIN32_MSG_CATEGORY_MOUSE},
+    {  512, L"WM_MOUSEFIRST",                 WIN32_MSG_CATEGORY_MOUSE},  // Alias
+    {  513, L"WM_LBUTTONDOWN",                WIN32_MSG_CATEGORY_MOUSE},
+    {  514, L"WM_LBUTTONUP",                  WIN32_MSG_CATEGORY_MOUSE},
+    {  515, L"WM_LBUTTONDBLCLK",              WIN32_MSG_CATEGORY_MOUSE},
+    {  516, L"WM_RBUTTONDOWN",                WIN32_MSG_CATEGORY_MOUSE},
+    {  517, L"WM_RBUTTONUP",                  WIN32_MSG_CATEGORY_MOUSE},
+    {  518, L"WM_RBUTTONDBLCLK",              WIN32_MSG_CATEGORY_MOUSE},
+    {  519, L"WM_MBUTTONDOWN",                WIN32_MSG_CATEGORY_MOUSE},
+    {  520, L"WM_MBUTTONUP",                  WIN32_MSG_CATEGORY_MOUSE},
+    {  521, L"WM_MBUTTONDBLCLK",              WIN32_MSG_CATEGORY_MOUSE},
+    {  521, L"WM_MOUSELAST",                  WIN32_MSG_CATEGORY_MOUSE},  // Alias
+    {  522, L"WM_MOUSEWHEEL",                 WIN32_MSG_CATEGORY_MOUSE},
+    {  523, L"WM_XBUTTONDOWN",                WIN32_MSG_CATEGORY_MOUSE},
+    {  524, L"WM_XBUTTONUP",                  WIN32_MSG_CATEGORY_MOUSE},
+    {  525, L"WM_XBUTTONDBLCLK",              WIN32_MSG_CATEGORY_MOUSE},
+    {  526, L"WM_MOUSEHWHEEL",                WIN32_MSG_CATEGORY_MOUSE},
+    {  528, L"WM_PARENTNOTIFY",               WIN32_MSG_CATEGORY_NOTIFY},
+    {  529, L"WM_ENTERMENULOOP",              WIN32_MSG_CATEGORY_MENU},
+    {  530, L"WM_EXITMENULOOP",               WIN32_MSG_CATEGORY_MENU},
+    {  531, L"WM_NEXTMENU",                   WIN32_MSG_CATEGORY_MENU},
+    {  532, L"WM_SIZING",                     WIN32_MSG_CATEGORY_WINDOW},
+    {  533, L"WM_CAPTURECHANGED",             WIN32_MSG_CATEGORY_MOUSE},
+    {  534, L"WM_MOVING",                     WIN32_MSG_CATEGORY_WINDOW},
+    {  536, L"WM_POWERBROADCAST",             WIN32_MSG_CATEGORY_SYSTEM},
+    {  537, L"WM_DEVICECHANGE",               WIN32_MSG_CATEGORY_SYSTEM},
+    {  544, L"WM_MDICREATE",                  WIN32_MSG_CATEGORY_WINDOW},
+    {  545, L"WM_MDIDESTROY",                 WIN32_MSG_CATEGORY_WINDOW},
+    {  546, L"WM_MDIACTIVATE",                WIN32_MSG_CATEGORY_WINDOW},
+    {  547, L"WM_MDIRESTORE",                 WIN32_MSG_CATEGORY_WINDOW},
+    {  548, L"WM_MDINEXT",                    WIN32_MSG_CATEGORY_WINDOW},
+    {  549, L"WM_MDIMAXIMIZE",                WIN32_MSG_CATEGORY_WINDOW},
+    {  550, L"WM_MDITILE",                    WIN32_MSG_CATEGORY_WINDOW},
+    {  551, L"WM_MDICASCADE",                 WIN32_MSG_CATEGORY_WINDOW},
+    {  552, L"WM_MDIICONARRANGE",             WIN32_MSG_CATEGORY_WINDOW},
+    {  553, L"WM_MDIGETACTIVE",               WIN32_MSG_CATEGORY_WINDOW},
+    {  560, L"WM_MDISETMENU",                 WIN32_MSG_CATEGORY_MENU},
+    {  561, L"WM_ENTERSIZEMOVE",              WIN32_MSG_CATEGORY_WINDOW},
+    {  562, L"WM_EXITSIZEMOVE",               WIN32_MSG_CATEGORY_WINDOW},
+    {  563, L"WM_DROPFILES",                  WIN32_MSG_CATEGORY_OTHER},
+    {  564, L"WM_MDIREFRESHMENU",             WIN32_MSG_CATEGORY_MENU},
+    {  640, L"WM_IME_REPORT",                 WIN32_MSG_CATEGORY_IME},
+    {  641, L"WM_IME_SETCONTEXT",             WIN32_MSG_CATEGORY_IME},
+    {  642, L"WM_IME_NOTIFY",                 WIN32_MSG_CATEGORY_IME},
+    {  643, L"WM_IME_CONTROL",                WIN32_MSG_CATEGORY_IME},
+    {  644, L"WM_IME_COMPOSITIONFULL",        WIN32_MSG_CATEGORY_IME},
+    {  645, L"WM_IME_SELECT",                 WIN32_MSG_CATEGORY_IME},
+    {  646, L"WM_IME_CHAR",                   WIN32_MSG_CATEGORY_IME},
+    {  648, L"WM_IME_REQUEST",                WIN32_MSG_CATEGORY_IME},
+    {  656, L"WM_IMEKEYDOWN",                 WIN32_MSG_CATEGORY_IME},
+    {  656, L"WM_IME_KEYDOWN",                WIN32_MSG_CATEGORY_IME},  // Alias
+    {  657, L"WM_IMEKEYUP",                   WIN32_MSG_CATEGORY_IME},
+    {  657, L"WM_IME_KEYUP",                  WIN32_MSG_CATEGORY_IME},  // Alias
+    {  672, L"WM_NCMOUSEHOVER",               WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  673, L"WM_MOUSEHOVER",                 WIN32_MSG_CATEGORY_MOUSE},
+    {  674, L"WM_NCMOUSELEAVE",               WIN32_MSG_CATEGORY_NONCLIENT | WIN32_MSG_CATEGORY_MOUSE},
+    {  675, L"WM_MOUSELEAVE",                 WIN32_MSG_CATEGORY_MOUSE},
+    {  736, L"WM_DPICHANGED",                 WIN32_MSG_CATEGORY_WINDOW},
+    {  738, L"WM_DPICHANGED_BEFOREPARENT",    WIN32_MSG_CATEGORY_WINDOW},
+    {  739, L"WM_DPICHANGED_AFTERPARENT",     WIN32_MSG_CATEGORY_WINDOW},
+    {  740, L"WM_GETDPISCALEDSIZE",           WIN32_MSG_CATEGORY_WINDOW},
+    {  768, L"WM_CUT",                        WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  769, L"WM_COPY",                       WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  770, L"WM_PASTE",                      WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  771, L"WM_CLEAR",                      WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  772, L"WM_UNDO",                       WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  773, L"WM_RENDERFORMAT",               WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  774, L"WM_RENDERALLFORMATS",           WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  775, L"WM_DESTROYCLIPBOARD",           WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  776, L"WM_DRAWCLIPBOARD",              WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  777, L"WM_PAINTCLIPBOARD",             WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  778, L"WM_VSCROLLCLIPBOARD",           WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  779, L"WM_SIZECLIPBOARD",              WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  780, L"WM_ASKCBFORMATNAME",            WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  781, L"WM_CHANGECBCHAIN",              WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  782, L"WM_HSCROLLCLIPBOARD",           WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  783, L"WM_QUERYNEWPALETTE",            WIN32_MSG_CATEGORY_PAINT},
+    {  784, L"WM_PALETTEISCHANGING",          WIN32_MSG_CATEGORY_PAINT},
+    {  785, L"WM_PALETTECHANGED",             WIN32_MSG_CATEGORY_PAINT},
+    {  786, L"WM_HOTKEY",                     WIN32_MSG_CATEGORY_KEYBOARD},
+    {  791, L"WM_PRINT",                      WIN32_MSG_CATEGORY_PAINT},
+    {  792, L"WM_PRINTCLIENT",                WIN32_MSG_CATEGORY_PAINT},
+    {  793, L"WM_APPCOMMAND",                 WIN32_MSG_CATEGORY_KEYBOARD},
+    {  794, L"WM_THEMECHANGED",               WIN32_MSG_CATEGORY_SYSTEM},
+    {  797, L"WM_CLIPBOARDUPDATE",            WIN32_MSG_CATEGORY_CLIPBOARD},
+    {  798, L"WM_DWMCOMPOSITIONCHANGED",      WIN32_MSG_CATEGORY_SYSTEM},
+    {  856, L"WM_HANDHELDFIRST",              WIN32_MSG_CATEGORY_OTHER},
+    {  863, L"WM_HANDHELDLAST",               WIN32_MSG_CATEGORY_OTHER},
+    {  864, L"WM_AFXFIRST",                   WIN32_MSG_CATEGORY_OTHER},
+    {  895, L"WM_AFXLAST",                    WIN32_MSG_CATEGORY_OTHER},
+    {  896, L"WM_PENWINFIRST",                WIN32_MSG_CATEGORY_OTHER},
+    {  897, L"WM_RCRESULT",                   WIN32_MSG_CATEGORY_OTHER},
+    {  898, L"WM_HOOKRCRESULT",               WIN32_MSG_CATEGORY_OTHER},
+    {  899, L"WM_GLOBALRCCHANGE",             WIN32_MSG_CATEGORY_OTHER},
+    {  899, L"WM_PENMISCINFO",                WIN32_MSG_CATEGORY_OTHER},  // Alias
+    {  900, L"WM_SKB",                        WIN32_MSG_CATEGORY_OTHER},
+    {  901, L"WM_HEDITCTL",                   WIN32_MSG_CATEGORY_OTHER},
+    {  901, L"WM_PENCTL",                     WIN32_MSG_CATEGORY_OTHER},  // Alias
+    {  902, L"WM_PENMISC",                    WIN32_MSG_CATEGORY_OTHER},
+    {  903, L"WM_CTLINIT",                    WIN32_MSG_CATEGORY_OTHER},
+    {  904, L"WM_PENEVENT",                   WIN32_MSG_CATEGORY_OTHER},
+    {  911, L"WM_PENWINLAST",                 WIN32_MSG_CATEGORY_OTHER},
+    { 1024, L"DDM_SETFMT",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1024, L"DM_GETDEFID",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1024, L"NIN_SELECT",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1024, L"TBM_GETPOS",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1024, L"WM_PSD_PAGESETUPDLG",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1024, L"WM_USER",                       WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"CBEM_INSERTITEMA",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1025, L"DDM_DRAW",                      WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"DM_SETDEFID",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"HKM_SETHOTKEY",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"PBM_SETRANGE",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"RB_INSERTBANDA",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"SB_SETTEXTA",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"TB_ENABLEBUTTON",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"TBM_GETRANGEMIN",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"TTM_ACTIVATE",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"WM_CHOOSEFONT_GETLOGFONT",      WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1025, L"WM_PSD_FULLPAGERECT",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"CBEM_SETIMAGELIST",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1026, L"DDM_CLOSE",                     WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"DM_REPOSITION",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"HKM_GETHOTKEY",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"PBM_SETPOS",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"RB_DELETEBAND",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"SB_GETTEXTA",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"TB_CHECKBUTTON",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"TBM_GETRANGEMAX",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1026, L"WM_PSD_MINMARGINRECT",          WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"CBEM_GETIMAGELIST",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1027, L"DDM_BEGIN",                     WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"HKM_SETRULES",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"PBM_DELTAPOS",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"RB_GETBARINFO",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"SB_GETTEXTLENGTHA",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"TBM_GETTIC",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"TB_PRESSBUTTON",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"TTM_SETDELAYTIME",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1027, L"WM_PSD_MARGINRECT",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1028, L"CBEM_GETITEMA",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1028, L"DDM_END",                       WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1028, L"PBM_SETSTEP",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1028, L"RB_SETBARINFO",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1028, L"SB_SETPARTS",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1028, L"TB_HIDEBUTTON",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1028, L"TBM_SETTIC",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1028, L"TTM_ADDTOOLA",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1028, L"WM_PSD_GREEKTEXTRECT",          WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1029, L"CBEM_SETITEMA",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1029, L"PBM_STEPIT",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1029, L"TB_INDETERMINATE",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1029, L"TBM_SETPOS",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1029, L"TTM_DELTOOLA",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1029, L"WM_PSD_ENVSTAMPRECT",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1030, L"CBEM_GETCOMBOCONTROL",          WIN32_MSG_CATEGORY_CONTROL},
+    { 1030, L"PBM_SETRANGE32",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1030, L"RB_SETBANDINFOA",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1030, L"SB_GETPARTS",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1030, L"TB_MARKBUTTON",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1030, L"TBM_SETRANGE",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1030, L"TTM_NEWTOOLRECTA",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1030, L"WM_PSD_YAFULLPAGERECT",         WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1031, L"CBEM_GETEDITCONTROL",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1031, L"PBM_GETRANGE",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1031, L"RB_SETPARENT",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1031, L"SB_GETBORDERS",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1031, L"TBM_SETRANGEMIN",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1031, L"TTM_RELAYEVENT",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1032, L"CBEM_SETEXSTYLE",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1032, L"PBM_GETPOS",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1032, L"RB_HITTEST",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1032, L"SB_SETMINHEIGHT",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1032, L"TBM_SETRANGEMAX",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1032, L"TTM_GETTOOLINFOA",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1033, L"CBEM_GETEXSTYLE",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1033, L"CBEM_GETEXTENDEDSTYLE",         WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1033, L"PBM_SETBARCOLOR",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1033, L"RB_GETRECT",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1033, L"SB_SIMPLE",                     WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1033, L"TB_ISBUTTONENABLED",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1033, L"TBM_CLEARTICS",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1033, L"TTM_SETTOOLINFOA",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1034, L"CBEM_HASEDITCHANGED",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1034, L"RB_INSERTBANDW",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1034, L"SB_GETRECT",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1034, L"TB_ISBUTTONCHECKED",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1034, L"TBM_SETSEL",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1034, L"TTM_HITTESTA",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1034, L"WIZ_QUERYNUMPAGES",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1035, L"CBEM_INSERTITEMW",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1035, L"RB_SETBANDINFOW",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1035, L"SB_SETTEXTW",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1035, L"TB_ISBUTTONPRESSED",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1035, L"TBM_SETSELSTART",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1035, L"TTM_GETTEXTA",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1035, L"WIZ_NEXT",                      WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1036, L"CBEM_SETITEMW",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1036, L"RB_GETBANDCOUNT",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1036, L"SB_GETTEXTLENGTHW",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1036, L"TB_ISBUTTONHIDDEN",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1036, L"TBM_SETSELEND",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1036, L"TTM_UPDATETIPTEXTA",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1036, L"WIZ_PREV",                      WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1037, L"CBEM_GETITEMW",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1037, L"RB_GETROWCOUNT",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1037, L"SB_GETTEXTW",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1037, L"TB_ISBUTTONINDETERMINATE",      WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1037, L"TTM_GETTOOLCOUNT",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1038, L"CBEM_SETEXTENDEDSTYLE",         WIN32_MSG_CATEGORY_CONTROL},
+    { 1038, L"RB_GETROWHEIGHT",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1038, L"SB_ISSIMPLE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1038, L"TB_ISBUTTONHIGHLIGHTED",        WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1038, L"TBM_GETPTICS",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1038, L"TTM_ENUMTOOLSA",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1039, L"SB_SETICON",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1039, L"TBM_GETTICPOS",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1039, L"TTM_GETCURRENTTOOLA",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1040, L"RB_IDTOINDEX",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1040, L"SB_SETTIPTEXTA",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1040, L"TBM_GETNUMTICS",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1040, L"TTM_WINDOWFROMPOINT",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1041, L"RB_GETTOOLTIPS",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1041, L"SB_SETTIPTEXTW",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1041, L"TBM_GETSELSTART",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1041, L"TB_SETSTATE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1041, L"TTM_TRACKACTIVATE",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1042, L"RB_SETTOOLTIPS",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1042, L"SB_GETTIPTEXTA",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1042, L"TB_GETSTATE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1042, L"TBM_GETSELEND",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1042, L"TTM_TRACKPOSITION",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1043, L"RB_SETBKCOLOR",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1043, L"SB_GETTIPTEXTW",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1043, L"TB_ADDBITMAP",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1043, L"TBM_CLEARSEL",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1043, L"TTM_SETTIPBKCOLOR",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1044, L"RB_GETBKCOLOR",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1044, L"SB_GETICON",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1044, L"TB_ADDBUTTONSA",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1044, L"TBM_SETTICFREQ",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1044, L"TTM_SETTIPTEXTCOLOR",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1045, L"RB_SETTEXTCOLOR",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1045, L"TB_INSERTBUTTONA",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1045, L"TBM_SETPAGESIZE",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1045, L"TTM_GETDELAYTIME",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1046, L"RB_GETTEXTCOLOR",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1046, L"TB_DELETEBUTTON",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1046, L"TBM_GETPAGESIZE",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1046, L"TTM_GETTIPBKCOLOR",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1047, L"RB_SIZETORECT",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1047, L"TB_GETBUTTON",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1047, L"TBM_SETLINESIZE",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1047, L"TTM_GETTIPTEXTCOLOR",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1048, L"RB_BEGINDRAG",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1048, L"TB_BUTTONCOUNT",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1048, L"TBM_GETLINESIZE",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1048, L"TTM_SETMAXTIPWIDTH",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1049, L"RB_ENDDRAG",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1049, L"TB_COMMANDTOINDEX",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1049, L"TBM_GETTHUMBRECT",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1049, L"TTM_GETMAXTIPWIDTH",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1050, L"RB_DRAGMOVE",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1050, L"TBM_GETCHANNELRECT",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1050, L"TB_SAVERESTOREA",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1050, L"TTM_SETMARGIN",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1051, L"RB_GETBARHEIGHT",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1051, L"TB_CUSTOMIZE",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1051, L"TBM_SETTHUMBLENGTH",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1051, L"TTM_GETMARGIN",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1052, L"RB_GETBANDINFOW",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1052, L"TB_ADDSTRINGA",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1052, L"TBM_GETTHUMBLENGTH",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1052, L"TTM_POP",                       WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1053, L"RB_GETBANDINFOA",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1053, L"TB_GETITEMRECT",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1053, L"TBM_SETTOOLTIPS",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1053, L"TTM_UPDATE",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1054, L"RB_MINIMIZEBAND",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1054, L"TB_BUTTONSTRUCTSIZE",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1054, L"TBM_GETTOOLTIPS",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1054, L"TTM_GETBUBBLESIZE",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1055, L"RB_MAXIMIZEBAND",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1055, L"TBM_SETTIPSIDE",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1055, L"TB_SETBUTTONSIZE",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1055, L"TTM_ADJUSTRECT",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1056, L"TBM_SETBUDDY",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1056, L"TB_SETBITMAPSIZE",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1056, L"TTM_SETTITLEA",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1057, L"MSG_FTS_JUMP_VA",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1057, L"TB_AUTOSIZE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1057, L"TBM_GETBUDDY",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1057, L"TTM_SETTITLEW",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1058, L"RB_GETBANDBORDERS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1059, L"MSG_FTS_JUMP_QWORD",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1059, L"RB_SHOWBAND",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1059, L"TB_GETTOOLTIPS",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1060, L"MSG_REINDEX_REQUEST",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1060, L"TB_SETTOOLTIPS",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1061, L"MSG_FTS_WHERE_IS_IT",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1061, L"RB_SETPALETTE",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1061, L"TB_SETPARENT",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1062, L"RB_GETPALETTE",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1063, L"RB_MOVEBAND",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1063, L"TB_SETROWS",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1064, L"TB_GETROWS",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1065, L"TB_GETBITMAPFLAGS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1066, L"TB_SETCMDID",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1067, L"RB_PUSHCHEVRON",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1067, L"TB_CHANGEBITMAP",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1068, L"TB_GETBITMAP",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1069, L"MSG_GET_DEFFONT",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1069, L"TB_GETBUTTONTEXTA",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1070, L"TB_REPLACEBITMAP",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1071, L"TB_SETINDENT",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1072, L"TB_SETIMAGELIST",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1073, L"TB_GETIMAGELIST",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1074, L"TB_LOADIMAGES",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1074, L"EM_CANPASTE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1074, L"TTM_ADDTOOLW",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1075, L"EM_DISPLAYBAND",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1075, L"TB_GETRECT",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1075, L"TTM_DELTOOLW",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1076, L"EM_EXGETSEL",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1076, L"TB_SETHOTIMAGELIST",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1076, L"TTM_NEWTOOLRECTW",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1077, L"EM_EXLIMITTEXT",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1077, L"TB_GETHOTIMAGELIST",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1077, L"TTM_GETTOOLINFOW",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1078, L"EM_EXLINEFROMCHAR",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1078, L"TB_SETDISABLEDIMAGELIST",       WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1078, L"TTM_SETTOOLINFOW",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1079, L"EM_EXSETSEL",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1079, L"TB_GETDISABLEDIMAGELIST",       WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1079, L"TTM_HITTESTW",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1080, L"EM_FINDTEXT",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1080, L"TB_SETSTYLE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1080, L"TTM_GETTEXTW",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1081, L"EM_FORMATRANGE",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1081, L"TB_GETSTYLE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1081, L"TTM_UPDATETIPTEXTW",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1082, L"EM_GETCHARFORMAT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1082, L"TB_GETBUTTONSIZE",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1082, L"TTM_ENUMTOOLSW",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1083, L"EM_GETEVENTMASK",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1083, L"TB_SETBUTTONWIDTH",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1083, L"TTM_GETCURRENTTOOLW",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1084, L"EM_GETOLEINTERFACE",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1084, L"TB_SETMAXTEXTROWS",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1085, L"EM_GETPARAFORMAT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1085, L"TB_GETTEXTROWS",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1086, L"EM_GETSELTEXT",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1086, L"TB_GETOBJECT",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1087, L"EM_HIDESELECTION",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1087, L"TB_GETBUTTONINFOW",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1088, L"EM_PASTESPECIAL",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1088, L"TB_SETBUTTONINFOW",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1089, L"EM_REQUESTRESIZE",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1089, L"TB_GETBUTTONINFOA",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1090, L"EM_SELECTIONTYPE",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1090, L"TB_SETBUTTONINFOA",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1091, L"EM_SETBKGNDCOLOR",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1091, L"TB_INSERTBUTTONW",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1092, L"EM_SETCHARFORMAT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1092, L"TB_ADDBUTTONSW",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1093, L"EM_SETEVENTMASK",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1093, L"TB_HITTEST",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1094, L"EM_SETOLECALLBACK",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1094, L"TB_SETDRAWTEXTFLAGS",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1095, L"EM_SETPARAFORMAT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1095, L"TB_GETHOTITEM",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1096, L"EM_SETTARGETDEVICE",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1096, L"TB_SETHOTITEM",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1097, L"EM_STREAMIN",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1097, L"TB_SETANCHORHIGHLIGHT",         WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1098, L"EM_STREAMOUT",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1098, L"TB_GETANCHORHIGHLIGHT",         WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1099, L"EM_GETTEXTRANGE",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1099, L"TB_GETBUTTONTEXTW",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1100, L"EM_FINDWORDBREAK",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1100, L"TB_SAVERESTOREW",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1101, L"EM_SETOPTIONS",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1101, L"TB_ADDSTRINGW",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1102, L"EM_GETOPTIONS",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1102, L"TB_MAPACCELERATORA",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1103, L"EM_FINDTEXTEX",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1103, L"TB_GETINSERTMARK",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1104, L"EM_GETWORDBREAKPROCEX",         WIN32_MSG_CATEGORY_CONTROL},
+    { 1104, L"TB_SETINSERTMARK",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1105, L"EM_SETWORDBREAKPROCEX",         WIN32_MSG_CATEGORY_CONTROL},
+    { 1105, L"TB_INSERTMARKHITTEST",          WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1106, L"EM_SETUNDOLIMIT",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1106, L"TB_MOVEBUTTON",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1107, L"TB_GETMAXSIZE",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1108, L"EM_REDO",                       WIN32_MSG_CATEGORY_CONTROL},
+    { 1108, L"TB_SETEXTENDEDSTYLE",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1109, L"EM_CANREDO",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1109, L"TB_GETEXTENDEDSTYLE",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1110, L"EM_GETUNDONAME",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1110, L"TB_GETPADDING",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1111, L"EM_GETREDONAME",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1111, L"TB_SETPADDING",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1112, L"EM_STOPGROUPTYPING",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1112, L"TB_SETINSERTMARKCOLOR",         WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1113, L"EM_SETTEXTMODE",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1113, L"TB_GETINSERTMARKCOLOR",         WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1114, L"EM_GETTEXTMODE",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1114, L"TB_MAPACCELERATORW",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1115, L"EM_AUTOURLDETECT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1115, L"TB_GETSTRINGW",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1116, L"EM_GETAUTOURLDETECT",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1116, L"TB_GETSTRINGA",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1117, L"EM_SETPALETTE",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1118, L"EM_GETTEXTEX",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1119, L"EM_GETTEXTLENGTHEX",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1120, L"EM_SHOWSCROLLBAR",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1121, L"EM_SETTEXTEX",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1123, L"TAPI_REPLY",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1124, L"ACM_OPENA",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 1124, L"BFFM_SETSTATUSTEXTA",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1124, L"CDM_FIRST",                     WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1124, L"CDM_GETSPEC",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1124, L"EM_SETPUNCTUATION",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1124, L"IPM_CLEARADDRESS",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1124, L"WM_CAP_UNICODE_START",          WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1125, L"ACM_PLAY",                      WIN32_MSG_CATEGORY_CONTROL},
+    { 1125, L"BFFM_ENABLEOK",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1125, L"CDM_GETFILEPATH",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1125, L"EM_GETPUNCTUATION",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1125, L"IPM_SETADDRESS",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1125, L"PSM_SETCURSEL",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1125, L"UDM_SETRANGE",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1125, L"WM_CHOOSEFONT_SETLOGFONT",      WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1126, L"ACM_STOP",                      WIN32_MSG_CATEGORY_CONTROL},
+    { 1126, L"BFFM_SETSELECTIONA",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1126, L"CDM_GETFOLDERPATH",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1126, L"EM_SETWORDWRAPMODE",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1126, L"IPM_GETADDRESS",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1126, L"PSM_REMOVEPAGE",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1126, L"UDM_GETRANGE",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1126, L"WM_CAP_SET_CALLBACK_ERRORW",    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1126, L"WM_CHOOSEFONT_SETFLAGS",        WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1127, L"ACM_OPENW",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 1127, L"BFFM_SETSELECTIONW",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1127, L"CDM_GETFOLDERIDLIST",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1127, L"EM_GETWORDWRAPMODE",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1127, L"IPM_SETRANGE",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1127, L"PSM_ADDPAGE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1127, L"UDM_SETPOS",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1127, L"WM_CAP_SET_CALLBACK_STATUSW",   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1128, L"BFFM_SETSTATUSTEXTW",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1128, L"CDM_SETCONTROLTEXT",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1128, L"EM_SETIMECOLOR",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1128, L"IPM_SETFOCUS",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1128, L"PSM_CHANGED",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1128, L"UDM_GETPOS",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1129, L"CDM_HIDECONTROL",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1129, L"EM_GETIMECOLOR",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1129, L"IPM_ISBLANK",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1129, L"PSM_RESTARTWINDOWS",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1129, L"UDM_SETBUDDY",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1130, L"CDM_SETDEFEXT",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1130, L"EM_SETIMEOPTIONS",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1130, L"PSM_REBOOTSYSTEM",              WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1130, L"UDM_GETBUDDY",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1131, L"EM_GETIMEOPTIONS",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1131, L"PSM_CANCELTOCLOSE",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1131, L"UDM_SETACCEL",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1132, L"EM_CONVPOSITION",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1132, L"PSM_QUERYSIBLINGS",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1132, L"UDM_GETACCEL",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1133, L"MCIWNDM_GETZOOM",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1133, L"PSM_UNCHANGED",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1133, L"UDM_SETBASE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1134, L"PSM_APPLY",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 1134, L"UDM_GETBASE",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1135, L"PSM_SETTITLEA",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1135, L"UDM_SETRANGE32",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1136, L"PSM_SETWIZBUTTONS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1136, L"UDM_GETRANGE32",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1136, L"WM_CAP_DRIVER_GET_NAMEW",       WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1137, L"PSM_PRESSBUTTON",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1137, L"UDM_SETPOS32",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1137, L"WM_CAP_DRIVER_GET_VERSIONW",    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1138, L"PSM_SETCURSELID",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1138, L"UDM_GETPOS32",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1139, L"PSM_SETFINISHTEXTA",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1140, L"PSM_GETTABCONTROL",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1141, L"PSM_ISDIALOGMESSAGE",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1142, L"MCIWNDM_REALIZE",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1142, L"PSM_GETCURRENTPAGEHWND",        WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1143, L"MCIWNDM_SETTIMEFORMATA",        WIN32_MSG_CATEGORY_CONTROL},
+    { 1143, L"PSM_INSERTPAGE",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1144, L"EM_SETLANGOPTIONS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1144, L"MCIWNDM_GETTIMEFORMATA",        WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1144, L"PSM_SETTITLEW",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1144, L"WM_CAP_FILE_SET_CAPTURE_FILEW", WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1145, L"EM_GETLANGOPTIONS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1145, L"MCIWNDM_VALIDATEMEDIA",         WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1145, L"PSM_SETFINISHTEXTW",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1145, L"WM_CAP_FILE_GET_CAPTURE_FILEW", WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1146, L"EM_GETIMECOMPMODE",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1147, L"EM_FINDTEXTW",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1147, L"MCIWNDM_PLAYTO",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1147, L"WM_CAP_FILE_SAVEASW",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1148, L"EM_FINDTEXTEXW",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1148, L"MCIWNDM_GETFILENAMEA",          WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1149, L"EM_RECONVERSION",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1149, L"MCIWNDM_GETDEVICEA",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1149, L"PSM_SETHEADERTITLEA",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1149, L"WM_CAP_FILE_SAVEDIBW",          WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1150, L"EM_SETIMEMODEBIAS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1150, L"MCIWNDM_GETPALETTE",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1150, L"PSM_SETHEADERTITLEW",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1151, L"EM_GETIMEMODEBIAS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1151, L"MCIWNDM_SETPALETTE",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1151, L"PSM_SETHEADERSUBTITLEA",        WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1152, L"MCIWNDM_GETERRORA",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1152, L"PSM_SETHEADERSUBTITLEW",        WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1153, L"PSM_HWNDTOINDEX",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1154, L"PSM_INDEXTOHWND",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1155, L"MCIWNDM_SETINACTIVETIMER",      WIN32_MSG_CATEGORY_CONTROL},
+    { 1155, L"PSM_PAGETOINDEX",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1156, L"PSM_INDEXTOPAGE",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1157, L"DL_BEGINDRAG",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1157, L"MCIWNDM_GETINACTIVETIMER",      WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1157, L"PSM_IDTOINDEX",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1158, L"DL_DRAGGING",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1158, L"PSM_INDEXTOID",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1159, L"DL_DROPPED",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1159, L"PSM_GETRESULT",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1160, L"DL_CANCELDRAG",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1160, L"PSM_RECALCPAGESIZES",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1164, L"MCIWNDM_GET_SOURCE",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1165, L"MCIWNDM_PUT_SOURCE",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1166, L"MCIWNDM_GET_DEST",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1167, L"MCIWNDM_PUT_DEST",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1168, L"MCIWNDM_CAN_PLAY",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1169, L"MCIWNDM_CAN_WINDOW",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1170, L"MCIWNDM_CAN_RECORD",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1171, L"MCIWNDM_CAN_SAVE",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1172, L"MCIWNDM_CAN_EJECT",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1173, L"MCIWNDM_CAN_CONFIG",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1174, L"IE_GETINK",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 1174, L"IE_MSGFIRST",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1174, L"MCIWNDM_PALETTEKICK",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1175, L"IE_SETINK",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 1176, L"IE_GETPENTIP",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1177, L"IE_SETPENTIP",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1178, L"IE_GETERASERTIP",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1179, L"IE_SETERASERTIP",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1180, L"IE_GETBKGND",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1181, L"IE_SETBKGND",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1182, L"IE_GETGRIDORIGIN",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1183, L"IE_SETGRIDORIGIN",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1184, L"IE_GETGRIDPEN",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1185, L"IE_SETGRIDPEN",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1186, L"IE_GETGRIDSIZE",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1187, L"IE_SETGRIDSIZE",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1188, L"IE_GETMODE",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1189, L"IE_SETMODE",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1190, L"IE_GETINKRECT",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1190, L"WM_CAP_SET_MCI_DEVICEW",        WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1191, L"WM_CAP_GET_MCI_DEVICEW",        WIN32_MSG_CATEGORY_CONTROL},
+    { 1204, L"WM_CAP_PAL_OPENW",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1205, L"WM_CAP_PAL_SAVEW",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1208, L"IE_GETAPPDATA",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1209, L"IE_SETAPPDATA",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1210, L"IE_GETDRAWOPTS",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1211, L"IE_SETDRAWOPTS",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1212, L"IE_GETFORMAT",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1213, L"IE_SETFORMAT",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1214, L"IE_GETINKINPUT",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1215, L"IE_SETINKINPUT",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1216, L"IE_GETNOTIFY",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1217, L"IE_SETNOTIFY",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 1218, L"IE_GETRECOG",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1219, L"IE_SETRECOG",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1220, L"IE_GETSECURITY",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1221, L"IE_SETSECURITY",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1222, L"IE_GETSEL",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 1223, L"IE_SETSEL",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 1224, L"CDM_LAST",                      WIN32_MSG_CATEGORY_CONTROL},
+    { 1224, L"EM_SETBIDIOPTIONS",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1224, L"IE_DOCOMMAND",                  WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1224, L"MCIWNDM_NOTIFYMODE",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1225, L"EM_GETBIDIOPTIONS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1225, L"IE_GETCOMMAND",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1226, L"EM_SETTYPOGRAPHYOPTIONS",       WIN32_MSG_CATEGORY_CONTROL},
+    { 1226, L"IE_GETCOUNT",                   WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1227, L"EM_GETTYPOGRAPHYOPTIONS",       WIN32_MSG_CATEGORY_CONTROL},
+    { 1227, L"IE_GETGESTURE",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1227, L"MCIWNDM_NOTIFYMEDIA",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1228, L"EM_SETEDITSTYLE",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1228, L"IE_GETMENU",                    WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1229, L"EM_GETEDITSTYLE",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1229, L"IE_GETPAINTDC",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1229, L"MCIWNDM_NOTIFYERROR",           WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1230, L"IE_GETPDEVENT",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 1231, L"IE_GETSELCOUNT",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1232, L"IE_GETSELITEMS",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1233, L"IE_GETSTYLE",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1243, L"MCIWNDM_SETTIMEFORMATW",        WIN32_MSG_CATEGORY_CONTROL},
+    { 1244, L"EM_OUTLINE",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1244, L"MCIWNDM_GETTIMEFORMATW",        WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1245, L"EM_GETSCROLLPOS",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1246, L"EM_SETSCROLLPOS",               WIN32_MSG_CATEGORY_CONTROL},
+    { 1247, L"EM_SETFONTSIZE",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1248, L"EM_GETZOOM",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1248, L"MCIWNDM_GETFILENAMEW",          WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1249, L"EM_SETZOOM",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1249, L"MCIWNDM_GETDEVICEW",            WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1250, L"EM_GETVIEWKIND",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1251, L"EM_SETVIEWKIND",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1252, L"EM_GETPAGE",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1252, L"MCIWNDM_GETERRORW",             WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 1253, L"EM_SETPAGE",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 1254, L"EM_GETHYPHENATEINFO",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1255, L"EM_SETHYPHENATEINFO",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1259, L"EM_GETPAGEROTATE",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1260, L"EM_SETPAGEROTATE",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1261, L"EM_GETCTFMODEBIAS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1262, L"EM_SETCTFMODEBIAS",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1264, L"EM_GETCTFOPENSTATUS",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1265, L"EM_SETCTFOPENSTATUS",           WIN32_MSG_CATEGORY_CONTROL},
+    { 1266, L"EM_GETIMECOMPTEXT",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1267, L"EM_ISIME",                      WIN32_MSG_CATEGORY_CONTROL},
+    { 1268, L"EM_GETIMEPROPERTY",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1293, L"EM_GETQUERYRTFOBJ",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1294, L"EM_SETQUERYRTFOBJ",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1536, L"FM_GETFOCUS",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 1537, L"FM_GETDRIVEINFOA",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1538, L"FM_GETSELCOUNT",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1539, L"FM_GETSELCOUNTLFN",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1540, L"FM_GETFILESELA",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1541, L"FM_GETFILESELLFNA",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1542, L"FM_REFRESH_WINDOWS",            WIN32_MSG_CATEGORY_CONTROL},
+    { 1543, L"FM_RELOAD_EXTENSIONS",          WIN32_MSG_CATEGORY_CONTROL},
+    { 1553, L"FM_GETDRIVEINFOW",              WIN32_MSG_CATEGORY_CONTROL},
+    { 1556, L"FM_GETFILESELW",                WIN32_MSG_CATEGORY_CONTROL},
+    { 1557, L"FM_GETFILESELLFNW",             WIN32_MSG_CATEGORY_CONTROL},
+    { 1625, L"WLX_WM_SAS",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 2024, L"SM_GETSELCOUNT",                WIN32_MSG_CATEGORY_CONTROL},
+    { 2024, L"UM_GETSELCOUNT",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 2024, L"WM_CPL_LAUNCH",                 WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 2025, L"SM_GETSERVERSELA",              WIN32_MSG_CATEGORY_CONTROL},
+    { 2025, L"UM_GETUSERSELA",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 2025, L"WM_CPL_LAUNCHED",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 2026, L"SM_GETSERVERSELW",              WIN32_MSG_CATEGORY_CONTROL},
+    { 2026, L"UM_GETUSERSELW",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 2027, L"SM_GETCURFOCUSA",               WIN32_MSG_CATEGORY_CONTROL},
+    { 2027, L"UM_GETGROUPSELA",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 2028, L"SM_GETCURFOCUSW",               WIN32_MSG_CATEGORY_CONTROL},
+    { 2028, L"UM_GETGROUPSELW",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 2029, L"SM_GETOPTIONS",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 2029, L"UM_GETCURFOCUSA",               WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 2030, L"UM_GETCURFOCUSW",               WIN32_MSG_CATEGORY_CONTROL},
+    { 2031, L"UM_GETOPTIONS",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 2032, L"UM_GETOPTIONS2",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4096, L"LVM_FIRST",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 4096, L"LVM_GETBKCOLOR",                WIN32_MSG_CATEGORY_CONTROL},  // Alias
+    { 4097, L"LVM_SETBKCOLOR",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4098, L"LVM_GETIMAGELIST",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4099, L"LVM_SETIMAGELIST",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4100, L"LVM_GETITEMCOUNT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4101, L"LVM_GETITEMA",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 4102, L"LVM_SETITEMA",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 4103, L"LVM_INSERTITEMA",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4104, L"LVM_DELETEITEM",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4105, L"LVM_DELETEALLITEMS",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4106, L"LVM_GETCALLBACKMASK",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4107, L"LVM_SETCALLBACKMASK",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4108, L"LVM_GETNEXTITEM",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4109, L"LVM_FINDITEMA",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 4110, L"LVM_GETITEMRECT",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4111, L"LVM_SETITEMPOSITION",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4112, L"LVM_GETITEMPOSITION",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4113, L"LVM_GETSTRINGWIDTHA",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4114, L"LVM_HITTEST",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 4115, L"LVM_ENSUREVISIBLE",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4116, L"LVM_SCROLL",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 4117, L"LVM_REDRAWITEMS",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4118, L"LVM_ARRANGE",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 4119, L"LVM_EDITLABELA",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4120, L"LVM_GETEDITCONTROL",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4121, L"LVM_GETCOLUMNA",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4122, L"LVM_SETCOLUMNA",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4123, L"LVM_INSERTCOLUMNA",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4124, L"LVM_DELETECOLUMN",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4125, L"LVM_GETCOLUMNWIDTH",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4126, L"LVM_SETCOLUMNWIDTH",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4127, L"LVM_GETHEADER",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 4129, L"LVM_CREATEDRAGIMAGE",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4130, L"LVM_GETVIEWRECT",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4131, L"LVM_GETTEXTCOLOR",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4132, L"LVM_SETTEXTCOLOR",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4133, L"LVM_GETTEXTBKCOLOR",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4134, L"LVM_SETTEXTBKCOLOR",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4135, L"LVM_GETTOPINDEX",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4136, L"LVM_GETCOUNTPERPAGE",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4137, L"LVM_GETORIGIN",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 4138, L"LVM_UPDATE",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 4139, L"LVM_SETITEMSTATE",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4140, L"LVM_GETITEMSTATE",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4141, L"LVM_GETITEMTEXTA",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4142, L"LVM_SETITEMTEXTA",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4143, L"LVM_SETITEMCOUNT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4144, L"LVM_SORTITEMS",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 4145, L"LVM_SETITEMPOSITION32",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4146, L"LVM_GETSELECTEDCOUNT",          WIN32_MSG_CATEGORY_CONTROL},
+    { 4147, L"LVM_GETITEMSPACING",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4148, L"LVM_GETISEARCHSTRINGA",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4149, L"LVM_SETICONSPACING",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4150, L"LVM_SETEXTENDEDLISTVIEWSTYLE",  WIN32_MSG_CATEGORY_CONTROL},
+    { 4151, L"LVM_GETEXTENDEDLISTVIEWSTYLE",  WIN32_MSG_CATEGORY_CONTROL},
+    { 4152, L"LVM_GETSUBITEMRECT",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4153, L"LVM_SUBITEMHITTEST",            WIN32_MSG_CATEGORY_CONTROL},
+    { 4154, L"LVM_SETCOLUMNORDERARRAY",       WIN32_MSG_CATEGORY_CONTROL},
+    { 4155, L"LVM_GETCOLUMNORDERARRAY",       WIN32_MSG_CATEGORY_CONTROL},
+    { 4156, L"LVM_SETHOTITEM",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4157, L"LVM_GETHOTITEM",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4158, L"LVM_SETHOTCURSOR",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4159, L"LVM_GETHOTCURSOR",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4160, L"LVM_APPROXIMATEVIEWRECT",       WIN32_MSG_CATEGORY_CONTROL},
+    { 4161, L"LVM_SETWORKAREAS",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4162, L"LVM_GETSELECTIONMARK",          WIN32_MSG_CATEGORY_CONTROL},
+    { 4163, L"LVM_SETSELECTIONMARK",          WIN32_MSG_CATEGORY_CONTROL},
+    { 4164, L"LVM_SETBKIMAGEA",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4165, L"LVM_GETBKIMAGEA",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4166, L"LVM_GETWORKAREAS",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4167, L"LVM_SETHOVERTIME",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4168, L"LVM_GETHOVERTIME",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4169, L"LVM_GETNUMBEROFWORKAREAS",      WIN32_MSG_CATEGORY_CONTROL},
+    { 4170, L"LVM_SETTOOLTIPS",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4171, L"LVM_GETITEMW",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 4172, L"LVM_SETITEMW",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 4173, L"LVM_INSERTITEMW",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4174, L"LVM_GETTOOLTIPS",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4179, L"LVM_FINDITEMW",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 4183, L"LVM_GETSTRINGWIDTHW",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4191, L"LVM_GETCOLUMNW",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4192, L"LVM_SETCOLUMNW",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4193, L"LVM_INSERTCOLUMNW",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4211, L"LVM_GETITEMTEXTW",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4212, L"LVM_SETITEMTEXTW",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4213, L"LVM_GETISEARCHSTRINGW",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4214, L"LVM_EDITLABELW",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4235, L"LVM_GETBKIMAGEW",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4236, L"LVM_SETSELECTEDCOLUMN",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4237, L"LVM_SETTILEWIDTH",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4238, L"LVM_SETVIEW",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 4239, L"LVM_GETVIEW",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 4241, L"LVM_INSERTGROUP",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4243, L"LVM_SETGROUPINFO",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4245, L"LVM_GETGROUPINFO",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4246, L"LVM_REMOVEGROUP",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4247, L"LVM_MOVEGROUP",                 WIN32_MSG_CATEGORY_CONTROL},
+    { 4250, L"LVM_MOVEITEMTOGROUP",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4251, L"LVM_SETGROUPMETRICS",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4252, L"LVM_GETGROUPMETRICS",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4253, L"LVM_ENABLEGROUPVIEW",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4254, L"LVM_SORTGROUPS",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4255, L"LVM_INSERTGROUPSORTED",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4256, L"LVM_REMOVEALLGROUPS",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4257, L"LVM_HASGROUP",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 4258, L"LVM_SETTILEVIEWINFO",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4259, L"LVM_GETTILEVIEWINFO",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4260, L"LVM_SETTILEINFO",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4261, L"LVM_GETTILEINFO",               WIN32_MSG_CATEGORY_CONTROL},
+    { 4262, L"LVM_SETINSERTMARK",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4263, L"LVM_GETINSERTMARK",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4264, L"LVM_INSERTMARKHITTEST",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4265, L"LVM_GETINSERTMARKRECT",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4266, L"LVM_SETINSERTMARKCOLOR",        WIN32_MSG_CATEGORY_CONTROL},
+    { 4267, L"LVM_GETINSERTMARKCOLOR",        WIN32_MSG_CATEGORY_CONTROL},
+    { 4269, L"LVM_SETINFOTIP",                WIN32_MSG_CATEGORY_CONTROL},
+    { 4270, L"LVM_GETSELECTEDCOLUMN",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4271, L"LVM_ISGROUPVIEWENABLED",        WIN32_MSG_CATEGORY_CONTROL},
+    { 4272, L"LVM_GETOUTLINECOLOR",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4273, L"LVM_SETOUTLINECOLOR",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4275, L"LVM_CANCELEDITLABEL",           WIN32_MSG_CATEGORY_CONTROL},
+    { 4276, L"LVM_MAPINDEXTOID",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4277, L"LVM_MAPIDTOINDEX",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4278, L"LVM_ISITEMVISIBLE",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4300, L"LVM_GETEMPTYTEXT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 4301, L"LVM_GETFOOTERRECT",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4302, L"LVM_GETFOOTERINFO",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4303, L"LVM_GETFOOTERITEMRECT",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4304, L"LVM_GETFOOTERITEM",             WIN32_MSG_CATEGORY_CONTROL},
+    { 4305, L"LVM_GETITEMINDEXRECT",          WIN32_MSG_CATEGORY_CONTROL},
+    { 4306, L"LVM_SETITEMINDEXSTATE",         WIN32_MSG_CATEGORY_CONTROL},
+    { 4307, L"LVM_GETNEXTITEMINDEX",          WIN32_MSG_CATEGORY_CONTROL},
+    { 8192, L"OCM__BASE",                     WIN32_MSG_CATEGORY_CONTROL},
+    { 8197, L"LVM_SETUNICODEFORMAT",          WIN32_MSG_CATEGORY_CONTROL},
+    { 8198, L"LVM_GETUNICODEFORMAT",          WIN32_MSG_CATEGORY_CONTROL},
+    { 8217, L"OCM_CTLCOLOR",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 8235, L"OCM_DRAWITEM",                  WIN32_MSG_CATEGORY_CONTROL},
+    { 8236, L"OCM_MEASUREITEM",               WIN32_MSG_CATEGORY_CONTROL},
+    { 8237, L"OCM_DELETEITEM",                WIN32_MSG_CATEGORY_CONTROL},
+    { 8238, L"OCM_VKEYTOITEM",                WIN32_MSG_CATEGORY_CONTROL},
+    { 8239, L"OCM_CHARTOITEM",                WIN32_MSG_CATEGORY_CONTROL},
+    { 8249, L"OCM_COMPAREITEM",               WIN32_MSG_CATEGORY_CONTROL},
+    { 8270, L"OCM_NOTIFY",                    WIN32_MSG_CATEGORY_CONTROL},
+    { 8465, L"OCM_COMMAND",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 8468, L"OCM_HSCROLL",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 8469, L"OCM_VSCROLL",                   WIN32_MSG_CATEGORY_CONTROL},
+    { 8498, L"OCM_CTLCOLORMSGBOX",            WIN32_MSG_CATEGORY_CONTROL},
+    { 8499, L"OCM_CTLCOLOREDIT",              WIN32_MSG_CATEGORY_CONTROL},
+    { 8500, L"OCM_CTLCOLORLISTBOX",           WIN32_MSG_CATEGORY_CONTROL},
+    { 8501, L"OCM_CTLCOLORBTN",               WIN32_MSG_CATEGORY_CONTROL},
+    { 8502, L"OCM_CTLCOLORDLG",               WIN32_MSG_CATEGORY_CONTROL},
+    { 8503, L"OCM_CTLCOLORSCROLLBAR",         WIN32_MSG_CATEGORY_CONTROL},
+    { 8504, L"OCM_CTLCOLORSTATIC",            WIN32_MSG_CATEGORY_CONTROL},
+    { 8720, L"OCM_PARENTNOTIFY",              WIN32_MSG_CATEGORY_CONTROL},
+    {32768, L"WM_APP",                        WIN32_MSG_CATEGORY_OTHER},
+    {52429, L"WM_RASDIALEVENT",               WIN32_MSG_CATEGORY_OTHER},
+};
+
+static const size_t WIN32_MSG_ARR_LEN = sizeof(WIN32_MSG_ARR) / sizeof(WIN32_MSG_ARR[0]);
+
+// @Nullable
+static const struct Win32Msg *
+StaticFind(const UINT uMsg)
+{
+    // Lower bound: Find first, not any, in case of aliases.
+    size_t ulLow  = 0;
+    size_t ulHigh = WIN32_MSG_ARR_LEN;
+    while (ulLow < ulHigh)
+    {
+        const size_t ulMid = ulLow + ((ulHigh - ulLow) / 2U);
+        if (WIN32_MSG_ARR[ulMid].uMsg < uMsg)
+        {
+            ulLow = ulMid + 1U;
+        }
+        else
+        {
+            ulHigh = ulMid;
+        }
+    }
+    if (ulLow < WIN32_MSG_ARR_LEN && uMsg == WIN32_MSG_ARR[ulLow].uMsg)
+    {
+        const struct Win32Msg *x = WIN32_MSG_ARR + ulLow;
+        return x;
+    }
+    return NULL;
+}
+
 const wchar_t *
 Win32MsgToText(const UINT uMsg)
 {
-    switch (uMsg)
+    const struct Win32Msg *lpNullableMsg = StaticFind(uMsg);
+    const wchar_t *x = (NULL == lpNullableMsg) ? L"???" : lpNullableMsg->lpszName;
+    return x;
+}
+
+enum EWin32MsgCategory
+Win32MsgToCategories(const UINT uMsg)
+{
+    const struct Win32Msg *lpNullableMsg = StaticFind(uMsg);
+    const enum EWin32MsgCategory x = (NULL == lpNullableMsg) ? WIN32_MSG_CATEGORY_OTHER : lpNullableMsg->eCategories;
+    return x;
+}
+
+bool
+Win32MsgFromText(_In_  const wchar_t *lpszName,
+                 _Out_ UINT          *lpuMsg)
+{
+    assert(NULL != lpszName);
+    assert(NULL != lpuMsg);
+
+    for (size_t i = 0; i < WIN32_MSG_ARR_LEN; ++i)
+    {
+        if (0 == wcscmp(lpszName, WIN32_MSG_ARR[i].lpszName))
+        {
+            *lpuMsg = WIN32_MSG_ARR[i].uMsg;
+            return true;
+        }
+    }
+    return false;
+}
+
+struct Win32MsgCategoryName
+{
+    const wchar_t          *lpszName;
+    enum EWin32MsgCategory  eCategories;
+};
+
+static const struct Win32MsgCategoryName WIN32_MSG_CATEGORY_NAME_ARR[] = {
+    {L"window",    WIN32_MSG_CATEGORY_WINDOW},
+    {L"nonclient", WIN32_MSG_CATEGORY_NONCLIENT},
+    {L"paint",     WIN32_MSG_CATEGORY_PAINT},
+    {L"mouse",     WIN32_MSG_CATEGORY_MOUSE},
+    {L"keyboard",  WIN32_MSG_CATEGORY_KEYBOARD},
+    {L"ime",       WIN32_MSG_CATEGORY_IME},
+    {L"timer",     WIN32_MSG_CATEGORY_TIMER},
+    {L"menu",      WIN32_MSG_CATEGORY_MENU},
+    {L"notify",    WIN32_MSG_CATEGORY_NOTIFY},
+    {L"clipboard", WIN32_MSG_CATEGORY_CLIPBOARD},
+    {L"system",    WIN32_MSG_CATEGORY_SYSTEM},
+    {L"control",   WIN32_MSG_CATEGORY_CONTROL},
+    {L"other",     WIN32_MSG_CATEGORY_OTHER},
+    {L"all",       WIN32_MSG_CATEGORY_ALL},
+};
+
+bool
+Win32MsgCategoriesFromText(_In_  const wchar_t          *lpszCsv,
+                           _Out_ enum EWin32MsgCategory *lpeCategories)
+{
+    assert(NULL != lpszCsv);
+    assert(NULL != lpeCategories);
+
+    if (L'\0' == lpszCsv[0])
     {
-        case 0: return L"WM_NULL";
-        case 1: return L"WM_CREATE";
-        case 2: return L"WM_DESTROY";
-        case 3: return L"WM_MOVE";
-        case 5: return L"WM_SIZE";
-        case 6: return L"WM_ACTIVATE";
-        case 7: return L"WM_SETFOCUS";
-        case 8: return L"WM_KILLFOCUS";
-        case 10: return L"WM_ENABLE";
-        case 11: return L"WM_SETREDRAW";
-        case 12: return L"WM_SETTEXT";
-        case 13: return L"WM_GETTEXT";
-        case 14: return L"WM_GETTEXTLENGTH";
-        case 15: return L"WM_PAINT";
-        case 16: return L"WM_CLOSE";
-        case 17: return L"WM_QUERYENDSESSION";
-        case 18: return L"WM_QUIT";
-        case 19: return L"WM_QUERYOPEN";
-        case 20: return L"WM_ERASEBKGND";
-        case 21: return L"WM_SYSCOLORCHANGE";
-        case 22: return L"WM_ENDSESSION";
-        case 24: return L"WM_SHOWWINDOW";
-        case 25: return L"WM_CTLCOLOR";
-        case 26: return L"WM_WININICHANGE";
-        case 27: return L"WM_DEVMODECHANGE";
-        case 28: return L"WM_ACTIVATEAPP";
-        case 29: return L"WM_FONTCHANGE";
-        case 30: return L"WM_TIMECHANGE";
-        case 31: return L"WM_CANCELMODE";
-        case 32: return L"WM_SETCURSOR";
-        case 33: return L"WM_MOUSEACTIVATE";
-        case 34: return L"WM_CHILDACTIVATE";
-        case 35: return L"WM_QUEUESYNC";
-        case 36: return L"WM_GETMINMAXINFO";
-        case 38: return L"WM_PAINTICON";
-        case 39: return L"WM_ICONERASEBKGND";
-        case 40: return L"WM_NEXTDLGCTL";
-        case 42: return L"WM_SPOOLERSTATUS";
-        case 43: return L"WM_DRAWITEM";
-        case 44: return L"WM_MEASUREITEM";
-        case 45: return L"WM_DELETEITEM";
-        case 46: return L"WM_VKEYTOITEM";
-        case 47: return L"WM_CHARTOITEM";
-        case 48: return L"WM_SETFONT";
-        case 49: return L"WM_GETFONT";
-        case 50: return L"WM_SETHOTKEY";
-        case 51: return L"WM_GETHOTKEY";
-        case 55: return L"WM_QUERYDRAGICON";
-        case 57: return L"WM_COMPAREITEM";
-        case 61: return L"WM_GETOBJECT";
-        case 65: return L"WM_COMPACTING";
-        case 68: return L"WM_COMMNOTIFY";
-        case 70: return L"WM_WINDOWPOSCHANGING";
-        case 71: return L"WM_WINDOWPOSCHANGED";
-        case 72: return L"WM_POWER";
-        case 73: return L"WM_COPYGLOBALDATA";
-        case 74: return L"WM_COPYDATA";
-        case 75: return L"WM_CANCELJOURNAL";
-        case 78: return L"WM_NOTIFY";
-        case 80: return L"WM_INPUTLANGCHANGEREQUEST";
-        case 81: return L"WM_INPUTLANGCHANGE";
-        case 82: return L"WM_TCARD";
-        case 83: return L"WM_HELP";
-        case 84: return L"WM_USERCHANGED";
-        case 85: return L"WM_NOTIFYFORMAT";
-        case 123: return L"WM_CONTEXTMENU";
-        case 124: return L"WM_STYLECHANGING";
-        case 125: return L"WM_STYLECHANGED";
-        case 126: return L"WM_DISPLAYCHANGE";
-        case 127: return L"WM_GETICON";
-        case 128: return L"WM_SETICON";
-        case 129: return L"WM_NCCREATE";
-        case 130: return L"WM_NCDESTROY";
-        case 131: return L"WM_NCCALCSIZE";
-        case 132: return L"WM_NCHITTEST";
-        case 133: return L"WM_NCPAINT";
-        case 134: return L"WM_NCACTIVATE";
-        case 135: return L"WM_GETDLGCODE";
-        case 136: return L"WM_SYNCPAINT";
-        case 160: return L"WM_NCMOUSEMOVE";
-        case 161: return L"WM_NCLBUTTONDOWN";
-        case 162: return L"WM_NCLBUTTONUP";
-        case 163: return L"WM_NCLBUTTONDBLCLK";
-        case 164: return L"WM_NCRBUTTONDOWN";
-        case 165: return L"WM_NCRBUTTONUP";
-        case 166: return L"WM_NCRBUTTONDBLCLK";
-        case 167: return L"WM_NCMBUTTONDOWN";
-        case 168: return L"WM_NCMBUTTONUP";
-        case 169: return L"WM_NCMBUTTONDBLCLK";
-        case 171: return L"WM_NCXBUTTONDOWN";
-        case 172: return L"WM_NCXBUTTONUP";
-        case 173: return L"WM_NCXBUTTONDBLCLK";
-        case 176: return L"EM_GETSEL";
-        case 177: return L"EM_SETSEL";
-        case 178: return L"EM_GETRECT";
-        case 179: return L"EM_SETRECT";
-        case 180: return L"EM_SETRECTNP";
-        case 181: return L"EM_SCROLL";
-        case 182: return L"EM_LINESCROLL";
-        case 183: return L"EM_SCROLLCARET";
-        case 185: return L"EM_GETMODIFY";
-        case 187: return L"EM_SETMODIFY";
-        case 188: return L"EM_GETLINECOUNT";
-        case 189: return L"EM_LINEINDEX";
-        case 190: return L"EM_SETHANDLE";
-        case 191: return L"EM_GETHANDLE";
-        case 192: return L"EM_GETTHUMB";
-        case 193: return L"EM_LINELENGTH";
-        case 194: return L"EM_REPLACESEL";
-        case 195: return L"EM_SETFONT";
-        case 196: return L"EM_GETLINE";
-        case 197: return L"EM_LIMITTEXT|EM_SETLIMITTEXT";
-//        case 197: return L"EM_SETLIMITTEXT";
-        case 198: return L"EM_CANUNDO";
-        case 199: return L"EM_UNDO";
-        case 200: return L"EM_FMTLINES";
-        case 201: return L"EM_LINEFROMCHAR";
-        case 202: return L"EM_SETWORDBREAK";
-        case 203: return L"EM_SETTABSTOPS";
-        case 204: return L"EM_SETPASSWORDCHAR";
-        case 205: return L"EM_EMPTYUNDOBUFFER";
-        case 206: return L"EM_GETFIRSTVISIBLELINE";
-        case 207: return L"EM_SETREADONLY";
-        case 209: return L"EM_SETWORDBREAKPROC";
-//        case 209: return L"EM_GETWORDBREAKPROC";
-        case 210: return L"EM_GETPASSWORDCHAR";
-        case 211: return L"EM_SETMARGINS";
-        case 212: return L"EM_GETMARGINS";
-        case 213: return L"EM_GETLIMITTEXT";
-        case 214: return L"EM_POSFROMCHAR";
-        case 215: return L"EM_CHARFROMPOS";
-        case 216: return L"EM_SETIMESTATUS";
-        case 217: return L"EM_GETIMESTATUS";
-        case 224: return L"SBM_SETPOS";
-        case 225: return L"SBM_GETPOS";
-        case 226: return L"SBM_SETRANGE";
-        case 227: return L"SBM_GETRANGE";
-        case 228: return L"SBM_ENABLE_ARROWS";
-        case 230: return L"SBM_SETRANGEREDRAW";
-        case 233: return L"SBM_SETSCROLLINFO";
-        case 234: return L"SBM_GETSCROLLINFO";
-        case 235: return L"SBM_GETSCROLLBARINFO";
-        case 240: return L"BM_GETCHECK";
-        case 241: return L"BM_SETCHECK";
-        case 242: return L"BM_GETSTATE";
-        case 243: return L"BM_SETSTATE";
-        case 244: return L"BM_SETSTYLE";
-        case 245: return L"BM_CLICK";
-        case 246: return L"BM_GETIMAGE";
-        case 247: return L"BM_SETIMAGE";
-        case 248: return L"BM_SETDONTCLICK";
-        case 255: return L"WM_INPUT";
-        case 256: return L"WM_KEYDOWN";
-//        case 256: return L"WM_KEYFIRST";
-        case 257: return L"WM_KEYUP";
-        case 258: return L"WM_CHAR";
-        case 259: return L"WM_DEADCHAR";
-        case 260: return L"WM_SYSKEYDOWN";
-        case 261: return L"WM_SYSKEYUP";
-        case 262: return L"WM_SYSCHAR";
-        case 263: return L"WM_SYSDEADCHAR";
-        case 265: return L"WM_UNICHAR";
-//        case 265: return L"WM_WNT_CONVERTREQUESTEX";
-        case 266: return L"WM_CONVERTREQUEST";
-        case 267: return L"WM_CONVERTRESULT";
-        case 268: return L"WM_INTERIM";
-        case 269: return L"WM_IME_STARTCOMPOSITION";
-        case 270: return L"WM_IME_ENDCOMPOSITION";
-        case 271: return L"WM_IME_COMPOSITION";
- //       case 271: return L"WM_IME_KEYLAST";
-        case 272: return L"WM_INITDIALOG";
-        case 273: return L"WM_COMMAND";
-        case 274: return L"WM_SYSCOMMAND";
-        case 275: return L"WM_TIMER";
-        case 276: return L"WM_HSCROLL";
-        case 277: return L"WM_VSCROLL";
-        case 278: return L"WM_INITMENU";
-        case 279: return L"WM_INITMENUPOPUP";
-        case 280: return L"WM_SYSTIMER";
-        case 287: return L"WM_MENUSELECT";
-        case 288: return L"WM_MENUCHAR";
-        case 289: return L"WM_ENTERIDLE";
-        case 290: return L"WM_MENURBUTTONUP";
-        case 291: return L"WM_MENUDRAG";
-        case 292: return L"WM_MENUGETOBJECT";
-        case 293: return L"WM_UNINITMENUPOPUP";
-        case 294: return L"WM_MENUCOMMAND";
-        case 295: return L"WM_CHANGEUISTATE";
-        case 296: return L"WM_UPDATEUISTATE";
-        case 297: return L"WM_QUERYUISTATE";
-        case 305: return L"WM_LBTRACKPOINT";
-        case 306: return L"WM_CTLCOLORMSGBOX";
-        case 307: return L"WM_CTLCOLOREDIT";
-        case 308: return L"WM_CTLCOLORLISTBOX";
-        case 309: return L"WM_CTLCOLORBTN";
-        case 310: return L"WM_CTLCOLORDLG";
-        case 311: return L"WM_CTLCOLORSCROLLBAR";
-        case 312: return L"WM_CTLCOLORSTATIC";
-        case 320: return L"CB_GETEDITSEL";
-        case 321: return L"CB_LIMITTEXT";
-        case 322: return L"CB_SETEDITSEL";
-        case 323: return L"CB_ADDSTRING";
-        case 324: return L"CB_DELETESTRING";
-        case 325: return L"CB_DIR";
-        case 326: return L"CB_GETCOUNT";
-        case 327: return L"CB_GETCURSEL";
-        case 328: return L"CB_GETLBTEXT";
-        case 329: return L"CB_GETLBTEXTLEN";
-        case 330: return L"CB_INSERTSTRING";
-        case 331: return L"CB_RESETCONTENT";
-        case 332: return L"CB_FINDSTRING";
-        case 333: return L"CB_SELECTSTRING";
-        case 334: return L"CB_SETCURSEL";
-        case 335: return L"CB_SHOWDROPDOWN";
-        case 336: return L"CB_GETITEMDATA";
-        case 337: return L"CB_SETITEMDATA";
-        case 338: return L"CB_GETDROPPEDCONTROLRECT";
-        case 339: return L"CB_SETITEMHEIGHT";
-        case 340: return L"CB_GETITEMHEIGHT";
-        case 341: return L"CB_SETEXTENDEDUI";
-        case 342: return L"CB_GETEXTENDEDUI";
-        case 343: return L"CB_GETDROPPEDSTATE";
-        case 344: return L"CB_FINDSTRINGEXACT";
-        case 345: return L"CB_SETLOCALE";
-        case 346: return L"CB_GETLOCALE";
-        case 347: return L"CB_GETTOPINDEX";
-        case 348: return L"CB_SETTOPINDEX";
-        case 349: return L"CB_GETHORIZONTALEXTENT";
-        case 350: return L"CB_SETHORIZONTALEXTENT";
-        case 351: return L"CB_GETDROPPEDWIDTH";
-        case 352: return L"CB_SETDROPPEDWIDTH";
-        case 353: return L"CB_INITSTORAGE";
-        case 355: return L"CB_MULTIPLEADDSTRING";
-        case 356: return L"CB_GETCOMBOBOXINFO";
-        case 357: return L"CB_MSGMAX";
-//        case 512: return L"WM_MOUSEFIRST";
-        case 512: return L"WM_MOUSEMOVE (WM_MOUSEFIRST)";
-        case 513: return L"WM_LBUTTONDOWN";
-        case 514: return L"WM_LBUTTONUP";
-        case 515: return L"WM_LBUTTONDBLCLK";
-        case 516: return L"WM_RBUTTONDOWN";
-        case 517: return L"WM_RBUTTONUP";
-        case 518: return L"WM_RBUTTONDBLCLK";
-        case 519: return L"WM_MBUTTONDOWN";
-        case 520: return L"WM_MBUTTONUP";
-        case 521: return L"WM_MBUTTONDBLCLK";
-//        case 521: return L"WM_MOUSELAST";
-        case 522: return L"WM_MOUSEWHEEL (WM_MOUSELAST)";
-        case 523: return L"WM_XBUTTONDOWN";
-        case 524: return L"WM_XBUTTONUP";
-        case 525: return L"WM_XBUTTONDBLCLK";
-        case 526: return L"WM_MOUSEHWHEEL";
-        case 528: return L"WM_PARENTNOTIFY";
-        case 529: return L"WM_ENTERMENULOOP";
-        case 530: return L"WM_EXITMENULOOP";
-        case 531: return L"WM_NEXTMENU";
-        case 532: return L"WM_SIZING";
-        case 533: return L"WM_CAPTURECHANGED";
-        case 534: return L"WM_MOVING";
-        case 536: return L"WM_POWERBROADCAST";
-        case 537: return L"WM_DEVICECHANGE";
-        case 544: return L"WM_MDICREATE";
-        case 545: return L"WM_MDIDESTROY";
-        case 546: return L"WM_MDIACTIVATE";
-        case 547: return L"WM_MDIRESTORE";
-        case 548: return L"WM_MDINEXT";
-        case 549: return L"WM_MDIMAXIMIZE";
-        case 550: return L"WM_MDITILE";
-        case 551: return L"WM_MDICASCADE";
-        case 552: return L"WM_MDIICONARRANGE";
-        case 553: return L"WM_MDIGETACTIVE";
-        case 560: return L"WM_MDISETMENU";
-        case 561: return L"WM_ENTERSIZEMOVE";
-        case 562: return L"WM_EXITSIZEMOVE";
-        case 563: return L"WM_DROPFILES";
-        case 564: return L"WM_MDIREFRESHMENU";
-        case 640: return L"WM_IME_REPORT";
-        case 641: return L"WM_IME_SETCONTEXT";
-        case 642: return L"WM_IME_NOTIFY";
-        case 643: return L"WM_IME_CONTROL";
-        case 644: return L"WM_IME_COMPOSITIONFULL";
-        case 645: return L"WM_IME_SELECT";
-        case 646: return L"WM_IME_CHAR";
-        case 648: return L"WM_IME_REQUEST";
-        case 656: return L"WM_IMEKEYDOWN";
-//        case 656: return L"WM_IME_KEYDOWN";
-        case 657: return L"WM_IMEKEYUP";
- //       case 657: return L"WM_IME_KEYUP";
-        case 672: return L"WM_NCMOUSEHOVER";
-        case 673: return L"WM_MOUSEHOVER";
-        case 674: return L"WM_NCMOUSELEAVE";
-        case 675: return L"WM_MOUSELEAVE";
-        case 768: return L"WM_CUT";
-        case 769: return L"WM_COPY";
-        case 770: return L"WM_PASTE";
-        case 771: return L"WM_CLEAR";
-        case 772: return L"WM_UNDO";
-        case 773: return L"WM_RENDERFORMAT";
-        case 774: return L"WM_RENDERALLFORMATS";
-        case 775: return L"WM_DESTROYCLIPBOARD";
-        case 776: return L"WM_DRAWCLIPBOARD";
-        case 777: return L"WM_PAINTCLIPBOARD";
-        case 778: return L"WM_VSCROLLCLIPBOARD";
-        case 779: return L"WM_SIZECLIPBOARD";
-        case 780: return L"WM_ASKCBFORMATNAME";
-        case 781: return L"WM_CHANGECBCHAIN";
-        case 782: return L"WM_HSCROLLCLIPBOARD";
-        case 783: return L"WM_QUERYNEWPALETTE";
-        case 784: return L"WM_PALETTEISCHANGING";
-        case 785: return L"WM_PALETTECHANGED";
-        case 786: return L"WM_HOTKEY";
-        case 791: return L"WM_PRINT";
-        case 792: return L"WM_PRINTCLIENT";
-        case 793: return L"WM_APPCOMMAND";
-        case 856: return L"WM_HANDHELDFIRST";
-        case 863: return L"WM_HANDHELDLAST";
-        case 864: return L"WM_AFXFIRST";
-        case 895: return L"WM_AFXLAST";
-        case 896: return L"WM_PENWINFIRST";
-        case 897: return L"WM_RCRESULT";
-        case 898: return L"WM_HOOKRCRESULT";
-        case 899: return L"WM_GLOBALRCCHANGE";
-//        case 899: return L"WM_PENMISCINFO";
-        case 900: return L"WM_SKB";
-        case 901: return L"WM_HEDITCTL";
- //       case 901: return L"WM_PENCTL";
-        case 902: return L"WM_PENMISC";
-        case 903: return L"WM_CTLINIT";
-        case 904: return L"WM_PENEVENT";
-        case 911: return L"WM_PENWINLAST";
-        case 1024: return L"DDM_SETFMT";
-//        case 1024: return L"DM_GETDEFID";
-//        case 1024: return L"NIN_SELECT";
-//        case 1024: return L"TBM_GETPOS";
-//        case 1024: return L"WM_PSD_PAGESETUPDLG";
-//        case 1024: return L"WM_USER";
-        case 1025: return L"CBEM_INSERTITEMA";
-//        case 1025: return L"DDM_DRAW";
-//        case 1025: return L"DM_SETDEFID";
-//        case 1025: return L"HKM_SETHOTKEY";
-//        case 1025: return L"PBM_SETRANGE";
-//        case 1025: return L"RB_INSERTBANDA";
-//        case 1025: return L"SB_SETTEXTA";
-//        case 1025: return L"TB_ENABLEBUTTON";
-//        case 1025: return L"TBM_GETRANGEMIN";
-//        case 1025: return L"TTM_ACTIVATE";
-//        case 1025: return L"WM_CHOOSEFONT_GETLOGFONT";
-//        case 1025: return L"WM_PSD_FULLPAGERECT";
-        case 1026: return L"CBEM_SETIMAGELIST";
-//        case 1026: return L"DDM_CLOSE";
-//        case 1026: return L"DM_REPOSITION";
-//        case 1026: return L"HKM_GETHOTKEY";
-//        case 1026: return L"PBM_SETPOS";
-//        case 1026: return L"RB_DELETEBAND";
-//        case 1026: return L"SB_GETTEXTA";
-//        case 1026: return L"TB_CHECKBUTTON";
-//        case 1026: return L"TBM_GETRANGEMAX";
-//        case 1026: return L"WM_PSD_MINMARGINRECT";
-        case 1027: return L"CBEM_GETIMAGELIST";
-//        case 1027: return L"DDM_BEGIN";
-//        case 1027: return L"HKM_SETRULES";
-//        case 1027: return L"PBM_DELTAPOS";
-//        case 1027: return L"RB_GETBARINFO";
-//        case 1027: return L"SB_GETTEXTLENGTHA";
-//        case 1027: return L"TBM_GETTIC";
-//        case 1027: return L"TB_PRESSBUTTON";
-//        case 1027: return L"TTM_SETDELAYTIME";
-//        case 1027: return L"WM_PSD_MARGINRECT";
-        case 1028: return L"CBEM_GETITEMA";
-//        case 1028: return L"DDM_END";
-//        case 1028: return L"PBM_SETSTEP";
-//        case 1028: return L"RB_SETBARINFO";
-//        case 1028: return L"SB_SETPARTS";
-//        case 1028: return L"TB_HIDEBUTTON";
-//        case 1028: return L"TBM_SETTIC";
-//        case 1028: return L"TTM_ADDTOOLA";
-//        case 1028: return L"WM_PSD_GREEKTEXTRECT";
-        case 1029: return L"CBEM_SETITEMA";
-//        case 1029: return L"PBM_STEPIT";
-//        case 1029: return L"TB_INDETERMINATE";
-//        case 1029: return L"TBM_SETPOS";
-//        case 1029: return L"TTM_DELTOOLA";
-//        case 1029: return L"WM_PSD_ENVSTAMPRECT";
-        case 1030: return L"CBEM_GETCOMBOCONTROL";
-//        case 1030: return L"PBM_SETRANGE32";
-//        case 1030: return L"RB_SETBANDINFOA";
-//        case 1030: return L"SB_GETPARTS";
-//        case 1030: return L"TB_MARKBUTTON";
-//        case 1030: return L"TBM_SETRANGE";
-//        case 1030: return L"TTM_NEWTOOLRECTA";
-//        case 1030: return L"WM_PSD_YAFULLPAGERECT";
-        case 1031: return L"CBEM_GETEDITCONTROL";
-//        case 1031: return L"PBM_GETRANGE";
-//        case 1031: return L"RB_SETPARENT";
-//        case 1031: return L"SB_GETBORDERS";
-//        case 1031: return L"TBM_SETRANGEMIN";
-//        case 1031: return L"TTM_RELAYEVENT";
-        case 1032: return L"CBEM_SETEXSTYLE";
-//        case 1032: return L"PBM_GETPOS";
-//        case 1032: return L"RB_HITTEST";
-//        case 1032: return L"SB_SETMINHEIGHT";
-//        case 1032: return L"TBM_SETRANGEMAX";
-//        case 1032: return L"TTM_GETTOOLINFOA";
-        case 1033: return L"CBEM_GETEXSTYLE";
-//        case 1033: return L"CBEM_GETEXTENDEDSTYLE";
-//        case 1033: return L"PBM_SETBARCOLOR";
-//        case 1033: return L"RB_GETRECT";
-//        case 1033: return L"SB_SIMPLE";
-//        case 1033: return L"TB_ISBUTTONENABLED";
-//        case 1033: return L"TBM_CLEARTICS";
-//        case 1033: return L"TTM_SETTOOLINFOA";
-        case 1034: return L"CBEM_HASEDITCHANGED";
-//        case 1034: return L"RB_INSERTBANDW";
-//        case 1034: return L"SB_GETRECT";
-//        case 1034: return L"TB_ISBUTTONCHECKED";
-//        case 1034: return L"TBM_SETSEL";
-//        case 1034: return L"TTM_HITTESTA";
-//        case 1034: return L"WIZ_QUERYNUMPAGES";
-        case 1035: return L"CBEM_INSERTITEMW";
-//        case 1035: return L"RB_SETBANDINFOW";
-//        case 1035: return L"SB_SETTEXTW";
-//        case 1035: return L"TB_ISBUTTONPRESSED";
-//        case 1035: return L"TBM_SETSELSTART";
-//        case 1035: return L"TTM_GETTEXTA";
-//        case 1035: return L"WIZ_NEXT";
-        case 1036: return L"CBEM_SETITEMW";
-//        case 1036: return L"RB_GETBANDCOUNT";
-//        case 1036: return L"SB_GETTEXTLENGTHW";
-//        case 1036: return L"TB_ISBUTTONHIDDEN";
-//        case 1036: return L"TBM_SETSELEND";
-//        case 1036: return L"TTM_UPDATETIPTEXTA";
-//        case 1036: return L"WIZ_PREV";
-        case 1037: return L"CBEM_GETITEMW";
-//        case 1037: return L"RB_GETROWCOUNT";
-//        case 1037: return L"SB_GETTEXTW";
-//        case 1037: return L"TB_ISBUTTONINDETERMINATE";
-//        case 1037: return L"TTM_GETTOOLCOUNT";
-        case 1038: return L"CBEM_SETEXTENDEDSTYLE";
-//        case 1038: return L"RB_GETROWHEIGHT";
-//        case 1038: return L"SB_ISSIMPLE";
-//        case 1038: return L"TB_ISBUTTONHIGHLIGHTED";
-//        case 1038: return L"TBM_GETPTICS";
-//        case 1038: return L"TTM_ENUMTOOLSA";
-        case 1039: return L"SB_SETICON";
-//        case 1039: return L"TBM_GETTICPOS";
-//        case 1039: return L"TTM_GETCURRENTTOOLA";
-        case 1040: return L"RB_IDTOINDEX";
-//        case 1040: return L"SB_SETTIPTEXTA";
-//        case 1040: return L"TBM_GETNUMTICS";
-//        case 1040: return L"TTM_WINDOWFROMPOINT";
-        case 1041: return L"RB_GETTOOLTIPS";
- //       case 1041: return L"SB_SETTIPTEXTW";
- //       case 1041: return L"TBM_GETSELSTART";
- //       case 1041: return L"TB_SETSTATE";
- //       case 1041: return L"TTM_TRACKACTIVATE";
-        case 1042: return L"RB_SETTOOLTIPS";
-//        case 1042: return L"SB_GETTIPTEXTA";
-//        case 1042: return L"TB_GETSTATE";
-//        case 1042: return L"TBM_GETSELEND";
-//        case 1042: return L"TTM_TRACKPOSITION";
-        case 1043: return L"RB_SETBKCOLOR";
-//        case 1043: return L"SB_GETTIPTEXTW";
-//        case 1043: return L"TB_ADDBITMAP";
-//        case 1043: return L"TBM_CLEARSEL";
-//        case 1043: return L"TTM_SETTIPBKCOLOR";
-        case 1044: return L"RB_GETBKCOLOR";
-//        case 1044: return L"SB_GETICON";
-//        case 1044: return L"TB_ADDBUTTONSA";
-//        case 1044: return L"TBM_SETTICFREQ";
-//        case 1044: return L"TTM_SETTIPTEXTCOLOR";
-        case 1045: return L"RB_SETTEXTCOLOR";
-//        case 1045: return L"TB_INSERTBUTTONA";
-//        case 1045: return L"TBM_SETPAGESIZE";
-//        case 1045: return L"TTM_GETDELAYTIME";
-        case 1046: return L"RB_GETTEXTCOLOR";
-//        case 1046: return L"TB_DELETEBUTTON";
-//        case 1046: return L"TBM_GETPAGESIZE";
-//        case 1046: return L"TTM_GETTIPBKCOLOR";
-        case 1047: return L"RB_SIZETORECT";
-//        case 1047: return L"TB_GETBUTTON";
-//        case 1047: return L"TBM_SETLINESIZE";
-//        case 1047: return L"TTM_GETTIPTEXTCOLOR";
-        case 1048: return L"RB_BEGINDRAG";
-//        case 1048: return L"TB_BUTTONCOUNT";
-//        case 1048: return L"TBM_GETLINESIZE";
-//        case 1048: return L"TTM_SETMAXTIPWIDTH";
-        case 1049: return L"RB_ENDDRAG";
-//        case 1049: return L"TB_COMMANDTOINDEX";
-//        case 1049: return L"TBM_GETTHUMBRECT";
-//        case 1049: return L"TTM_GETMAXTIPWIDTH";
-        case 1050: return L"RB_DRAGMOVE";
-//        case 1050: return L"TBM_GETCHANNELRECT";
-//        case 1050: return L"TB_SAVERESTOREA";
-//        case 1050: return L"TTM_SETMARGIN";
-        case 1051: return L"RB_GETBARHEIGHT";
-//        case 1051: return L"TB_CUSTOMIZE";
-//        case 1051: return L"TBM_SETTHUMBLENGTH";
-//        case 1051: return L"TTM_GETMARGIN";
-        case 1052: return L"RB_GETBANDINFOW";
-//        case 1052: return L"TB_ADDSTRINGA";
-//        case 1052: return L"TBM_GETTHUMBLENGTH";
-//        case 1052: return L"TTM_POP";
-        case 1053: return L"RB_GETBANDINFOA";
-//        case 1053: return L"TB_GETITEMRECT";
-//        case 1053: return L"TBM_SETTOOLTIPS";
-//        case 1053: return L"TTM_UPDATE";
-        case 1054: return L"RB_MINIMIZEBAND";
-//        case 1054: return L"TB_BUTTONSTRUCTSIZE";
-//        case 1054: return L"TBM_GETTOOLTIPS";
-//        case 1054: return L"TTM_GETBUBBLESIZE";
-        case 1055: return L"RB_MAXIMIZEBAND";
-//        case 1055: return L"TBM_SETTIPSIDE";
-//        case 1055: return L"TB_SETBUTTONSIZE";
-//        case 1055: return L"TTM_ADJUSTRECT";
-        case 1056: return L"TBM_SETBUDDY";
-//        case 1056: return L"TB_SETBITMAPSIZE";
-//        case 1056: return L"TTM_SETTITLEA";
-        case 1057: return L"MSG_FTS_JUMP_VA";
-//        case 1057: return L"TB_AUTOSIZE";
-//        case 1057: return L"TBM_GETBUDDY";
-//        case 1057: return L"TTM_SETTITLEW";
-        case 1058: return L"RB_GETBANDBORDERS";
-        case 1059: return L"MSG_FTS_JUMP_QWORD";
-//        case 1059: return L"RB_SHOWBAND";
-//        case 1059: return L"TB_GETTOOLTIPS";
-        case 1060: return L"MSG_REINDEX_REQUEST";
-//        case 1060: return L"TB_SETTOOLTIPS";
-        case 1061: return L"MSG_FTS_WHERE_IS_IT";
-//        case 1061: return L"RB_SETPALETTE";
-//        case 1061: return L"TB_SETPARENT";
-        case 1062: return L"RB_GETPALETTE";
-        case 1063: return L"RB_MOVEBAND";
-//        case 1063: return L"TB_SETROWS";
-        case 1064: return L"TB_GETROWS";
-        case 1065: return L"TB_GETBITMAPFLAGS";
-        case 1066: return L"TB_SETCMDID";
-        case 1067: return L"RB_PUSHCHEVRON";
-//        case 1067: return L"TB_CHANGEBITMAP";
-        case 1068: return L"TB_GETBITMAP";
-        case 1069: return L"MSG_GET_DEFFONT";
-//        case 1069: return L"TB_GETBUTTONTEXTA";
-        case 1070: return L"TB_REPLACEBITMAP";
-        case 1071: return L"TB_SETINDENT";
-        case 1072: return L"TB_SETIMAGELIST";
-        case 1073: return L"TB_GETIMAGELIST";
-        case 1074: return L"TB_LOADIMAGES";
-//        case 1074: return L"EM_CANPASTE";
-//        case 1074: return L"TTM_ADDTOOLW";
-        case 1075: return L"EM_DISPLAYBAND";
-//        case 1075: return L"TB_GETRECT";
-//        case 1075: return L"TTM_DELTOOLW";
-        case 1076: return L"EM_EXGETSEL";
-//        case 1076: return L"TB_SETHOTIMAGELIST";
-//        case 1076: return L"TTM_NEWTOOLRECTW";
-        case 1077: return L"EM_EXLIMITTEXT";
-//        case 1077: return L"TB_GETHOTIMAGELIST";
-//        case 1077: return L"TTM_GETTOOLINFOW";
-        case 1078: return L"EM_EXLINEFROMCHAR";
-//        case 1078: return L"TB_SETDISABLEDIMAGELIST";
-//        case 1078: return L"TTM_SETTOOLINFOW";
-        case 1079: return L"EM_EXSETSEL";
-//        case 1079: return L"TB_GETDISABLEDIMAGELIST";
-//        case 1079: return L"TTM_HITTESTW";
-        case 1080: return L"EM_FINDTEXT";
-//        case 1080: return L"TB_SETSTYLE";
-//        case 1080: return L"TTM_GETTEXTW";
-        case 1081: return L"EM_FORMATRANGE";
-//        case 1081: return L"TB_GETSTYLE";
-//        case 1081: return L"TTM_UPDATETIPTEXTW";
-        case 1082: return L"EM_GETCHARFORMAT";
-//        case 1082: return L"TB_GETBUTTONSIZE";
-//        case 1082: return L"TTM_ENUMTOOLSW";
-        case 1083: return L"EM_GETEVENTMASK";
-//        case 1083: return L"TB_SETBUTTONWIDTH";
-//        case 1083: return L"TTM_GETCURRENTTOOLW";
-        case 1084: return L"EM_GETOLEINTERFACE";
-//        case 1084: return L"TB_SETMAXTEXTROWS";
-        case 1085: return L"EM_GETPARAFORMAT";
-//        case 1085: return L"TB_GETTEXTROWS";
-        case 1086: return L"EM_GETSELTEXT";
-//        case 1086: return L"TB_GETOBJECT";
-        case 1087: return L"EM_HIDESELECTION";
-//        case 1087: return L"TB_GETBUTTONINFOW";
-        case 1088: return L"EM_PASTESPECIAL";
-//        case 1088: return L"TB_SETBUTTONINFOW";
-        case 1089: return L"EM_REQUESTRESIZE";
-//        case 1089: return L"TB_GETBUTTONINFOA";
-        case 1090: return L"EM_SELECTIONTYPE";
-//        case 1090: return L"TB_SETBUTTONINFOA";
-        case 1091: return L"EM_SETBKGNDCOLOR";
-//        case 1091: return L"TB_INSERTBUTTONW";
-        case 1092: return L"EM_SETCHARFORMAT";
-//        case 1092: return L"TB_ADDBUTTONSW";
-        case 1093: return L"EM_SETEVENTMASK";
-//        case 1093: return L"TB_HITTEST";
-        case 1094: return L"EM_SETOLECALLBACK";
-//        case 1094: return L"TB_SETDRAWTEXTFLAGS";
-        case 1095: return L"EM_SETPARAFORMAT";
-//        case 1095: return L"TB_GETHOTITEM";
-        case 1096: return L"EM_SETTARGETDEVICE";
-//        case 1096: return L"TB_SETHOTITEM";
-        case 1097: return L"EM_STREAMIN";
-//        case 1097: return L"TB_SETANCHORHIGHLIGHT";
-        case 1098: return L"EM_STREAMOUT";
-//        case 1098: return L"TB_GETANCHORHIGHLIGHT";
-        case 1099: return L"EM_GETTEXTRANGE";
-//        case 1099: return L"TB_GETBUTTONTEXTW";
-        case 1100: return L"EM_FINDWORDBREAK";
-//        case 1100: return L"TB_SAVERESTOREW";
-        case 1101: return L"EM_SETOPTIONS";
-//        case 1101: return L"TB_ADDSTRINGW";
-        case 1102: return L"EM_GETOPTIONS";
-//        case 1102: return L"TB_MAPACCELERATORA";
-        case 1103: return L"EM_FINDTEXTEX";
-//        case 1103: return L"TB_GETINSERTMARK";
-        case 1104: return L"EM_GETWORDBREAKPROCEX";
-//        case 1104: return L"TB_SETINSERTMARK";
-        case 1105: return L"EM_SETWORDBREAKPROCEX";
-//        case 1105: return L"TB_INSERTMARKHITTEST";
-        case 1106: return L"EM_SETUNDOLIMIT";
-//        case 1106: return L"TB_MOVEBUTTON";
-        case 1107: return L"TB_GETMAXSIZE";
-        case 1108: return L"EM_REDO";
-//        case 1108: return L"TB_SETEXTENDEDSTYLE";
-        case 1109: return L"EM_CANREDO";
-//        case 1109: return L"TB_GETEXTENDEDSTYLE";
-        case 1110: return L"EM_GETUNDONAME";
-//        case 1110: return L"TB_GETPADDING";
-        case 1111: return L"EM_GETREDONAME";
-//        case 1111: return L"TB_SETPADDING";
-        case 1112: return L"EM_STOPGROUPTYPING";
-//        case 1112: return L"TB_SETINSERTMARKCOLOR";
-        case 1113: return L"EM_SETTEXTMODE";
-//        case 1113: return L"TB_GETINSERTMARKCOLOR";
-        case 1114: return L"EM_GETTEXTMODE";
-//        case 1114: return L"TB_MAPACCELERATORW";
-        case 1115: return L"EM_AUTOURLDETECT";
-//        case 1115: return L"TB_GETSTRINGW";
-        case 1116: return L"EM_GETAUTOURLDETECT";
-//        case 1116: return L"TB_GETSTRINGA";
-        case 1117: return L"EM_SETPALETTE";
-        case 1118: return L"EM_GETTEXTEX";
-        case 1119: return L"EM_GETTEXTLENGTHEX";
-        case 1120: return L"EM_SHOWSCROLLBAR";
-        case 1121: return L"EM_SETTEXTEX";
-        case 1123: return L"TAPI_REPLY";
-        case 1124: return L"ACM_OPENA";
-//        case 1124: return L"BFFM_SETSTATUSTEXTA";
-//        case 1124: return L"CDM_FIRST";
-//        case 1124: return L"CDM_GETSPEC";
-//        case 1124: return L"EM_SETPUNCTUATION";
-//        case 1124: return L"IPM_CLEARADDRESS";
-//        case 1124: return L"WM_CAP_UNICODE_START";
-        case 1125: return L"ACM_PLAY";
-//        case 1125: return L"BFFM_ENABLEOK";
-//        case 1125: return L"CDM_GETFILEPATH";
-//        case 1125: return L"EM_GETPUNCTUATION";
-//        case 1125: return L"IPM_SETADDRESS";
-//        case 1125: return L"PSM_SETCURSEL";
-//        case 1125: return L"UDM_SETRANGE";
-//        case 1125: return L"WM_CHOOSEFONT_SETLOGFONT";
-        case 1126: return L"ACM_STOP";
-//        case 1126: return L"BFFM_SETSELECTIONA";
-//        case 1126: return L"CDM_GETFOLDERPATH";
-//        case 1126: return L"EM_SETWORDWRAPMODE";
-//        case 1126: return L"IPM_GETADDRESS";
-//        case 1126: return L"PSM_REMOVEPAGE";
-//        case 1126: return L"UDM_GETRANGE";
-//        case 1126: return L"WM_CAP_SET_CALLBACK_ERRORW";
-//        case 1126: return L"WM_CHOOSEFONT_SETFLAGS";
-        case 1127: return L"ACM_OPENW";
-//        case 1127: return L"BFFM_SETSELECTIONW";
-//        case 1127: return L"CDM_GETFOLDERIDLIST";
-//        case 1127: return L"EM_GETWORDWRAPMODE";
-//        case 1127: return L"IPM_SETRANGE";
-//        case 1127: return L"PSM_ADDPAGE";
-//        case 1127: return L"UDM_SETPOS";
-//        case 1127: return L"WM_CAP_SET_CALLBACK_STATUSW";
-        case 1128: return L"BFFM_SETSTATUSTEXTW";
-//        case 1128: return L"CDM_SETCONTROLTEXT";
-//        case 1128: return L"EM_SETIMECOLOR";
-//        case 1128: return L"IPM_SETFOCUS";
-//        case 1128: return L"PSM_CHANGED";
-//        case 1128: return L"UDM_GETPOS";
-        case 1129: return L"CDM_HIDECONTROL";
-//        case 1129: return L"EM_GETIMECOLOR";
-//        case 1129: return L"IPM_ISBLANK";
-//        case 1129: return L"PSM_RESTARTWINDOWS";
-//        case 1129: return L"UDM_SETBUDDY";
-        case 1130: return L"CDM_SETDEFEXT";
-//        case 1130: return L"EM_SETIMEOPTIONS";
-//        case 1130: return L"PSM_REBOOTSYSTEM";
-//        case 1130: return L"UDM_GETBUDDY";
-        case 1131: return L"EM_GETIMEOPTIONS";
-//        case 1131: return L"PSM_CANCELTOCLOSE";
-//        case 1131: return L"UDM_SETACCEL";
-        case 1132: return L"EM_CONVPOSITION";
-//        case 1132: return L"EM_CONVPOSITION";
-//        case 1132: return L"PSM_QUERYSIBLINGS";
-//        case 1132: return L"UDM_GETACCEL";
-        case 1133: return L"MCIWNDM_GETZOOM";
-//        case 1133: return L"PSM_UNCHANGED";
-//        case 1133: return L"UDM_SETBASE";
-        case 1134: return L"PSM_APPLY";
-//        case 1134: return L"UDM_GETBASE";
-        case 1135: return L"PSM_SETTITLEA";
-//        case 1135: return L"UDM_SETRANGE32";
-        case 1136: return L"PSM_SETWIZBUTTONS";
-//        case 1136: return L"UDM_GETRANGE32";
-//        case 1136: return L"WM_CAP_DRIVER_GET_NAMEW";
-        case 1137: return L"PSM_PRESSBUTTON";
-//        case 1137: return L"UDM_SETPOS32";
-//        case 1137: return L"WM_CAP_DRIVER_GET_VERSIONW";
-        case 1138: return L"PSM_SETCURSELID";
-//        case 1138: return L"UDM_GETPOS32";
-        case 1139: return L"PSM_SETFINISHTEXTA";
-        case 1140: return L"PSM_GETTABCONTROL";
-        case 1141: return L"PSM_ISDIALOGMESSAGE";
-        case 1142: return L"MCIWNDM_REALIZE";
-//        case 1142: return L"PSM_GETCURRENTPAGEHWND";
-        case 1143: return L"MCIWNDM_SETTIMEFORMATA";
-//        case 1143: return L"PSM_INSERTPAGE";
-        case 1144: return L"EM_SETLANGOPTIONS";
-//        case 1144: return L"MCIWNDM_GETTIMEFORMATA";
-//        case 1144: return L"PSM_SETTITLEW";
-//        case 1144: return L"WM_CAP_FILE_SET_CAPTURE_FILEW";
-        case 1145: return L"EM_GETLANGOPTIONS";
-//        case 1145: return L"MCIWNDM_VALIDATEMEDIA";
-//        case 1145: return L"PSM_SETFINISHTEXTW";
-//        case 1145: return L"WM_CAP_FILE_GET_CAPTURE_FILEW";
-        case 1146: return L"EM_GETIMECOMPMODE";
-        case 1147: return L"EM_FINDTEXTW";
-//        case 1147: return L"MCIWNDM_PLAYTO";
-//        case 1147: return L"WM_CAP_FILE_SAVEASW";
-        case 1148: return L"EM_FINDTEXTEXW";
-//        case 1148: return L"MCIWNDM_GETFILENAMEA";
-        case 1149: return L"EM_RECONVERSION";
-//        case 1149: return L"MCIWNDM_GETDEVICEA";
-//        case 1149: return L"PSM_SETHEADERTITLEA";
-//        case 1149: return L"WM_CAP_FILE_SAVEDIBW";
-        case 1150: return L"EM_SETIMEMODEBIAS";
-//        case 1150: return L"MCIWNDM_GETPALETTE";
-//        case 1150: return L"PSM_SETHEADERTITLEW";
-        case 1151: return L"EM_GETIMEMODEBIAS";
-//        case 1151: return L"MCIWNDM_SETPALETTE";
-//        case 1151: return L"PSM_SETHEADERSUBTITLEA";
-        case 1152: return L"MCIWNDM_GETERRORA";
-//        case 1152: return L"PSM_SETHEADERSUBTITLEW";
-        case 1153: return L"PSM_HWNDTOINDEX";
-        case 1154: return L"PSM_INDEXTOHWND";
-        case 1155: return L"MCIWNDM_SETINACTIVETIMER";
-//        case 1155: return L"PSM_PAGETOINDEX";
-        case 1156: return L"PSM_INDEXTOPAGE";
-        case 1157: return L"DL_BEGINDRAG";
-//        case 1157: return L"MCIWNDM_GETINACTIVETIMER";
-//        case 1157: return L"PSM_IDTOINDEX";
-        case 1158: return L"DL_DRAGGING";
-//        case 1158: return L"PSM_INDEXTOID";
-        case 1159: return L"DL_DROPPED";
-//        case 1159: return L"PSM_GETRESULT";
-        case 1160: return L"DL_CANCELDRAG";
-//        case 1160: return L"PSM_RECALCPAGESIZES";
-        case 1164: return L"MCIWNDM_GET_SOURCE";
-        case 1165: return L"MCIWNDM_PUT_SOURCE";
-        case 1166: return L"MCIWNDM_GET_DEST";
-        case 1167: return L"MCIWNDM_PUT_DEST";
-        case 1168: return L"MCIWNDM_CAN_PLAY";
-        case 1169: return L"MCIWNDM_CAN_WINDOW";
-        case 1170: return L"MCIWNDM_CAN_RECORD";
-        case 1171: return L"MCIWNDM_CAN_SAVE";
-        case 1172: return L"MCIWNDM_CAN_EJECT";
-        case 1173: return L"MCIWNDM_CAN_CONFIG";
-        case 1174: return L"IE_GETINK";
-//        case 1174: return L"IE_MSGFIRST";
-//        case 1174: return L"MCIWNDM_PALETTEKICK";
-        case 1175: return L"IE_SETINK";
-        case 1176: return L"IE_GETPENTIP";
-        case 1177: return L"IE_SETPENTIP";
-        case 1178: return L"IE_GETERASERTIP";
-        case 1179: return L"IE_SETERASERTIP";
-        case 1180: return L"IE_GETBKGND";
-        case 1181: return L"IE_SETBKGND";
-        case 1182: return L"IE_GETGRIDORIGIN";
-        case 1183: return L"IE_SETGRIDORIGIN";
-        case 1184: return L"IE_GETGRIDPEN";
-        case 1185: return L"IE_SETGRIDPEN";
-        case 1186: return L"IE_GETGRIDSIZE";
-        case 1187: return L"IE_SETGRIDSIZE";
-        case 1188: return L"IE_GETMODE";
-        case 1189: return L"IE_SETMODE";
-        case 1190: return L"IE_GETINKRECT";
-//        case 1190: return L"WM_CAP_SET_MCI_DEVICEW";
-        case 1191: return L"WM_CAP_GET_MCI_DEVICEW";
-        case 1204: return L"WM_CAP_PAL_OPENW";
-        case 1205: return L"WM_CAP_PAL_SAVEW";
-        case 1208: return L"IE_GETAPPDATA";
-        case 1209: return L"IE_SETAPPDATA";
-        case 1210: return L"IE_GETDRAWOPTS";
-        case 1211: return L"IE_SETDRAWOPTS";
-        case 1212: return L"IE_GETFORMAT";
-        case 1213: return L"IE_SETFORMAT";
-        case 1214: return L"IE_GETINKINPUT";
-        case 1215: return L"IE_SETINKINPUT";
-        case 1216: return L"IE_GETNOTIFY";
-        case 1217: return L"IE_SETNOTIFY";
-        case 1218: return L"IE_GETRECOG";
-        case 1219: return L"IE_SETRECOG";
-        case 1220: return L"IE_GETSECURITY";
-        case 1221: return L"IE_SETSECURITY";
-        case 1222: return L"IE_GETSEL";
-        case 1223: return L"IE_SETSEL";
-        case 1224: return L"CDM_LAST";
-//        case 1224: return L"EM_SETBIDIOPTIONS";
-//        case 1224: return L"IE_DOCOMMAND";
-//        case 1224: return L"MCIWNDM_NOTIFYMODE";
-        case 1225: return L"EM_GETBIDIOPTIONS";
-//        case 1225: return L"IE_GETCOMMAND";
-        case 1226: return L"EM_SETTYPOGRAPHYOPTIONS";
-//        case 1226: return L"IE_GETCOUNT";
-        case 1227: return L"EM_GETTYPOGRAPHYOPTIONS";
-//        case 1227: return L"IE_GETGESTURE";
-//        case 1227: return L"MCIWNDM_NOTIFYMEDIA";
-        case 1228: return L"EM_SETEDITSTYLE";
-//        case 1228: return L"IE_GETMENU";
-        case 1229: return L"EM_GETEDITSTYLE";
-//        case 1229: return L"IE_GETPAINTDC";
-//        case 1229: return L"MCIWNDM_NOTIFYERROR";
-        case 1230: return L"IE_GETPDEVENT";
-        case 1231: return L"IE_GETSELCOUNT";
-        case 1232: return L"IE_GETSELITEMS";
-        case 1233: return L"IE_GETSTYLE";
-        case 1243: return L"MCIWNDM_SETTIMEFORMATW";
-        case 1244: return L"EM_OUTLINE";
-//        case 1244: return L"MCIWNDM_GETTIMEFORMATW";
-        case 1245: return L"EM_GETSCROLLPOS";
-        case 1246: return L"EM_SETSCROLLPOS";
-//        case 1246: return L"EM_SETSCROLLPOS";
-        case 1247: return L"EM_SETFONTSIZE";
-        case 1248: return L"EM_GETZOOM";
-//        case 1248: return L"MCIWNDM_GETFILENAMEW";
-        case 1249: return L"EM_SETZOOM";
-//        case 1249: return L"MCIWNDM_GETDEVICEW";
-        case 1250: return L"EM_GETVIEWKIND";
-        case 1251: return L"EM_SETVIEWKIND";
-        case 1252: return L"EM_GETPAGE";
-//        case 1252: return L"MCIWNDM_GETERRORW";
-        case 1253: return L"EM_SETPAGE";
-        case 1254: return L"EM_GETHYPHENATEINFO";
-        case 1255: return L"EM_SETHYPHENATEINFO";
-        case 1259: return L"EM_GETPAGEROTATE";
-        case 1260: return L"EM_SETPAGEROTATE";
-        case 1261: return L"EM_GETCTFMODEBIAS";
-        case 1262: return L"EM_SETCTFMODEBIAS";
-        case 1264: return L"EM_GETCTFOPENSTATUS";
-        case 1265: return L"EM_SETCTFOPENSTATUS";
-        case 1266: return L"EM_GETIMECOMPTEXT";
-        case 1267: return L"EM_ISIME";
-        case 1268: return L"EM_GETIMEPROPERTY";
-        case 1293: return L"EM_GETQUERYRTFOBJ";
-        case 1294: return L"EM_SETQUERYRTFOBJ";
-        case 1536: return L"FM_GETFOCUS";
-        case 1537: return L"FM_GETDRIVEINFOA";
-        case 1538: return L"FM_GETSELCOUNT";
-        case 1539: return L"FM_GETSELCOUNTLFN";
-        case 1540: return L"FM_GETFILESELA";
-        case 1541: return L"FM_GETFILESELLFNA";
-        case 1542: return L"FM_REFRESH_WINDOWS";
-        case 1543: return L"FM_RELOAD_EXTENSIONS";
-        case 1553: return L"FM_GETDRIVEINFOW";
-        case 1556: return L"FM_GETFILESELW";
-        case 1557: return L"FM_GETFILESELLFNW";
-        case 1625: return L"WLX_WM_SAS";
-        case 2024: return L"SM_GETSELCOUNT";
-//        case 2024: return L"UM_GETSELCOUNT";
-//        case 2024: return L"WM_CPL_LAUNCH";
-        case 2025: return L"SM_GETSERVERSELA";
-//        case 2025: return L"UM_GETUSERSELA";
-//        case 2025: return L"WM_CPL_LAUNCHED";
-        case 2026: return L"SM_GETSERVERSELW";
-//        case 2026: return L"UM_GETUSERSELW";
-        case 2027: return L"SM_GETCURFOCUSA";
-//        case 2027: return L"UM_GETGROUPSELA";
-        case 2028: return L"SM_GETCURFOCUSW";
-//        case 2028: return L"UM_GETGROUPSELW";
-        case 2029: return L"SM_GETOPTIONS";
-//        case 2029: return L"UM_GETCURFOCUSA";
-        case 2030: return L"UM_GETCURFOCUSW";
-        case 2031: return L"UM_GETOPTIONS";
-        case 2032: return L"UM_GETOPTIONS2";
-        case 4096: return L"LVM_FIRST";
-//        case 4096: return L"LVM_GETBKCOLOR";
-        case 4097: return L"LVM_SETBKCOLOR";
-        case 4098: return L"LVM_GETIMAGELIST";
-        case 4099: return L"LVM_SETIMAGELIST";
-        case 4100: return L"LVM_GETITEMCOUNT";
-        case 4101: return L"LVM_GETITEMA";
-        case 4102: return L"LVM_SETITEMA";
-        case 4103: return L"LVM_INSERTITEMA";
-        case 4104: return L"LVM_DELETEITEM";
-        case 4105: return L"LVM_DELETEALLITEMS";
-        case 4106: return L"LVM_GETCALLBACKMASK";
-        case 4107: return L"LVM_SETCALLBACKMASK";
-        case 4108: return L"LVM_GETNEXTITEM";
-        case 4109: return L"LVM_FINDITEMA";
-        case 4110: return L"LVM_GETITEMRECT";
-        case 4111: return L"LVM_SETITEMPOSITION";
-        case 4112: return L"LVM_GETITEMPOSITION";
-        case 4113: return L"LVM_GETSTRINGWIDTHA";
-        case 4114: return L"LVM_HITTEST";
-        case 4115: return L"LVM_ENSUREVISIBLE";
-        case 4116: return L"LVM_SCROLL";
-        case 4117: return L"LVM_REDRAWITEMS";
-        case 4118: return L"LVM_ARRANGE";
-        case 4119: return L"LVM_EDITLABELA";
-        case 4120: return L"LVM_GETEDITCONTROL";
-        case 4121: return L"LVM_GETCOLUMNA";
-        case 4122: return L"LVM_SETCOLUMNA";
-        case 4123: return L"LVM_INSERTCOLUMNA";
-        case 4124: return L"LVM_DELETECOLUMN";
-        case 4125: return L"LVM_GETCOLUMNWIDTH";
-        case 4126: return L"LVM_SETCOLUMNWIDTH";
-        case 4127: return L"LVM_GETHEADER";
-        case 4129: return L"LVM_CREATEDRAGIMAGE";
-        case 4130: return L"LVM_GETVIEWRECT";
-        case 4131: return L"LVM_GETTEXTCOLOR";
-        case 4132: return L"LVM_SETTEXTCOLOR";
-        case 4133: return L"LVM_GETTEXTBKCOLOR";
-        case 4134: return L"LVM_SETTEXTBKCOLOR";
-        case 4135: return L"LVM_GETTOPINDEX";
-        case 4136: return L"LVM_GETCOUNTPERPAGE";
-        case 4137: return L"LVM_GETORIGIN";
-        case 4138: return L"LVM_UPDATE";
-        case 4139: return L"LVM_SETITEMSTATE";
-        case 4140: return L"LVM_GETITEMSTATE";
-        case 4141: return L"LVM_GETITEMTEXTA";
-        case 4142: return L"LVM_SETITEMTEXTA";
-        case 4143: return L"LVM_SETITEMCOUNT";
-        case 4144: return L"LVM_SORTITEMS";
-        case 4145: return L"LVM_SETITEMPOSITION32";
-        case 4146: return L"LVM_GETSELECTEDCOUNT";
-        case 4147: return L"LVM_GETITEMSPACING";
-        case 4148: return L"LVM_GETISEARCHSTRINGA";
-        case 4149: return L"LVM_SETICONSPACING";
-        case 4150: return L"LVM_SETEXTENDEDLISTVIEWSTYLE";
-        case 4151: return L"LVM_GETEXTENDEDLISTVIEWSTYLE";
-        case 4152: return L"LVM_GETSUBITEMRECT";
-        case 4153: return L"LVM_SUBITEMHITTEST";
-        case 4154: return L"LVM_SETCOLUMNORDERARRAY";
-        case 4155: return L"LVM_GETCOLUMNORDERARRAY";
-        case 4156: return L"LVM_SETHOTITEM";
-        case 4157: return L"LVM_GETHOTITEM";
-        case 4158: return L"LVM_SETHOTCURSOR";
-        case 4159: return L"LVM_GETHOTCURSOR";
-        case 4160: return L"LVM_APPROXIMATEVIEWRECT";
-        case 4161: return L"LVM_SETWORKAREAS";
-        case 4162: return L"LVM_GETSELECTIONMARK";
-        case 4163: return L"LVM_SETSELECTIONMARK";
-        case 4164: return L"LVM_SETBKIMAGEA";
-        case 4165: return L"LVM_GETBKIMAGEA";
-        case 4166: return L"LVM_GETWORKAREAS";
-        case 4167: return L"LVM_SETHOVERTIME";
-        case 4168: return L"LVM_GETHOVERTIME";
-        case 4169: return L"LVM_GETNUMBEROFWORKAREAS";
-        case 4170: return L"LVM_SETTOOLTIPS";
-        case 4171: return L"LVM_GETITEMW";
-        case 4172: return L"LVM_SETITEMW";
-        case 4173: return L"LVM_INSERTITEMW";
-        case 4174: return L"LVM_GETTOOLTIPS";
-        case 4179: return L"LVM_FINDITEMW";
-        case 4183: return L"LVM_GETSTRINGWIDTHW";
-        case 4191: return L"LVM_GETCOLUMNW";
-        case 4192: return L"LVM_SETCOLUMNW";
-        case 4193: return L"LVM_INSERTCOLUMNW";
-        case 4211: return L"LVM_GETITEMTEXTW";
-        case 4212: return L"LVM_SETITEMTEXTW";
-        case 4213: return L"LVM_GETISEARCHSTRINGW";
-        case 4214: return L"LVM_EDITLABELW";
-        case 4235: return L"LVM_GETBKIMAGEW";
-        case 4236: return L"LVM_SETSELECTEDCOLUMN";
-        case 4237: return L"LVM_SETTILEWIDTH";
-        case 4238: return L"LVM_SETVIEW";
-        case 4239: return L"LVM_GETVIEW";
-        case 4241: return L"LVM_INSERTGROUP";
-        case 4243: return L"LVM_SETGROUPINFO";
-        case 4245: return L"LVM_GETGROUPINFO";
-        case 4246: return L"LVM_REMOVEGROUP";
-        case 4247: return L"LVM_MOVEGROUP";
-        case 4250: return L"LVM_MOVEITEMTOGROUP";
-        case 4251: return L"LVM_SETGROUPMETRICS";
-        case 4252: return L"LVM_GETGROUPMETRICS";
-        case 4253: return L"LVM_ENABLEGROUPVIEW";
-        case 4254: return L"LVM_SORTGROUPS";
-        case 4255: return L"LVM_INSERTGROUPSORTED";
-        case 4256: return L"LVM_REMOVEALLGROUPS";
-        case 4257: return L"LVM_HASGROUP";
-        case 4258: return L"LVM_SETTILEVIEWINFO";
-        case 4259: return L"LVM_GETTILEVIEWINFO";
-        case 4260: return L"LVM_SETTILEINFO";
-        case 4261: return L"LVM_GETTILEINFO";
-        case 4262: return L"LVM_SETINSERTMARK";
-        case 4263: return L"LVM_GETINSERTMARK";
-        case 4264: return L"LVM_INSERTMARKHITTEST";
-        case 4265: return L"LVM_GETINSERTMARKRECT";
-        case 4266: return L"LVM_SETINSERTMARKCOLOR";
-        case 4267: return L"LVM_GETINSERTMARKCOLOR";
-        case 4269: return L"LVM_SETINFOTIP";
-        case 4270: return L"LVM_GETSELECTEDCOLUMN";
-        case 4271: return L"LVM_ISGROUPVIEWENABLED";
-        case 4272: return L"LVM_GETOUTLINECOLOR";
-        case 4273: return L"LVM_SETOUTLINECOLOR";
-        case 4275: return L"LVM_CANCELEDITLABEL";
-        case 4276: return L"LVM_MAPINDEXTOID";
-        case 4277: return L"LVM_MAPIDTOINDEX";
-        case 4278: return L"LVM_ISITEMVISIBLE";
-        case 4300: return L"LVM_GETEMPTYTEXT";
-        case 4301: return L"LVM_GETFOOTERRECT";
-        case 4302: return L"LVM_GETFOOTERINFO";
-        case 4303: return L"LVM_GETFOOTERITEMRECT";
-        case 4304: return L"LVM_GETFOOTERITEM";
-        case 4305: return L"LVM_GETITEMINDEXRECT";
-        case 4306: return L"LVM_SETITEMINDEXSTATE";
-        case 4307: return L"LVM_GETNEXTITEMINDEX";
-        case 8192: return L"OCM__BASE";
-        case 8197: return L"LVM_SETUNICODEFORMAT";
-        case 8198: return L"LVM_GETUNICODEFORMAT";
-        case 8217: return L"OCM_CTLCOLOR";
-        case 8235: return L"OCM_DRAWITEM";
-        case 8236: return L"OCM_MEASUREITEM";
-        case 8237: return L"OCM_DELETEITEM";
-        case 8238: return L"OCM_VKEYTOITEM";
-        case 8239: return L"OCM_CHARTOITEM";
-        case 8249: return L"OCM_COMPAREITEM";
-        case 8270: return L"OCM_NOTIFY";
-        case 8465: return L"OCM_COMMAND";
-        case 8468: return L"OCM_HSCROLL";
-        case 8469: return L"OCM_VSCROLL";
-        case 8498: return L"OCM_CTLCOLORMSGBOX";
-        case 8499: return L"OCM_CTLCOLOREDIT";
-        case 8500: return L"OCM_CTLCOLORLISTBOX";
-        case 8501: return L"OCM_CTLCOLORBTN";
-        case 8502: return L"OCM_CTLCOLORDLG";
-        case 8503: return L"OCM_CTLCOLORSCROLLBAR";
-        case 8504: return L"OCM_CTLCOLORSTATIC";
-        case 8720: return L"OCM_PARENTNOTIFY";
-        case 32768: return L"WM_APP";
-        case 52429: return L"WM_RASDIALEVENT";
-        default: return L"???";
+        return false;
     }
+    enum EWin32MsgCategory eCategories = 0;
+    const wchar_t *lpszToken = lpszCsv;
+    while (true)
+    {
+        const bool bIsRemove = (L'-' == lpszToken[0]);
+        const wchar_t *lpszName = bIsRemove ? lpszToken + 1 : lpszToken;
+        const wchar_t *lpNullableComma = wcschr(lpszName, L',');
+        const size_t ulNameLen = (NULL == lpNullableComma) ? wcslen(lpszName) : (size_t) (lpNullableComma - lpszName);
+
+        bool bIsFound = false;
+        const size_t ulArrLen = sizeof(WIN32_MSG_CATEGORY_NAME_ARR) / sizeof(WIN32_MSG_CATEGORY_NAME_ARR[0]);
+        for (size_t i = 0; i < ulArrLen; ++i)
+        {
+            const struct Win32MsgCategoryName *lpCategoryName = WIN32_MSG_CATEGORY_NAME_ARR + i;
+            if (ulNameLen == wcslen(lpCategoryName->lpszName)
+                && 0 == wcsncmp(lpszName, lpCategoryName->lpszName, ulNameLen))
+            {
+                if (bIsRemove)
+                {
+                    eCategories &= ~(lpCategoryName->eCategories);
+                }
+                else
+                {
+                    eCategories |= lpCategoryName->eCategories;
+                }
+                bIsFound = true;
+                break;
+            }
+        }
+        // Intentional: Also empty name, e.g., L"mouse,,paint" or trailing comma.
+        if (!bIsFound)
+        {
+            return false;
+        }
+        if (NULL == lpNullableComma)
+        {
+            break;
+        }
+        lpszToken = lpNullableComma + 1;
+    }
+    *lpeCategories = eCategories;
+    return true;
 }
 
+bool
+Win32ArgvRemovePrefix(_Inout_ int                *lpArgc,
+                      _Inout_ wchar_t           **lppArgvWCharArr,
+                      _In_    const wchar_t      *lpszPrefix,
+                      _In_    Win32ArgvValueFunc  lpfnValue,
+                      _Inout_ void               *lpContext)
+{
+    assert(NULL != lpArgc);
+    assert(NULL != lppArgvWCharArr);
+    assert(NULL != lpszPrefix);
+    assert(NULL != lpfnValue);
+
+    const size_t ulPrefixLen = wcslen(lpszPrefix);
+    bool bResult = true;
+    // Intentional: Skip 0 == i which is path to executable.
+    int iDestIndex = 1;
+    for (int i = 1; i < *lpArgc; ++i)
+    {
+        wchar_t *lpszArg = lppArgvWCharArr[i];
+        if (0 == wcsncmp(lpszPrefix, lpszArg, ulPrefixLen))
+        {
+            if (bResult) {
+                bResult = lpfnValue(lpszArg + ulPrefixLen, lpContext);
+            }
+        }
+        else
+        {
+            lppArgvWCharArr[iDestIndex] = lpszArg;
+            ++iDestIndex;
+        }
+    }
+    // Intentional: Keep argv[argc] == NULL, same as C runtime.
+    for (int i = iDestIndex; i < *lpArgc; ++i) {
+        lppArgvWCharArr[i] = NULL;
+    }
+    *lpArgc = iDestIndex;
+    return bResult;
+}
@@ -50,9 +50,137 @@
 // Usually false on Win32, which makes sense, as wchar_t represents one "code unit" in Unicode UTF-16 on Win32.
 #define WCHAR_IS_SIGNED = ((bool) (((wchar_t) -1) < 0))
 
+// Flags: A message may have more than one category, e.g., WM_NCMOUSEMOVE is mouse and non-client.
+enum EWin32MsgCategory
+{
+    // Ex: WM_CREATE, WM_SIZE, WM_ACTIVATE, WM_SETFOCUS, WM_DPICHANGED
+    WIN32_MSG_CATEGORY_WINDOW    = 1 << 0,
+    // Ex: WM_NCHITTEST, WM_NCPAINT, WM_NCMOUSEMOVE
+    WIN32_MSG_CATEGORY_NONCLIENT = 1 << 1,
+    // Ex: WM_PAINT, WM_ERASEBKGND, WM_CTLCOLORSTATIC, WM_DRAWITEM
+    WIN32_MSG_CATEGORY_PAINT     = 1 << 2,
+    // Ex: WM_MOUSEMOVE, WM_LBUTTONDOWN, WM_SETCURSOR, WM_MOUSELEAVE
+    WIN32_MSG_CATEGORY_MOUSE     = 1 << 3,
+    // Ex: WM_KEYDOWN, WM_CHAR, WM_HOTKEY, WM_GETDLGCODE
+    WIN32_MSG_CATEGORY_KEYBOARD  = 1 << 4,
+    // Ex: WM_IME_COMPOSITION, WM_IME_NOTIFY
+    WIN32_MSG_CATEGORY_IME       = 1 << 5,
+    // WM_TIMER and WM_SYSTIMER
+    WIN32_MSG_CATEGORY_TIMER     = 1 << 6,
+    // Ex: WM_INITMENUPOPUP, WM_MENUSELECT, WM_CONTEXTMENU, WM_SYSCOMMAND
+    WIN32_MSG_CATEGORY_MENU      = 1 << 7,
+    // Sent to parent by a control.  Ex: WM_COMMAND, WM_NOTIFY, WM_PARENTNOTIFY, WM_VSCROLL
+    WIN32_MSG_CATEGORY_NOTIFY    = 1 << 8,
+    // Ex: WM_COPY, WM_PASTE, WM_RENDERFORMAT, WM_CLIPBOARDUPDATE
+    WIN32_MSG_CATEGORY_CLIPBOARD = 1 << 9,
+    // Broadcast by system.  Ex: WM_SETTINGCHANGE, WM_POWERBROADCAST, WM_DISPLAYCHANGE
+    WIN32_MSG_CATEGORY_SYSTEM    = 1 << 10,
+    // Sent to a control: Standard (EM_*, LB_*, CB_*, BM_*, ...), common (LVM_*, TB_*, ...), and range WM_USER to WM_APP - 1
+    // Intentional: Range WM_USER to WM_APP - 1 is class-specific.  Why?  Name is one guess: Many classes reuse same ids.
+    WIN32_MSG_CATEGORY_CONTROL   = 1 << 11,
+    // All others, including unknown messages.  Ex: WM_NULL, WM_COPYDATA, WM_APP
+    WIN32_MSG_CATEGORY_OTHER     = 1 << 12,
+
+    WIN32_MSG_CATEGORY_ALL       = (1 << 13) - 1,
+};
+
+// Ex: L"--log-msg=all,-mouse"  See: Win32MsgCategoriesFromText()
+#define WIN32_MSG_CATEGORY_ARG_PREFIX L"--log-msg="
+
+struct Win32Msg
+{
+    UINT                   uMsg;
+    // Ex: L"WM_CREATE"
+    const wchar_t         *lpszName;
+    enum EWin32MsgCategory eCategories;
+};
+
+/**
+ * Binary search of a sorted static table: No formatting and no heap alloc.
+ * For ids used by more than one name, e.g., WM_USER + N, the first name is returned.
+ *
+ * @return name of message, e.g., L"WM_CREATE", or L"???" if unknown
+ */
 // Ref: https://wiki.winehq.org/List_Of_Windows_Messages
 const wchar_t *
 Win32MsgToText(const UINT uMsg);
 
+/**
+ * Same search as Win32MsgToText().  Fast enough to call for each message: Filter *before* formatting a trace line.
+ * Ex: if (0 != (Win32MsgToCategories(uMsg) & eTraceCategories)) { ... }
+ *
+ * @return categories of message, or WIN32_MSG_CATEGORY_OTHER if unknown
+ */
+enum EWin32MsgCategory
+Win32MsgToCategories(const UINT uMsg);
+
+/**
+ * Reverse lookup: Linear search, including aliases, e.g., L"WM_SETTINGCHANGE" and L"WM_USER".
+ * Slower than Win32MsgToText(): Intended for config and command-line args, not per message.
+ *
+ * @param lpszName
+ *        case-sensitive; ex: L"WM_PAINT"
+ *
+ * @param lpuMsg
+ *        on return, set only if found
+ *
+ * @return true if found
+ */
+bool
+Win32MsgFromText(_In_  const wchar_t *lpszName,
+                 _Out_ UINT          *lpuMsg);
+
+/**
+ * Parse comma-separated category names, applied left to right.  A leading '-' removes, else adds.
+ * Names: window, nonclient, paint, mouse, keyboard, ime, timer, menu, notify, clipboard, system, control, other, all
+ * Ex: L"all,-mouse,-timer" -> all except mouse and timer
+ * Ex: L"keyboard,window"
+ *
+ * @param lpeCategories
+ *        on return, set only if valid
+ *
+ * @return false if empty or any name is unknown
+ */
+bool
+Win32MsgCategoriesFromText(_In_  const wchar_t          *lpszCsv,
+                           _Out_ enum EWin32MsgCategory *lpeCategories);
+
+/**
+ * Parse one value from Win32ArgvRemovePrefix().
+ *
+ * @param lpszValue
+ *        text after prefix; may be empty
+ *
+ * @return false if invalid; caller of Win32ArgvRemovePrefix() usually prints error here
+ */
+typedef bool (*Win32ArgvValueFunc)(_In_    const wchar_t *lpszValue,
+                                   _Inout_ void          *lpContext);
+
+/**
+ * Remove each command-line arg that starts with lpszPrefix.  Other args keep their order.  Same as C runtime, on return,
+ * lppArgvWCharArr[*lpArgc] is NULL.
+ * Each value is passed to lpfnValue, left to right.  After first invalid value, remaining args are still removed, but
+ * not passed to lpfnValue.
+ * Ex: Win32ArgvRemovePrefix(&__argc, __wargv, L"--log-level=", StaticLogLevelArgThenSet, stderr)
+ *
+ * @param lpArgc
+ *        on return, decremented for each removed arg
+ *
+ * @param lppArgvWCharArr
+ *        on return, args after each removed arg are moved left
+ *        Intentional: First arg, i.e., path to executable, is never removed.
+ *
+ * @param lpContext
+ *        passed to each lpfnValue call; may be NULL
+ *
+ * @return true if each value is valid, including if none
+ */
+bool
+Win32ArgvRemovePrefix(_Inout_ int                *lpArgc,
+                      _Inout_ wchar_t           **lppArgvWCharArr,
+                      _In_    const wchar_t      *lpszPrefix,
+                      _In_    Win32ArgvValueFunc  lpfnValue,
+                      _Inout_ void               *lpContext);
+
 #endif  // H_COMMON_WIN32
 
@@ -69,7 +69,7 @@ Win32DPIGet(_Inout_ struct Win32DPI *lpDpi,
 
     if (dpiAwareness != lpDpi->dpiAwareness || dpi != lpDpi->dpi)
     {
-        DEBUG_LOGWF(stdout, L"INFO: Win32DPIGet: DPI_AWARENESS dpiAwareness: %d/%ls->%d/%ls, UINT dpi: %u->%u\r\n",
+        DEBUG_LOGWF(stdout, L"DEBUG: Win32DPIGet: DPI_AWARENESS dpiAwareness: %d/%ls->%d/%ls, UINT dpi: %u->%u\r\n",
                     lpDpi->dpiAwareness, WIN32_DPI_AWARENESS_TO_WCHAR_ARR(lpDpi->dpiAwareness),
                     dpiAwareness, WIN32_DPI_AWARENESS_TO_WCHAR_ARR(dpiAwareness),
                     *lpDpi, dpi);
@@ -128,7 +128,8 @@ StaticFileAttrVisitAppend(__attribute__ ((unused))
     WStrCopyWCharArr(&fileAttrWStr, lpFileAttrWCharArr, wcslen(lpFileAttrWCharArr));
 
     struct WStr *lpWStr = appendData->lpWStrArr->lpWStrArr + appendData->ulNextIndex;
-    *lpWStr = fileAttrWStr;
+    // Intentional: Do not assign.  Why?  fileAttrWStr may be small (stored inline).
+    WStrMove(lpWStr, &fileAttrWStr);
     ++(appendData->ulNextIndex);
 
     return VISIT_NEXT_YES;
@@ -3,24 +3,27 @@
 #include <assert.h>  // required for assert
 #include <stdlib.h>  // required for assert on MinGW
 
+// Ref: https://github.com/dotnet/runtime/blob/3b63eb1346f1ddbc921374a5108d025662fb5ffd/src/coreclr/utilcode/posterror.cpp#L113
+#define WIN32_NEW_LINE_LEN 2
+#define WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN (512 + WIN32_NEW_LINE_LEN)
+
 /**
  * @param lpWStr
+ *        must be WSTR_ALLOC_STACK with capacity WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN
  *        Ex: {@code "Path not found"}
- *        Ownership of lpWStr->lpWCharArr is not passed to caller.
  */
 static bool
-StaticGetErrorMessageW(_In_  const DWORD  dwLastError,
-                       _Out_ struct WStr *lpWStr,
-                       _Out_ FILE        *lpErrorStream)
+StaticGetErrorMessageW(_In_    const DWORD  dwLastError,
+                       _Inout_ struct WStr *lpWStr,
+                       _Out_   FILE        *lpErrorStream)
 {
-    assert(NULL != lpWStr);
+    WStrAssertValid(lpWStr);
+    assert(WSTR_ALLOC_STACK == lpWStr->eAlloc);
+    assert(WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN == lpWStr->ulStackCapacity);
     assert(NULL != lpErrorStream);
 
-    // Ref: https://github.com/dotnet/runtime/blob/3b63eb1346f1ddbc921374a5108d025662fb5ffd/src/coreclr/utilcode/posterror.cpp#L113
-    #define WIN32_NEW_LINE_LEN 2
-    #define LP_BUFFER_WCHAR_ARR_LEN (512 + WIN32_NEW_LINE_LEN)
-    // TODO: Consider thread-local storage: https://learn.microsoft.com/en-us/windows/win32/procthread/thread-local-storage
-    static wchar_t lpBufferWCharArr[LP_BUFFER_WCHAR_ARR_LEN] = {0};
+    // Intentional: Caller's stack buffer, not static buffer.  Why?  Thread-safe and no heap alloc.
+    wchar_t *lpBufferWCharArr = lpWStr->lpWCharArr;
     // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winnt/nf-winnt-makelangid
     // "User default language"
     const DWORD dwLanguageId = MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT);
@@ -32,13 +35,14 @@ StaticGetErrorMessageW(_In_  const DWORD  dwLastError,
                        dwLastError,                      // [in] DWORD dwMessageId
                        dwLanguageId,                     // [in] DWORD dwLanguageId
                        lpBufferWCharArr,                 // [out] LPWSTR lpBuffer
-                       LP_BUFFER_WCHAR_ARR_LEN,          // [in] DWORD nSize
+                       WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN,  // [in] DWORD nSize
                        NULL);                            // [in, optional] va_list *Arguments
 
     // "If the function fails, the return value is zero. To get extended error information, call GetLastError."
     if (0 == dwStrLen)
     {
         LogWF(lpErrorStream, L"ERROR: 0 == FormatMessageW(dwFlags:FORMAT_MESSAGE_ALLOCATE_BUFFER, dwMessageId:%u...)\r\n", dwLastError);
+        lpBufferWCharArr[0] = L'\0';
         return false;
     }
 
@@ -58,7 +62,6 @@ StaticGetErrorMessageW(_In_  const DWORD  dwLastError,
         lpBufferWCharArr[dwStrLen] = 0;
     }
 
-    lpWStr->lpWCharArr = lpBufferWCharArr;
     lpWStr->ulSize = dwStrLen;
     return true;
 }
@@ -80,7 +83,9 @@ Win32LastErrorGetWStr2(_In_  const DWORD  dwLastError,
                        _Out_ struct WStr *lpWStr,
                        _Out_ FILE        *lpErrorStream)
 {
+    wchar_t lpMessageWCharArr[WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN];
     struct WStr wstr = {0};
+    WStrInitStackBuffer(&wstr, lpMessageWCharArr, WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN);
     if (false == StaticGetErrorMessageW(dwLastError,     // _In_  const DWORD  dwLastError
                                         &wstr,           // _Out_ struct WStr *lpWStr
                                         lpErrorStream))  // _Out_ FILE        *lpErrorStream
@@ -118,7 +123,9 @@ Win32LastErrorFPutW2(_In_  FILE *lpStream,
 
     // Ref: https://learn.microsoft.com/en-us/windows/win32/api/errhandlingapi/nf-errhandlingapi-getlasterror
     const DWORD dwLastError = GetLastError();
+    wchar_t lpMessageWCharArr[WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN];
     struct WStr wstr = {0};
+    WStrInitStackBuffer(&wstr, lpMessageWCharArr, WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN);
     if (false == StaticGetErrorMessageW(dwLastError,     // _In_  const DWORD  dwLastError
                                         &wstr,           // _Out_ struct WStr *lpWStr
                                         lpErrorStream))  // _Out_ FILE        *lpErrorStream
@@ -164,7 +171,9 @@ Win32LastErrorFPutWS2(_In_  FILE          *lpStream,
 
     // Ref: https://learn.microsoft.com/en-us/windows/win32/api/errhandlingapi/nf-errhandlingapi-getlasterror
     const DWORD dwLastError = GetLastError();
+    wchar_t lpMessageWCharArr[WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN];
     struct WStr wstr = {0};
+    WStrInitStackBuffer(&wstr, lpMessageWCharArr, WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN);
     if (false == StaticGetErrorMessageW(dwLastError,     // _In_  const DWORD  dwLastError
                                         &wstr,           // _Out_ struct WStr *lpWStr
                                         lpErrorStream))  // _Out_ FILE        *lpErrorStream
@@ -270,7 +279,9 @@ Win32LastErrorFPrintFWV2(_In_  FILE          *lpStream,
     // Ref: https://learn.microsoft.com/en-us/windows/win32/api/errhandlingapi/nf-errhandlingapi-getlasterror
     const DWORD dwLastError = GetLastError();
 
+    wchar_t lpMessageWCharArr[WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN];
     struct WStr wstr = {0};
+    WStrInitStackBuffer(&wstr, lpMessageWCharArr, WIN32_LAST_ERROR_BUFFER_WCHAR_ARR_LEN);
     if (false == StaticGetErrorMessageW(dwLastError,     // _In_  const DWORD  dwLastError
                                         &wstr,           // _Out_ struct WStr *lpWStr
                                         lpErrorStream))  // _Out_ FILE        *lpErrorStream
@@ -278,35 +289,44 @@ Win32LastErrorFPrintFWV2(_In_  FILE          *lpStream,
         return false;
     }
 
-    // Print prefix, e.g., "2023-01-31 00:51:45.064 +09:00 ERROR: "
-    LogW(lpStream, L"ERROR: ");
+    // Intentional: Format complete message in stack buffer, then log once.  Why?  Previously, prefix, message, and
+    // error text were three separate stream writes.
+    wchar_t lpBufferWCharArr[512];
+    struct WStrBuilder sb = {0};
+    WStrBuilderInitBuffer(&sb, lpBufferWCharArr, sizeof(lpBufferWCharArr) / sizeof(lpBufferWCharArr[0]));
 
-    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
-    va_list ap_copy;
-    va_copy(ap_copy, ap);
-    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/vfprintf-vfprintf-l-vfwprintf-vfwprintf-l?view=msvc-170
-    // "If execution is allowed to continue, the functions return -1 and set errno to EINVAL."
-    const int strlen = vfwprintf(lpStream, lpMessageFormat, ap_copy);
-    va_end(ap_copy);
-
-    if (-1 == strlen)
+    const struct WStr errorWStr = WSTR_FROM_LITERAL(L"ERROR: ");
+    WStrBuilderAppendWStr(&sb, &errorWStr);
+    const size_t ulPrefixSize = sb.ulSize;
+
+    // Intentional: Do not call WStrBuilderAppendFV2().  Why?  On error, it will call this function: infinite recursion.
+    // Ref: https://en.cppreference.com/w/c/io/vfwprintf
+    // "If an encoding error occurred or if n is too large, a negative value is returned."
+    if (false == WStrBuilderTryAppendFV(&sb, lpMessageFormat, ap))
     {
         // Ref: https://en.cppreference.com/w/c/error/errno
         // "errno is a preprocessor macro (but see note below) that expands to a thread-local (since C11) modifiable lvalue of type int."
         const int last_errno = errno;
+        WStrBuilderFree(&sb);
         // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/strerror-strerror-wcserror-wcserror?view=msvc-170
         const wchar_t *lpErrorWCharArr = _wcserror(last_errno);
         LogWF(lpErrorStream, L"Errno:%d: %ls\r\n", last_errno, lpErrorWCharArr);
         return false;
     }
 
-    if (strlen > 0)
+    if (sb.ulSize > ulPrefixSize)
     {
-        fputws(L": ", lpStream);
+        const struct WStr colonWStr = WSTR_FROM_LITERAL(L": ");
+        WStrBuilderAppendWStr(&sb, &colonWStr);
     }
 
-    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fprintf-fprintf-l-fwprintf-fwprintf-l?view=msvc-170
-    fwprintf(lpStream, L"LastError:%u/0x%X: %ls\r\n", dwLastError, dwLastError, wstr.lpWCharArr);
+    __attribute__((unused))
+    const bool b = WStrBuilderTryAppendF(&sb, L"LastError:%u/0x%X: %ls\r\n", dwLastError, dwLastError, wstr.lpWCharArr);
+    // Intentional: Only integers and a valid wide string: Cannot fail.
+    assert(b);
+
+    // Ex: "2023-01-31 00:51:45.064 +09:00 ERROR: Failed to open file: LastError:3/0x3: Path not found\r\n"
+    LogW(lpStream, sb.lpWCharArr);
+    WStrBuilderFree(&sb);
     return true;
 }
-
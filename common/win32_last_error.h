@@ -21,6 +21,7 @@ Win32LastErrorGetWStr(_In_    const DWORD  dwLastError,
  * @param lpWStr
  *        output: pointer to error message
  *        ownership is transferred to caller for lpWStr->lpWCharArr
+ *        if WSTR_ALLOC_STACK and message fits, no heap alloc.  See: WStrInitStackBuffer()
  *
  * @param lpErrorStream
  *        stream to print errors
@@ -1,4 +1,5 @@
 #include "win32_shortcut_key.h"
+#include "wstr_hash_map.h"
 #include <assert.h>  // required for assert
 #include <stdlib.h>  // required for assert on MinGW
 
@@ -60,20 +61,22 @@ Win32ShortcutKeyTryParseWStr(_In_  const struct WStr  *lpShortcutKeyWStr,
 
     const struct WStr delimWStr = WSTR_FROM_LITERAL(L"+");
 
-    const struct WStrSplitOptions splitOptions = {
-        .iMinTokenCount             = UNLIMITED_MIN_TOKEN_COUNT,
-        .iMaxTokenCount             = UNLIMITED_MAX_TOKEN_COUNT,
-        .fpNullableWStrConsumerFunc = WStrTrimSpace,
+    const struct WStrViewSplitOptions splitOptions = {
+        .iMinTokenCount                 = UNLIMITED_MIN_TOKEN_COUNT,
+        .iMaxTokenCount                 = UNLIMITED_MAX_TOKEN_COUNT,
+        .fpNullableWStrViewConsumerFunc = WStrViewTrimSpace,
     };
 
     // Ex: "0x50" -> ["0x50"], "Ctrl+Shift+Alt+0x50" -> ["Ctrl", "Shift", "Alt", "0x50"]
+    // Intentional: Arena mode.  Why?  All tokens in one allocation, and each token is terminated with '\0'.
     struct WStrArr tokenWStrArr = {};
-    WStrSplit(lpShortcutKeyWStr, &delimWStr, &splitOptions, &tokenWStrArr);
+    WStrSplitArena(lpShortcutKeyWStr, &delimWStr, &splitOptions, &tokenWStrArr);
 
     if (1 == tokenWStrArr.ulSize)
     {
         WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Zero key modifiers found, e.g., [%ls+]",
                     lpShortcutKeyWStr->lpWCharArr, WIN32_KM_CTRL_LEFT_WSTR.lpWCharArr);
+        WStrArrFree(&tokenWStrArr);
         return FALSE;
     }
 
@@ -87,6 +90,7 @@ Win32ShortcutKeyTryParseWStr(_In_  const struct WStr  *lpShortcutKeyWStr,
         if (FALSE == Win32ShortcutKeyTryParseModifiers(lpTokenWStr, lpShortcutKeyWStr, &eKeyModifiers, lpErrorWStr))
         {
             // lpErrorWStr is set
+            WStrArrFree(&tokenWStrArr);
             return FALSE;
         }
     }
@@ -104,6 +108,7 @@ Win32ShortcutKeyTryParseWStr(_In_  const struct WStr  *lpShortcutKeyWStr,
     {
         WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Failed to parse virtual key code [%ls]: Expected hexidecimal integer, e.g., 0x50",
                     lpShortcutKeyWStr->lpWCharArr, lpVkCodeWStr->lpWCharArr);
+        WStrArrFree(&tokenWStrArr);
         return FALSE;
     }
 
@@ -112,6 +117,7 @@ Win32ShortcutKeyTryParseWStr(_In_  const struct WStr  *lpShortcutKeyWStr,
     {
         WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Invalid virtual key code [%ls]->0x%X: Min: 0x01, Max: 0xFE",
                     lpShortcutKeyWStr->lpWCharArr, lpVkCodeWStr->lpWCharArr, signedVkCode);
+        WStrArrFree(&tokenWStrArr);
         return FALSE;
     }
 
@@ -122,27 +128,57 @@ Win32ShortcutKeyTryParseWStr(_In_  const struct WStr  *lpShortcutKeyWStr,
     return TRUE;
 }
 
-static BOOL
-Win32ShortcutKeyTryParseModifiers0(_In_  const struct WStr            *lpExpectedTokenWStr,  // Ex: L"LShift"
-                                   _In_  const enum EWin32KeyModifier  eKeyModifier,         // Ex: WIN32_KM_SHIFT_LEFT
-                                   _In_  const struct WStr            *lpTokenWStr,          // Ex: L"LShift"
-                                   _In_  const struct WStr            *lpShortcutKeyWStr,    // Ex: L"LCtrl+LShift+LAlt+0x70"
-                                   _Out_ enum EWin32KeyModifier       *peKeyModifiers,
-                                   _Out_ struct WStr                  *lpErrorWStr)
+static const struct WStr WIN32_KM_SHIFT_WSTR = WSTR_FROM_LITERAL(L"Shift");
+static const struct WStr WIN32_KM_CTRL_WSTR  = WSTR_FROM_LITERAL(L"Ctrl");
+static const struct WStr WIN32_KM_ALT_WSTR   = WSTR_FROM_LITERAL(L"Alt");
+
+struct Win32KeyModifierName
+{
+    // Ex: L"LShift"
+    const struct WStr            *lpNameWStr;
+    // Zero if generic modifier is not supported, e.g., L"Shift"
+    const enum EWin32KeyModifier  eKeyModifier;
+    // @Nullable
+    // Only set if (0 == eKeyModifier).  Ex: L"LShift" and L"RShift"
+    const struct WStr            *lpNullableLeftWStr;
+    const struct WStr            *lpNullableRightWStr;
+};
+
+static const struct Win32KeyModifierName WIN32_KEY_MODIFIER_NAME_ARR[] =
+{
+    { &WIN32_KM_SHIFT_LEFT_WSTR , WIN32_KM_SHIFT_LEFT , NULL, NULL },
+    { &WIN32_KM_SHIFT_RIGHT_WSTR, WIN32_KM_SHIFT_RIGHT, NULL, NULL },
+    { &WIN32_KM_CTRL_LEFT_WSTR  , WIN32_KM_CTRL_LEFT  , NULL, NULL },
+    { &WIN32_KM_CTRL_RIGHT_WSTR , WIN32_KM_CTRL_RIGHT , NULL, NULL },
+    { &WIN32_KM_ALT_LEFT_WSTR   , WIN32_KM_ALT_LEFT   , NULL, NULL },
+    { &WIN32_KM_ALT_RIGHT_WSTR  , WIN32_KM_ALT_RIGHT  , NULL, NULL },
+    // Intentional: Generic "shift" is not supported, only "lshift" or "rshift" is supported.
+    { &WIN32_KM_SHIFT_WSTR      , 0, &WIN32_KM_SHIFT_LEFT_WSTR, &WIN32_KM_SHIFT_RIGHT_WSTR },
+    // Intentional: Generic "ctrl" is not supported, only "lctrl" or "rctrl" is supported.
+    { &WIN32_KM_CTRL_WSTR       , 0, &WIN32_KM_CTRL_LEFT_WSTR , &WIN32_KM_CTRL_RIGHT_WSTR  },
+    // Intentional: Generic "alt" is not supported, only "lalt" or "ralt" is supported.
+    { &WIN32_KM_ALT_WSTR        , 0, &WIN32_KM_ALT_LEFT_WSTR  , &WIN32_KM_ALT_RIGHT_WSTR   },
+};
+
+/**
+ * @return case-insensitive map: modifier name -> const struct Win32KeyModifierName *
+ */
+static const struct WStrHashMap *
+StaticGetKeyModifierNameMap()
 {
-    // Intentional: Case-insensitive comparison
-    if (0 == _wcsicmp(lpExpectedTokenWStr->lpWCharArr, lpTokenWStr->lpWCharArr))
+    // Intentional: Build once, never free.  Why?  Every shortcut key token is one lookup, not one compare per name.
+    static struct WStrHashMap map = {.bIgnoreCase = true};
+    if (0 == map.ulSize)
     {
-        if (0 != (eKeyModifier & *peKeyModifiers))
+        const size_t ulCount = sizeof(WIN32_KEY_MODIFIER_NAME_ARR) / sizeof(WIN32_KEY_MODIFIER_NAME_ARR[0]);
+        for (size_t i = 0; i < ulCount; ++i)
         {
-            WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Multiple %ls modifiers are not allowed",
-                        lpShortcutKeyWStr->lpWCharArr, lpExpectedTokenWStr->lpWCharArr);
-            return FALSE;
+            const struct Win32KeyModifierName *lpName = WIN32_KEY_MODIFIER_NAME_ARR + i;
+            const bool bIsNew = WStrHashMapInsert(&map, lpName->lpNameWStr->lpWCharArr, lpName->lpNameWStr->ulSize, (void *) lpName);
+            assert(bIsNew);
         }
-        *peKeyModifiers |= eKeyModifier;
-        return TRUE;
     }
-    return FALSE;
+    return &map;
 }
 
 BOOL
@@ -156,47 +192,29 @@ Win32ShortcutKeyTryParseModifiers(_In_  const struct WStr      *lpTokenWStr,
     assert(NULL != peKeyModifiers);
     WStrAssertValid(lpErrorWStr);
 
-    // Intentional: Generic "shift" is not supported, only "lshift" or "rshift" is supported.
-    if (0 == _wcsicmp(L"Shift", lpTokenWStr->lpWCharArr))
+    void *lpNullableValue = NULL;
+    if (!WStrHashMapFind(StaticGetKeyModifierNameMap(), lpTokenWStr->lpWCharArr, lpTokenWStr->ulSize, &lpNullableValue))
     {
-        WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Shortcut key modifier [%ls] is not supported: Please use [%ls] or [%ls]",
-                    lpShortcutKeyWStr->lpWCharArr, lpTokenWStr->lpWCharArr, WIN32_KM_SHIFT_LEFT_WSTR.lpWCharArr, WIN32_KM_SHIFT_RIGHT_WSTR.lpWCharArr);
+        WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Unknown modifier: [%ls]",
+                    lpShortcutKeyWStr->lpWCharArr, lpTokenWStr->lpWCharArr);
         return FALSE;
     }
 
-    // Intentional: Generic "ctrl" is not supported, only "lctrl" or "rctrl" is supported.
-    if (0 == _wcsicmp(L"Ctrl", lpTokenWStr->lpWCharArr))
+    const struct Win32KeyModifierName *lpName = lpNullableValue;
+    if (0 == lpName->eKeyModifier)
     {
         WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Shortcut key modifier [%ls] is not supported: Please use [%ls] or [%ls]",
-                    lpShortcutKeyWStr->lpWCharArr, lpTokenWStr->lpWCharArr, WIN32_KM_CTRL_LEFT_WSTR.lpWCharArr, WIN32_KM_CTRL_RIGHT_WSTR.lpWCharArr);
+                    lpShortcutKeyWStr->lpWCharArr, lpTokenWStr->lpWCharArr,
+                    lpName->lpNullableLeftWStr->lpWCharArr, lpName->lpNullableRightWStr->lpWCharArr);
         return FALSE;
     }
 
-    // Intentional: Generic "alt" is not supported, only "lalt" or "ralt" is supported.
-    if (0 == _wcsicmp(L"Alt", lpTokenWStr->lpWCharArr))
+    if (0 != (lpName->eKeyModifier & *peKeyModifiers))
     {
-        WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Shortcut key modifier [%ls] is not supported: Please use [%ls] or [%ls]",
-                    lpShortcutKeyWStr->lpWCharArr, lpTokenWStr->lpWCharArr, WIN32_KM_ALT_LEFT_WSTR.lpWCharArr, WIN32_KM_ALT_RIGHT_WSTR.lpWCharArr);
-        return FALSE;
-    }
-
-    // Technical note: Win32ShortcutKeyTryParseModifiers0() can fail multiple times and set lpErrorWStr.
-    // Subsequent failures will free lpErrorWStr, then set again with new error message.
-    // Only the last error will be set in lpErrorWStr.  This is good enough for our needs.
-    if (!Win32ShortcutKeyTryParseModifiers0(&WIN32_KM_SHIFT_LEFT_WSTR , WIN32_KM_SHIFT_LEFT , lpTokenWStr, lpShortcutKeyWStr, peKeyModifiers, lpErrorWStr)
-    &&  !Win32ShortcutKeyTryParseModifiers0(&WIN32_KM_SHIFT_RIGHT_WSTR, WIN32_KM_SHIFT_RIGHT, lpTokenWStr, lpShortcutKeyWStr, peKeyModifiers, lpErrorWStr)
-    &&  !Win32ShortcutKeyTryParseModifiers0(&WIN32_KM_CTRL_LEFT_WSTR  , WIN32_KM_CTRL_LEFT  , lpTokenWStr, lpShortcutKeyWStr, peKeyModifiers, lpErrorWStr)
-    &&  !Win32ShortcutKeyTryParseModifiers0(&WIN32_KM_CTRL_RIGHT_WSTR , WIN32_KM_CTRL_RIGHT , lpTokenWStr, lpShortcutKeyWStr, peKeyModifiers, lpErrorWStr)
-    &&  !Win32ShortcutKeyTryParseModifiers0(&WIN32_KM_ALT_LEFT_WSTR   , WIN32_KM_ALT_LEFT   , lpTokenWStr, lpShortcutKeyWStr, peKeyModifiers, lpErrorWStr)
-    &&  !Win32ShortcutKeyTryParseModifiers0(&WIN32_KM_ALT_RIGHT_WSTR  , WIN32_KM_ALT_RIGHT  , lpTokenWStr, lpShortcutKeyWStr, peKeyModifiers, lpErrorWStr))
-    {
-        if (0 == lpErrorWStr->ulSize)
-        {
-            WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Unknown modifier: [%ls]",
-                        lpShortcutKeyWStr->lpWCharArr, lpTokenWStr->lpWCharArr);
-        }
+        WStrSPrintF(lpErrorWStr, L"Failed to parse shortcut key [%ls]: Multiple %ls modifiers are not allowed",
+                    lpShortcutKeyWStr->lpWCharArr, lpName->lpNameWStr->lpWCharArr);
         return FALSE;
     }
+    *peKeyModifiers |= lpName->eKeyModifier;
     return TRUE;
 }
-
@@ -47,6 +47,7 @@ struct Win32ShortcutKey
  *
  * @param lpErrorWStr
  *        output value -- only set if return result is FALSE
+ *        may be WSTR_ALLOC_STACK: If message fits, no heap alloc.  See: WStrInitStackBuffer()
  *        Ex: L"Failed to parse shortcut key [Ctrl+Shift+Alt+0x70]: Shortcut key modifier [Shift] is not supported: Please use [LShift] or [RShift]"
  *
  * @return TRUE on success
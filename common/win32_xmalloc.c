@@ -3,6 +3,15 @@
 #include <assert.h>  // required for assert
 #include <stdlib.h>  // required for assert on MinGW
 #include <windows.h>
+#include <stdbool.h>  // required for bool
+
+#ifdef XMALLOC_STATS
+// Intentional: Undefine macros from xmalloc.h.  Why?  Below, these names are the real functions.
+#undef xcalloc
+#undef xmalloc
+#undef xrealloc
+#undef xfree
+#endif  // XMALLOC_STATS
 
 static HANDLE
 StaticGetProcessHeap()
@@ -17,6 +26,69 @@ StaticGetProcessHeap()
     return hProcessHeap;
 }
 
+static enum EXMallocHeap eXMallocHeap = XMALLOC_HEAP_PROCESS;
+// @Nullable: NULL until first allocation or XMallocInit()
+// Intentional: Race to init process heap is harmless: every thread writes the same value.
+static HANDLE hXMallocHeap = NULL;
+// Only used by XMALLOC_HEAP_PRIVATE_NO_SERIALIZE
+static DWORD dwXMallocHeapThreadId = 0;
+
+static HANDLE
+StaticGetHeap()
+{
+    if (NULL == hXMallocHeap)
+    {
+        hXMallocHeap = StaticGetProcessHeap();
+    }
+    // Important: HEAP_NO_SERIALIZE is not thread-safe.  In debug builds, catch calls from other threads.
+    assert(XMALLOC_HEAP_PROCESS == eXMallocHeap || GetCurrentThreadId() == dwXMallocHeapThreadId);
+    return hXMallocHeap;
+}
+
+void
+XMallocInit(_In_ const enum EXMallocHeap eHeap)
+{
+    if (XMALLOC_HEAP_PRIVATE_NO_SERIALIZE == eXMallocHeap && NULL != hXMallocHeap)
+    {
+        // Ref: https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapdestroy
+        if (!HeapDestroy(hXMallocHeap))  // [in] HANDLE hHeap
+        {
+            Win32LastErrorFPrintFWAbort(stderr,                           // _In_ FILE          *lpStream
+                                        L"HeapDestroy(hXMallocHeap:%p)",  // _In_ const wchar_t *lpMessageFormat
+                                        hXMallocHeap);                    // ...
+        }
+    }
+
+    switch (eHeap)
+    {
+        case XMALLOC_HEAP_PROCESS:
+        {
+            hXMallocHeap = StaticGetProcessHeap();
+            break;
+        }
+        case XMALLOC_HEAP_PRIVATE_NO_SERIALIZE:
+        {
+            // Ref: https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapcreate
+            hXMallocHeap = HeapCreate(HEAP_NO_SERIALIZE | HEAP_GENERATE_EXCEPTIONS,  // [in] DWORD  flOptions
+                                      0,                                             // [in] SIZE_T dwInitialSize
+                                      0);                                            // [in] SIZE_T dwMaximumSize: growable
+            if (NULL == hXMallocHeap)
+            {
+                Win32LastErrorFPutWSAbort(stderr,                                               // _In_ FILE          *lpStream
+                                          L"HeapCreate(HEAP_NO_SERIALIZE | HEAP_GENERATE_EXCEPTIONS, 0, 0)");  // _In_ const wchar_t *lpMessage
+            }
+            dwXMallocHeapThreadId = GetCurrentThreadId();
+            break;
+        }
+        default:
+        {
+            fprintf(stderr, "Internal error: XMallocInit(eHeap:%d): Unknown value\n", (int) eHeap);
+            abort();
+        }
+    }
+    eXMallocHeap = eHeap;
+}
+
 void *
 xcalloc(_In_ const size_t ulNumItem,
         _In_ const size_t ulSizeOfEachItem)
@@ -24,15 +96,29 @@ xcalloc(_In_ const size_t ulNumItem,
     assert(ulNumItem > 0);
     assert(ulSizeOfEachItem > 0);
 
-    const HANDLE hProcessHeap = StaticGetProcessHeap();
+    const HANDLE hHeap = StaticGetHeap();
 
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
-    void *lpData = HeapAlloc(hProcessHeap,                                 // [in] HANDLE hHeap
+    void *lpData = HeapAlloc(hHeap,                                        // [in] HANDLE hHeap
                              HEAP_GENERATE_EXCEPTIONS | HEAP_ZERO_MEMORY,  // [in] DWORD  dwFlags
                              ulNumItem * ulSizeOfEachItem);                // [in] SIZE_T dwBytes
     return lpData;
 }
 
+void *
+xmalloc(_In_ const size_t ulByteSize)
+{
+    assert(ulByteSize > 0);
+
+    const HANDLE hHeap = StaticGetHeap();
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+    void *lpData = HeapAlloc(hHeap,                     // [in] HANDLE hHeap
+                             HEAP_GENERATE_EXCEPTIONS,  // [in] DWORD  dwFlags
+                             ulByteSize);               // [in] SIZE_T dwBytes
+    return lpData;
+}
+
 void
 xrealloc(_Inout_ void         **lppData,
          _In_    const size_t   ulNewDataSize)
@@ -41,10 +127,10 @@ xrealloc(_Inout_ void         **lppData,
     assert(NULL != *lppData);
     assert(ulNewDataSize > 0);
 
-    const HANDLE hProcessHeap = StaticGetProcessHeap();
+    const HANDLE hHeap = StaticGetHeap();
 
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heaprealloc
-    void *lpData = HeapReAlloc(hProcessHeap,
+    void *lpData = HeapReAlloc(hHeap,
                                HEAP_GENERATE_EXCEPTIONS | HEAP_ZERO_MEMORY,
                                *lppData,
                                ulNewDataSize);
@@ -58,16 +144,302 @@ xfree(_Inout_ void **lppData)
 
     if (NULL != *lppData)
     {
-        const HANDLE hProcessHeap = StaticGetProcessHeap();
+        const HANDLE hHeap = StaticGetHeap();
 
         // Ref: https://docs.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
-        if (!HeapFree(hProcessHeap, 0, *lppData))
+        if (!HeapFree(hHeap, 0, *lppData))
         {
-            Win32LastErrorFPrintFWAbort(stderr,                            // _In_ FILE          *lpStream
-                                        L"HeapFree(hProcessHeap:%p, 0, *lppData:%p/%p)",  // _In_ const wchar_t *lpMessageFormat
-                                        hProcessHeap, lppData, *lppData);  // ...
+            Win32LastErrorFPrintFWAbort(stderr,                     // _In_ FILE          *lpStream
+                                        L"HeapFree(hHeap:%p, 0, *lppData:%p/%p)",  // _In_ const wchar_t *lpMessageFormat
+                                        hHeap, lppData, *lppData);  // ...
         }
         *lppData = NULL;
     }
 }
 
+#ifdef XMALLOC_STATS
+
+// Intentional: Fixed capacity; no allocation.  Why?  Instrumentation must never call xcalloc().
+// Power of two.  If full, remaining call sites are counted as one site: "(other)".
+#define XMALLOC_STATS_SITE_CAPACITY 4096U
+
+struct XMallocStatsSite
+{
+    // @Nullable: NULL if slot is empty
+    // Intentional: Compare pointer, not text.  Why?  __FILE__ is one literal per translation unit.
+    const char *lpszFile;
+    int         iLine;
+    size_t      ulCallocCount;
+    size_t      ulMallocCount;
+    size_t      ulReallocCount;
+    size_t      ulFreeCount;
+    // Sum of bytes from xcalloc(), xmalloc(), and xrealloc() at this call site
+    size_t      ulByteSize;
+};
+
+// Important: Only read or write while lock is held.
+static SRWLOCK xmallocStatsLock = SRWLOCK_INIT;
+static struct XMallocStats xmallocStats = {0};
+static struct XMallocStatsSite xmallocStatsSiteArr[XMALLOC_STATS_SITE_CAPACITY] = {0};
+static struct XMallocStatsSite xmallocStatsOtherSite = {.lpszFile = "(other)"};
+static bool bIsXMallocStatsAtExitRegistered = false;
+
+static void
+StaticStatsAtExit()
+{
+    XMallocStatsFPrint(stderr, "at exit");
+}
+
+/**
+ * Important: Lock must be held.
+ */
+static struct XMallocStatsSite *
+StaticStatsFindSite(_In_ const char *lpszFile,
+                    _In_ const int   iLine)
+{
+    if (false == bIsXMallocStatsAtExitRegistered)
+    {
+        bIsXMallocStatsAtExitRegistered = true;
+        atexit(StaticStatsAtExit);
+    }
+
+    const size_t ulMask = XMALLOC_STATS_SITE_CAPACITY - 1U;
+    // Ref: https://en.wikipedia.org/wiki/Hash_function#Fibonacci_hashing
+    const size_t ulHash = (((size_t) lpszFile) ^ ((size_t) iLine)) * (size_t) 0x9E3779B97F4A7C15ULL;
+    size_t ulIndex = (ulHash >> 20) & ulMask;
+    for (size_t i = 0; i < XMALLOC_STATS_SITE_CAPACITY; ++i)
+    {
+        struct XMallocStatsSite *lpSite = xmallocStatsSiteArr + ulIndex;
+        if (NULL == lpSite->lpszFile)
+        {
+            lpSite->lpszFile = lpszFile;
+            lpSite->iLine    = iLine;
+            return lpSite;
+        }
+        if (lpszFile == lpSite->lpszFile && iLine == lpSite->iLine) {
+            return lpSite;
+        }
+        ulIndex = (ulIndex + 1U) & ulMask;
+    }
+    return &xmallocStatsOtherSite;
+}
+
+static size_t
+StaticStatsGetHistogramIndex(_In_ const size_t ulByteSize)
+{
+    size_t x = 0;
+    size_t ulRemaining = ulByteSize;
+    while (ulRemaining > 1U && x + 1U < XMALLOC_STATS_HISTOGRAM_BUCKET_COUNT)
+    {
+        ulRemaining >>= 1;
+        ++x;
+    }
+    return x;
+}
+
+/**
+ * @return number of bytes in block from HeapAlloc() or HeapReAlloc()
+ */
+static size_t
+StaticStatsHeapSize(_In_ const void *lpData)
+{
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapsize
+    const SIZE_T x = HeapSize(StaticGetHeap(),  // [in] HANDLE  hHeap
+                              0,                // [in] DWORD   dwFlags
+                              lpData);          // [in] LPCVOID lpMem
+    if ((SIZE_T) -1 == x)
+    {
+        // "The function does not call SetLastError."
+        fprintf(stderr, "HeapSize(..., lpData:%p) failed\n", lpData);
+        abort();
+    }
+    return x;
+}
+
+/**
+ * Important: Lock must be held.
+ */
+static void
+StaticStatsAddAlloc(_Inout_ struct XMallocStatsSite *lpSite,
+                    _In_    const size_t             ulRequestByteSize,
+                    _In_    const size_t             ulOldLiveByteSize,
+                    _In_    const size_t             ulNewLiveByteSize)
+{
+    lpSite->ulByteSize += ulRequestByteSize;
+    xmallocStats.ulTotalByteSize += ulRequestByteSize;
+    ++(xmallocStats.ulHistogramArr[StaticStatsGetHistogramIndex(ulRequestByteSize)]);
+
+    xmallocStats.ulLiveByteSize -= ulOldLiveByteSize;
+    xmallocStats.ulLiveByteSize += ulNewLiveByteSize;
+    if (xmallocStats.ulLiveByteSize > xmallocStats.ulPeakByteSize) {
+        xmallocStats.ulPeakByteSize = xmallocStats.ulLiveByteSize;
+    }
+}
+
+void *
+XMallocStatsCalloc(_In_ const size_t  ulNumItem,
+                   _In_ const size_t  ulSizeOfEachItem,
+                   _In_ const char   *lpszFile,
+                   _In_ const int     iLine)
+{
+    void *lpData = xcalloc(ulNumItem, ulSizeOfEachItem);
+    const size_t ulLiveByteSize = StaticStatsHeapSize(lpData);
+
+    AcquireSRWLockExclusive(&xmallocStatsLock);
+    struct XMallocStatsSite *lpSite = StaticStatsFindSite(lpszFile, iLine);
+    ++(lpSite->ulCallocCount);
+    ++(xmallocStats.ulCallocCount);
+    StaticStatsAddAlloc(lpSite, ulNumItem * ulSizeOfEachItem, 0, ulLiveByteSize);
+    ReleaseSRWLockExclusive(&xmallocStatsLock);
+    return lpData;
+}
+
+void *
+XMallocStatsMalloc(_In_ const size_t  ulByteSize,
+                   _In_ const char   *lpszFile,
+                   _In_ const int     iLine)
+{
+    void *lpData = xmalloc(ulByteSize);
+    const size_t ulLiveByteSize = StaticStatsHeapSize(lpData);
+
+    AcquireSRWLockExclusive(&xmallocStatsLock);
+    struct XMallocStatsSite *lpSite = StaticStatsFindSite(lpszFile, iLine);
+    ++(lpSite->ulMallocCount);
+    ++(xmallocStats.ulMallocCount);
+    StaticStatsAddAlloc(lpSite, ulByteSize, 0, ulLiveByteSize);
+    ReleaseSRWLockExclusive(&xmallocStatsLock);
+    return lpData;
+}
+
+void
+XMallocStatsRealloc(_Inout_ void         **lppData,
+                    _In_    const size_t   ulNewDataSize,
+                    _In_    const char    *lpszFile,
+                    _In_    const int      iLine)
+{
+    assert(NULL != lppData);
+    assert(NULL != *lppData);
+
+    const size_t ulOldLiveByteSize = StaticStatsHeapSize(*lppData);
+    xrealloc(lppData, ulNewDataSize);
+    const size_t ulNewLiveByteSize = StaticStatsHeapSize(*lppData);
+
+    AcquireSRWLockExclusive(&xmallocStatsLock);
+    struct XMallocStatsSite *lpSite = StaticStatsFindSite(lpszFile, iLine);
+    ++(lpSite->ulReallocCount);
+    ++(xmallocStats.ulReallocCount);
+    StaticStatsAddAlloc(lpSite, ulNewDataSize, ulOldLiveByteSize, ulNewLiveByteSize);
+    ReleaseSRWLockExclusive(&xmallocStatsLock);
+}
+
+void
+XMallocStatsFree(_Inout_ void       **lppData,
+                 _In_    const char  *lpszFile,
+                 _In_    const int    iLine)
+{
+    assert(NULL != lppData);
+
+    // Intentional: xfree(NULL) is not counted.  Why?  No heap operation.
+    if (NULL == *lppData)
+    {
+        return;
+    }
+
+    const size_t ulLiveByteSize = StaticStatsHeapSize(*lppData);
+    xfree(lppData);
+
+    AcquireSRWLockExclusive(&xmallocStatsLock);
+    struct XMallocStatsSite *lpSite = StaticStatsFindSite(lpszFile, iLine);
+    ++(lpSite->ulFreeCount);
+    ++(xmallocStats.ulFreeCount);
+    xmallocStats.ulLiveByteSize -= ulLiveByteSize;
+    ReleaseSRWLockExclusive(&xmallocStatsLock);
+}
+
+void
+XMallocStatsGet(_Out_ struct XMallocStats *lpStats)
+{
+    assert(NULL != lpStats);
+
+    AcquireSRWLockShared(&xmallocStatsLock);
+    *lpStats = xmallocStats;
+    ReleaseSRWLockShared(&xmallocStatsLock);
+}
+
+static size_t
+StaticStatsSiteCallCount(_In_ const struct XMallocStatsSite *lpSite)
+{
+    const size_t x = lpSite->ulCallocCount + lpSite->ulMallocCount + lpSite->ulReallocCount + lpSite->ulFreeCount;
+    return x;
+}
+
+static int
+StaticStatsCompareSiteDesc(_In_ const void *lpLeft,
+                           _In_ const void *lpRight)
+{
+    const size_t left  = StaticStatsSiteCallCount((const struct XMallocStatsSite *) lpLeft);
+    const size_t right = StaticStatsSiteCallCount((const struct XMallocStatsSite *) lpRight);
+    return (left < right) - (left > right);
+}
+
+void
+XMallocStatsFPrint(_Inout_ FILE       *lpStream,
+                   _In_    const char *lpszLabel)
+{
+    assert(NULL != lpStream);
+    assert(NULL != lpszLabel);
+
+    // Intentional: Static copy.  Why?  Too large for stack, and instrumentation must never call xcalloc().
+    // Intentional: Keep lock while sorting and printing.  Why?  siteArr is shared by all callers.
+    static struct XMallocStatsSite siteArr[XMALLOC_STATS_SITE_CAPACITY + 1U];
+    size_t ulSiteCount = 0;
+    struct XMallocStats stats = {0};
+
+    AcquireSRWLockExclusive(&xmallocStatsLock);
+    stats = xmallocStats;
+    for (size_t i = 0; i < XMALLOC_STATS_SITE_CAPACITY; ++i)
+    {
+        if (NULL != xmallocStatsSiteArr[i].lpszFile) {
+            siteArr[ulSiteCount++] = xmallocStatsSiteArr[i];
+        }
+    }
+    if (StaticStatsSiteCallCount(&xmallocStatsOtherSite) > 0) {
+        siteArr[ulSiteCount++] = xmallocStatsOtherSite;
+    }
+    qsort(siteArr, ulSiteCount, sizeof(siteArr[0]), StaticStatsCompareSiteDesc);
+
+    fprintf(lpStream, "xmalloc stats: %s\n", lpszLabel);
+    fprintf(lpStream, "    calls: calloc %zu, malloc %zu, realloc %zu, free %zu\n",
+            stats.ulCallocCount, stats.ulMallocCount, stats.ulReallocCount, stats.ulFreeCount);
+    fprintf(lpStream, "    bytes: total %zu, live %zu, peak %zu\n",
+            stats.ulTotalByteSize, stats.ulLiveByteSize, stats.ulPeakByteSize);
+
+    fprintf(lpStream, "    size histogram (calloc + malloc + realloc):\n");
+    for (size_t i = 0; i < XMALLOC_STATS_HISTOGRAM_BUCKET_COUNT; ++i)
+    {
+        if (stats.ulHistogramArr[i] > 0)
+        {
+            // Intentional: Bucket 0 starts at zero.  Why?  It also counts 0-byte requests.  See: StaticStatsGetHistogramIndex()
+            const size_t ulMin = (0 == i) ? 0U : ((size_t) 1) << i;
+            if (i + 1U < XMALLOC_STATS_HISTOGRAM_BUCKET_COUNT) {
+                fprintf(lpStream, "        %12zu - %12zu bytes: %zu\n", ulMin, (((size_t) 2) << i) - 1U, stats.ulHistogramArr[i]);
+            }
+            else {
+                fprintf(lpStream, "        %12zu +              bytes: %zu\n", ulMin, stats.ulHistogramArr[i]);
+            }
+        }
+    }
+
+    fprintf(lpStream, "    call sites (%zu):\n", ulSiteCount);
+    for (size_t i = 0; i < ulSiteCount; ++i)
+    {
+        const struct XMallocStatsSite *lpSite = siteArr + i;
+        fprintf(lpStream, "        %s:%d: calloc %zu, malloc %zu, realloc %zu, free %zu, bytes %zu\n",
+                lpSite->lpszFile, lpSite->iLine, lpSite->ulCallocCount, lpSite->ulMallocCount, lpSite->ulReallocCount,
+                lpSite->ulFreeCount, lpSite->ulByteSize);
+    }
+    fflush(lpStream);
+    ReleaseSRWLockExclusive(&xmallocStatsLock);
+}
+
+#endif  // XMALLOC_STATS
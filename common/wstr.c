@@ -2,10 +2,16 @@
 #include "xmalloc.h"
 #include "log.h"
 #include "win32_last_error.h"
+#include "wstr_simd.h"
+#include "wstr_file_map.h"
+#include "wstr_file_writer.h"
 #include <assert.h>  // required for assert
 #include <stdlib.h>  // required for assert on MinGW
 #include <windows.h>
 #include <errno.h>
+#include <stddef.h>  // required for offsetof
+#include <stdint.h>  // required for uintptr_t, uint64_t
+#include <wctype.h>  // required for towlower
 
 void
 SafeWCharArrCopy(_Out_ wchar_t       *lpDestWCharArr,                // dest wstr ptr
@@ -32,10 +38,16 @@ void
 WStrAssertValid(_In_ const struct WStr *lpWStr)
 {
     assert(NULL != lpWStr);
+    assert(lpWStr->eAlloc >= WSTR_ALLOC_HEAP && lpWStr->eAlloc <= WSTR_ALLOC_ARENA);
     if (lpWStr->ulSize > 0)
     {
         assert(NULL != lpWStr->lpWCharArr);
     }
+    if (WSTR_ALLOC_STACK == lpWStr->eAlloc)
+    {
+        assert(NULL != lpWStr->lpWCharArr);
+        assert(lpWStr->ulSize < lpWStr->ulStackCapacity);
+    }
 }
 
 void
@@ -43,8 +55,135 @@ WStrFree(_Inout_ struct WStr *lpWStr)
 {
     WStrAssertValid(lpWStr);
 
-    xfree((void **) &(lpWStr->lpWCharArr));
-    lpWStr->ulSize = 0;  // Explicit
+    // Intentional: Only free heap buffer.  Why?  Literal, stack, and arena wchars are borrowed, never owned.
+    if (WSTR_ALLOC_HEAP == lpWStr->eAlloc && !WStrIsSmall(lpWStr))
+    {
+        xfree((void **) &(lpWStr->lpWCharArr));
+    }
+    *lpWStr = (struct WStr) {0};
+}
+
+void
+WStrInitStackBuffer(_Inout_ struct WStr  *lpWStr,
+                    _Inout_ wchar_t      *lpBufferWCharArr,
+                    _In_    const size_t  ulBufferWCharArrLen)
+{
+    assert(NULL != lpBufferWCharArr);
+    assert(ulBufferWCharArrLen >= LEN_NUL_CHAR);
+    WStrFree(lpWStr);
+
+    lpBufferWCharArr[0] = L'\0';
+    lpWStr->lpWCharArr      = lpBufferWCharArr;
+    lpWStr->ulSize          = 0;
+    lpWStr->ulStackCapacity = ulBufferWCharArrLen;
+    lpWStr->eAlloc          = WSTR_ALLOC_STACK;
+}
+
+bool
+WStrIsSmall(_In_ const struct WStr *lpWStr)
+{
+    assert(NULL != lpWStr);
+
+    const bool x = (lpWStr->smallWCharArr == lpWStr->lpWCharArr);
+    return x;
+}
+
+/**
+ * @return true if lpWStr is WSTR_ALLOC_STACK and ulSize wchars (plus final '\0' char) fit in stack buffer
+ */
+static bool
+StaticIsStackFit(_In_ const struct WStr *lpWStr,
+                 _In_ const size_t       ulSize)
+{
+    const bool x = (WSTR_ALLOC_STACK == lpWStr->eAlloc && ulSize < lpWStr->ulStackCapacity);
+    return x;
+}
+
+/**
+ * Copy into stack buffer.  Caller must check StaticIsStackFit().
+ * Intentional: wmemmove(), not wmemcpy().  Why?  lpSrcWCharArr may point into stack buffer, e.g., WStrTrim().
+ */
+static void
+StaticStackCopy(_Inout_ struct WStr   *lpDestWStr,
+                _In_    const wchar_t *lpSrcWCharArr,
+                _In_    const size_t   ulSrcSize)
+{
+    assert(StaticIsStackFit(lpDestWStr, ulSrcSize));
+
+    if (ulSrcSize > 0) {
+        wmemmove(lpDestWStr->lpWCharArr, lpSrcWCharArr, ulSrcSize);
+    }
+    lpDestWStr->lpWCharArr[ulSrcSize] = L'\0';
+    lpDestWStr->ulSize = ulSrcSize;
+}
+
+wchar_t *
+WStrAlloc(_Inout_ struct WStr  *lpWStr,
+          _In_    const size_t  ulSize)
+{
+    if (StaticIsStackFit(lpWStr, ulSize))
+    {
+        // Intentional: Zero all wchars to match xcalloc()
+        wmemset(lpWStr->lpWCharArr, L'\0', ulSize + LEN_NUL_CHAR);
+        lpWStr->ulSize = ulSize;
+        return lpWStr->lpWCharArr;
+    }
+
+    WStrFree(lpWStr);
+
+    lpWStr->ulSize = ulSize;
+    if (0 == ulSize) {
+        return NULL;
+    }
+
+    if (ulSize < WSTR_SMALL_CAPACITY)
+    {
+        // Intentional: Zero all wchars to match xcalloc()
+        wmemset(lpWStr->smallWCharArr, L'\0', WSTR_SMALL_CAPACITY);
+        lpWStr->lpWCharArr = lpWStr->smallWCharArr;
+    }
+    else
+    {
+        lpWStr->lpWCharArr = xcalloc(ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
+    }
+    return lpWStr->lpWCharArr;
+}
+
+void
+WStrMove(_Inout_ struct WStr *lpDestWStr,
+         _Inout_ struct WStr *lpSrcWStr)
+{
+    WStrAssertValid(lpSrcWStr);
+    assert(lpDestWStr != lpSrcWStr);
+
+    if (StaticIsStackFit(lpDestWStr, lpSrcWStr->ulSize))
+    {
+        // Intentional: Copy, not transfer.  Why?  Later writes to lpDestWStr continue to use stack buffer.
+        StaticStackCopy(lpDestWStr, lpSrcWStr->lpWCharArr, lpSrcWStr->ulSize);
+        WStrFree(lpSrcWStr);
+        return;
+    }
+
+    WStrFree(lpDestWStr);
+
+    if (WStrIsSmall(lpSrcWStr))
+    {
+        wmemcpy(lpDestWStr->smallWCharArr, lpSrcWStr->smallWCharArr, WSTR_SMALL_CAPACITY);
+        lpDestWStr->lpWCharArr = lpDestWStr->smallWCharArr;
+    }
+    else
+    {
+        lpDestWStr->lpWCharArr = lpSrcWStr->lpWCharArr;
+        if (WSTR_ALLOC_STACK == lpSrcWStr->eAlloc) {
+            lpDestWStr->ulStackCapacity = lpSrcWStr->ulStackCapacity;
+        }
+    }
+    lpDestWStr->ulSize = lpSrcWStr->ulSize;
+    lpDestWStr->eAlloc = lpSrcWStr->eAlloc;
+
+    lpSrcWStr->lpWCharArr = NULL;
+    lpSrcWStr->ulSize     = 0;
+    lpSrcWStr->eAlloc     = WSTR_ALLOC_HEAP;
 }
 
 BOOL
@@ -63,27 +202,72 @@ WStrCompare(_In_ const struct WStr *lpWStrLeft,
     WStrAssertValid(lpWStrLeft);
     WStrAssertValid(lpWStrRight);
 
-    const wchar_t *lpLeftWCharArr  = (0 == lpWStrLeft->ulSize ) ? L"" : lpWStrLeft->lpWCharArr;
-    const wchar_t *lpRightWCharArr = (0 == lpWStrRight->ulSize) ? L"" : lpWStrRight->lpWCharArr;
+    // Intentional: Do not use wcscmp().  Why?  Sizes are known, so compare with vectorised kernel.
+    const struct WStrView leftWStrView  = WSTR_VIEW_FROM_WSTR(lpWStrLeft);
+    const struct WStrView rightWStrView = WSTR_VIEW_FROM_WSTR(lpWStrRight);
 
-    const int cmp = wcscmp(lpLeftWCharArr, lpRightWCharArr);
+    const int cmp = WStrViewCompare(&leftWStrView, &rightWStrView);
     return cmp;
 }
 
+size_t
+WStrHashWCharArr(_In_ const wchar_t *lpWCharArr,
+                 _In_ const size_t   ulSize)
+{
+    assert(0 == ulSize || NULL != lpWCharArr);
+
+    // Intentional: Always 64-bit, then truncate.  Why?  Same constants for 32-bit and 64-bit builds.
+    uint64_t ullHash = 14695981039346656037ULL;  // FNV offset basis
+    for (size_t i = 0; i < ulSize; ++i)
+    {
+        ullHash ^= (uint64_t) lpWCharArr[i];
+        ullHash *= 1099511628211ULL;  // FNV prime
+    }
+    return (size_t) ullHash;
+}
+
+size_t
+WStrHashWCharArrI(_In_ const wchar_t *lpWCharArr,
+                  _In_ const size_t   ulSize)
+{
+    assert(0 == ulSize || NULL != lpWCharArr);
+
+    uint64_t ullHash = 14695981039346656037ULL;  // FNV offset basis
+    for (size_t i = 0; i < ulSize; ++i)
+    {
+        // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/tolower-tolower-towlower-tolower-l-towlower-l?view=msvc-170
+        ullHash ^= (uint64_t) towlower(lpWCharArr[i]);
+        ullHash *= 1099511628211ULL;  // FNV prime
+    }
+    return (size_t) ullHash;
+}
+
 static void
 WStrCopyWCharArr0(_Inout_ struct WStr   *lpDestWStr,
                   _In_    const wchar_t *lpSrcWCharArr,
                   _In_    const size_t   ulSrcSize)
 {
-    WStrFree(lpDestWStr);
     // Intentional: Allow (NULL == lpSrcWCharArr)
+    if (StaticIsStackFit(lpDestWStr, ulSrcSize))
+    {
+        StaticStackCopy(lpDestWStr, lpSrcWCharArr, ulSrcSize);
+        return;
+    }
 
-    lpDestWStr->ulSize = ulSrcSize;
-    if (0 == ulSrcSize) {
+    // Intentional: Allow lpSrcWCharArr to point into lpDestWStr->smallWCharArr
+    if (ulSrcSize > 0 && ulSrcSize < WSTR_SMALL_CAPACITY)
+    {
+        wchar_t smallWCharArr[WSTR_SMALL_CAPACITY] = {0};
+        wmemcpy(smallWCharArr, lpSrcWCharArr, ulSrcSize);
+        WStrAlloc(lpDestWStr, ulSrcSize);
+        wmemcpy(lpDestWStr->lpWCharArr, smallWCharArr, ulSrcSize);
         return;
     }
 
-    lpDestWStr->lpWCharArr = xcalloc(lpDestWStr->ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
+    WStrAlloc(lpDestWStr, ulSrcSize);
+    if (0 == ulSrcSize) {
+        return;
+    }
 
     SafeWCharArrCopy(lpDestWStr->lpWCharArr,
                      lpDestWStr->ulSize + LEN_NUL_CHAR,
@@ -172,65 +356,64 @@ WStrSPrintFV2(_Inout_ struct WStr   *lpDestWStr,
               _In_    const wchar_t *lpFormatWCharArr,
               _In_    va_list        ap)
 {
-    WStrFree(lpDestWStr);
+    WStrAssertValid(lpDestWStr);
     assert(NULL != lpErrorStream);
     assert(NULL != lpFormatWCharArr);
 
-    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-172
-    va_list ap_copy;
-    va_copy(ap_copy, ap);
-
-    // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/vsprintf-vsprintf-l-vswprintf-vswprintf-l-vswprintf-l?view=msvc-170
-    // Ref: https://en.cppreference.com/w/c/io/vfwprintf
-    // "Writes the results to a wide string buffer. At most bufsz-1 wide characters are written followed by null wide character.
-    //  The resulting wide character string will be terminated with a null wide character, unless bufsz is zero."
-    // "The number of wide characters written if successful or negative value if an error occurred.
-    //  If the resulting string gets truncated due to bufsz limit, function returns the total number of characters
-    //  (not including the terminating null wide character) which would have been written, if the limit were not imposed."
-    const int cch = vswprintf(NULL,              // wchar_t *buffer
-                              0,                 // size_t bufsz
-                              lpFormatWCharArr,  // const wchar_t *format
-                              ap_copy);          // va_list vlist
-    va_end(ap_copy);
-
-    if (cch < 0)
+    if (WSTR_ALLOC_STACK == lpDestWStr->eAlloc && lpDestWStr->ulStackCapacity >= 1U + LEN_NUL_CHAR)
     {
-        Win32LastErrorFPrintFW2(lpErrorStream,      // _In_  FILE          *lpStream
-                                lpErrorStream,      // _Out_ FILE          *lpErrorStream
-                                L"Internal error: -1 == vswprintf(NULL, 0, lpFormatWCharArr[%ls], ap_copy)",  // _In_  const wchar_t *lpMessageFormat
-                                lpFormatWCharArr);  // _In_  ...
-        return false;
-    }
-
-    lpDestWStr->ulSize = cch;
-    lpDestWStr->lpWCharArr = xcalloc(lpDestWStr->ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
+        // Intentional: Format directly into caller's stack buffer.  Why?  If result fits: No heap alloc and no copy.
+        struct WStrBuilder sb = {0};
+        WStrBuilderInitBuffer(&sb, lpDestWStr->lpWCharArr, lpDestWStr->ulStackCapacity);
+        lpDestWStr->ulSize = 0;
+
+        if (false == WStrBuilderAppendFV2(&sb,               // _Inout_ struct WStrBuilder *lpWStrBuilder
+                                          lpErrorStream,     // _In_    FILE               *lpErrorStream
+                                          lpFormatWCharArr,  // _In_    const wchar_t      *lpFormatWCharArr
+                                          ap))               // _In_    va_list             ap
+        {
+            WStrBuilderFree(&sb);
+            lpDestWStr->lpWCharArr[0] = L'\0';
+            return false;
+        }
 
-    va_list ap_copy2;
-    va_copy(ap_copy2, ap);
+        if (sb.lpWCharArr == lpDestWStr->lpWCharArr)
+        {
+            lpDestWStr->ulSize = sb.ulSize;
+            WStrBuilderFree(&sb);
+        }
+        else
+        {
+            // Too long for stack buffer: Transfer heap buffer from builder.
+            WStrBuilderMoveToWStr(&sb, lpDestWStr);
+        }
+        return true;
+    }
 
-    const int cch2 = vswprintf(lpDestWStr->lpWCharArr,             // wchar_t *buffer
-                               lpDestWStr->ulSize + LEN_NUL_CHAR,  // size_t bufsz
-                               lpFormatWCharArr,                   // const wchar_t *format
-                               ap_copy2);                          // va_list vlist
-    va_end(ap_copy2);
+    // Intentional: Format into stack buffer first.  Why?  Most results are short: Format once, not twice.
+    #define WSTR_SPRINTF_BUFFER_WCHAR_ARR_LEN 256
+    wchar_t lpBufferWCharArr[WSTR_SPRINTF_BUFFER_WCHAR_ARR_LEN];
+    struct WStrBuilder sb = {0};
+    WStrBuilderInitBuffer(&sb, lpBufferWCharArr, WSTR_SPRINTF_BUFFER_WCHAR_ARR_LEN);
 
-    if (cch2 < 0)
+    if (false == WStrBuilderAppendFV2(&sb,               // _Inout_ struct WStrBuilder *lpWStrBuilder
+                                      lpErrorStream,     // _In_    FILE               *lpErrorStream
+                                      lpFormatWCharArr,  // _In_    const wchar_t      *lpFormatWCharArr
+                                      ap))               // _In_    va_list             ap
     {
-        WStrFree(lpDestWStr);
-        Win32LastErrorFPrintFW2(lpErrorStream,                                         // _In_  FILE          *lpStream
-                                lpErrorStream,                                         // _Out_ FILE          *lpErrorStream
-                                L"Internal error: -1 == vswprintf(lpDestWStr->lpWCharArr, lpDestWStr->ulSize + LEN_NUL_CHAR[%zd], lpFormatWCharArr[%ls], ap_copy)",  // _In_  const wchar_t *lpMessageFormat
-                                lpDestWStr->ulSize + LEN_NUL_CHAR, lpFormatWCharArr);  // _In_  ...
+        WStrBuilderFree(&sb);
+        WStrAlloc(lpDestWStr, 0);
         return false;
     }
 
-    if (cch != cch2)
+    // Intentional: No WStrFree() before.  Why?  WStrBuilderMoveToWStr() keeps a WSTR_ALLOC_STACK buffer if result fits.
+    WStrBuilderMoveToWStr(&sb, lpDestWStr);
+    if (0 == lpDestWStr->ulSize && WSTR_ALLOC_STACK != lpDestWStr->eAlloc)
     {
-        WStrFree(lpDestWStr);
-        LogWF(lpErrorStream, L"Internal error: cch[%d] != cch2[%d]", cch, cch2);
-        return false;
+        // Intentional: Result is L"", not NULL.
+        lpDestWStr->lpWCharArr = lpDestWStr->smallWCharArr;
+        lpDestWStr->lpWCharArr[0] = L'\0';
     }
-
     return true;
 }
 
@@ -242,15 +425,11 @@ WStrConcat(_Inout_ struct WStr       *lpDestWStr,
     WStrAssertValid(lpSrcWStr);
     WStrAssertValid(lpSrcWStr2);
 
-    WStrFree(lpDestWStr);
-
-    lpDestWStr->ulSize = lpSrcWStr->ulSize + lpSrcWStr2->ulSize;
+    WStrAlloc(lpDestWStr, lpSrcWStr->ulSize + lpSrcWStr2->ulSize);
     if (0 == lpDestWStr->ulSize) {
         return;
     }
 
-    lpDestWStr->lpWCharArr = xcalloc(lpDestWStr->ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
-
     SafeWCharArrCopy(lpDestWStr->lpWCharArr,
                      lpSrcWStr->ulSize + LEN_NUL_CHAR,
                      lpSrcWStr->lpWCharArr,
@@ -271,9 +450,7 @@ WStrConcatMany(_Inout_ struct WStr       *lpDestWStr,
     WStrAssertValid(lpSrcWStr);
     WStrAssertValid(lpSrcWStr2);
 
-    WStrFree(lpDestWStr);
-
-    lpDestWStr->ulSize = lpSrcWStr->ulSize + lpSrcWStr2->ulSize;
+    size_t ulSize = lpSrcWStr->ulSize + lpSrcWStr2->ulSize;
 
     va_list ap;
     va_start(ap, lpSrcWStr2);
@@ -284,16 +461,15 @@ WStrConcatMany(_Inout_ struct WStr       *lpDestWStr,
         {
             break;
         }
-        lpDestWStr->ulSize += lpWStr->ulSize;
+        ulSize += lpWStr->ulSize;
     }
     va_end(ap);
 
+    WStrAlloc(lpDestWStr, ulSize);
     if (0 == lpDestWStr->ulSize) {
         return;
     }
 
-    lpDestWStr->lpWCharArr = xcalloc(lpDestWStr->ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
-
     size_t ulOffset = 0;
     SafeWCharArrCopy(lpDestWStr->lpWCharArr + ulOffset,
                      lpSrcWStr->ulSize + LEN_NUL_CHAR,
@@ -330,182 +506,515 @@ WStrConcatMany(_Inout_ struct WStr       *lpDestWStr,
 }
 
 void
-WStrTrim(_Inout_ struct WStr                 *lpWStr,
-         _In_    const enum EWStrTrim         eWStrTrim,
-         _In_    const WStrCharPredicateFunc  fpWStrCharPredicateFunc)
+WStrBuilderAssertValid(_In_ const struct WStrBuilder *lpWStrBuilder)
 {
-    WStrAssertValid(lpWStr);
-    assert(eWStrTrim >= WSTR_LTRIM && eWStrTrim <= (WSTR_LTRIM | WSTR_RTRIM));
-    assert(NULL != fpWStrCharPredicateFunc);
+    assert(NULL != lpWStrBuilder);
 
-    if (0 == lpWStr->ulSize) {
-        return;
+    if (NULL == lpWStrBuilder->lpWCharArr)
+    {
+        assert(0 == lpWStrBuilder->ulSize);
+        assert(0 == lpWStrBuilder->ulCapacity);
     }
-
-    // Iterate forward to count leading whitespace chars
-    size_t ulLeadingCount = 0;
-    if (0 != (eWStrTrim & WSTR_LTRIM))
+    else
     {
-        for (size_t i = 0; i < lpWStr->ulSize; ++i)
-        {
-            const wchar_t ch = lpWStr->lpWCharArr[i];
-            if (!fpWStrCharPredicateFunc(ch)) {
-                break;
-            }
-            ++ulLeadingCount;
-        }
+        assert(lpWStrBuilder->ulSize <= lpWStrBuilder->ulCapacity);
+        assert(L'\0' == lpWStrBuilder->lpWCharArr[lpWStrBuilder->ulSize]);
     }
+}
 
-    // If trim all wchars, then free lpWStr.
-    if (lpWStr->ulSize == ulLeadingCount)
+void
+WStrBuilderInitBuffer(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                      _In_    wchar_t            *lpBufferWCharArr,
+                      _In_    const size_t        ulBufferLen)
+{
+    WStrBuilderAssertValid(lpWStrBuilder);
+    assert(NULL == lpWStrBuilder->lpWCharArr);
+    assert(NULL != lpBufferWCharArr);
+    assert(ulBufferLen >= 1U + LEN_NUL_CHAR);
+
+    lpBufferWCharArr[0] = L'\0';
+    lpWStrBuilder->lpWCharArr             = lpBufferWCharArr;
+    lpWStrBuilder->ulSize                 = 0;
+    lpWStrBuilder->ulCapacity             = ulBufferLen - LEN_NUL_CHAR;
+    lpWStrBuilder->lpNullableInitWCharArr = lpBufferWCharArr;
+}
+
+void
+WStrBuilderFree(_Inout_ struct WStrBuilder *lpWStrBuilder)
+{
+    WStrBuilderAssertValid(lpWStrBuilder);
+
+    if (lpWStrBuilder->lpWCharArr == lpWStrBuilder->lpNullableInitWCharArr)
     {
-        WStrFree(lpWStr);
-        return;
+        // Intentional: Never free caller-owned initial buffer.
+        lpWStrBuilder->lpWCharArr = NULL;
     }
-
-    // Iterate backward to count trailing whitespace chars
-    size_t ulTrailingCount = 0;
-    if (0 != (eWStrTrim & WSTR_RTRIM))
+    else
     {
-        // Note: Reverse iteration is tricky with unsigned values in C!  Example: 0U - 1U == SIZE_MAX
-        for (size_t i = lpWStr->ulSize - 1U; i < SIZE_MAX; --i)
-        {
-            const wchar_t ch = lpWStr->lpWCharArr[i];
-            if (!fpWStrCharPredicateFunc(ch)) {
-                break;
-            }
-            ++ulTrailingCount;
-        }
+        xfree((void **) &(lpWStrBuilder->lpWCharArr));
     }
+    lpWStrBuilder->ulSize                 = 0;     // Explicit
+    lpWStrBuilder->ulCapacity             = 0;     // Explicit
+    lpWStrBuilder->lpNullableInitWCharArr = NULL;  // Explicit
+}
 
-    // If trim all wchars, then free lpWStr.
-    if (lpWStr->ulSize == ulTrailingCount)
-    {
-        WStrFree(lpWStr);
-        return;
+void
+WStrBuilderClear(_Inout_ struct WStrBuilder *lpWStrBuilder)
+{
+    WStrBuilderAssertValid(lpWStrBuilder);
+
+    lpWStrBuilder->ulSize = 0;
+    if (NULL != lpWStrBuilder->lpWCharArr) {
+        lpWStrBuilder->lpWCharArr[0] = L'\0';
     }
+}
 
-    const size_t ulTrimmedSize = lpWStr->ulSize - ulLeadingCount - ulTrailingCount;
+// Intentional: Initial heap capacity is larger than WSTR_SMALL_CAPACITY.  Why?  Builders are used for longer strings.
+static const size_t WSTR_BUILDER_MIN_CAPACITY = 32;
 
-    wchar_t *lpWCharArr = xcalloc(ulTrimmedSize + LEN_NUL_CHAR, sizeof(wchar_t));
+void
+WStrBuilderReserve(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                   _In_    const size_t        ulMinCapacity)
+{
+    WStrBuilderAssertValid(lpWStrBuilder);
 
-    SafeWCharArrCopy(lpWCharArr,
-                     ulTrimmedSize + LEN_NUL_CHAR,
-                     lpWStr->lpWCharArr + ulLeadingCount,
-                     ulTrimmedSize);
+    if (ulMinCapacity <= lpWStrBuilder->ulCapacity) {
+        return;
+    }
 
-    WStrFree(lpWStr);
+    // Intentional: Grow geometrically.  Why?  Amortised O(1) appends.
+    size_t ulNewCapacity =
+        (lpWStrBuilder->ulCapacity < WSTR_BUILDER_MIN_CAPACITY) ? WSTR_BUILDER_MIN_CAPACITY : (2U * lpWStrBuilder->ulCapacity);
+    if (ulNewCapacity < ulMinCapacity) {
+        ulNewCapacity = ulMinCapacity;
+    }
 
-    lpWStr->lpWCharArr = lpWCharArr;
-    lpWStr->ulSize     = ulTrimmedSize;
+    if (NULL == lpWStrBuilder->lpWCharArr || lpWStrBuilder->lpWCharArr == lpWStrBuilder->lpNullableInitWCharArr)
+    {
+        // Intentional: xcalloc() also writes final '\0' char.
+        wchar_t *lpNewWCharArr = xcalloc(ulNewCapacity + LEN_NUL_CHAR, sizeof(wchar_t));
+        if (lpWStrBuilder->ulSize > 0) {
+            wmemcpy(lpNewWCharArr, lpWStrBuilder->lpWCharArr, lpWStrBuilder->ulSize);
+        }
+        lpWStrBuilder->lpWCharArr = lpNewWCharArr;
+    }
+    else
+    {
+        xrealloc((void **) &(lpWStrBuilder->lpWCharArr), (ulNewCapacity + LEN_NUL_CHAR) * sizeof(wchar_t));
+    }
+    lpWStrBuilder->ulCapacity = ulNewCapacity;
 }
 
 void
-WStrLTrimSpace(_Inout_ struct WStr *lpWStr)
+WStrBuilderAppendWCharArr(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                          _In_    const wchar_t      *lpWCharArr,
+                          _In_    const size_t        ulSize)
 {
-    WStrTrim(lpWStr, WSTR_LTRIM, iswspace);
+    WStrBuilderAssertValid(lpWStrBuilder);
+    assert(NULL != lpWCharArr || 0 == ulSize);
+
+    if (0 == ulSize) {
+        return;
+    }
+
+    WStrBuilderReserve(lpWStrBuilder, lpWStrBuilder->ulSize + ulSize);
+
+    wmemcpy(lpWStrBuilder->lpWCharArr + lpWStrBuilder->ulSize, lpWCharArr, ulSize);
+    lpWStrBuilder->ulSize += ulSize;
+    lpWStrBuilder->lpWCharArr[lpWStrBuilder->ulSize] = L'\0';
 }
 
 void
-WStrRTrimSpace(_Inout_ struct WStr *lpWStr)
+WStrBuilderAppendWStr(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                      _In_    const struct WStr  *lpWStr)
 {
-    WStrTrim(lpWStr, WSTR_RTRIM, iswspace);
+    WStrAssertValid(lpWStr);
+
+    WStrBuilderAppendWCharArr(lpWStrBuilder, lpWStr->lpWCharArr, lpWStr->ulSize);
 }
 
 void
-WStrTrimSpace(_Inout_ struct WStr *lpWStr)
+WStrBuilderAppendF(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                   // @EmptyStringAllowed
+                   _In_    const wchar_t      *lpFormatWCharArr, ...)
 {
-    WStrTrim(lpWStr, WSTR_LTRIM | WSTR_RTRIM, iswspace);
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-172
+    va_list ap;
+    va_start(ap, lpFormatWCharArr);
+    const bool b = WStrBuilderAppendFV2(lpWStrBuilder,     // _Inout_ struct WStrBuilder *lpWStrBuilder
+                                        stderr,            // _In_    FILE               *lpErrorStream
+                                        lpFormatWCharArr,  // _In_    const wchar_t      *lpFormatWCharArr
+                                        ap);               // _In_    va_list             ap
+    va_end(ap);
+    if (false == b)
+    {
+        abort();
+    }
 }
 
-const int UNLIMITED_MIN_TOKEN_COUNT = -1;
-const int UNLIMITED_MAX_TOKEN_COUNT = -1;
+bool
+WStrBuilderAppendFV2(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                     _In_    FILE               *lpErrorStream,
+                     // @EmptyStringAllowed
+                     _In_    const wchar_t      *lpFormatWCharArr,
+                     _In_    va_list             ap)
+{
+    assert(NULL != lpErrorStream);
 
-static void
-WStrSplit0(_In_    const struct WStr             *lpWStrText,
-           _In_    const struct WStr             *lpWStrDelim,
-           _In_    const struct WStrSplitOptions *lpOptions,
-           _In_    const BOOL                     bDiscardFinalEmptyToken,
-           _Inout_ struct WStrArr                *lpTokenWStrArr)
+    if (false == WStrBuilderTryAppendFV(lpWStrBuilder, lpFormatWCharArr, ap))
+    {
+        Win32LastErrorFPrintFW2(lpErrorStream,      // _In_  FILE          *lpStream
+                                lpErrorStream,      // _Out_ FILE          *lpErrorStream
+                                L"Internal error: vswprintf(..., lpFormatWCharArr[%ls], ap) failed",  // _In_  const wchar_t *lpMessageFormat
+                                lpFormatWCharArr);  // _In_  ...
+        return false;
+    }
+    return true;
+}
+
+bool
+WStrBuilderTryAppendF(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                      // @EmptyStringAllowed
+                      _In_    const wchar_t      *lpFormatWCharArr, ...)
 {
-    WStrAssertValid(lpWStrText);
-    WStrAssertValid(lpWStrDelim);
-    // Do not allow empty delim
-    assert(0 != lpWStrDelim->ulSize);
-    assert(NULL != lpOptions);
-    assert(UNLIMITED_MIN_TOKEN_COUNT == lpOptions->iMinTokenCount || lpOptions->iMinTokenCount >= 1);
-    assert(UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount || lpOptions->iMaxTokenCount >= 2);
-    WStrArrFree(lpTokenWStrArr);
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-172
+    va_list ap;
+    va_start(ap, lpFormatWCharArr);
+    const bool b = WStrBuilderTryAppendFV(lpWStrBuilder,     // _Inout_ struct WStrBuilder *lpWStrBuilder
+                                          lpFormatWCharArr,  // _In_    const wchar_t      *lpFormatWCharArr
+                                          ap);               // _In_    va_list             ap
+    va_end(ap);
+    return b;
+}
 
-    // Important: Text after last delim is final token.
-    const int iMaxDelimCount = (UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount)
-        ? UNLIMITED_MAX_TOKEN_COUNT : (lpOptions->iMaxTokenCount - 1);
-    size_t ulDelimCount = 0;
+bool
+WStrBuilderTryAppendFV(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                       // @EmptyStringAllowed
+                       _In_    const wchar_t      *lpFormatWCharArr,
+                       _In_    va_list             ap)
+{
+    WStrBuilderAssertValid(lpWStrBuilder);
+    assert(NULL != lpFormatWCharArr);
 
-    // Step 1: Count number of delimiters
-    const wchar_t *lpIter = lpWStrText->lpWCharArr;
-    while (TRUE)
-    {
-        const wchar_t *lpNextDelim = wcsstr(lpIter, lpWStrDelim->lpWCharArr);
-        if (NULL == lpNextDelim) {
-            break;
-        }
+    if (NULL == lpWStrBuilder->lpWCharArr) {
+        WStrBuilderReserve(lpWStrBuilder, WSTR_BUILDER_MIN_CAPACITY);
+    }
 
-        lpIter = lpNextDelim + lpWStrDelim->ulSize;
+    // Step 1: Format directly into spare capacity.  Usually, this is enough.
+    const size_t ulSpareSize = lpWStrBuilder->ulCapacity - lpWStrBuilder->ulSize;
 
-        // This condition only applies if at least one delimiter is found.
-        // Why?  Both "abc" and "abc\r\n" will split as: ["abc"]
-        // And: "\r\n" will split as [""]
-        // But: "" will also split as [""]
-        if (L'\0' == *lpIter && TRUE == bDiscardFinalEmptyToken) {
-            break;
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-172
+    va_list ap_copy;
+    va_copy(ap_copy, ap);
+    // Ref: https://en.cppreference.com/w/c/io/vfwprintf
+    // "If the resulting string gets truncated due to bufsz limit, function returns the total number of characters
+    //  (not including the terminating null wide character) which would have been written, if the limit were not imposed."
+    // Intentional: Also handle -1 on truncation.  Why?  This is what MSVCRT _vsnwprintf() returns.
+    const int cch = vswprintf(lpWStrBuilder->lpWCharArr + lpWStrBuilder->ulSize,  // wchar_t *buffer
+                              ulSpareSize + LEN_NUL_CHAR,                         // size_t bufsz
+                              lpFormatWCharArr,                                   // const wchar_t *format
+                              ap_copy);                                           // va_list vlist
+    va_end(ap_copy);
+
+    if (cch >= 0 && (size_t) cch <= ulSpareSize)
+    {
+        lpWStrBuilder->ulSize += (size_t) cch;
+        return true;
+    }
+
+    // Intentional: Restore final '\0' char.  Why?  Spare capacity may contain a truncated result.
+    lpWStrBuilder->lpWCharArr[lpWStrBuilder->ulSize] = L'\0';
+
+    // Step 2: Too large for spare capacity.  Calculate size, grow, then format again.
+    va_list ap_copy2;
+    va_copy(ap_copy2, ap);
+    const int cch2 = vswprintf(NULL,              // wchar_t *buffer
+                               0,                 // size_t bufsz
+                               lpFormatWCharArr,  // const wchar_t *format
+                               ap_copy2);         // va_list vlist
+    va_end(ap_copy2);
+
+    if (cch2 < 0) {
+        return false;
+    }
+
+    WStrBuilderReserve(lpWStrBuilder, lpWStrBuilder->ulSize + (size_t) cch2);
+
+    va_list ap_copy3;
+    va_copy(ap_copy3, ap);
+    const int cch3 = vswprintf(lpWStrBuilder->lpWCharArr + lpWStrBuilder->ulSize,  // wchar_t *buffer
+                               (size_t) cch2 + LEN_NUL_CHAR,                       // size_t bufsz
+                               lpFormatWCharArr,                                   // const wchar_t *format
+                               ap_copy3);                                          // va_list vlist
+    va_end(ap_copy3);
+
+    if (cch2 != cch3)
+    {
+        lpWStrBuilder->lpWCharArr[lpWStrBuilder->ulSize] = L'\0';
+        return false;
+    }
+
+    lpWStrBuilder->ulSize += (size_t) cch3;
+    return true;
+}
+
+void
+WStrBuilderMoveToWStr(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                      _Inout_ struct WStr        *lpDestWStr)
+{
+    WStrBuilderAssertValid(lpWStrBuilder);
+
+    if (NULL == lpWStrBuilder->lpWCharArr
+        || lpWStrBuilder->lpWCharArr == lpWStrBuilder->lpNullableInitWCharArr
+        || lpWStrBuilder->ulSize < WSTR_SMALL_CAPACITY
+        || StaticIsStackFit(lpDestWStr, lpWStrBuilder->ulSize))
+    {
+        // Intentional: Copy small strings, even from heap.  Why?  Inline storage: Free a (mostly) unused heap buffer.
+        // Same for WSTR_ALLOC_STACK: Keep using stack buffer.
+        WStrCopyWCharArr(lpDestWStr, lpWStrBuilder->lpWCharArr, lpWStrBuilder->ulSize);
+        WStrBuilderFree(lpWStrBuilder);
+        return;
+    }
+
+    // Intentional: Transfer ownership of heap buffer.  No copy.
+    WStrFree(lpDestWStr);
+    lpDestWStr->lpWCharArr = lpWStrBuilder->lpWCharArr;
+    lpDestWStr->ulSize     = lpWStrBuilder->ulSize;
+
+    lpWStrBuilder->lpWCharArr             = NULL;
+    lpWStrBuilder->ulSize                 = 0;
+    lpWStrBuilder->ulCapacity             = 0;
+    lpWStrBuilder->lpNullableInitWCharArr = NULL;
+}
+
+void
+WStrTrim(_Inout_ struct WStr                 *lpWStr,
+         _In_    const enum EWStrTrim         eWStrTrim,
+         _In_    const WStrCharPredicateFunc  fpWStrCharPredicateFunc)
+{
+    WStrAssertValid(lpWStr);
+    assert(eWStrTrim >= WSTR_LTRIM && eWStrTrim <= (WSTR_LTRIM | WSTR_RTRIM));
+    assert(NULL != fpWStrCharPredicateFunc);
+
+    if (0 == lpWStr->ulSize) {
+        return;
+    }
+
+    // Intentional: Compare function pointers.  Why?  Vectorised kernels are exactly the same as iswspace().
+    const bool bIsSpace = ((WStrCharPredicateFunc) iswspace == fpWStrCharPredicateFunc);
+
+    // Iterate forward to count leading whitespace chars
+    size_t ulLeadingCount = 0;
+    if (0 != (eWStrTrim & WSTR_LTRIM) && bIsSpace)
+    {
+        ulLeadingCount = WStrSimdSpanSpace(lpWStr->lpWCharArr, lpWStr->ulSize);
+    }
+    else if (0 != (eWStrTrim & WSTR_LTRIM))
+    {
+        for (size_t i = 0; i < lpWStr->ulSize; ++i)
+        {
+            const wchar_t ch = lpWStr->lpWCharArr[i];
+            if (!fpWStrCharPredicateFunc(ch)) {
+                break;
+            }
+            ++ulLeadingCount;
         }
+    }
 
-        ++ulDelimCount;
+    // If trim all wchars, then free lpWStr.  Intentional: WStrAlloc(), not WStrFree().  Why?  Keep stack buffer.
+    if (lpWStr->ulSize == ulLeadingCount)
+    {
+        WStrAlloc(lpWStr, 0);
+        return;
+    }
 
-        if (UNLIMITED_MAX_TOKEN_COUNT != iMaxDelimCount && ((size_t) iMaxDelimCount) == ulDelimCount) {
-            break;
+    // Iterate backward to count trailing whitespace chars
+    size_t ulTrailingCount = 0;
+    if (0 != (eWStrTrim & WSTR_RTRIM) && bIsSpace)
+    {
+        ulTrailingCount = WStrSimdRSpanSpace(lpWStr->lpWCharArr, lpWStr->ulSize);
+    }
+    else if (0 != (eWStrTrim & WSTR_RTRIM))
+    {
+        // Note: Reverse iteration is tricky with unsigned values in C!  Example: 0U - 1U == SIZE_MAX
+        for (size_t i = lpWStr->ulSize - 1U; i < SIZE_MAX; --i)
+        {
+            const wchar_t ch = lpWStr->lpWCharArr[i];
+            if (!fpWStrCharPredicateFunc(ch)) {
+                break;
+            }
+            ++ulTrailingCount;
         }
     }
 
-    const size_t ulTokenCount = 1U + ulDelimCount;
+    // If trim all wchars, then free lpWStr.
+    if (lpWStr->ulSize == ulTrailingCount)
+    {
+        WStrAlloc(lpWStr, 0);
+        return;
+    }
 
-    if (UNLIMITED_MIN_TOKEN_COUNT != lpOptions->iMinTokenCount && ulTokenCount < ((size_t) lpOptions->iMinTokenCount))
+    if (0 == ulLeadingCount && 0 == ulTrailingCount) {
+        return;
+    }
+
+    const size_t ulTrimmedSize = lpWStr->ulSize - ulLeadingCount - ulTrailingCount;
+
+    if (WSTR_ALLOC_STACK == lpWStr->eAlloc)
     {
-        Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
-                                    L"ERROR: Failed to split [%ls] with delim [%ls]: ulTokenCount < lpOptions->iMinTokenCount: %lu < %d",  // _In_ const wchar_t *lpMessageFormat,
-                                    lpWStrText->lpWCharArr, lpWStrDelim->lpWCharArr, ulTokenCount, lpOptions->iMinTokenCount);             // _In_ ...
+        // Intentional: Trim in place.  Why?  No heap alloc.
+        WStrCopyWCharArr0(lpWStr, lpWStr->lpWCharArr + ulLeadingCount, ulTrimmedSize);
+        return;
     }
 
-    WStrArrAlloc(lpTokenWStrArr, ulTokenCount);
+    struct WStr trimmedWStr = {0};
+    WStrCopyWCharArr0(&trimmedWStr, lpWStr->lpWCharArr + ulLeadingCount, ulTrimmedSize);
+    WStrMove(lpWStr, &trimmedWStr);
+}
 
-    // Step 2: Extract tokens between delimiters
-    lpIter = lpWStrText->lpWCharArr;
-    for (size_t ulTokenIndex = 0; ulTokenIndex < ulTokenCount; ++ulTokenIndex)
+void
+WStrLTrimSpace(_Inout_ struct WStr *lpWStr)
+{
+    WStrTrim(lpWStr, WSTR_LTRIM, iswspace);
+}
+
+void
+WStrRTrimSpace(_Inout_ struct WStr *lpWStr)
+{
+    WStrTrim(lpWStr, WSTR_RTRIM, iswspace);
+}
+
+void
+WStrTrimSpace(_Inout_ struct WStr *lpWStr)
+{
+    WStrTrim(lpWStr, WSTR_LTRIM | WSTR_RTRIM, iswspace);
+}
+
+const int UNLIMITED_MIN_TOKEN_COUNT = -1;
+const int UNLIMITED_MAX_TOKEN_COUNT = -1;
+
+/**
+ * Unlike wcsstr(), lpBeginWCharArr does not need to be terminated with '\0'.
+ *
+ * @return pointer to first wchar of lpWStrViewDelim in range [lpBeginWCharArr, lpEndWCharArr) or NULL if not found
+ */
+static const wchar_t *
+StaticWCharArrFind(_In_ const wchar_t         *lpBeginWCharArr,
+                   _In_ const wchar_t         *lpEndWCharArr,
+                   _In_ const struct WStrView *lpWStrViewDelim)
+{
+    const wchar_t *lpResult = WStrSimdFindWCharArr(lpBeginWCharArr,                           // _In_ const wchar_t *lpWCharArr
+                                                   (size_t) (lpEndWCharArr - lpBeginWCharArr),  // _In_ const size_t   ulSize
+                                                   lpWStrViewDelim->lpWCharArr,               // _In_ const wchar_t *lpNeedleWCharArr
+                                                   lpWStrViewDelim->ulSize);                  // _In_ const size_t   ulNeedleSize
+    return lpResult;
+}
+
+/**
+ * @return WSTR_LTRIM, WSTR_RTRIM, or both if fpNullableWStrConsumerFunc is a whitespace trim that can be fused into split.
+ *         Else, zero.
+ */
+static enum EWStrTrim
+StaticGetFusedTrim(_In_ const WStrConsumerFunc fpNullableWStrConsumerFunc)
+{
+    // Intentional: Compare function pointers.  Why?  Same idea as WStrTrim() with iswspace(): Callers need not change.
+    if (WStrTrimSpace == fpNullableWStrConsumerFunc) {
+        return WSTR_LTRIM | WSTR_RTRIM;
+    }
+    if (WStrLTrimSpace == fpNullableWStrConsumerFunc) {
+        return WSTR_LTRIM;
+    }
+    if (WStrRTrimSpace == fpNullableWStrConsumerFunc) {
+        return WSTR_RTRIM;
+    }
+    return 0;
+}
+
+static void
+WStrSplit0(_In_    const struct WStr             *lpWStrText,
+           _In_    const struct WStr             *lpWStrDelim,
+           _In_    const struct WStrSplitOptions *lpOptions,
+           _In_    const BOOL                     bDiscardFinalEmptyToken,
+           _Inout_ struct WStrArr                *lpTokenWStrArr)
+{
+    WStrAssertValid(lpWStrText);
+    WStrAssertValid(lpWStrDelim);
+    // Do not allow empty delim
+    assert(0 != lpWStrDelim->ulSize);
+    assert(NULL != lpOptions);
+    assert(UNLIMITED_MIN_TOKEN_COUNT == lpOptions->iMinTokenCount || lpOptions->iMinTokenCount >= 1);
+    assert(UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount || lpOptions->iMaxTokenCount >= 2);
+    WStrArrFree(lpTokenWStrArr);
+
+    const struct WStrView delimWStrView = WSTR_VIEW_FROM_WSTR(lpWStrDelim);
+    const wchar_t *lpEnd = lpWStrText->lpWCharArr + lpWStrText->ulSize;
+
+    // Intentional: Trim bounds are found before each token is copied.  Why?  Previously, each token was copied,
+    // then WStrTrim() copied the trimmed wchars again into a new buffer.  Now, each token is copied exactly once.
+    const enum EWStrTrim eFusedTrim = StaticGetFusedTrim(lpOptions->fpNullableWStrConsumerFunc);
+
+    // Intentional: Single pass over text.  Why?  Previously, we scanned twice with wcsstr(): once to count
+    // delimiters, then again to extract tokens.  For large text, e.g., a multi-megabyte file, this doubles
+    // memory traffic.  Now, each token is appended to lpTokenWStrArr, which grows geometrically.
+    const wchar_t *lpIter = lpWStrText->lpWCharArr;
+    while (TRUE)
     {
         // Intention: Include (UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount) for readability.
         const BOOL bIsLastToken =
             (UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount)
-                ? FALSE : (1U + ulTokenIndex == ((size_t) lpOptions->iMaxTokenCount));
+                ? FALSE : (1U + lpTokenWStrArr->ulSize == ((size_t) lpOptions->iMaxTokenCount));
 
-        const wchar_t *lpNextDelim = wcsstr(lpIter, lpWStrDelim->lpWCharArr);
-        if (NULL == lpNextDelim || bIsLastToken)
+        const wchar_t *lpNextDelim = bIsLastToken ? NULL : StaticWCharArrFind(lpIter, lpEnd, &delimWStrView);
+        if (NULL == lpNextDelim)
         {
-            // Point to trailing null char
-            lpNextDelim = lpWStrText->lpWCharArr + lpWStrText->ulSize;
+            // Important: Text after last delim is final token.
+            lpNextDelim = lpEnd;
         }
 
         const ptrdiff_t lTokenLen = lpNextDelim - lpIter;
         // Note: Empty token is allowed, e.g., L""
         assert(lTokenLen >= 0);
 
-        WStrCopyWCharArr(lpTokenWStrArr->lpWStrArr + ulTokenIndex, lpIter, lTokenLen);
+        const wchar_t *lpTokenBegin = lpIter;
+        size_t ulTokenSize = (size_t) lTokenLen;
+        if (0 != (eFusedTrim & WSTR_LTRIM))
+        {
+            const size_t ulLeadingCount = WStrSimdSpanSpace(lpTokenBegin, ulTokenSize);
+            lpTokenBegin += ulLeadingCount;
+            ulTokenSize  -= ulLeadingCount;
+        }
+        if (0 != (eFusedTrim & WSTR_RTRIM))
+        {
+            ulTokenSize -= WStrSimdRSpanSpace(lpTokenBegin, ulTokenSize);
+        }
+
+        WStrArrAppendWCharArr(lpTokenWStrArr, lpTokenBegin, ulTokenSize);
+
+        if (lpEnd == lpNextDelim) {
+            break;
+        }
 
-        // Note: In final iteration, 'lpIter' may point to an invalid memory location.
         lpIter = lpNextDelim + lpWStrDelim->ulSize;
+
+        // This condition only applies if at least one delimiter is found.
+        // Why?  Both "abc" and "abc\r\n" will split as: ["abc"]
+        // And: "\r\n" will split as [""]
+        // But: "" will also split as [""]
+        if (lpEnd == lpIter && TRUE == bDiscardFinalEmptyToken) {
+            break;
+        }
+    }
+
+    const size_t ulTokenCount = lpTokenWStrArr->ulSize;
+
+    if (UNLIMITED_MIN_TOKEN_COUNT != lpOptions->iMinTokenCount && ulTokenCount < ((size_t) lpOptions->iMinTokenCount))
+    {
+        Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                    L"ERROR: Failed to split [%ls] with delim [%ls]: ulTokenCount < lpOptions->iMinTokenCount: %lu < %d",  // _In_ const wchar_t *lpMessageFormat,
+                                    lpWStrText->lpWCharArr, lpWStrDelim->lpWCharArr, ulTokenCount, lpOptions->iMinTokenCount);             // _In_ ...
     }
 
-    if (NULL != lpOptions->fpNullableWStrConsumerFunc)
+    if (NULL != lpOptions->fpNullableWStrConsumerFunc && 0 == eFusedTrim)
     {
         WStrArrForEach(lpTokenWStrArr, lpOptions->fpNullableWStrConsumerFunc);
     }
@@ -531,7 +1040,7 @@ WStrSplitNewLine(_In_    const struct WStr             *lpWStrText,
 
     const BOOL bDiscardFinalEmptyToken = TRUE;
 
-    if (NULL != wcsstr(lpWStrText->lpWCharArr, L"\r\n"))
+    if (NULL != WStrSimdFindWCharArr(lpWStrText->lpWCharArr, lpWStrText->ulSize, L"\r\n", 2))
     {
         struct WStr wstrDelim = {.lpWCharArr = L"\r\n", .ulSize = 2};
         WStrSplit0(lpWStrText, &wstrDelim, lpOptions, bDiscardFinalEmptyToken, lpTokenWStrArr);
@@ -554,26 +1063,27 @@ WStrJoin(_In_    const struct WStrArr *lpWStrArr,
 
     WStrArrAssertValid(lpWStrArr);
     WStrAssertValid(lpDelimWStr);
-    WStrFree(lpDestWStr);
+    // Intentional: WStrAlloc(), not WStrFree().  Why?  Keep stack buffer.
+    WStrAlloc(lpDestWStr, 0);
 
     if (0 == lpWStrArr->ulSize) {
         return;
     }
 
-    lpDestWStr->ulSize = lpDelimWStr->ulSize * (lpWStrArr->ulSize - 1UL);
+    size_t ulSize = lpDelimWStr->ulSize * (lpWStrArr->ulSize - 1UL);
 
     for (size_t i = 0; i < lpWStrArr->ulSize; ++i)
     {
         const struct WStr *lpWStr = lpWStrArr->lpWStrArr + i;
-        lpDestWStr->ulSize += lpWStr->ulSize;
+        ulSize += lpWStr->ulSize;
     }
 
     // We are trying to join all empty strings with empty delim!
-    if (0 == lpDestWStr->ulSize) {
+    if (0 == ulSize) {
         return;
     }
 
-    lpDestWStr->lpWCharArr = xcalloc(lpDestWStr->ulSize + LEN_NUL_CHAR, sizeof(wchar_t));
+    WStrAlloc(lpDestWStr, ulSize);
 
     wchar_t *lpWCharArr = lpDestWStr->lpWCharArr;
     for (size_t i = 0; i < lpWStrArr->ulSize; ++i)
@@ -598,95 +1108,33 @@ WStrJoin(_In_    const struct WStrArr *lpWStrArr,
     }
 }
 
-// Maybe: WStrFileAppend
-// Ref: https://docs.microsoft.com/en-us/windows/win32/fileio/appending-one-file-to-another-file
-
 void
 WStrFileWrite(_In_ const wchar_t     *lpFilePath,
               _In_ const UINT         codePage,  // Ex: CP_UTF8
               _In_ const struct WStr *lpWStr)
 {
     assert(NULL != lpFilePath);
-    assert(NULL != lpWStr);
-
-    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
-    const HANDLE hWriteFile = CreateFile(lpFilePath,             // [in] LPCWSTR lpFileName
-                                         GENERIC_WRITE,          // [in] DWORD dwDesiredAccess
-                                         0,                      // [in] DWORD dwShareMode
-                                         NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
-                                         CREATE_ALWAYS,          // [in] DWORD dwCreationDisposition
-                                         FILE_ATTRIBUTE_NORMAL,  // [in] DWORD dwFlagsAndAttributes
-                                         NULL);                  // [in, optional] hTemplateFile
-    if (INVALID_HANDLE_VALUE == hWriteFile)
-    {
-        Win32LastErrorFPrintFWAbort(stderr,       // _In_ FILE          *lpStream,
-                                    L"CreateFile(lpFilePath[%ls], GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL)",  // _In_ const wchar_t *lpMessageFormat,
-                                    lpFilePath);  // _In_ ...
-    }
+    WStrAssertValid(lpWStr);
 
-    if (lpWStr->ulSize > 0)
-    {
-        // Ref: https://docs.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-widechartomultibyte
-        // Note: If 'cchWideChar' == -1, then resulting count includes trailing null char.
-        const int iCharArrLen = WideCharToMultiByte(codePage,              // [in] UINT CodePage
-                                                    WC_ERR_INVALID_CHARS,  // [in] DWORD dwFlags
-                                                    lpWStr->lpWCharArr,    // [in] LPCWCH lpWideCharStr
-                                                    -1,                    // [in] int cchWideChar
-                                                    NULL,                  // [out/opt] LPSTR lpMultiByteStr
-                                                    0,                     // [in] int cbMultiByte
-                                                    NULL,                  // [in/opt] LPCCH lpDefaultChar
-                                                    NULL);                 // [out/opt] LPBOOL lpUsedDefaultChar
-        assert(iCharArrLen >= 0);
-        if (0 == iCharArrLen)
-        {
-            Win32LastErrorFPrintFWAbort(stderr,                         // _In_ FILE          *lpStream,
-                                        L"WideCharToMultiByte(codePage[%ud], WC_ERR_INVALID_CHARS, lpWStr->lpWCharArr[%ld], -1, NULL, 0, NULL, NULL))",  // _In_ const wchar_t *lpMessageFormat,
-                                        codePage, lpWStr->lpWCharArr);  // _In_ ...
-        }
-
-        // Important: WriteFile() only writes chars not wchars.
-        const size_t ulCharArrLen = sizeof(char) * iCharArrLen;  // includes trailing null char
-
-        char *lpCharArr = xcalloc(iCharArrLen, sizeof(char));
-
-        // Note: If 'cchWideChar' == -1, then resulting lpCharArr includes trailing null char.
-        const int iCharArrLen2 = WideCharToMultiByte(codePage,              // [in] UINT CodePage
-                                                     WC_ERR_INVALID_CHARS,  // [in] DWORD dwFlags
-                                                     lpWStr->lpWCharArr,    // [in] LPCWCH lpWideCharStr
-                                                     -1,                    // [in] int cchWideChar
-                                                     lpCharArr,             // [out/opt] LPSTR lpMultiByteStr
-                                                     ulCharArrLen,          // [in] int cbMultiByte
-                                                     NULL,                  // [in/opt] LPCCH lpDefaultChar
-                                                     NULL);                 // [out/opt] LPBOOL lpUsedDefaultChar
-        assert(iCharArrLen2 >= 0);
-        if (0 == iCharArrLen2)
-        {
-            Win32LastErrorFPrintFWAbort(stderr,                         // _In_ FILE          *lpStream,
-                                        L"WideCharToMultiByte(codePage[%ud], WC_ERR_INVALID_CHARS, lpWStr->lpWCharArr[%ld], -1, lpCharArr, ulCharArrLen, NULL, NULL))",  // _In_ const wchar_t *lpMessageFormat,
-                                        codePage, lpWStr->lpWCharArr);  // _In_ ...
-        }
-        assert(iCharArrLen == iCharArrLen2);
-
-        // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-writefile
-        DWORD numberOfBytesWritten = 0;
-        if (!WriteFile(hWriteFile,                   // [in] HANDLE hFile
-                       lpCharArr,                    // [in] LPCVOID lpBuffer
-                       ulCharArrLen - LEN_NUL_CHAR,  // [in] DWORD nNumberOfBytesToWrite
-                       &numberOfBytesWritten,        // [out/opt] LPDWORD lpNumberOfBytesWritten
-                       NULL))                        // [in/out/opt] LPOVERLAPPED lpOverlapped
-        {
-            Win32LastErrorFPutWSAbort(stderr,         // _In_ FILE          *lpStream
-                                      L"WriteFile");  // _In_ const wchar_t *lpMessage
-        }
+    // Intentional: Encode to fixed-size buffer, not one full-size staging copy.  Why?  Large output doubles peak memory.
+    struct WStrFileWriter writer = {0};
+    WStrFileWriterOpen(&writer, lpFilePath, codePage, WSTR_FILE_WRITER_MODE_TRUNCATE, WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE);
+    WStrFileWriterWrite(&writer, lpWStr);
+    WStrFileWriterClose(&writer);
+}
 
-        xfree((void **) &lpCharArr);
-    }
+void
+WStrFileAppend(_In_ const wchar_t     *lpFilePath,
+               _In_ const UINT         codePage,  // Ex: CP_UTF8
+               _In_ const struct WStr *lpWStr)
+{
+    assert(NULL != lpFilePath);
+    WStrAssertValid(lpWStr);
 
-    if (!CloseHandle(hWriteFile))
-    {
-        Win32LastErrorFPutWSAbort(stderr,                       // _In_ FILE          *lpStream
-                                  L"CloseHandle(hWriteFile)");  // _In_ const wchar_t *lpMessage
-    }
+    struct WStrFileWriter writer = {0};
+    WStrFileWriterOpen(&writer, lpFilePath, codePage, WSTR_FILE_WRITER_MODE_APPEND, WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE);
+    WStrFileWriterWrite(&writer, lpWStr);
+    WStrFileWriterClose(&writer);
 }
 
 void
@@ -695,135 +1143,48 @@ WStrFileRead(_In_    const wchar_t *lpFilePathWCharArr,
              _Inout_ struct WStr   *lpDestWStr)
 {
     assert(NULL != lpFilePathWCharArr);
-    WStrFree(lpDestWStr);
-
-    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
-    const HANDLE hReadFile = CreateFile(lpFilePathWCharArr,     // [in] LPCWSTR lpFileName
-                                        GENERIC_READ,           // [in] DWORD dwDesiredAccess
-                                        FILE_SHARE_READ,        // [in] DWORD dwShareMode
-                                        NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
-                                        OPEN_EXISTING,          // [in] DWORD dwCreationDisposition
-                                        FILE_ATTRIBUTE_NORMAL,  // [in] DWORD dwFlagsAndAttributes
-                                        NULL);                  // [in, optional] hTemplateFile
-    if (INVALID_HANDLE_VALUE == hReadFile)
-    {
-        Win32LastErrorFPrintFWAbort(stderr,               // _In_ FILE          *lpStream,
-                                    L"CreateFile(lpFileName[%ls], GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)",  // _In_ const wchar_t *lpMessageFormat,
-                                    lpFilePathWCharArr);  // _In_ ...
-    }
-
-    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getfilesize
-    const LPDWORD lpdwHighFileSize = NULL;
-    const DWORD dwFileSize = GetFileSize(hReadFile, lpdwHighFileSize);
-    if (INVALID_FILE_SIZE == dwFileSize)
-    {
-        Win32LastErrorFPrintFWAbort(stderr,                           // _In_ FILE          *lpStream
-                                    L"GetFileSize(lpFileName[%ls])",  // _In_ const wchar_t *lpMessageFormat
-                                    lpFilePathWCharArr);              // _In_ ...
-    }
-
-    if (0 == dwFileSize)
-    {
-        if (!CloseHandle(hReadFile))
-        {
-            Win32LastErrorFPrintFWAbort(stderr,                                      // _In_ FILE          *lpStream
-                                        L"CloseHandle(hReadFile, lpFileName[%ls])",  // _In_ const wchar_t *lpMessageFormat
-                                        lpFilePathWCharArr);                         // _In_ ...
-        }
-        // Above, WStrFree(lpDestWStr) is called.  Thus, lpDestWStr has zero length.
-        return;
-    }
-
-    // Important: ReadFile() only reads chars not wchars.
-    const size_t ulCharArrLen = sizeof(char) * (dwFileSize + LEN_NUL_CHAR);
-
-    char *lpCharArr = xcalloc(dwFileSize + LEN_NUL_CHAR, sizeof(char));
 
-    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-readfile
-    DWORD dwNumberOfBytesRead = 0;
-    if (!ReadFile(hReadFile, lpCharArr, ulCharArrLen, &dwNumberOfBytesRead, NULL))
-    {
-        Win32LastErrorFPrintFWAbort(stderr,                       // _In_ FILE          *lpStream
-                                    L"ReadFile(lpFileName:%ls)",  // _In_ const wchar_t *lpMessageFormat
-                                    lpFilePathWCharArr);          // _In_ ...
-    }
-    assert(dwFileSize == dwNumberOfBytesRead);
-    lpCharArr[dwNumberOfBytesRead] = '\0';
+    // Intentional: Map file, not ReadFile() into a heap buffer.  Why?  Decode directly from file cache pages:
+    // No copy of all bytes, and peak memory is only the decoded wchars.
+    struct WStrFileMap fileMap = {0};
+    WStrFileMapOpen(&fileMap, lpFilePathWCharArr, codePage);
+    WStrFileMapDecode(&fileMap, lpDestWStr);
+    WStrFileMapClose(&fileMap);
+}
 
-    if (!CloseHandle(hReadFile))
-    {
-        Win32LastErrorFPrintFWAbort(stderr,                                     // _In_ FILE          *lpStream
-                                    L"CloseHandle(hReadFile, lpFileName:%ls)",  // _In_ const wchar_t *lpMessageFormat
-                                    lpFilePathWCharArr);                        // _In_ ...
-    }
+size_t
+WStrFileGetBOMSize(_In_ const char   *lpCharArr,
+                   _In_ const size_t  ulSize)
+{
+    assert(0 == ulSize || NULL != lpCharArr);
 
     // Note: "BOM" == byte order mark
     // Ref: https://docs.microsoft.com/en-us/windows/win32/intl/using-byte-order-marks
-    char *lpCharArrAfterBOM = lpCharArr;
-    if (dwFileSize >= 3 && ((char) 0xEF) == lpCharArr[0] && ((char) 0xBB) == lpCharArr[1] && ((char) 0xBF) == lpCharArr[2])
+    if (ulSize >= 3 && ((char) 0xEF) == lpCharArr[0] && ((char) 0xBB) == lpCharArr[1] && ((char) 0xBF) == lpCharArr[2])
     {
-        lpCharArrAfterBOM += 3;  // Skip UTF-8 BOM
+        return 3;  // Skip UTF-8 BOM
     }
-    else if (dwFileSize >= 4 && ((char) 0xFF) == lpCharArr[0] && ((char) 0xFE) == lpCharArr[1] && ((char) 0x00) == lpCharArr[2] && ((char) 0x00) == lpCharArr[3])
+    else if (ulSize >= 4 && ((char) 0xFF) == lpCharArr[0] && ((char) 0xFE) == lpCharArr[1] && ((char) 0x00) == lpCharArr[2] && ((char) 0x00) == lpCharArr[3])
     {
         Win32LastErrorFPutWSAbort(stderr,  // _In_ FILE          *lpStream
                                   L"UTF-32LE (little endian) BOM (byte order mark) is not supported!");  // _In_ const wchar_t *lpMessage
     }
-    else if (dwFileSize >= 4 && ((char) 0x00) == lpCharArr[0] && ((char) 0x00) == lpCharArr[1] && ((char) 0xFF) == lpCharArr[2] && ((char) 0xFE) == lpCharArr[3])
+    else if (ulSize >= 4 && ((char) 0x00) == lpCharArr[0] && ((char) 0x00) == lpCharArr[1] && ((char) 0xFF) == lpCharArr[2] && ((char) 0xFE) == lpCharArr[3])
     {
         Win32LastErrorFPutWSAbort(stderr,  // _In_ FILE          *lpStream
                                   L"UTF-32BE (big endian) BOM (byte order mark) is not supported!");  // _In_ const wchar_t *lpMessage
     }
-    else if (dwFileSize >= 2 && ((char) 0xFF) == lpCharArr[0] && ((char) 0xFE) == lpCharArr[1])
+    else if (ulSize >= 2 && ((char) 0xFF) == lpCharArr[0] && ((char) 0xFE) == lpCharArr[1])
     {
         Win32LastErrorFPutWSAbort(stderr,  // _In_ FILE          *lpStream
                                   L"UTF-16LE (little endian) BOM (byte order mark) is not supported!");  // _In_ const wchar_t *lpMessage
     }
-    else if (dwFileSize >= 2 && ((char) 0xFE) == lpCharArr[0] && ((char) 0xFF) == lpCharArr[1])
+    else if (ulSize >= 2 && ((char) 0xFE) == lpCharArr[0] && ((char) 0xFF) == lpCharArr[1])
     {
         Win32LastErrorFPutWSAbort(stderr,  // _In_ FILE          *lpStream
                                   L"UTF-16BE (big endian) BOM (byte order mark) is not supported!");  // _In_ const wchar_t *lpMessage
     }
-
-    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
-    // Ref: https://stackoverflow.com/a/6693107/257299
-    // Note: If 'cbMultiByte' == -1, then resulting count includes trailing null char.
-    const int iWCharArrLen = MultiByteToWideChar(codePage,              // [in] UINT codePage
-                                                 MB_ERR_INVALID_CHARS,  // [in] DWORD dwFlags
-                                                 lpCharArrAfterBOM,     // [in] char *lpMultiByteStr
-                                                 -1,                    // [in] int cbMultiByte
-                                                 NULL,                  // [out/opt] wchar_t *lpWideCharStr
-                                                 0);                    // [in] int cchWideChar
-    assert(iWCharArrLen >= 0);
-    if (0 == iWCharArrLen)
-    {
-        Win32LastErrorFPrintFWAbort(stderr,     // _In_ FILE          *lpStream,
-                                    L"MultiByteToWideChar(codePage[%ud], MB_ERR_INVALID_CHARS, lpCharArrAfterBOM, -1, NULL, 0)",  // _In_ const wchar_t *lpMessageFormat,
-                                    codePage);  // _In_ ...
-    }
-
-    wchar_t* lpWCharArr = xcalloc(iWCharArrLen, sizeof(wchar_t));
-
-    // Note: If 'cbMultiByte' == -1, then resulting lpWCharArr includes trailing null char.
-    const int iWCharArrLen2 = MultiByteToWideChar(codePage,              // [in] UINT codePage
-                                                  MB_ERR_INVALID_CHARS,  // [in] DWORD dwFlags
-                                                  lpCharArrAfterBOM,     // [in] char *lpMultiByteStr
-                                                  -1,                    // [in] int cbMultiByte
-                                                  lpWCharArr,            // [out/opt] wchar_t *lpWideCharStr
-                                                  iWCharArrLen);         // [in] int cchWideChar
-    assert(iWCharArrLen2 >= 0);
-    if (0 == iWCharArrLen2)
-    {
-        Win32LastErrorFPrintFWAbort(stderr,     // _In_ FILE          *lpStream,
-                                    L"MultiByteToWideChar(codePage[%ud], MB_ERR_INVALID_CHARS, lpCharArrAfterBOM, lpWCharArr, iWCharArrLen)",  // _In_ const wchar_t *lpMessageFormat,
-                                    codePage);  // _In_ ...
-    }
-    assert(iWCharArrLen == iWCharArrLen2);
-
-    xfree((void **) &lpCharArr);
-
-    lpDestWStr->lpWCharArr = lpWCharArr;
-    lpDestWStr->ulSize     = iWCharArrLen - LEN_NUL_CHAR;
+    return 0;
 }
 
 void
@@ -834,6 +1195,11 @@ WStrArrAssertValid(_In_ const struct WStrArr *lpWStrArr)
     {
         assert(NULL != lpWStrArr->lpWStrArr);
     }
+    assert(0 == lpWStrArr->ulCapacity || lpWStrArr->ulSize <= lpWStrArr->ulCapacity);
+    if (NULL != lpWStrArr->lpNullableArenaWCharArr)
+    {
+        assert(NULL != lpWStrArr->lpWStrArr);
+    }
 }
 
 void
@@ -841,7 +1207,13 @@ WStrArrFree(_Inout_ struct WStrArr *lpWStrArr)
 {
     WStrArrAssertValid(lpWStrArr);
 
-    if (NULL != lpWStrArr->lpWStrArr)
+    if (NULL != lpWStrArr->lpNullableArenaWCharArr)
+    {
+        // Intentional: Do not free each element.  Why?  In arena mode, all wchars live in one block.
+        xfree((void **) &(lpWStrArr->lpNullableArenaWCharArr));
+        xfree((void **) &(lpWStrArr->lpWStrArr));
+    }
+    else if (NULL != lpWStrArr->lpWStrArr)
     {
         for (size_t i = 0; i < lpWStrArr->ulSize; ++i)
         {
@@ -849,7 +1221,8 @@ WStrArrFree(_Inout_ struct WStrArr *lpWStrArr)
         }
         xfree((void **) &(lpWStrArr->lpWStrArr));
     }
-    lpWStrArr->ulSize = 0;  // Explicit
+    lpWStrArr->ulSize     = 0;  // Explicit
+    lpWStrArr->ulCapacity = 0;  // Explicit
 }
 
 void
@@ -859,30 +1232,94 @@ WStrArrAlloc(_Inout_ struct WStrArr *lpWStrArr,
     WStrArrFree(lpWStrArr);
     if (ulSize > 0)
     {
-        lpWStrArr->lpWStrArr = xcalloc(ulSize, sizeof(struct WStr));
-        lpWStrArr->ulSize = ulSize;
+        lpWStrArr->lpWStrArr  = xcalloc(ulSize, sizeof(struct WStr));
+        lpWStrArr->ulSize     = ulSize;
+        lpWStrArr->ulCapacity = ulSize;
     }
 }
 
 void
-WStrArrCopyWCharArrArr(_Inout_ struct WStrArr  *lpDestWStrArr,
-                       _In_    const wchar_t  **lppNullableSrcWCharArrArr,
-                       _In_    const size_t     ulSrcCount)
+WStrArrReserve(_Inout_ struct WStrArr *lpWStrArr,
+               _In_    const size_t    ulMinCapacity)
 {
-    assert(NULL != lpDestWStrArr);
+    WStrArrAssertValid(lpWStrArr);
 
-    WStrArrFree(lpDestWStrArr);
-    WStrArrAlloc(lpDestWStrArr, ulSrcCount);
+    if (ulMinCapacity <= lpWStrArr->ulCapacity) {
+        return;
+    }
 
-    if (0 == ulSrcCount)
+    if (NULL == lpWStrArr->lpWStrArr)
     {
-        assert(NULL == lppNullableSrcWCharArrArr);
-        return;
+        lpWStrArr->lpWStrArr = xcalloc(ulMinCapacity, sizeof(struct WStr));
     }
     else
     {
-        assert(NULL != lppNullableSrcWCharArrArr);
-    }
+        // Intentional: Grow with xrealloc(), not xcalloc() + WStrMove() for each element.  Why?  For large arrays,
+        // the heap can often grow the block in place.  When the block moves, small strings still point to the inline
+        // buffer in the *old* block.  Remember the old address (as integer) to find and fix them.
+        const uintptr_t ulOldAddr = (uintptr_t) lpWStrArr->lpWStrArr;
+        xrealloc((void **) &(lpWStrArr->lpWStrArr), ulMinCapacity * sizeof(struct WStr));
+        const uintptr_t ulNewAddr = (uintptr_t) lpWStrArr->lpWStrArr;
+
+        if (ulOldAddr != ulNewAddr)
+        {
+            for (size_t i = 0; i < lpWStrArr->ulSize; ++i)
+            {
+                struct WStr *lpWStr = lpWStrArr->lpWStrArr + i;
+                const uintptr_t ulOldSmallAddr = ulOldAddr + (i * sizeof(struct WStr)) + offsetof(struct WStr, smallWCharArr);
+                if (ulOldSmallAddr == (uintptr_t) lpWStr->lpWCharArr) {
+                    lpWStr->lpWCharArr = lpWStr->smallWCharArr;
+                }
+            }
+        }
+    }
+
+    lpWStrArr->ulCapacity = ulMinCapacity;
+}
+
+// Intentional: Small initial capacity.  Why?  Most splits, e.g., config file lines, have few tokens.
+static const size_t WSTR_ARR_MIN_CAPACITY = 8;
+
+void
+WStrArrAppendWCharArr(_Inout_ struct WStrArr *lpWStrArr,
+                      _In_    const wchar_t  *lpWCharArr,
+                      _In_    const size_t    ulSize)
+{
+    WStrArrAssertValid(lpWStrArr);
+    // Intentional: Arena is never re-allocated.  Why?  Elements point into it.
+    assert(NULL == lpWStrArr->lpNullableArenaWCharArr);
+
+    if (lpWStrArr->ulSize == lpWStrArr->ulCapacity)
+    {
+        const size_t ulNewCapacity =
+            (lpWStrArr->ulCapacity < WSTR_ARR_MIN_CAPACITY) ? WSTR_ARR_MIN_CAPACITY : (2U * lpWStrArr->ulCapacity);
+        WStrArrReserve(lpWStrArr, ulNewCapacity);
+    }
+
+    struct WStr *lpWStr = lpWStrArr->lpWStrArr + lpWStrArr->ulSize;
+    WStrCopyWCharArr(lpWStr, lpWCharArr, ulSize);
+    ++(lpWStrArr->ulSize);
+}
+
+void
+WStrArrCopyWCharArrArr(_Inout_ struct WStrArr  *lpDestWStrArr,
+                       _In_    const wchar_t  **lppNullableSrcWCharArrArr,
+                       _In_    const size_t     ulSrcCount)
+{
+    assert(NULL != lpDestWStrArr);
+
+    WStrArrFree(lpDestWStrArr);
+    WStrArrAlloc(lpDestWStrArr, ulSrcCount);
+
+    if (0 == ulSrcCount)
+    {
+        assert(NULL == lppNullableSrcWCharArrArr);
+        return;
+    }
+    else
+    {
+        assert(NULL != lppNullableSrcWCharArrArr);
+    }
 
     for (size_t i = 0; i < ulSrcCount; ++i)
     {
@@ -905,3 +1342,538 @@ WStrArrForEach(_Inout_ struct WStrArr         *lpWStrArr,
     }
 }
 
+
+void
+WStrViewAssertValid(_In_ const struct WStrView *lpWStrView)
+{
+    assert(NULL != lpWStrView);
+    if (lpWStrView->ulSize > 0)
+    {
+        assert(NULL != lpWStrView->lpWCharArr);
+    }
+}
+
+BOOL
+WStrViewIsEmpty(_In_ const struct WStrView *lpWStrView)
+{
+    WStrViewAssertValid(lpWStrView);
+
+    const BOOL x = (0 == lpWStrView->ulSize);
+    return x;
+}
+
+static int
+StaticWStrViewCompareSize(_In_ const struct WStrView *lpWStrViewLeft,
+                          _In_ const struct WStrView *lpWStrViewRight)
+{
+    // Shorter is less, e.g., L"abc" < L"abcd"
+    const int cmp = (lpWStrViewLeft->ulSize < lpWStrViewRight->ulSize) ? -1
+                  : (lpWStrViewLeft->ulSize > lpWStrViewRight->ulSize) ? 1 : 0;
+    return cmp;
+}
+
+int
+WStrViewCompare(_In_ const struct WStrView *lpWStrViewLeft,
+                _In_ const struct WStrView *lpWStrViewRight)
+{
+    WStrViewAssertValid(lpWStrViewLeft);
+    WStrViewAssertValid(lpWStrViewRight);
+
+    const size_t ulMinSize = (lpWStrViewLeft->ulSize < lpWStrViewRight->ulSize) ? lpWStrViewLeft->ulSize : lpWStrViewRight->ulSize;
+    const size_t ulMismatchIndex = WStrSimdMismatch(lpWStrViewLeft->lpWCharArr, lpWStrViewRight->lpWCharArr, ulMinSize);
+    if (ulMismatchIndex < ulMinSize)
+    {
+        // Intentional: Same as wcscmp() on Windows: wchar_t is unsigned.
+        const wchar_t wchLeft  = lpWStrViewLeft->lpWCharArr[ulMismatchIndex];
+        const wchar_t wchRight = lpWStrViewRight->lpWCharArr[ulMismatchIndex];
+        const int cmp = (wchLeft < wchRight) ? -1 : 1;
+        return cmp;
+    }
+
+    const int cmp = StaticWStrViewCompareSize(lpWStrViewLeft, lpWStrViewRight);
+    return cmp;
+}
+
+int
+WStrViewCompareI(_In_ const struct WStrView *lpWStrViewLeft,
+                 _In_ const struct WStrView *lpWStrViewRight)
+{
+    WStrViewAssertValid(lpWStrViewLeft);
+    WStrViewAssertValid(lpWStrViewRight);
+
+    const size_t ulMinSize = (lpWStrViewLeft->ulSize < lpWStrViewRight->ulSize) ? lpWStrViewLeft->ulSize : lpWStrViewRight->ulSize;
+    if (ulMinSize > 0)
+    {
+        // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/strnicmp-wcsnicmp-mbsnicmp-strnicmp-l-wcsnicmp-l-mbsnicmp-l?view=msvc-170
+        const int cmp = _wcsnicmp(lpWStrViewLeft->lpWCharArr, lpWStrViewRight->lpWCharArr, ulMinSize);
+        if (0 != cmp) {
+            return cmp;
+        }
+    }
+
+    const int cmp = StaticWStrViewCompareSize(lpWStrViewLeft, lpWStrViewRight);
+    return cmp;
+}
+
+void
+WStrViewTrim(_Inout_ struct WStrView             *lpWStrView,
+             _In_    const enum EWStrTrim         eWStrTrim,
+             _In_    const WStrCharPredicateFunc  fpWStrCharPredicateFunc)
+{
+    WStrViewAssertValid(lpWStrView);
+    assert(eWStrTrim >= WSTR_LTRIM && eWStrTrim <= (WSTR_LTRIM | WSTR_RTRIM));
+    assert(NULL != fpWStrCharPredicateFunc);
+
+    // Same as WStrTrim()
+    const bool bIsSpace = ((WStrCharPredicateFunc) iswspace == fpWStrCharPredicateFunc);
+
+    size_t ulBeginIndex = 0;
+    if (0 != (eWStrTrim & WSTR_LTRIM) && bIsSpace)
+    {
+        ulBeginIndex = WStrSimdSpanSpace(lpWStrView->lpWCharArr, lpWStrView->ulSize);
+    }
+    else if (0 != (eWStrTrim & WSTR_LTRIM))
+    {
+        while (ulBeginIndex < lpWStrView->ulSize && fpWStrCharPredicateFunc(lpWStrView->lpWCharArr[ulBeginIndex]))
+        {
+            ++ulBeginIndex;
+        }
+    }
+
+    // Intentional: Exclusive
+    size_t ulEndIndex = lpWStrView->ulSize;
+    if (0 != (eWStrTrim & WSTR_RTRIM) && bIsSpace)
+    {
+        ulEndIndex -= WStrSimdRSpanSpace(lpWStrView->lpWCharArr + ulBeginIndex, ulEndIndex - ulBeginIndex);
+    }
+    else if (0 != (eWStrTrim & WSTR_RTRIM))
+    {
+        while (ulEndIndex > ulBeginIndex && fpWStrCharPredicateFunc(lpWStrView->lpWCharArr[ulEndIndex - 1U]))
+        {
+            --ulEndIndex;
+        }
+    }
+
+    // If trim all wchars, then match WStrTrim(): NULL.
+    if (ulBeginIndex == ulEndIndex)
+    {
+        lpWStrView->lpWCharArr = NULL;
+        lpWStrView->ulSize     = 0;
+        return;
+    }
+
+    lpWStrView->lpWCharArr += ulBeginIndex;
+    lpWStrView->ulSize      = ulEndIndex - ulBeginIndex;
+}
+
+void
+WStrViewLTrimSpace(_Inout_ struct WStrView *lpWStrView)
+{
+    WStrViewTrim(lpWStrView, WSTR_LTRIM, iswspace);
+}
+
+void
+WStrViewRTrimSpace(_Inout_ struct WStrView *lpWStrView)
+{
+    WStrViewTrim(lpWStrView, WSTR_RTRIM, iswspace);
+}
+
+void
+WStrViewTrimSpace(_Inout_ struct WStrView *lpWStrView)
+{
+    WStrViewTrim(lpWStrView, WSTR_LTRIM | WSTR_RTRIM, iswspace);
+}
+
+void
+WStrCopyWStrView(_Inout_ struct WStr           *lpDestWStr,
+                 _In_    const struct WStrView *lpSrcWStrView)
+{
+    WStrViewAssertValid(lpSrcWStrView);
+
+    WStrCopyWCharArr0(lpDestWStr, lpSrcWStrView->lpWCharArr, lpSrcWStrView->ulSize);
+}
+
+void
+WStrCopyWStrViewXArena(_Inout_ struct WStr           *lpDestWStr,
+                       _In_    const struct WStrView *lpSrcWStrView,
+                       _Inout_ struct XArena         *lpArena)
+{
+    WStrViewAssertValid(lpSrcWStrView);
+    WStrFree(lpDestWStr);
+
+    // Intentional: Not zeroed.  Why?  All wchars are written below.
+    wchar_t *lpWCharArr = XArenaMalloc(lpArena, (lpSrcWStrView->ulSize + LEN_NUL_CHAR) * sizeof(wchar_t));
+    if (lpSrcWStrView->ulSize > 0) {
+        wmemcpy(lpWCharArr, lpSrcWStrView->lpWCharArr, lpSrcWStrView->ulSize);
+    }
+    lpWCharArr[lpSrcWStrView->ulSize] = L'\0';
+
+    lpDestWStr->lpWCharArr = lpWCharArr;
+    lpDestWStr->ulSize     = lpSrcWStrView->ulSize;
+    lpDestWStr->eAlloc     = WSTR_ALLOC_ARENA;
+}
+
+static void
+WStrSplitView0(_In_    const struct WStrView             *lpWStrViewText,
+               _In_    const struct WStrView             *lpWStrViewDelim,
+               _In_    const struct WStrViewSplitOptions *lpOptions,
+               _In_    const BOOL                         bDiscardFinalEmptyToken,
+               // @Nullable
+               _Inout_ struct XArena                     *lpNullableArena,
+               _Inout_ struct WStrViewArr                *lpTokenWStrViewArr)
+{
+    WStrViewAssertValid(lpWStrViewText);
+    WStrViewAssertValid(lpWStrViewDelim);
+    // Do not allow empty delim
+    assert(0 != lpWStrViewDelim->ulSize);
+    assert(NULL != lpOptions);
+    assert(UNLIMITED_MIN_TOKEN_COUNT == lpOptions->iMinTokenCount || lpOptions->iMinTokenCount >= 1);
+    assert(UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount || lpOptions->iMaxTokenCount >= 2);
+    if (NULL == lpNullableArena) {
+        WStrViewArrFree(lpTokenWStrViewArr);
+    }
+    else {
+        // Intentional: Do not free.  Why?  Previous array is empty or from arena.
+        *lpTokenWStrViewArr = (struct WStrViewArr) {0};
+    }
+
+    const wchar_t *lpEnd = lpWStrViewText->lpWCharArr + lpWStrViewText->ulSize;
+
+    // Important: Text after last delim is final token.
+    const int iMaxDelimCount = (UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount)
+        ? UNLIMITED_MAX_TOKEN_COUNT : (lpOptions->iMaxTokenCount - 1);
+    size_t ulDelimCount = 0;
+
+    // Step 1: Count number of delimiters
+    const wchar_t *lpIter = lpWStrViewText->lpWCharArr;
+    while (TRUE)
+    {
+        const wchar_t *lpNextDelim = StaticWCharArrFind(lpIter, lpEnd, lpWStrViewDelim);
+        if (NULL == lpNextDelim) {
+            break;
+        }
+
+        lpIter = lpNextDelim + lpWStrViewDelim->ulSize;
+
+        // Same rule as WStrSplit0(): "abc" and "abc\r\n" will split as: ["abc"]
+        if (lpEnd == lpIter && TRUE == bDiscardFinalEmptyToken) {
+            break;
+        }
+
+        ++ulDelimCount;
+
+        if (UNLIMITED_MAX_TOKEN_COUNT != iMaxDelimCount && ((size_t) iMaxDelimCount) == ulDelimCount) {
+            break;
+        }
+    }
+
+    const size_t ulTokenCount = 1U + ulDelimCount;
+
+    if (UNLIMITED_MIN_TOKEN_COUNT != lpOptions->iMinTokenCount && ulTokenCount < ((size_t) lpOptions->iMinTokenCount))
+    {
+        Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                    L"ERROR: Failed to split [%.*ls] with delim [%.*ls]: ulTokenCount < lpOptions->iMinTokenCount: %zu < %d",  // _In_ const wchar_t *lpMessageFormat,
+                                    (int) lpWStrViewText->ulSize, lpWStrViewText->lpWCharArr,
+                                    (int) lpWStrViewDelim->ulSize, lpWStrViewDelim->lpWCharArr,
+                                    ulTokenCount, lpOptions->iMinTokenCount);  // _In_ ...
+    }
+
+    if (NULL == lpNullableArena) {
+        WStrViewArrAlloc(lpTokenWStrViewArr, ulTokenCount);
+    }
+    else {
+        lpTokenWStrViewArr->lpWStrViewArr = XArenaCalloc(lpNullableArena, ulTokenCount, sizeof(struct WStrView));
+        lpTokenWStrViewArr->ulSize        = ulTokenCount;
+    }
+
+    // Step 2: Point each token between delimiters.  Zero copies.
+    lpIter = lpWStrViewText->lpWCharArr;
+    for (size_t ulTokenIndex = 0; ulTokenIndex < ulTokenCount; ++ulTokenIndex)
+    {
+        // Intention: Include (UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount) for readability.
+        const BOOL bIsLastToken =
+            (UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount)
+                ? FALSE : (1U + ulTokenIndex == ((size_t) lpOptions->iMaxTokenCount));
+
+        const wchar_t *lpNextDelim = StaticWCharArrFind(lpIter, lpEnd, lpWStrViewDelim);
+        if (NULL == lpNextDelim || bIsLastToken)
+        {
+            // Point to end of text
+            lpNextDelim = lpEnd;
+        }
+
+        struct WStrView *lpTokenWStrView = lpTokenWStrViewArr->lpWStrViewArr + ulTokenIndex;
+        // Note: Empty token is allowed, e.g., L""
+        lpTokenWStrView->ulSize     = lpNextDelim - lpIter;
+        lpTokenWStrView->lpWCharArr = (0 == lpTokenWStrView->ulSize) ? NULL : lpIter;
+
+        // Note: In final iteration, 'lpIter' may point past lpEnd.
+        lpIter = lpNextDelim + lpWStrViewDelim->ulSize;
+    }
+
+    if (NULL != lpOptions->fpNullableWStrViewConsumerFunc)
+    {
+        WStrViewArrForEach(lpTokenWStrViewArr, lpOptions->fpNullableWStrViewConsumerFunc);
+    }
+}
+
+void
+WStrSplitView(_In_    const struct WStrView             *lpWStrViewText,
+              _In_    const struct WStrView             *lpWStrViewDelim,
+              _In_    const struct WStrViewSplitOptions *lpOptions,
+              _Inout_ struct WStrViewArr                *lpTokenWStrViewArr)
+{
+    const BOOL bDiscardFinalEmptyToken = FALSE;
+    WStrSplitView0(lpWStrViewText, lpWStrViewDelim, lpOptions, bDiscardFinalEmptyToken, NULL, lpTokenWStrViewArr);
+}
+
+void
+WStrSplitViewXArena(_In_    const struct WStrView             *lpWStrViewText,
+                    _In_    const struct WStrView             *lpWStrViewDelim,
+                    _In_    const struct WStrViewSplitOptions *lpOptions,
+                    _Inout_ struct XArena                     *lpArena,
+                    _Inout_ struct WStrViewArr                *lpTokenWStrViewArr)
+{
+    XArenaAssertValid(lpArena);
+
+    const BOOL bDiscardFinalEmptyToken = FALSE;
+    WStrSplitView0(lpWStrViewText, lpWStrViewDelim, lpOptions, bDiscardFinalEmptyToken, lpArena, lpTokenWStrViewArr);
+}
+
+void
+WStrSplitNewLineView(_In_    const struct WStrView             *lpWStrViewText,
+                     _In_    const struct WStrViewSplitOptions *lpOptions,
+                     _Inout_ struct WStrViewArr                *lpTokenWStrViewArr)
+{
+    WStrViewAssertValid(lpWStrViewText);
+    WStrViewArrFree(lpTokenWStrViewArr);
+
+    const BOOL bDiscardFinalEmptyToken = TRUE;
+    const struct WStrView crlfWStrView = WSTR_VIEW_FROM_LITERAL(L"\r\n");
+    const wchar_t *lpEnd = lpWStrViewText->lpWCharArr + lpWStrViewText->ulSize;
+
+    if (NULL != StaticWCharArrFind(lpWStrViewText->lpWCharArr, lpEnd, &crlfWStrView))
+    {
+        WStrSplitView0(lpWStrViewText, &crlfWStrView, lpOptions, bDiscardFinalEmptyToken, NULL, lpTokenWStrViewArr);
+    }
+    else  // Intentional: Do not check if contains L"\n".  Why?  Always apply rules for lpOptions->iMinTokenCount.
+    {
+        const struct WStrView lfWStrView = WSTR_VIEW_FROM_LITERAL(L"\n");
+        WStrSplitView0(lpWStrViewText, &lfWStrView, lpOptions, bDiscardFinalEmptyToken, NULL, lpTokenWStrViewArr);
+    }
+}
+
+void
+WStrViewArrAssertValid(_In_ const struct WStrViewArr *lpWStrViewArr)
+{
+    assert(NULL != lpWStrViewArr);
+    if (lpWStrViewArr->ulSize > 0)
+    {
+        assert(NULL != lpWStrViewArr->lpWStrViewArr);
+    }
+}
+
+void
+WStrViewArrFree(_Inout_ struct WStrViewArr *lpWStrViewArr)
+{
+    WStrViewArrAssertValid(lpWStrViewArr);
+
+    // Intentional: Do not free viewed wchars.  They are owned by the source buffer.
+    xfree((void **) &(lpWStrViewArr->lpWStrViewArr));
+    lpWStrViewArr->ulSize = 0;  // Explicit
+}
+
+void
+WStrViewArrAlloc(_Inout_ struct WStrViewArr *lpWStrViewArr,
+                 _In_    const size_t        ulSize)
+{
+    WStrViewArrFree(lpWStrViewArr);
+    if (ulSize > 0)
+    {
+        lpWStrViewArr->lpWStrViewArr = xcalloc(ulSize, sizeof(struct WStrView));
+        lpWStrViewArr->ulSize = ulSize;
+    }
+}
+
+void
+WStrViewArrForEach(_Inout_ struct WStrViewArr         *lpWStrViewArr,
+                   _In_    const WStrViewConsumerFunc  fpWStrViewConsumerFunc)
+{
+    WStrViewArrAssertValid(lpWStrViewArr);
+    assert(NULL != fpWStrViewConsumerFunc);
+
+    for (size_t i = 0; i < lpWStrViewArr->ulSize; ++i)
+    {
+        struct WStrView *lpWStrView = lpWStrViewArr->lpWStrViewArr + i;
+        fpWStrViewConsumerFunc(lpWStrView);
+    }
+}
+
+void
+WStrArrCopyWStrViewArrArena(_Inout_ struct WStrArr           *lpDestWStrArr,
+                            _In_    const struct WStrViewArr *lpSrcWStrViewArr)
+{
+    WStrViewArrAssertValid(lpSrcWStrViewArr);
+    WStrArrFree(lpDestWStrArr);
+
+    if (0 == lpSrcWStrViewArr->ulSize) {
+        return;
+    }
+
+    // Step 1: Calculate arena size
+    size_t ulArenaSize = 0;
+    for (size_t i = 0; i < lpSrcWStrViewArr->ulSize; ++i)
+    {
+        ulArenaSize += lpSrcWStrViewArr->lpWStrViewArr[i].ulSize + LEN_NUL_CHAR;
+    }
+
+    // Step 2: Exactly two allocations.  xcalloc() also writes final '\0' char for each element.
+    lpDestWStrArr->lpWStrArr               = xcalloc(lpSrcWStrViewArr->ulSize, sizeof(struct WStr));
+    lpDestWStrArr->ulSize                  = lpSrcWStrViewArr->ulSize;
+    lpDestWStrArr->ulCapacity              = lpSrcWStrViewArr->ulSize;
+    lpDestWStrArr->lpNullableArenaWCharArr = xcalloc(ulArenaSize, sizeof(wchar_t));
+
+    // Step 3: Copy wchars.  Intentional: Do not use small string buffer.  Why?  Arena is already one block.
+    wchar_t *lpIter = lpDestWStrArr->lpNullableArenaWCharArr;
+    for (size_t i = 0; i < lpSrcWStrViewArr->ulSize; ++i)
+    {
+        const struct WStrView *lpWStrView = lpSrcWStrViewArr->lpWStrViewArr + i;
+        struct WStr           *lpWStr     = lpDestWStrArr->lpWStrArr + i;
+        if (lpWStrView->ulSize > 0) {
+            wmemcpy(lpIter, lpWStrView->lpWCharArr, lpWStrView->ulSize);
+        }
+        lpWStr->lpWCharArr = lpIter;
+        lpWStr->ulSize     = lpWStrView->ulSize;
+        lpWStr->eAlloc     = WSTR_ALLOC_ARENA;
+        lpIter += lpWStrView->ulSize + LEN_NUL_CHAR;
+    }
+    assert(lpDestWStrArr->lpNullableArenaWCharArr + ulArenaSize == lpIter);
+}
+
+static void
+StaticWStrSplitArena0(_In_    const struct WStrView             *lpWStrViewText,
+                      _In_    const struct WStrView             *lpWStrViewDelim,
+                      _In_    const struct WStrViewSplitOptions *lpOptions,
+                      _In_    const BOOL                         bDiscardFinalEmptyToken,
+                      _Inout_ struct WStrArr                    *lpTokenWStrArr)
+{
+    WStrViewAssertValid(lpWStrViewText);
+    WStrViewAssertValid(lpWStrViewDelim);
+    // Do not allow empty delim
+    assert(0 != lpWStrViewDelim->ulSize);
+    assert(NULL != lpOptions);
+    assert(UNLIMITED_MIN_TOKEN_COUNT == lpOptions->iMinTokenCount || lpOptions->iMinTokenCount >= 1);
+    assert(UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount || lpOptions->iMaxTokenCount >= 2);
+    WStrArrFree(lpTokenWStrArr);
+
+    // Intentional: Allocate arena once, before the scan.  Why?  Elements point into arena, so it can never move.
+    // Each token is followed by a delim (at least one wchar) or end of text, so tokens plus one '\0' each can never
+    // exceed (text size + 1).  Delims are wasted space, but this is much cheaper than a second pass.
+    const size_t ulArenaSize = lpWStrViewText->ulSize + LEN_NUL_CHAR;
+    WStrArrReserve(lpTokenWStrArr, WSTR_ARR_MIN_CAPACITY);
+    lpTokenWStrArr->lpNullableArenaWCharArr = xcalloc(ulArenaSize, sizeof(wchar_t));
+
+    const wchar_t *lpEnd = lpWStrViewText->lpWCharArr + lpWStrViewText->ulSize;
+    wchar_t *lpArenaIter = lpTokenWStrArr->lpNullableArenaWCharArr;
+
+    // Same rules as WStrSplit0(): Single pass over text.
+    const wchar_t *lpIter = lpWStrViewText->lpWCharArr;
+    while (TRUE)
+    {
+        // Intention: Include (UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount) for readability.
+        const BOOL bIsLastToken =
+            (UNLIMITED_MAX_TOKEN_COUNT == lpOptions->iMaxTokenCount)
+                ? FALSE : (1U + lpTokenWStrArr->ulSize == ((size_t) lpOptions->iMaxTokenCount));
+
+        const wchar_t *lpNextDelim = bIsLastToken ? NULL : StaticWCharArrFind(lpIter, lpEnd, lpWStrViewDelim);
+        if (NULL == lpNextDelim)
+        {
+            // Important: Text after last delim is final token.
+            lpNextDelim = lpEnd;
+        }
+
+        // Note: Empty token is allowed, e.g., L""
+        struct WStrView tokenWStrView = {.lpWCharArr = lpIter, .ulSize = (size_t) (lpNextDelim - lpIter)};
+        if (0 == tokenWStrView.ulSize) {
+            tokenWStrView.lpWCharArr = NULL;
+        }
+        // Intentional: Apply consumer before copy.  Why?  Trimmed wchars are never copied.
+        if (NULL != lpOptions->fpNullableWStrViewConsumerFunc) {
+            lpOptions->fpNullableWStrViewConsumerFunc(&tokenWStrView);
+        }
+
+        if (lpTokenWStrArr->ulSize == lpTokenWStrArr->ulCapacity) {
+            WStrArrReserve(lpTokenWStrArr, 2U * lpTokenWStrArr->ulCapacity);
+        }
+        if (tokenWStrView.ulSize > 0) {
+            wmemcpy(lpArenaIter, tokenWStrView.lpWCharArr, tokenWStrView.ulSize);
+        }
+        // Intentional: Final '\0' char is already written by xcalloc().
+        struct WStr *lpTokenWStr = lpTokenWStrArr->lpWStrArr + lpTokenWStrArr->ulSize;
+        lpTokenWStr->lpWCharArr = lpArenaIter;
+        lpTokenWStr->ulSize     = tokenWStrView.ulSize;
+        lpTokenWStr->eAlloc     = WSTR_ALLOC_ARENA;
+        ++(lpTokenWStrArr->ulSize);
+        lpArenaIter += tokenWStrView.ulSize + LEN_NUL_CHAR;
+        assert(lpArenaIter <= lpTokenWStrArr->lpNullableArenaWCharArr + ulArenaSize);
+
+        if (lpEnd == lpNextDelim) {
+            break;
+        }
+
+        lpIter = lpNextDelim + lpWStrViewDelim->ulSize;
+
+        // Same rule as WStrSplit0(): "abc" and "abc\r\n" will split as: ["abc"]
+        if (lpEnd == lpIter && TRUE == bDiscardFinalEmptyToken) {
+            break;
+        }
+    }
+
+    const size_t ulTokenCount = lpTokenWStrArr->ulSize;
+
+    if (UNLIMITED_MIN_TOKEN_COUNT != lpOptions->iMinTokenCount && ulTokenCount < ((size_t) lpOptions->iMinTokenCount))
+    {
+        Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                    L"ERROR: Failed to split [%.*ls] with delim [%.*ls]: ulTokenCount < lpOptions->iMinTokenCount: %zu < %d",  // _In_ const wchar_t *lpMessageFormat,
+                                    (int) lpWStrViewText->ulSize, lpWStrViewText->lpWCharArr,
+                                    (int) lpWStrViewDelim->ulSize, lpWStrViewDelim->lpWCharArr,
+                                    ulTokenCount, lpOptions->iMinTokenCount);  // _In_ ...
+    }
+}
+
+void
+WStrSplitArena(_In_    const struct WStr                 *lpWStrText,
+               _In_    const struct WStr                 *lpWStrDelim,
+               _In_    const struct WStrViewSplitOptions *lpOptions,
+               _Inout_ struct WStrArr                    *lpTokenWStrArr)
+{
+    WStrAssertValid(lpWStrText);
+    WStrAssertValid(lpWStrDelim);
+
+    const BOOL bDiscardFinalEmptyToken = FALSE;
+    const struct WStrView textWStrView  = WSTR_VIEW_FROM_WSTR(lpWStrText);
+    const struct WStrView delimWStrView = WSTR_VIEW_FROM_WSTR(lpWStrDelim);
+    StaticWStrSplitArena0(&textWStrView, &delimWStrView, lpOptions, bDiscardFinalEmptyToken, lpTokenWStrArr);
+}
+
+void
+WStrSplitNewLineArena(_In_    const struct WStr                 *lpWStrText,
+                      _In_    const struct WStrViewSplitOptions *lpOptions,
+                      _Inout_ struct WStrArr                    *lpTokenWStrArr)
+{
+    WStrAssertValid(lpWStrText);
+
+    const BOOL bDiscardFinalEmptyToken = TRUE;
+    const struct WStrView textWStrView = WSTR_VIEW_FROM_WSTR(lpWStrText);
+
+    if (NULL != WStrSimdFindWCharArr(lpWStrText->lpWCharArr, lpWStrText->ulSize, L"\r\n", 2))
+    {
+        const struct WStrView crlfWStrView = WSTR_VIEW_FROM_LITERAL(L"\r\n");
+        StaticWStrSplitArena0(&textWStrView, &crlfWStrView, lpOptions, bDiscardFinalEmptyToken, lpTokenWStrArr);
+    }
+    else  // Intentional: Do not check if contains L"\n".  Why?  Always apply rules for lpOptions->iMinTokenCount.
+    {
+        const struct WStrView lfWStrView = WSTR_VIEW_FROM_LITERAL(L"\n");
+        StaticWStrSplitArena0(&textWStrView, &lfWStrView, lpOptions, bDiscardFinalEmptyToken, lpTokenWStrArr);
+    }
+}
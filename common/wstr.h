@@ -2,6 +2,7 @@
 #define H_COMMON_WSTR
 
 #include "win32.h"
+#include "xarena.h"
 #include <wchar.h>  // required for wchar_t
 #include <sal.h>    // required for _Inout_, etc.
 #include <windef.h>  // required for UINT
@@ -13,14 +14,97 @@ SafeWCharArrCopy(_Out_ wchar_t       *lpDestWCharArr,                // dest wst
                  _In_  const wchar_t *lpSrcWCharArr,                 // source wstr ptr
                  _In_  const size_t   ulWCharCount);                 // wchar count to be copied (excluding null char)
 
+// Number of wchars in small-string buffer WStr.smallWCharArr, including final '\0' char
+// Strings shorter than this size (excluding final '\0' char) are stored inline: no heap alloc.
+#define WSTR_SMALL_CAPACITY 16
+
+/**
+ * Who owns {@code WStr#lpWCharArr}?  Each value has different rules to read, write, malloc, and free.
+ * "Write" means in-place write by WStrAlloc(), WStrCopyWStr(), WStrSPrintF(), WStrTrim(), etc.
+ */
+enum EWStrAlloc
+{
+    /**
+     * {@code WStr#lpWCharArr} is NULL, inline buffer {@code WStr#smallWCharArr}, or heap-allocated and owned.
+     * {@code
+     * struct WStr wstr = {0};
+     * WStrSPrintF(&wstr, L"%d", 123);
+     * WStrFree(&wstr);}
+     *
+     * Read  : Yes -- It is safe to read from this string.
+     * Write : Yes -- Existing buffer is freed and replaced.
+     * Malloc: Yes -- If too long for inline buffer.
+     * Free  : Yes -- WStrFree() frees heap buffer.
+     *
+     * Intentional: Value is zero.  Why?  Supports: {@code struct WStr wstr = {0};}
+     * All code written before EWStrAlloc existed (zero-init, direct assignment after WStrFree()) is unchanged.
+     */
+    WSTR_ALLOC_HEAP    = 0,
+    /**
+     * {@code WStr#lpWCharArr} is read-only and borrowed, e.g., string literal.  Must outlive the WStr.
+     * {@code
+     * const struct WStr wstr = WSTR_FROM_LITERAL(L"read-only string literal");}
+     *
+     * Read  : Yes -- It is safe to read from this string.
+     * Write : No  -- Never written in place.  Write replaces with new owned buffer, then WSTR_ALLOC_HEAP.
+     * Malloc: Yes -- Only on write.
+     * Free  : No  -- WStrFree() only forgets pointer, then WSTR_ALLOC_HEAP.
+     */
+    WSTR_ALLOC_LITERAL = 1,
+    /**
+     * {@code WStr#lpWCharArr} is a caller-owned buffer, usually on the stack, with capacity
+     * {@code WStr#ulStackCapacity}.  Must outlive the WStr.
+     * {@code
+     * wchar_t lpBufferWCharArr[256];
+     * struct WStr wstr = {0};
+     * WStrInitStackBuffer(&wstr, lpBufferWCharArr, sizeof(lpBufferWCharArr) / sizeof(lpBufferWCharArr[0]));
+     * WStrSPrintF(&wstr, L"%d", 123);  // No heap alloc
+     * WStrFree(&wstr);}
+     *
+     * Read  : Yes -- It is safe to read from this string.
+     * Write : Yes -- In place, if result fits: {@code ulSize < ulStackCapacity}.
+     * Malloc: Yes -- Only if result does not fit.  Then WSTR_ALLOC_HEAP; buffer is no longer used.  Same as WStrBuilder.
+     * Free  : No  -- WStrFree() only forgets pointer, then WSTR_ALLOC_HEAP.
+     */
+    WSTR_ALLOC_STACK   = 2,
+    /**
+     * {@code WStr#lpWCharArr} is allocated from a struct XArena, e.g., WStrCopyWStrViewXArena().
+     * Must not outlive the arena (or its next reset).
+     * {@code
+     * struct XArena arena = {0};
+     * struct WStr wstr = {0};
+     * WStrCopyWStrViewXArena(&wstr, &wstrView, &arena);
+     * WStrFree(&wstr);  // optional
+     * XArenaFree(&arena);}
+     *
+     * Read  : Yes -- It is safe to read from this string.
+     * Write : No  -- Never written in place.  Write replaces with new owned buffer, then WSTR_ALLOC_HEAP.
+     * Malloc: Yes -- Only on write.
+     * Free  : No  -- WStrFree() only forgets pointer, then WSTR_ALLOC_HEAP.  XArenaFree() releases wchars.
+     */
+    WSTR_ALLOC_ARENA   = 3,
+};
+
 struct WStr
 {
     // always terminated with '\0'
     // if 0 == ulSize, lpWCharArr can be NULL or L"" (empty string)
-    wchar_t *lpWCharArr;
+    // if lpWCharArr == smallWCharArr, then string is stored inline (small-string optimisation)
+    wchar_t         *lpWCharArr;
     // non-negative number of wchars in member 'lpWCharArr', excluding final '\0' char
     // usually: wcslen(lpWCharArr)
-    size_t   ulSize;
+    size_t           ulSize;
+    // Intentional: Union.  Why?  Inline buffer is never used by WSTR_ALLOC_STACK.
+    union
+    {
+        // Important: Since lpWCharArr may point to this member, do not copy a WStr by value (assignment or memcpy).
+        // Instead, call WStrMove() or WStrCopyWStr().
+        wchar_t      smallWCharArr[WSTR_SMALL_CAPACITY];
+        // Only if WSTR_ALLOC_STACK: Number of wchars in lpWCharArr, including final '\0' char
+        size_t       ulStackCapacity;
+    };
+    // Note: struct WStr wstr = {0} -> WSTR_ALLOC_HEAP
+    enum EWStrAlloc  eAlloc;
 };
 
 // Intentional: Cast to (const struct WStr) to make compatible with both initialisation and assignment.
@@ -34,13 +118,15 @@ struct WStr
 #define WSTR_FROM_LITERAL(/* wchar_t* */ lpNullableLiteral) \
     ((const struct WStr) { \
         .lpWCharArr = (wchar_t *) (lpNullableLiteral), \
-        .ulSize     = (NULL == (lpNullableLiteral) ? 0 : ((sizeof(lpNullableLiteral) / sizeof(wchar_t)) - 1)) \
+        .ulSize     = (NULL == (lpNullableLiteral) ? 0 : ((sizeof(lpNullableLiteral) / sizeof(wchar_t)) - 1)), \
+        .eAlloc     = WSTR_ALLOC_LITERAL \
     })
 
 #define WSTR_FROM_WCHAR_ARR(/* wchar_t[] */ wcharArr) \
     ((const struct WStr) { \
         .lpWCharArr = (wchar_t *) (wcharArr), \
-        .ulSize     = ((sizeof(wcharArr) / sizeof(wchar_t)) - 1) \
+        .ulSize     = ((sizeof(wcharArr) / sizeof(wchar_t)) - 1), \
+        .eAlloc     = WSTR_ALLOC_LITERAL \
     })
 
 /**
@@ -58,21 +144,81 @@ struct WStr
 #define WSTR_FROM_VALUE(/* wchar_t* */ lpNullableValue) \
     ((const struct WStr) { \
         .lpWCharArr = (wchar_t *) (lpNullableValue), \
-        .ulSize     = (NULL == (lpNullableValue) ? 0 : wcslen((lpNullableValue))) \
+        .ulSize     = (NULL == (lpNullableValue) ? 0 : wcslen((lpNullableValue))), \
+        .eAlloc     = WSTR_ALLOC_LITERAL \
     })
 
 struct WStrArr
 {
     struct WStr *lpWStrArr;
     size_t       ulSize;
+    // Number of allocated elements in lpWStrArr.  Always >= ulSize.
+    // Zero is allowed for static arrays that are never freed or appended, e.g., WIN32_MESSAGE_BOX_BUTTON_TEXT_WSTR_ARR.
+    size_t       ulCapacity;
+    // @Nullable
+    // If not NULL, this is "arena mode": wchars of all elements live in this one block, owned by this array.
+    // Each element is WSTR_ALLOC_ARENA: WStrFree() on an element only forgets the pointer.  WStrArrFree() is one xfree().
+    wchar_t     *lpNullableArenaWCharArr;
 };
 
 void
 WStrAssertValid(_In_ const struct WStr *lpWStr);
 
+/**
+ * Free heap buffer, if any.  Never frees WSTR_ALLOC_LITERAL or WSTR_ALLOC_STACK wchars.
+ * Afterwards, lpWStr is same as {@code struct WStr wstr = {0};}
+ */
 void
 WStrFree(_Inout_ struct WStr *lpWStr);
 
+/**
+ * Free lpWStr, then use caller-owned buffer for all writes that fit.  See: WSTR_ALLOC_STACK
+ * Afterwards, lpWStr is L"" (empty string).
+ *
+ * @param lpBufferWCharArr
+ *        must outlive lpWStr
+ *
+ * @param ulBufferWCharArrLen
+ *        number of wchars in lpBufferWCharArr, including final '\0' char.  Must be at least one.
+ */
+void
+WStrInitStackBuffer(_Inout_ struct WStr  *lpWStr,
+                    _Inout_ wchar_t      *lpBufferWCharArr,
+                    _In_    const size_t  ulBufferWCharArrLen);
+
+/**
+ * @return true if lpWStr->lpWCharArr points to inline buffer lpWStr->smallWCharArr
+ */
+bool
+WStrIsSmall(_In_ const struct WStr *lpWStr);
+
+/**
+ * Free lpWStr, then allocate a zeroed buffer for ulSize wchars plus final '\0' char.
+ * If ulSize is less than WSTR_SMALL_CAPACITY, the inline buffer is used and no heap alloc occurs.
+ * If WSTR_ALLOC_STACK and ulSize fits, the stack buffer is reused and no heap alloc occurs.
+ *
+ * @param ulSize
+ *        if zero, lpWStr->lpWCharArr is NULL, or L"" if WSTR_ALLOC_STACK
+ *
+ * @return lpWStr->lpWCharArr
+ */
+wchar_t *
+WStrAlloc(_Inout_ struct WStr  *lpWStr,
+          _In_    const size_t  ulSize);
+
+/**
+ * Move ownership of lpSrcWStr to lpDestWStr.  If lpSrcWStr is small, inline wchars are copied.
+ * If lpDestWStr is WSTR_ALLOC_STACK and lpSrcWStr fits, wchars are copied into the stack buffer.
+ * Else, lpDestWStr has same EWStrAlloc as lpSrcWStr.
+ * Afterwards, lpSrcWStr is empty and WSTR_ALLOC_HEAP.
+ *
+ * @param lpDestWStr
+ *        destination WStr.  If non-empty, free first.
+ */
+void
+WStrMove(_Inout_ struct WStr *lpDestWStr,
+         _Inout_ struct WStr *lpSrcWStr);
+
 BOOL
 WStrIsEmpty(_In_ const struct WStr *lpWStr);
 
@@ -87,6 +233,26 @@ int
 WStrCompare(_In_ const struct WStr *lpWStrLeft,
             _In_ const struct WStr *lpWStrRight);
 
+/**
+ * FNV-1a hash of wchars.  Same text always has same hash, e.g., for WStrIntern.
+ * Ref: http://www.isthe.com/chongo/tech/comp/fnv/index.html
+ *
+ * @param lpWCharArr
+ *        @Nullable if (0 == ulSize)
+ *        need not be terminated with '\0'
+ */
+size_t
+WStrHashWCharArr(_In_ const wchar_t *lpWCharArr,
+                 _In_ const size_t   ulSize);
+
+/**
+ * Case-insensitive version of WStrHashWCharArr(): Each wchar is hashed as towlower(wchar).
+ * Same rule as WStrViewCompareI(), so L"LCtrl" and L"lctrl" have same hash.
+ */
+size_t
+WStrHashWCharArrI(_In_ const wchar_t *lpWCharArr,
+                  _In_ const size_t   ulSize);
+
 void
 WStrCopyWCharArr(_Inout_ struct WStr   *lpDestWStr,
                  _In_    const wchar_t *lpSrcWCharArr,
@@ -167,7 +333,130 @@ WStrConcatMany(_Inout_ struct WStr       *lpDestWStr,
                _In_    const struct WStr *lpSrcWStr,
                _In_    const struct WStr *lpSrcWStr2, ...);
 
-// Maybe: WStrInsert, WStrAppend
+// Maybe: WStrInsert
+
+/**
+ * Append-only buffer to build a WStr from many parts with amortised O(1) appends.
+ * Unlike WStrConcat() and WStrSPrintF(), the destination is not freed and re-allocated for each part.
+ * <pre>{@code
+ * wchar_t lpBufferWCharArr[256];
+ * struct WStrBuilder sb = {0};
+ * WStrBuilderInitBuffer(&sb, lpBufferWCharArr, sizeof(lpBufferWCharArr) / sizeof(lpBufferWCharArr[0]));  // optional
+ * WStrBuilderAppendWStr(&sb, &wstr);
+ * WStrBuilderAppendF(&sb, L": %d", 123);
+ * WStrBuilderMoveToWStr(&sb, &destWStr);
+ * }</pre>
+ */
+struct WStrBuilder
+{
+    // @Nullable if (0 == ulCapacity)
+    // If not NULL, always terminated with '\0'.
+    wchar_t *lpWCharArr;
+    size_t   ulSize;
+    // Excluding final '\0' char
+    size_t   ulCapacity;
+    // @Nullable
+    // Caller-owned initial buffer, e.g., on stack.  Never freed.  Used if (lpWCharArr == lpNullableInitWCharArr).
+    wchar_t *lpNullableInitWCharArr;
+};
+
+void
+WStrBuilderAssertValid(_In_ const struct WStrBuilder *lpWStrBuilder);
+
+/**
+ * Use a caller-owned buffer until it is full.  Usually, this is a stack buffer: no heap alloc for short results.
+ *
+ * @param lpWStrBuilder
+ *        must be empty
+ *
+ * @param lpBufferWCharArr
+ *        must outlive lpWStrBuilder
+ *
+ * @param ulBufferLen
+ *        including final '\0' char; must be >= 2
+ */
+void
+WStrBuilderInitBuffer(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                      _In_    wchar_t            *lpBufferWCharArr,
+                      _In_    const size_t        ulBufferLen);
+
+void
+WStrBuilderFree(_Inout_ struct WStrBuilder *lpWStrBuilder);
+
+/**
+ * Set size to zero, but keep capacity.  Use to build many strings with one builder.
+ */
+void
+WStrBuilderClear(_Inout_ struct WStrBuilder *lpWStrBuilder);
+
+/**
+ * Ensures capacity for at least ulMinCapacity wchars (excluding final '\0' char).  Grows geometrically.
+ */
+void
+WStrBuilderReserve(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                   _In_    const size_t        ulMinCapacity);
+
+/**
+ * @param lpWCharArr
+ *        does not need to be terminated with '\0'
+ *        @Nullable if ulSize is zero
+ */
+void
+WStrBuilderAppendWCharArr(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                          _In_    const wchar_t      *lpWCharArr,
+                          _In_    const size_t        ulSize);
+
+void
+WStrBuilderAppendWStr(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                      _In_    const struct WStr  *lpWStr);
+
+/**
+ * Calls {@code WStrBuilderAppendFV2(lpWStrBuilder, stderr, lpFormatWCharArr, ap)}.  On error, abort() is called.
+ */
+void
+WStrBuilderAppendF(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                   // @EmptyStringAllowed
+                   _In_    const wchar_t      *lpFormatWCharArr, ...);
+
+/**
+ * Same as WStrBuilderTryAppendFV(), but print errors to lpErrorStream.
+ */
+bool
+WStrBuilderAppendFV2(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                     _In_    FILE               *lpErrorStream,
+                     // @EmptyStringAllowed
+                     _In_    const wchar_t      *lpFormatWCharArr,
+                     _In_    va_list             ap);
+
+/**
+ * Same as WStrBuilderTryAppendFV(), but with variable arguments.
+ */
+bool
+WStrBuilderTryAppendF(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                      // @EmptyStringAllowed
+                      _In_    const wchar_t      *lpFormatWCharArr, ...);
+
+/**
+ * Format directly into spare capacity.  Only if result does not fit: grow, then format again.
+ * <p>
+ * Intentional: Do not print errors.  Why?  This function is used by log.c and win32_last_error.c.
+ *
+ * @return true on success
+ *         false if vswprintf() fails; lpWStrBuilder is unchanged
+ */
+bool
+WStrBuilderTryAppendFV(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                       // @EmptyStringAllowed
+                       _In_    const wchar_t      *lpFormatWCharArr,
+                       _In_    va_list             ap);
+
+/**
+ * Move result to lpDestWStr, then reset lpWStrBuilder to empty.  If result is on the heap, ownership is transferred:
+ * no copy.  If result is in the caller-owned initial buffer, it is copied.
+ */
+void
+WStrBuilderMoveToWStr(_Inout_ struct WStrBuilder *lpWStrBuilder,
+                      _Inout_ struct WStr        *lpDestWStr);
 
 enum EWStrTrim
 {
@@ -201,6 +490,8 @@ struct WStrSplitOptions
 {
     int              iMinTokenCount;  // UNLIMITED_MIN_TOKEN_COUNT for unlimited
     int              iMaxTokenCount;  // UNLIMITED_MAX_TOKEN_COUNT for unlimited
+    // If WStrTrimSpace(), WStrLTrimSpace(), or WStrRTrimSpace(), trim is fused into split: Each token is copied once,
+    // already trimmed.  Any other function is called for each token after split.
     WStrConsumerFunc fpNullableWStrConsumerFunc;
 };
 
@@ -220,16 +511,47 @@ WStrJoin(_In_    const struct WStrArr *lpWStrArr,
          _In_    const struct WStr    *lpDelimWStr,
          _Inout_ struct WStr          *lpDestWStr);
 
+/**
+ * Create or truncate file, then write lpWStr with WStrFileWriter.  No BOM (byte order mark) is written.
+ * To write large output in pieces, see WStrFileWriter.
+ */
 void
 WStrFileWrite(_In_ const wchar_t     *lpFilePath,
               _In_ const UINT         codePage,  // Ex: CP_UTF8
               _In_ const struct WStr *lpWStr);
 
+/**
+ * Like WStrFileWrite(), but append to end of file.  If file does not exist, it is created.
+ */
+void
+WStrFileAppend(_In_ const wchar_t     *lpFilePath,
+               _In_ const UINT         codePage,  // Ex: CP_UTF8
+               _In_ const struct WStr *lpWStr);
+
+/**
+ * Map full file with WStrFileMap, then decode to lpDestWStr.  See WStrFileMapDecode() for size limits.
+ * To read large files, see WStrFileMap and WStrLineReader.
+ */
 void
 WStrFileRead(_In_    const wchar_t *lpFilePath,
              _In_    const UINT     codePage,  // Ex: CP_UTF8
              _Inout_ struct WStr   *lpDestWStr);
 
+/**
+ * Check BOM (byte order mark) at start of file.  UTF-16 and UTF-32 BOMs are not supported: abort() is called.
+ *
+ * @param lpCharArr
+ *        first bytes of file
+ *
+ * @param ulSize
+ *        number of bytes in lpCharArr
+ *
+ * @return number of bytes to skip: 3 for UTF-8 BOM, else 0
+ */
+size_t
+WStrFileGetBOMSize(_In_ const char   *lpCharArr,
+                   _In_ const size_t  ulSize);
+
 void
 WStrArrAssertValid(_In_ const struct WStrArr *lpWStrArr);
 
@@ -240,6 +562,30 @@ void
 WStrArrAlloc(_Inout_ struct WStrArr *lpWStrArr,
              _In_    const size_t    ulSize);
 
+/**
+ * Ensures lpWStrArr->ulCapacity >= ulMinCapacity.  Size is unchanged.
+ * <p>
+ * Important: Because of small string optimisation, after xrealloc(), each small string is re-pointed to its own
+ * inline buffer.  All other pointers into lpWStrArr->lpWStrArr are invalid after this call.
+ */
+void
+WStrArrReserve(_Inout_ struct WStrArr *lpWStrArr,
+               _In_    const size_t    ulMinCapacity);
+
+/**
+ * Copies a wchar_t array as new last element.  Capacity grows geometrically, so n appends are amortised O(n).
+ * <p>
+ * Important: lpWStrArr must not be in arena mode.
+ *
+ * @param lpWCharArr
+ *        does not need to be terminated with '\0'
+ *        @Nullable if ulSize is zero
+ */
+void
+WStrArrAppendWCharArr(_Inout_ struct WStrArr *lpWStrArr,
+                      _In_    const wchar_t  *lpWCharArr,
+                      _In_    const size_t    ulSize);
+
 void
 WStrArrCopyWCharArrArr(_Inout_ struct WStrArr  *lpDestWStrArr,
                        _In_    const wchar_t  **lppSrcWCharArrArr,
@@ -249,5 +595,197 @@ void
 WStrArrForEach(_Inout_ struct WStrArr         *lpWStrArr,
                _In_    const WStrConsumerFunc  fpWStrConsumerFunc);
 
+/**
+ * Non-owning view of wchars: pointer + length.  Never free lpWCharArr.
+ * The source buffer must outlive the view.
+ */
+struct WStrView
+{
+    // Important: May *not* be terminated with '\0', e.g., token from WStrSplitView()
+    // if 0 == ulSize, lpWCharArr can be NULL
+    const wchar_t *lpWCharArr;
+    // non-negative number of wchars in member 'lpWCharArr'
+    size_t         ulSize;
+};
+
+/**
+ * @param lpWStr
+ *        const struct WStr *
+ *
+ * @return const struct WStrView
+ */
+#define WSTR_VIEW_FROM_WSTR(/* const struct WStr * */ lpWStr) \
+    ((const struct WStrView) { \
+        .lpWCharArr = (lpWStr)->lpWCharArr, \
+        .ulSize     = (lpWStr)->ulSize \
+    })
+
+/**
+ * @param lpNullableLiteral
+ *        must be a string literal, e.g., NULL or L"" or L"abc"
+ *
+ * @return const struct WStrView
+ */
+#define WSTR_VIEW_FROM_LITERAL(/* wchar_t* */ lpNullableLiteral) \
+    ((const struct WStrView) { \
+        .lpWCharArr = (lpNullableLiteral), \
+        .ulSize     = (NULL == (lpNullableLiteral) ? 0 : ((sizeof(lpNullableLiteral) / sizeof(wchar_t)) - 1)) \
+    })
+
+struct WStrViewArr
+{
+    struct WStrView *lpWStrViewArr;
+    size_t           ulSize;
+};
+
+// Matches WStrViewTrimSpace(), etc.
+typedef void (*WStrViewConsumerFunc)(_Inout_ struct WStrView *lpWStrView);
+
+struct WStrViewSplitOptions
+{
+    int                  iMinTokenCount;  // UNLIMITED_MIN_TOKEN_COUNT for unlimited
+    int                  iMaxTokenCount;  // UNLIMITED_MAX_TOKEN_COUNT for unlimited
+    WStrViewConsumerFunc fpNullableWStrViewConsumerFunc;
+};
+
+void
+WStrViewAssertValid(_In_ const struct WStrView *lpWStrView);
+
+BOOL
+WStrViewIsEmpty(_In_ const struct WStrView *lpWStrView);
+
+/**
+ * Compare wchars, then length.  Same sign as WStrCompare() for the same text.
+ */
+int
+WStrViewCompare(_In_ const struct WStrView *lpWStrViewLeft,
+                _In_ const struct WStrView *lpWStrViewRight);
+
+/**
+ * Case-insensitive version of WStrViewCompare().  Uses _wcsnicmp().
+ */
+int
+WStrViewCompareI(_In_ const struct WStrView *lpWStrViewLeft,
+                 _In_ const struct WStrView *lpWStrViewRight);
+
+/**
+ * Same as WStrTrim(), but only moves the view bounds.  Never allocates.
+ * If all wchars are trimmed, lpWStrView->lpWCharArr is NULL.
+ */
+void
+WStrViewTrim(_Inout_ struct WStrView             *lpWStrView,
+             _In_    const enum EWStrTrim         eWStrTrim,
+             _In_    const WStrCharPredicateFunc  fpWStrCharPredicateFunc);
+
+void
+WStrViewLTrimSpace(_Inout_ struct WStrView *lpWStrView);
+
+void
+WStrViewRTrimSpace(_Inout_ struct WStrView *lpWStrView);
+
+void
+WStrViewTrimSpace(_Inout_ struct WStrView *lpWStrView);
+
+/**
+ * Copy wchars from a view into an owning WStr (always terminated with '\0').
+ */
+void
+WStrCopyWStrView(_Inout_ struct WStr           *lpDestWStr,
+                 _In_    const struct WStrView *lpSrcWStrView);
+
+/**
+ * Same as WStrCopyWStrView(), but wchars are allocated from lpArena: lpDestWStr is WSTR_ALLOC_ARENA.
+ * Intentional: Never small-string buffer.  Why?  lpDestWStr may be copied by value, like a view.
+ */
+void
+WStrCopyWStrViewXArena(_Inout_ struct WStr           *lpDestWStr,
+                       _In_    const struct WStrView *lpSrcWStrView,
+                       _Inout_ struct XArena         *lpArena);
+
+/**
+ * Same rules as WStrSplit(), but each token is a view into lpWStrViewText.  Zero allocations per token:
+ * only lpTokenWStrViewArr->lpWStrViewArr is allocated.
+ *
+ * @param lpWStrViewText
+ *        Important: Must outlive lpTokenWStrViewArr
+ */
+void
+WStrSplitView(_In_    const struct WStrView             *lpWStrViewText,
+              _In_    const struct WStrView             *lpWStrViewDelim,
+              _In_    const struct WStrViewSplitOptions *lpOptions,
+              _Inout_ struct WStrViewArr                *lpTokenWStrViewArr);
+
+/**
+ * Same as WStrSplitView(), but lpTokenWStrViewArr->lpWStrViewArr is allocated from lpArena.  Zero heap allocations.
+ * <p>
+ * Important: Never call WStrViewArrFree() for lpTokenWStrViewArr.  Release with XArenaResetToMark() or XArenaFree().
+ *
+ * @param lpTokenWStrViewArr
+ *        previous array is not freed: must be empty or also from lpArena
+ */
+void
+WStrSplitViewXArena(_In_    const struct WStrView             *lpWStrViewText,
+                    _In_    const struct WStrView             *lpWStrViewDelim,
+                    _In_    const struct WStrViewSplitOptions *lpOptions,
+                    _Inout_ struct XArena                     *lpArena,
+                    _Inout_ struct WStrViewArr                *lpTokenWStrViewArr);
+
+/**
+ * Same rules as WStrSplitNewLine(), but each line is a view into lpWStrViewText.
+ */
+void
+WStrSplitNewLineView(_In_    const struct WStrView             *lpWStrViewText,
+                     _In_    const struct WStrViewSplitOptions *lpOptions,
+                     _Inout_ struct WStrViewArr                *lpTokenWStrViewArr);
+
+void
+WStrViewArrAssertValid(_In_ const struct WStrViewArr *lpWStrViewArr);
+
+/**
+ * Only frees the array of views, not the viewed wchars.
+ */
+void
+WStrViewArrFree(_Inout_ struct WStrViewArr *lpWStrViewArr);
+
+void
+WStrViewArrAlloc(_Inout_ struct WStrViewArr *lpWStrViewArr,
+                 _In_    const size_t        ulSize);
+
+void
+WStrViewArrForEach(_Inout_ struct WStrViewArr         *lpWStrViewArr,
+                   _In_    const WStrViewConsumerFunc  fpWStrViewConsumerFunc);
+
+/**
+ * Copy each view into lpDestWStrArr in arena mode: All wchars are copied into one block owned by lpDestWStrArr.
+ * Exactly two allocations, regardless of number of views: the array of WStr and the arena.
+ * Each element is terminated with '\0'.
+ */
+void
+WStrArrCopyWStrViewArrArena(_Inout_ struct WStrArr           *lpDestWStrArr,
+                            _In_    const struct WStrViewArr *lpSrcWStrViewArr);
+
+/**
+ * Same rules as WStrSplitView(), but tokens are copied into lpTokenWStrArr in arena mode.  Single pass over text.
+ * All wchars share one allocation (at most text size + 1), and WStrArrFree() is a single xfree() for all wchars.
+ * Only the array of WStr grows geometrically, like WStrArrAppendWCharArr().
+ * Unlike WStrSplitView(), tokens are copied: lpWStrText may be freed before lpTokenWStrArr.
+ * <p>
+ * Intentional: Use WStrViewSplitOptions, not WStrSplitOptions.  Why?  Consumers like WStrTrimSpace() may re-allocate,
+ * which is not allowed for elements in arena mode.  View consumers, e.g., WStrViewTrimSpace(), never allocate.
+ */
+void
+WStrSplitArena(_In_    const struct WStr                 *lpWStrText,
+               _In_    const struct WStr                 *lpWStrDelim,
+               _In_    const struct WStrViewSplitOptions *lpOptions,
+               _Inout_ struct WStrArr                    *lpTokenWStrArr);
+
+/**
+ * Same rules as WStrSplitNewLine(), but lines are copied into lpTokenWStrArr in arena mode.
+ */
+void
+WStrSplitNewLineArena(_In_    const struct WStr                 *lpWStrText,
+                      _In_    const struct WStrViewSplitOptions *lpOptions,
+                      _Inout_ struct WStrArr                    *lpTokenWStrArr);
+
 #endif  // H_COMMON_WSTR
 
@@ -0,0 +1,363 @@
+#include "wstr_file_map.h"
+#include "xmalloc.h"
+#include "win32_last_error.h"
+#include "wstr_utf8.h"
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+#include <stdint.h>  // required for SIZE_MAX
+#include <limits.h>  // required for INT_MAX
+#include <string.h>  // required for memchr()
+
+void
+WStrFileMapAssertValid(_In_ const struct WStrFileMap *lpFileMap)
+{
+    assert(NULL != lpFileMap);
+    assert(INVALID_HANDLE_VALUE != lpFileMap->hFile);
+    assert(NULL != lpFileMap->hFile);
+    if (0 == lpFileMap->ulByteSize)
+    {
+        assert(NULL == lpFileMap->hNullableFileMapping);
+        assert(NULL == lpFileMap->lpCharArr);
+    }
+    else
+    {
+        assert(NULL != lpFileMap->hNullableFileMapping);
+        assert(NULL != lpFileMap->lpCharArr);
+    }
+    assert(lpFileMap->ulBOMSize <= lpFileMap->ulByteSize);
+    assert(lpFileMap->ulLineByteOffset >= lpFileMap->ulBOMSize);
+    assert(lpFileMap->ulLineByteOffset <= lpFileMap->ulByteSize);
+    WStrBuilderAssertValid(&(lpFileMap->lineWStrBuilder));
+}
+
+void
+WStrFileMapOpen(_Out_ struct WStrFileMap *lpFileMap,
+                _In_  const wchar_t      *lpFilePathWCharArr,
+                _In_  const UINT          codePage)  // Ex: CP_UTF8
+{
+    if (!WStrFileMapOpen2(lpFileMap, lpFilePathWCharArr, codePage, stderr))
+    {
+        abort();
+    }
+}
+
+bool
+WStrFileMapOpen2(_Out_   struct WStrFileMap *lpFileMap,
+                 _In_    const wchar_t      *lpFilePathWCharArr,
+                 _In_    const UINT          codePage,  // Ex: CP_UTF8
+                 _Inout_ FILE               *lpErrorStream)
+{
+    assert(NULL != lpFileMap);
+    assert(NULL != lpFilePathWCharArr);
+    assert(NULL != lpErrorStream);
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    const HANDLE hFile = CreateFile(lpFilePathWCharArr,     // [in] LPCWSTR lpFileName
+                                    GENERIC_READ,           // [in] DWORD dwDesiredAccess
+                                    FILE_SHARE_READ,        // [in] DWORD dwShareMode
+                                    NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
+                                    OPEN_EXISTING,          // [in] DWORD dwCreationDisposition
+                                    FILE_ATTRIBUTE_NORMAL,  // [in] DWORD dwFlagsAndAttributes
+                                    NULL);                  // [in, optional] hTemplateFile
+    if (INVALID_HANDLE_VALUE == hFile)
+    {
+        Win32LastErrorFPrintFW(lpErrorStream,  // _In_ FILE          *lpStream,
+                               L"CreateFile(lpFileName[%ls], GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)",  // _In_ const wchar_t *lpMessageFormat,
+                               lpFilePathWCharArr);  // _In_ ...
+        return false;
+    }
+
+    *lpFileMap = (struct WStrFileMap) {
+        .hFile       = hFile,
+        .codePage    = codePage,
+        .ulLineIndex = SIZE_MAX,
+    };
+    WStrCopyWCharArr(&(lpFileMap->filePathWStr), lpFilePathWCharArr, wcslen(lpFilePathWCharArr));
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getfilesizeex
+    LARGE_INTEGER fileSize = {0};
+    if (!GetFileSizeEx(hFile, &fileSize))
+    {
+        Win32LastErrorFPrintFW(lpErrorStream,                      // _In_ FILE          *lpStream
+                               L"GetFileSizeEx(lpFileName[%ls])",  // _In_ const wchar_t *lpMessageFormat
+                               lpFilePathWCharArr);                // _In_ ...
+        WStrFileMapClose(lpFileMap);
+        return false;
+    }
+
+    // Intentional: Only possible for 32-bit process.  Why?  View of all bytes must fit in address space.
+    if ((unsigned long long) fileSize.QuadPart > SIZE_MAX)
+    {
+        Win32LastErrorFPrintFW(lpErrorStream,  // _In_ FILE          *lpStream
+                               L"File is too large to map: lpFileName[%ls]: %lld bytes",  // _In_ const wchar_t *lpMessageFormat
+                               lpFilePathWCharArr, (long long) fileSize.QuadPart);        // _In_ ...
+        WStrFileMapClose(lpFileMap);
+        return false;
+    }
+
+    if (0 == fileSize.QuadPart)
+    {
+        WStrFileMapAssertValid(lpFileMap);
+        return true;
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-createfilemappingw
+    // Note: If dwMaximumSizeHigh and dwMaximumSizeLow are zero, maximum size is file size.
+    lpFileMap->hNullableFileMapping = CreateFileMappingW(hFile,          // [in] HANDLE hFile
+                                                         NULL,           // [in, optional] LPSECURITY_ATTRIBUTES lpFileMappingAttributes
+                                                         PAGE_READONLY,  // [in] DWORD flProtect
+                                                         0,              // [in] DWORD dwMaximumSizeHigh
+                                                         0,              // [in] DWORD dwMaximumSizeLow
+                                                         NULL);          // [in, optional] LPCWSTR lpName
+    if (NULL == lpFileMap->hNullableFileMapping)
+    {
+        Win32LastErrorFPrintFW(lpErrorStream,  // _In_ FILE          *lpStream
+                               L"CreateFileMappingW(lpFileName[%ls], NULL, PAGE_READONLY, 0, 0, NULL)",  // _In_ const wchar_t *lpMessageFormat
+                               lpFilePathWCharArr);  // _In_ ...
+        WStrFileMapClose(lpFileMap);
+        return false;
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile
+    // Note: If dwNumberOfBytesToMap is zero, the mapping extends to end of file.
+    lpFileMap->lpCharArr = MapViewOfFile(lpFileMap->hNullableFileMapping,  // [in] HANDLE hFileMappingObject
+                                         FILE_MAP_READ,                    // [in] DWORD dwDesiredAccess
+                                         0,                                // [in] DWORD dwFileOffsetHigh
+                                         0,                                // [in] DWORD dwFileOffsetLow
+                                         0);                               // [in] SIZE_T dwNumberOfBytesToMap
+    if (NULL == lpFileMap->lpCharArr)
+    {
+        Win32LastErrorFPrintFW(lpErrorStream,  // _In_ FILE          *lpStream
+                               L"MapViewOfFile(lpFileName[%ls], FILE_MAP_READ, 0, 0, 0)",  // _In_ const wchar_t *lpMessageFormat
+                               lpFilePathWCharArr);  // _In_ ...
+        WStrFileMapClose(lpFileMap);
+        return false;
+    }
+
+    lpFileMap->ulByteSize       = (size_t) fileSize.QuadPart;
+    lpFileMap->ulBOMSize        = WStrFileGetBOMSize(lpFileMap->lpCharArr, lpFileMap->ulByteSize);
+    lpFileMap->ulLineByteOffset = lpFileMap->ulBOMSize;
+
+    WStrFileMapAssertValid(lpFileMap);
+    return true;
+}
+
+bool
+WStrFileMapNextLine(_Inout_ struct WStrFileMap *lpFileMap,
+                    _Out_   struct WStrView    *lpLineWStrView)
+{
+    WStrFileMapAssertValid(lpFileMap);
+    assert(NULL != lpLineWStrView);
+
+    if (lpFileMap->ulLineByteOffset == lpFileMap->ulByteSize) {
+        return false;
+    }
+
+    const char *lpBeginCharArr = lpFileMap->lpCharArr + lpFileMap->ulLineByteOffset;
+    const size_t ulRemainSize = lpFileMap->ulByteSize - lpFileMap->ulLineByteOffset;
+    // Intentional: Search bytes, not wchars.  Why?  Byte 0x0A is never part of a multi-byte char: UTF-8 continuation
+    // bytes are 0x80-0xBF, and DBCS (double-byte character set) trail bytes are at least 0x40.
+    const char *lpNewLine = memchr(lpBeginCharArr, '\n', ulRemainSize);
+
+    size_t ulByteSize = 0;
+    if (NULL == lpNewLine)
+    {
+        // Final line without line terminator: Like WStrSplitNewLine(), keep a final "\r".
+        ulByteSize = ulRemainSize;
+        lpFileMap->ulLineByteOffset = lpFileMap->ulByteSize;
+    }
+    else
+    {
+        ulByteSize = lpNewLine - lpBeginCharArr;
+        lpFileMap->ulLineByteOffset += ulByteSize + 1U;
+        if (ulByteSize > 0 && '\r' == lpBeginCharArr[ulByteSize - 1U]) {
+            --ulByteSize;
+        }
+    }
+    ++(lpFileMap->ulLineIndex);
+
+    struct WStrBuilder *lpWStrBuilder = &(lpFileMap->lineWStrBuilder);
+    WStrBuilderClear(lpWStrBuilder);
+
+    // Intentional: Skip empty line.  Why?  MultiByteToWideChar() fails if cbMultiByte is zero.
+    if (0 == ulByteSize) {
+        // Empty line: Above, WStrBuilderClear() sets zero size.
+    }
+    else if (CP_UTF8 == lpFileMap->codePage)
+    {
+        // Intentional: One pass.  Why?  At most one wchar per byte.
+        WStrBuilderReserve(lpWStrBuilder, ulByteSize);
+
+        size_t ulInvalidByteOffset = 0;
+        if (!WStrUtf8Decode(lpBeginCharArr,              // _In_  const char   *lpCharArr
+                            ulByteSize,                  // _In_  const size_t  ulByteSize
+                            lpWStrBuilder->lpWCharArr,   // _Out_ wchar_t      *lpDestWCharArr
+                            &(lpWStrBuilder->ulSize),    // _Out_ size_t       *lpulDestSize
+                            &ulInvalidByteOffset))       // _Out_ size_t       *lpulInvalidByteOffset
+        {
+            Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                        L"WStrUtf8Decode: lpFileName[%ls]: line #%zd: Invalid UTF-8 at byte offset %zd",  // _In_ const wchar_t *lpMessageFormat,
+                                        lpFileMap->filePathWStr.lpWCharArr, 1U + lpFileMap->ulLineIndex,
+                                        (size_t) (lpBeginCharArr - lpFileMap->lpCharArr) + ulInvalidByteOffset);  // _In_ ...
+        }
+        // Intentional: Decode directly into builder buffer.  Why?  Avoid a second copy.
+        lpWStrBuilder->lpWCharArr[lpWStrBuilder->ulSize] = L'\0';
+    }
+    else
+    {
+        if (ulByteSize > INT_MAX)
+        {
+            Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream
+                                        L"Line is too long: lpFileName[%ls]: line #%zd: %zd bytes > INT_MAX",  // _In_ const wchar_t *lpMessageFormat
+                                        lpFileMap->filePathWStr.lpWCharArr, 1U + lpFileMap->ulLineIndex, ulByteSize);  // _In_ ...
+        }
+        // Intentional: One pass.  Why?  At most one wchar per byte.
+        WStrBuilderReserve(lpWStrBuilder, ulByteSize);
+
+        // Ref: https://docs.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
+        const int iWCharSize = MultiByteToWideChar(lpFileMap->codePage,            // [in] UINT codePage
+                                                   MB_ERR_INVALID_CHARS,           // [in] DWORD dwFlags
+                                                   lpBeginCharArr,                 // [in] char *lpMultiByteStr
+                                                   (int) ulByteSize,               // [in] int cbMultiByte
+                                                   lpWStrBuilder->lpWCharArr,      // [out/opt] wchar_t *lpWideCharStr
+                                                   (int) lpWStrBuilder->ulCapacity);  // [in] int cchWideChar
+        if (iWCharSize <= 0)
+        {
+            Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                        L"MultiByteToWideChar(codePage[%u], MB_ERR_INVALID_CHARS, ...): lpFileName[%ls]: line #%zd",  // _In_ const wchar_t *lpMessageFormat,
+                                        lpFileMap->codePage, lpFileMap->filePathWStr.lpWCharArr, 1U + lpFileMap->ulLineIndex);  // _In_ ...
+        }
+        // Intentional: Decode directly into builder buffer.  Why?  Avoid a second copy.
+        lpWStrBuilder->ulSize = (size_t) iWCharSize;
+        lpWStrBuilder->lpWCharArr[lpWStrBuilder->ulSize] = L'\0';
+    }
+
+    *lpLineWStrView = (struct WStrView) {.lpWCharArr = lpWStrBuilder->lpWCharArr, .ulSize = lpWStrBuilder->ulSize};
+    return true;
+}
+
+void
+WStrFileMapDecode(_In_    const struct WStrFileMap *lpFileMap,
+                  _Inout_ struct WStr              *lpDestWStr)
+{
+    WStrFileMapAssertValid(lpFileMap);
+    WStrFree(lpDestWStr);
+
+    const char *lpCharArrAfterBOM = lpFileMap->lpCharArr + lpFileMap->ulBOMSize;
+    const size_t ulByteSize = lpFileMap->ulByteSize - lpFileMap->ulBOMSize;
+    if (0 == ulByteSize) {
+        // Above, WStrFree(lpDestWStr) is called.  Thus, lpDestWStr has zero length.
+        return;
+    }
+
+    if (CP_UTF8 == lpFileMap->codePage)
+    {
+        // Intentional: Do not use MultiByteToWideChar().  Why?  It needs two passes: sizing, then conversion.
+        // One byte of UTF-8 is never more than one wchar, so allocate worst case, decode once, then shrink.
+        // Intentional: xmalloc(), not xcalloc().  Why?  Each wchar is written by decode: Zero-fill is wasted work.
+        wchar_t *lpWCharArr = xmalloc((ulByteSize + LEN_NUL_CHAR) * sizeof(wchar_t));
+
+        size_t ulWCharSize = 0;
+        size_t ulInvalidByteOffset = 0;
+        if (!WStrUtf8Decode(lpCharArrAfterBOM,      // _In_  const char   *lpCharArr
+                            ulByteSize,             // _In_  const size_t  ulByteSize
+                            lpWCharArr,             // _Out_ wchar_t      *lpDestWCharArr
+                            &ulWCharSize,           // _Out_ size_t       *lpulDestSize
+                            &ulInvalidByteOffset))  // _Out_ size_t       *lpulInvalidByteOffset
+        {
+            Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                        L"WStrUtf8Decode: lpFileName[%ls]: Invalid UTF-8 at byte offset %zd",  // _In_ const wchar_t *lpMessageFormat,
+                                        lpFileMap->filePathWStr.lpWCharArr, lpFileMap->ulBOMSize + ulInvalidByteOffset);  // _In_ ...
+        }
+        // Intentional: Shrink only if non-ASCII.  Why?  ASCII-only text is already exact size.
+        if (ulWCharSize < ulByteSize) {
+            xrealloc((void **) &lpWCharArr, (ulWCharSize + LEN_NUL_CHAR) * sizeof(wchar_t));
+        }
+        lpWCharArr[ulWCharSize] = L'\0';
+
+        lpDestWStr->lpWCharArr = lpWCharArr;
+        lpDestWStr->ulSize     = ulWCharSize;
+        return;
+    }
+
+    // Intentional: MultiByteToWideChar() counts bytes with int.  Later, result needs one more wchar for trailing null char.
+    if (ulByteSize >= INT_MAX)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream
+                                    L"File is too large: lpFileName[%ls]: %zd bytes >= INT_MAX.  Use WStrFileMapNextLine() or WStrLineReader instead.",  // _In_ const wchar_t *lpMessageFormat
+                                    lpFileMap->filePathWStr.lpWCharArr, ulByteSize);  // _In_ ...
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
+    // Intentional: Explicit cbMultiByte, not -1.  Why?  Mapped bytes are not terminated with '\0'.
+    const int iWCharSize = MultiByteToWideChar(lpFileMap->codePage,   // [in] UINT codePage
+                                               MB_ERR_INVALID_CHARS,  // [in] DWORD dwFlags
+                                               lpCharArrAfterBOM,     // [in] char *lpMultiByteStr
+                                               (int) ulByteSize,      // [in] int cbMultiByte
+                                               NULL,                  // [out/opt] wchar_t *lpWideCharStr
+                                               0);                    // [in] int cchWideChar
+    if (iWCharSize <= 0)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                    L"MultiByteToWideChar(codePage[%u], MB_ERR_INVALID_CHARS, lpCharArrAfterBOM, ulByteSize, NULL, 0): lpFileName[%ls]",  // _In_ const wchar_t *lpMessageFormat,
+                                    lpFileMap->codePage, lpFileMap->filePathWStr.lpWCharArr);  // _In_ ...
+    }
+
+    wchar_t *lpWCharArr = xcalloc(iWCharSize + LEN_NUL_CHAR, sizeof(wchar_t));
+
+    const int iWCharSize2 = MultiByteToWideChar(lpFileMap->codePage,   // [in] UINT codePage
+                                                MB_ERR_INVALID_CHARS,  // [in] DWORD dwFlags
+                                                lpCharArrAfterBOM,     // [in] char *lpMultiByteStr
+                                                (int) ulByteSize,      // [in] int cbMultiByte
+                                                lpWCharArr,            // [out/opt] wchar_t *lpWideCharStr
+                                                iWCharSize);           // [in] int cchWideChar
+    if (iWCharSize2 <= 0)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                    L"MultiByteToWideChar(codePage[%u], MB_ERR_INVALID_CHARS, lpCharArrAfterBOM, ulByteSize, lpWCharArr, iWCharSize): lpFileName[%ls]",  // _In_ const wchar_t *lpMessageFormat,
+                                    lpFileMap->codePage, lpFileMap->filePathWStr.lpWCharArr);  // _In_ ...
+    }
+    assert(iWCharSize == iWCharSize2);
+    // Above, xcalloc() sets trailing null char.
+
+    lpDestWStr->lpWCharArr = lpWCharArr;
+    lpDestWStr->ulSize     = (size_t) iWCharSize;
+}
+
+void
+WStrFileMapClose(_Inout_ struct WStrFileMap *lpFileMap)
+{
+    assert(NULL != lpFileMap);
+
+    if (NULL != lpFileMap->lpCharArr)
+    {
+        // Ref: https://docs.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-unmapviewoffile
+        if (!UnmapViewOfFile(lpFileMap->lpCharArr))
+        {
+            Win32LastErrorFPrintFWAbort(stderr,                                    // _In_ FILE          *lpStream
+                                        L"UnmapViewOfFile(lpFileName:%ls)",        // _In_ const wchar_t *lpMessageFormat
+                                        lpFileMap->filePathWStr.lpWCharArr);       // _In_ ...
+        }
+    }
+    if (NULL != lpFileMap->hNullableFileMapping)
+    {
+        if (!CloseHandle(lpFileMap->hNullableFileMapping))
+        {
+            Win32LastErrorFPrintFWAbort(stderr,                                    // _In_ FILE          *lpStream
+                                        L"CloseHandle(hFileMapping, lpFileName:%ls)",  // _In_ const wchar_t *lpMessageFormat
+                                        lpFileMap->filePathWStr.lpWCharArr);       // _In_ ...
+        }
+    }
+    if (NULL != lpFileMap->hFile && INVALID_HANDLE_VALUE != lpFileMap->hFile)
+    {
+        if (!CloseHandle(lpFileMap->hFile))
+        {
+            Win32LastErrorFPrintFWAbort(stderr,                                    // _In_ FILE          *lpStream
+                                        L"CloseHandle(hFile, lpFileName:%ls)",     // _In_ const wchar_t *lpMessageFormat
+                                        lpFileMap->filePathWStr.lpWCharArr);       // _In_ ...
+        }
+    }
+    WStrBuilderFree(&(lpFileMap->lineWStrBuilder));
+    WStrFree(&(lpFileMap->filePathWStr));
+    *lpFileMap = (struct WStrFileMap) {0};
+}
@@ -0,0 +1,110 @@
+#ifndef H_COMMON_WSTR_FILE_MAP
+#define H_COMMON_WSTR_FILE_MAP
+
+#include "win32.h"
+#include "wstr.h"
+#include <sal.h>     // required for _In_, etc.
+#include <stddef.h>  // required for size_t
+#include <stdio.h>   // required for FILE
+#include <windef.h>  // required for UINT, HANDLE
+
+// Read-only memory-mapped file.  Bytes are zero-copy: Pages are loaded on first access, and shared with the file cache.
+// Unlike WStrLineReader, all bytes are available at once, e.g., to search or to decode lines out of order.
+
+/**
+ * <pre>{@code
+ * struct WStrFileMap fileMap = {0};
+ * WStrFileMapOpen(&fileMap, L"data.txt", CP_UTF8);
+ * struct WStrView lineWStrView = {0};
+ * while (WStrFileMapNextLine(&fileMap, &lineWStrView))
+ * {
+ *     // fileMap.ulLineIndex is zero-based index of lineWStrView
+ * }
+ * WStrFileMapClose(&fileMap);
+ * }</pre>
+ */
+struct WStrFileMap
+{
+    HANDLE   hFile;
+    // @Nullable if (0 == ulByteSize).  Why?  CreateFileMapping() fails for empty files.
+    HANDLE   hNullableFileMapping;
+    // Intentional: Copy.  Why?  Error messages after open.
+    struct WStr filePathWStr;
+    // Ex: CP_UTF8
+    UINT     codePage;
+
+    // @Nullable if (0 == ulByteSize)
+    // All bytes of file, including BOM (byte order mark).  Never terminated with '\0'.
+    const char *lpCharArr;
+    size_t   ulByteSize;
+    // Number of bytes to skip at start of lpCharArr.  Ex: 3 for UTF-8 BOM
+    size_t   ulBOMSize;
+
+    // Byte offset in lpCharArr of next line for WStrFileMapNextLine()
+    size_t   ulLineByteOffset;
+    // Zero-based index of last line returned by WStrFileMapNextLine().  SIZE_MAX before first line.
+    size_t   ulLineIndex;
+    // Decoded line.  Reused for each line.
+    struct WStrBuilder lineWStrBuilder;
+};
+
+void
+WStrFileMapAssertValid(_In_ const struct WStrFileMap *lpFileMap);
+
+/**
+ * This is a convenience method to call WStrFileMapOpen2(..., stderr).
+ * On error, abort() is called.
+ */
+void
+WStrFileMapOpen(_Out_ struct WStrFileMap *lpFileMap,
+                _In_  const wchar_t      *lpFilePathWCharArr,
+                _In_  const UINT          codePage);  // Ex: CP_UTF8
+
+/**
+ * Open file, then map a read-only view of all bytes.  Then check BOM like WStrFileRead(): UTF-8 BOM is skipped;
+ * UTF-16 and UTF-32 BOMs abort().  No bytes are decoded.
+ *
+ * @param lpErrorStream
+ *        stream to print errors
+ *        usually 'stderr' (from <stdio.h>), but may be any valid stream
+ *
+ * @return true on success
+ *         false on failure and error printed to {@code lpErrorStream}
+ */
+bool
+WStrFileMapOpen2(_Out_   struct WStrFileMap *lpFileMap,
+                 _In_    const wchar_t      *lpFilePathWCharArr,
+                 _In_    const UINT          codePage,  // Ex: CP_UTF8
+                 _Inout_ FILE               *lpErrorStream);
+
+/**
+ * Find next line in mapped bytes, then decode only this line.  Line rules are the same as WStrLineReaderNext().
+ * On decode error, abort() is called.
+ *
+ * @param lpLineWStrView
+ *        on true return, view of next line
+ *        Important: View is only valid until next call to WStrFileMapNextLine() or WStrFileMapClose().
+ *
+ * @return true if lpLineWStrView is next line
+ *         false at end of file
+ */
+bool
+WStrFileMapNextLine(_Inout_ struct WStrFileMap *lpFileMap,
+                    _Out_   struct WStrView    *lpLineWStrView);
+
+/**
+ * Decode all bytes after BOM to lpDestWStr.  CP_UTF8 is decoded in one pass by WStrUtf8Decode().
+ * For other code pages, files larger than INT_MAX - 1 bytes abort().
+ * On decode error, abort() is called.
+ */
+void
+WStrFileMapDecode(_In_    const struct WStrFileMap *lpFileMap,
+                  _Inout_ struct WStr              *lpDestWStr);
+
+/**
+ * Unmap view, then close file.  Safe to call for zero-initialised lpFileMap.
+ */
+void
+WStrFileMapClose(_Inout_ struct WStrFileMap *lpFileMap);
+
+#endif  // H_COMMON_WSTR_FILE_MAP
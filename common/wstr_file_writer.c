@@ -0,0 +1,297 @@
+#include "wstr_file_writer.h"
+#include "wstr_utf8.h"
+#include "xmalloc.h"
+#include "win32_last_error.h"
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+#include <limits.h>  // required for INT_MAX
+
+void
+WStrFileWriterAssertValid(_In_ const struct WStrFileWriter *lpWriter)
+{
+    assert(NULL != lpWriter);
+    assert(INVALID_HANDLE_VALUE != lpWriter->hFile);
+    assert(NULL != lpWriter->hFile);
+    assert(lpWriter->ulMaxBytesPerWChar > 0);
+    assert(NULL != lpWriter->lpBufferCharArr);
+    assert(lpWriter->ulBufferByteCapacity >= WSTR_FILE_WRITER_MIN_BUFFER_BYTE_SIZE);
+    assert(lpWriter->ulBufferByteCapacity >= 2U * lpWriter->ulMaxBytesPerWChar);
+    assert(lpWriter->ulBufferByteSize <= lpWriter->ulBufferByteCapacity);
+    assert(lpWriter->ulBufferByteSize <= lpWriter->ulTotalByteSize);
+}
+
+void
+WStrFileWriterOpen(_Out_ struct WStrFileWriter         *lpWriter,
+                   _In_  const wchar_t                 *lpFilePathWCharArr,
+                   _In_  const UINT                     codePage,  // Ex: CP_UTF8
+                   _In_  const enum EWStrFileWriterMode eMode,
+                   _In_  const size_t                   ulBufferByteSize)
+{
+    if (!WStrFileWriterOpen2(lpWriter, lpFilePathWCharArr, codePage, eMode, ulBufferByteSize, stderr))
+    {
+        abort();
+    }
+}
+
+bool
+WStrFileWriterOpen2(_Out_   struct WStrFileWriter         *lpWriter,
+                    _In_    const wchar_t                 *lpFilePathWCharArr,
+                    _In_    const UINT                     codePage,  // Ex: CP_UTF8
+                    _In_    const enum EWStrFileWriterMode eMode,
+                    _In_    const size_t                   ulBufferByteSize,
+                    _Inout_ FILE                          *lpErrorStream)
+{
+    assert(NULL != lpWriter);
+    assert(NULL != lpFilePathWCharArr);
+    assert(WSTR_FILE_WRITER_MODE_TRUNCATE == eMode || WSTR_FILE_WRITER_MODE_APPEND == eMode);
+    assert(ulBufferByteSize >= WSTR_FILE_WRITER_MIN_BUFFER_BYTE_SIZE);
+    // Intentional: WriteFile() and WideCharToMultiByte() count with DWORD and int.
+    assert(ulBufferByteSize <= INT_MAX);
+    assert(NULL != lpErrorStream);
+
+    size_t ulMaxBytesPerWChar = WSTR_UTF8_MAX_BYTES_PER_WCHAR;
+    if (CP_UTF8 != codePage)
+    {
+        // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winnls/nf-winnls-getcpinfo
+        CPINFO cpInfo = {0};
+        if (!GetCPInfo(codePage, &cpInfo))
+        {
+            Win32LastErrorFPrintFW(lpErrorStream,     // _In_ FILE          *lpStream
+                                   L"GetCPInfo(%u)",  // _In_ const wchar_t *lpMessageFormat
+                                   codePage);         // _In_ ...
+            return false;
+        }
+        ulMaxBytesPerWChar = cpInfo.MaxCharSize;
+    }
+    assert(ulBufferByteSize >= 2U * ulMaxBytesPerWChar);
+
+    const bool bIsAppend = (WSTR_FILE_WRITER_MODE_APPEND == eMode);
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/fileio/file-access-rights-constants
+    // Intentional: FILE_APPEND_DATA without FILE_WRITE_DATA.  Why?  Each write is atomically at end of file.
+    const DWORD dwDesiredAccess       = bIsAppend ? FILE_APPEND_DATA : GENERIC_WRITE;
+    const DWORD dwCreationDisposition = bIsAppend ? OPEN_ALWAYS      : CREATE_ALWAYS;
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    const HANDLE hFile = CreateFile(lpFilePathWCharArr,     // [in] LPCWSTR lpFileName
+                                    dwDesiredAccess,        // [in] DWORD dwDesiredAccess
+                                    // Intentional: Allow readers.  Why?  Watch a log file while it is written.
+                                    FILE_SHARE_READ,        // [in] DWORD dwShareMode
+                                    NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
+                                    dwCreationDisposition,  // [in] DWORD dwCreationDisposition
+                                    FILE_ATTRIBUTE_NORMAL,  // [in] DWORD dwFlagsAndAttributes
+                                    NULL);                  // [in, optional] hTemplateFile
+    if (INVALID_HANDLE_VALUE == hFile)
+    {
+        Win32LastErrorFPrintFW(lpErrorStream,  // _In_ FILE          *lpStream,
+                               L"CreateFile(lpFileName[%ls], 0x%lx, FILE_SHARE_READ, NULL, %lu, FILE_ATTRIBUTE_NORMAL, NULL)",  // _In_ const wchar_t *lpMessageFormat,
+                               lpFilePathWCharArr, dwDesiredAccess, dwCreationDisposition);  // _In_ ...
+        return false;
+    }
+
+    *lpWriter = (struct WStrFileWriter) {
+        .hFile                = hFile,
+        .codePage             = codePage,
+        .ulMaxBytesPerWChar   = ulMaxBytesPerWChar,
+        // Intentional: Not zeroed.  Why?  Bytes are always written before flush.
+        .lpBufferCharArr      = xmalloc(ulBufferByteSize),
+        .ulBufferByteCapacity = ulBufferByteSize,
+    };
+    WStrCopyWCharArr(&(lpWriter->filePathWStr), lpFilePathWCharArr, wcslen(lpFilePathWCharArr));
+
+    WStrFileWriterAssertValid(lpWriter);
+    return true;
+}
+
+static bool
+StaticIsHighSurrogate(_In_ const wchar_t wch)
+{
+    const bool x = (wch >= 0xD800 && wch <= 0xDBFF);
+    return x;
+}
+
+/**
+ * Encode wchars to end of buffer.
+ *
+ * @param ulSize
+ *        caller must check buffer has space for (ulSize * lpWriter->ulMaxBytesPerWChar) bytes
+ */
+static void
+StaticEncode(_Inout_ struct WStrFileWriter *lpWriter,
+             _In_    const wchar_t         *lpWCharArr,
+             _In_    const size_t           ulSize)
+{
+    assert(ulSize > 0);
+    assert(lpWriter->ulBufferByteSize + (ulSize * lpWriter->ulMaxBytesPerWChar) <= lpWriter->ulBufferByteCapacity);
+
+    char *lpDestCharArr = lpWriter->lpBufferCharArr + lpWriter->ulBufferByteSize;
+    size_t ulByteSize = 0;
+    if (CP_UTF8 == lpWriter->codePage)
+    {
+        size_t ulInvalidOffset = 0;
+        if (!WStrUtf8Encode(lpWCharArr,         // _In_  const wchar_t *lpWCharArr
+                            ulSize,             // _In_  const size_t   ulSize
+                            lpDestCharArr,      // _Out_ char          *lpDestCharArr
+                            &ulByteSize,        // _Out_ size_t        *lpulDestByteSize
+                            &ulInvalidOffset))  // _Out_ size_t        *lpulInvalidOffset
+        {
+            Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                        L"WStrUtf8Encode: lpFileName[%ls]: Unpaired surrogate 0x%04x",  // _In_ const wchar_t *lpMessageFormat,
+                                        lpWriter->filePathWStr.lpWCharArr, (unsigned) lpWCharArr[ulInvalidOffset]);  // _In_ ...
+        }
+    }
+    else
+    {
+        // Ref: https://docs.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-widechartomultibyte
+        // Intentional: dwFlags is zero.  Why?  WC_ERR_INVALID_CHARS is only valid for CP_UTF8 and 54936 (GB18030).
+        const int iByteSize = WideCharToMultiByte(lpWriter->codePage,  // [in] UINT CodePage
+                                                  0,                   // [in] DWORD dwFlags
+                                                  lpWCharArr,          // [in] LPCWCH lpWideCharStr
+                                                  (int) ulSize,        // [in] int cchWideChar
+                                                  lpDestCharArr,       // [out/opt] LPSTR lpMultiByteStr
+                                                  (int) (lpWriter->ulBufferByteCapacity - lpWriter->ulBufferByteSize),  // [in] int cbMultiByte
+                                                  NULL,                // [in/opt] LPCCH lpDefaultChar
+                                                  NULL);               // [out/opt] LPBOOL lpUsedDefaultChar
+        if (iByteSize <= 0)
+        {
+            Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                        L"WideCharToMultiByte(codePage[%u], 0, ...): lpFileName[%ls]",  // _In_ const wchar_t *lpMessageFormat,
+                                        lpWriter->codePage, lpWriter->filePathWStr.lpWCharArr);  // _In_ ...
+        }
+        ulByteSize = (size_t) iByteSize;
+    }
+    lpWriter->ulBufferByteSize += ulByteSize;
+    lpWriter->ulTotalByteSize  += ulByteSize;
+}
+
+void
+WStrFileWriterWriteWCharArr(_Inout_ struct WStrFileWriter *lpWriter,
+                            _In_    const wchar_t         *lpWCharArr,
+                            _In_    const size_t           ulSize)
+{
+    WStrFileWriterAssertValid(lpWriter);
+    assert(0 == ulSize || NULL != lpWCharArr);
+
+    if (0 == ulSize) {
+        return;
+    }
+
+    const size_t ulPairByteSize = 2U * lpWriter->ulMaxBytesPerWChar;
+    size_t ulOffset = 0;
+    if (0 != lpWriter->wchPendingHighSurrogate)
+    {
+        const wchar_t lpPairWCharArr[2] = {lpWriter->wchPendingHighSurrogate, lpWCharArr[0]};
+        lpWriter->wchPendingHighSurrogate = 0;
+        if (lpWriter->ulBufferByteSize + ulPairByteSize > lpWriter->ulBufferByteCapacity) {
+            WStrFileWriterFlush(lpWriter);
+        }
+        // If CP_UTF8 and lpWCharArr[0] is not a low surrogate, then abort().  Other code pages: Default char, same as
+        // an unpaired surrogate inside one write.  See: StaticEncode()
+        StaticEncode(lpWriter, lpPairWCharArr, 2U);
+        ulOffset = 1U;
+    }
+
+    size_t ulEndOffset = ulSize;
+    if (ulEndOffset > ulOffset && StaticIsHighSurrogate(lpWCharArr[ulEndOffset - 1U]))
+    {
+        --ulEndOffset;
+        lpWriter->wchPendingHighSurrogate = lpWCharArr[ulEndOffset];
+    }
+
+    while (ulOffset < ulEndOffset)
+    {
+        if (lpWriter->ulBufferByteSize + ulPairByteSize > lpWriter->ulBufferByteCapacity) {
+            WStrFileWriterFlush(lpWriter);
+        }
+        const size_t ulFreeByteSize = lpWriter->ulBufferByteCapacity - lpWriter->ulBufferByteSize;
+        const size_t ulRemainSize = ulEndOffset - ulOffset;
+        size_t ulChunkSize = ulFreeByteSize / lpWriter->ulMaxBytesPerWChar;
+        if (ulChunkSize >= ulRemainSize) {
+            ulChunkSize = ulRemainSize;
+        }
+        // Intentional: Do not split surrogate pair between chunks.  Above, chunk is at least two wchars.
+        else if (StaticIsHighSurrogate(lpWCharArr[ulOffset + ulChunkSize - 1U])) {
+            --ulChunkSize;
+        }
+        StaticEncode(lpWriter, lpWCharArr + ulOffset, ulChunkSize);
+        ulOffset += ulChunkSize;
+    }
+}
+
+void
+WStrFileWriterWrite(_Inout_ struct WStrFileWriter *lpWriter,
+                    _In_    const struct WStr     *lpWStr)
+{
+    WStrAssertValid(lpWStr);
+    WStrFileWriterWriteWCharArr(lpWriter, lpWStr->lpWCharArr, lpWStr->ulSize);
+}
+
+void
+WStrFileWriterFlush(_Inout_ struct WStrFileWriter *lpWriter)
+{
+    WStrFileWriterAssertValid(lpWriter);
+
+    if (0 == lpWriter->ulBufferByteSize) {
+        return;
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-writefile
+    DWORD numberOfBytesWritten = 0;
+    if (!WriteFile(lpWriter->hFile,                    // [in] HANDLE hFile
+                   lpWriter->lpBufferCharArr,          // [in] LPCVOID lpBuffer
+                   (DWORD) lpWriter->ulBufferByteSize,  // [in] DWORD nNumberOfBytesToWrite
+                   &numberOfBytesWritten,              // [out/opt] LPDWORD lpNumberOfBytesWritten
+                   NULL))                              // [in/out/opt] LPOVERLAPPED lpOverlapped
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                        // _In_ FILE          *lpStream
+                                    L"WriteFile(lpFileName[%ls])",  // _In_ const wchar_t *lpMessageFormat
+                                    lpWriter->filePathWStr.lpWCharArr);  // _In_ ...
+    }
+    if (numberOfBytesWritten != lpWriter->ulBufferByteSize)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream
+                                    L"WriteFile(lpFileName[%ls]): Partial write: %lu of %zd bytes",  // _In_ const wchar_t *lpMessageFormat
+                                    lpWriter->filePathWStr.lpWCharArr, numberOfBytesWritten, lpWriter->ulBufferByteSize);  // _In_ ...
+    }
+    lpWriter->ulBufferByteSize = 0;
+}
+
+void
+WStrFileWriterSync(_Inout_ struct WStrFileWriter *lpWriter)
+{
+    WStrFileWriterFlush(lpWriter);
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-flushfilebuffers
+    if (!FlushFileBuffers(lpWriter->hFile))
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                               // _In_ FILE          *lpStream
+                                    L"FlushFileBuffers(lpFileName[%ls])",  // _In_ const wchar_t *lpMessageFormat
+                                    lpWriter->filePathWStr.lpWCharArr);   // _In_ ...
+    }
+}
+
+void
+WStrFileWriterClose(_Inout_ struct WStrFileWriter *lpWriter)
+{
+    assert(NULL != lpWriter);
+
+    if (NULL != lpWriter->hFile && INVALID_HANDLE_VALUE != lpWriter->hFile)
+    {
+        if (0 != lpWriter->wchPendingHighSurrogate)
+        {
+            Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream
+                                        L"lpFileName[%ls]: Unpaired high surrogate 0x%04x at end",  // _In_ const wchar_t *lpMessageFormat
+                                        lpWriter->filePathWStr.lpWCharArr, (unsigned) lpWriter->wchPendingHighSurrogate);  // _In_ ...
+        }
+        WStrFileWriterFlush(lpWriter);
+
+        if (!CloseHandle(lpWriter->hFile))
+        {
+            Win32LastErrorFPrintFWAbort(stderr,                                // _In_ FILE          *lpStream
+                                        L"CloseHandle(hFile, lpFileName:%ls)",  // _In_ const wchar_t *lpMessageFormat
+                                        lpWriter->filePathWStr.lpWCharArr);     // _In_ ...
+        }
+    }
+    xfree((void **) &(lpWriter->lpBufferCharArr));
+    WStrFree(&(lpWriter->filePathWStr));
+    *lpWriter = (struct WStrFileWriter) {0};
+}
@@ -0,0 +1,138 @@
+#ifndef H_COMMON_WSTR_FILE_WRITER
+#define H_COMMON_WSTR_FILE_WRITER
+
+#include "win32.h"
+#include "wstr.h"
+#include <sal.h>     // required for _In_, etc.
+#include <stddef.h>  // required for size_t
+#include <windef.h>  // required for UINT, HANDLE
+
+// Write a text file with bounded memory: wchars are encoded into one fixed-size buffer, then written with sequential
+// WriteFile() calls.  Unlike one WideCharToMultiByte() of the full text, peak memory does not grow with output size.
+
+#define WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE (64U * 1024U)
+// Intentional: Minimum is two wchars of longest encoding.  Why?  A UTF-16 surrogate pair is always encoded together.
+#define WSTR_FILE_WRITER_MIN_BUFFER_BYTE_SIZE 8U
+
+enum EWStrFileWriterMode
+{
+    // Create new file or truncate existing file
+    WSTR_FILE_WRITER_MODE_TRUNCATE = 1,
+    // Create new file or append to end of existing file
+    WSTR_FILE_WRITER_MODE_APPEND,
+};
+
+/**
+ * <pre>{@code
+ * struct WStrFileWriter writer = {0};
+ * WStrFileWriterOpen(&writer, L"export.txt", CP_UTF8, WSTR_FILE_WRITER_MODE_TRUNCATE, WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE);
+ * WStrFileWriterWrite(&writer, &lineWStr);
+ * WStrFileWriterWriteWCharArr(&writer, L"\r\n", 2);
+ * WStrFileWriterClose(&writer);
+ * }</pre>
+ */
+struct WStrFileWriter
+{
+    HANDLE   hFile;
+    // Intentional: Copy.  Why?  Error messages after open.
+    struct WStr filePathWStr;
+    // Ex: CP_UTF8
+    UINT     codePage;
+    // Ex: WSTR_UTF8_MAX_BYTES_PER_WCHAR for CP_UTF8, or CPINFO.MaxCharSize
+    size_t   ulMaxBytesPerWChar;
+
+    // Encoded bytes not yet written
+    char    *lpBufferCharArr;
+    size_t   ulBufferByteSize;
+    size_t   ulBufferByteCapacity;
+
+    // High surrogate at end of previous write, else zero.  Why?  Low surrogate may be first wchar of next write.
+    wchar_t  wchPendingHighSurrogate;
+    // Total encoded bytes since open: written and buffered
+    size_t   ulTotalByteSize;
+};
+
+void
+WStrFileWriterAssertValid(_In_ const struct WStrFileWriter *lpWriter);
+
+/**
+ * This is a convenience method to call WStrFileWriterOpen2(..., stderr).
+ * On error, abort() is called.
+ */
+void
+WStrFileWriterOpen(_Out_ struct WStrFileWriter         *lpWriter,
+                   _In_  const wchar_t                 *lpFilePathWCharArr,
+                   _In_  const UINT                     codePage,  // Ex: CP_UTF8
+                   _In_  const enum EWStrFileWriterMode eMode,
+                   _In_  const size_t                   ulBufferByteSize);
+
+/**
+ * Open file for writing.  No bytes are written until buffer is full, or WStrFileWriterFlush() or WStrFileWriterClose().
+ * No BOM (byte order mark) is written.
+ *
+ * @param eMode
+ *        WSTR_FILE_WRITER_MODE_APPEND opens with FILE_APPEND_DATA: Each WriteFile() is at end of file, even if
+ *        another process appends to same file.  Ex: Log files
+ *
+ * @param ulBufferByteSize
+ *        usually WSTR_FILE_WRITER_DEFAULT_BUFFER_BYTE_SIZE
+ *        must be at least WSTR_FILE_WRITER_MIN_BUFFER_BYTE_SIZE
+ *
+ * @param lpErrorStream
+ *        stream to print errors
+ *        usually 'stderr' (from <stdio.h>), but may be any valid stream
+ *
+ * @return true on success
+ *         false on failure and error printed to {@code lpErrorStream}
+ */
+bool
+WStrFileWriterOpen2(_Out_   struct WStrFileWriter         *lpWriter,
+                    _In_    const wchar_t                 *lpFilePathWCharArr,
+                    _In_    const UINT                     codePage,  // Ex: CP_UTF8
+                    _In_    const enum EWStrFileWriterMode eMode,
+                    _In_    const size_t                   ulBufferByteSize,
+                    _Inout_ FILE                          *lpErrorStream);
+
+/**
+ * Encode wchars to buffer.  When buffer is full, it is written to file.
+ * A surrogate pair may be split across two calls.
+ * On encode or write error, abort() is called.
+ *
+ * @param lpWCharArr
+ *        @Nullable if (0 == ulSize)
+ *        need not be terminated with '\0'
+ */
+void
+WStrFileWriterWriteWCharArr(_Inout_ struct WStrFileWriter *lpWriter,
+                            _In_    const wchar_t         *lpWCharArr,
+                            _In_    const size_t           ulSize);
+
+/**
+ * This is a convenience method to call WStrFileWriterWriteWCharArr().
+ */
+void
+WStrFileWriterWrite(_Inout_ struct WStrFileWriter *lpWriter,
+                    _In_    const struct WStr     *lpWStr);
+
+/**
+ * Write buffer to file with WriteFile().  Data is in OS cache, but may not be on disk.
+ * On error, abort() is called.
+ */
+void
+WStrFileWriterFlush(_Inout_ struct WStrFileWriter *lpWriter);
+
+/**
+ * Call WStrFileWriterFlush(), then FlushFileBuffers(): Data is on disk.  This is slow: Do not call per line.
+ * On error, abort() is called.
+ */
+void
+WStrFileWriterSync(_Inout_ struct WStrFileWriter *lpWriter);
+
+/**
+ * Call WStrFileWriterFlush(), then close file and free buffer.  Safe to call for zero-initialised lpWriter.
+ * On error, e.g., unpaired high surrogate at end, abort() is called.
+ */
+void
+WStrFileWriterClose(_Inout_ struct WStrFileWriter *lpWriter);
+
+#endif  // H_COMMON_WSTR_FILE_WRITER
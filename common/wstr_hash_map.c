@@ -0,0 +1,232 @@
+#include "wstr_hash_map.h"
+#include "wstr_simd.h"
+#include "xmalloc.h"
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+
+// Intentional: Power of two.  Why?  Slot index is (ulHash & (ulSlotCapacity - 1)).
+#define WSTR_HASH_MAP_MIN_SLOT_CAPACITY 16U
+
+void
+WStrHashMapAssertValid(_In_ const struct WStrHashMap *lpMap)
+{
+    assert(NULL != lpMap);
+    if (0 == lpMap->ulSlotCapacity)
+    {
+        assert(NULL == lpMap->lpSlotArr);
+        assert(0 == lpMap->ulSize);
+    }
+    else
+    {
+        assert(NULL != lpMap->lpSlotArr);
+        // Power of two
+        assert(0 == (lpMap->ulSlotCapacity & (lpMap->ulSlotCapacity - 1U)));
+        assert(lpMap->ulSize <= lpMap->ulSlotCapacity / 2U);
+    }
+}
+
+static size_t
+StaticHash(_In_ const struct WStrHashMap *lpMap,
+           _In_ const wchar_t            *lpKeyWCharArr,
+           _In_ const size_t              ulKeySize)
+{
+    const size_t x = lpMap->bIgnoreCase ? WStrHashWCharArrI(lpKeyWCharArr, ulKeySize) : WStrHashWCharArr(lpKeyWCharArr, ulKeySize);
+    return x;
+}
+
+static bool
+StaticIsEqual(_In_ const struct WStrHashMap     *lpMap,
+              _In_ const struct WStrHashMapSlot *lpSlot,
+              _In_ const wchar_t                *lpKeyWCharArr,
+              _In_ const size_t                  ulKeySize,
+              _In_ const size_t                  ulHash)
+{
+    if (ulHash != lpSlot->ulHash || ulKeySize != lpSlot->ulKeySize) {
+        return false;
+    }
+    if (0 == ulKeySize) {
+        return true;
+    }
+    if (lpMap->bIgnoreCase)
+    {
+        // Ref: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/strnicmp-wcsnicmp-mbsnicmp-strnicmp-l-wcsnicmp-l-mbsnicmp-l?view=msvc-170
+        const bool x = (0 == _wcsnicmp(lpKeyWCharArr, lpSlot->lpNullableKeyWCharArr, ulKeySize));
+        return x;
+    }
+    const bool x = (ulKeySize == WStrSimdMismatch(lpKeyWCharArr, lpSlot->lpNullableKeyWCharArr, ulKeySize));
+    return x;
+}
+
+/**
+ * @return index of slot for key: either equal key or first empty slot
+ */
+static size_t
+StaticFindSlotIndex(_In_ const struct WStrHashMap *lpMap,
+                    _In_ const wchar_t            *lpKeyWCharArr,
+                    _In_ const size_t              ulKeySize,
+                    _In_ const size_t              ulHash)
+{
+    const size_t ulMask = lpMap->ulSlotCapacity - 1U;
+    size_t ulIndex = ulHash & ulMask;
+    while (true)
+    {
+        const struct WStrHashMapSlot *lpSlot = lpMap->lpSlotArr + ulIndex;
+        if (NULL == lpSlot->lpNullableKeyWCharArr
+            || StaticIsEqual(lpMap, lpSlot, lpKeyWCharArr, ulKeySize, ulHash))
+        {
+            return ulIndex;
+        }
+        ulIndex = (ulIndex + 1U) & ulMask;
+    }
+}
+
+static void
+StaticGrow(_Inout_ struct WStrHashMap *lpMap)
+{
+    const size_t ulOldSlotCapacity = lpMap->ulSlotCapacity;
+    struct WStrHashMapSlot *lpOldSlotArr = lpMap->lpSlotArr;
+
+    lpMap->ulSlotCapacity = (0 == ulOldSlotCapacity) ? WSTR_HASH_MAP_MIN_SLOT_CAPACITY : 2U * ulOldSlotCapacity;
+    lpMap->lpSlotArr = xcalloc(lpMap->ulSlotCapacity, sizeof(struct WStrHashMapSlot));
+
+    // Intentional: Re-insert with stored hash.  Why?  No keys are read or hashed again.
+    const size_t ulMask = lpMap->ulSlotCapacity - 1U;
+    for (size_t i = 0; i < ulOldSlotCapacity; ++i)
+    {
+        const struct WStrHashMapSlot *lpOldSlot = lpOldSlotArr + i;
+        if (NULL != lpOldSlot->lpNullableKeyWCharArr)
+        {
+            size_t ulIndex = lpOldSlot->ulHash & ulMask;
+            while (NULL != lpMap->lpSlotArr[ulIndex].lpNullableKeyWCharArr)
+            {
+                ulIndex = (ulIndex + 1U) & ulMask;
+            }
+            lpMap->lpSlotArr[ulIndex] = *lpOldSlot;
+        }
+    }
+    xfree((void **) &lpOldSlotArr);
+}
+
+bool
+WStrHashMapInsert(_Inout_ struct WStrHashMap *lpMap,
+                  _In_    const wchar_t      *lpKeyWCharArr,
+                  _In_    const size_t        ulKeySize,
+                  _In_    void               *lpNullableValue)
+{
+    WStrHashMapAssertValid(lpMap);
+    assert(0 == ulKeySize || NULL != lpKeyWCharArr);
+
+    // Intentional: Grow before find.  Why?  Slot index from StaticFindSlotIndex() must stay valid for insert.
+    if (2U * (lpMap->ulSize + 1U) > lpMap->ulSlotCapacity)
+    {
+        StaticGrow(lpMap);
+    }
+
+    const size_t ulHash = StaticHash(lpMap, lpKeyWCharArr, ulKeySize);
+    const size_t ulIndex = StaticFindSlotIndex(lpMap, lpKeyWCharArr, ulKeySize, ulHash);
+    struct WStrHashMapSlot *lpSlot = lpMap->lpSlotArr + ulIndex;
+    if (NULL != lpSlot->lpNullableKeyWCharArr) {
+        return false;
+    }
+
+    // Intentional: Always allocate, even for empty key.  Why?  NULL key means empty slot.
+    wchar_t *lpKeyCopyWCharArr = xcalloc(ulKeySize + LEN_NUL_CHAR, sizeof(wchar_t));
+    if (ulKeySize > 0) {
+        wmemcpy(lpKeyCopyWCharArr, lpKeyWCharArr, ulKeySize);
+    }
+
+    *lpSlot = (struct WStrHashMapSlot) {
+        .ulHash                = ulHash,
+        .lpNullableKeyWCharArr = lpKeyCopyWCharArr,
+        .ulKeySize             = ulKeySize,
+        .lpNullableValue       = lpNullableValue,
+    };
+    ++(lpMap->ulSize);
+    return true;
+}
+
+bool
+WStrHashMapFind(_In_  const struct WStrHashMap  *lpMap,
+                _In_  const wchar_t             *lpKeyWCharArr,
+                _In_  const size_t               ulKeySize,
+                _Out_ void                     **lppNullableValue)
+{
+    WStrHashMapAssertValid(lpMap);
+    assert(0 == ulKeySize || NULL != lpKeyWCharArr);
+    assert(NULL != lppNullableValue);
+
+    if (0 == lpMap->ulSize) {
+        return false;
+    }
+
+    const size_t ulHash = StaticHash(lpMap, lpKeyWCharArr, ulKeySize);
+    const size_t ulIndex = StaticFindSlotIndex(lpMap, lpKeyWCharArr, ulKeySize, ulHash);
+    const struct WStrHashMapSlot *lpSlot = lpMap->lpSlotArr + ulIndex;
+    if (NULL == lpSlot->lpNullableKeyWCharArr) {
+        return false;
+    }
+    *lppNullableValue = lpSlot->lpNullableValue;
+    return true;
+}
+
+bool
+WStrHashMapErase(_Inout_ struct WStrHashMap *lpMap,
+                 _In_    const wchar_t      *lpKeyWCharArr,
+                 _In_    const size_t        ulKeySize)
+{
+    WStrHashMapAssertValid(lpMap);
+    assert(0 == ulKeySize || NULL != lpKeyWCharArr);
+
+    if (0 == lpMap->ulSize) {
+        return false;
+    }
+
+    const size_t ulHash = StaticHash(lpMap, lpKeyWCharArr, ulKeySize);
+    size_t ulHoleIndex = StaticFindSlotIndex(lpMap, lpKeyWCharArr, ulKeySize, ulHash);
+    if (NULL == lpMap->lpSlotArr[ulHoleIndex].lpNullableKeyWCharArr) {
+        return false;
+    }
+    xfree((void **) &(lpMap->lpSlotArr[ulHoleIndex].lpNullableKeyWCharArr));
+    --(lpMap->ulSize);
+
+    // Intentional: Backward shift, not tombstones.  Why?  Probe sequences never grow after many erases.
+    // Ref: https://en.wikipedia.org/wiki/Linear_probing#Deletion
+    const size_t ulMask = lpMap->ulSlotCapacity - 1U;
+    size_t ulIndex = ulHoleIndex;
+    while (true)
+    {
+        ulIndex = (ulIndex + 1U) & ulMask;
+        const struct WStrHashMapSlot *lpSlot = lpMap->lpSlotArr + ulIndex;
+        if (NULL == lpSlot->lpNullableKeyWCharArr) {
+            break;
+        }
+        // If home slot is cyclically in (ulHoleIndex, ulIndex], this key is still reachable.  Else, move to hole.
+        const size_t ulHomeIndex = lpSlot->ulHash & ulMask;
+        const bool bIsReachable = (ulHoleIndex <= ulIndex)
+                                  ? (ulHoleIndex < ulHomeIndex && ulHomeIndex <= ulIndex)
+                                  : (ulHoleIndex < ulHomeIndex || ulHomeIndex <= ulIndex);
+        if (!bIsReachable)
+        {
+            lpMap->lpSlotArr[ulHoleIndex] = *lpSlot;
+            ulHoleIndex = ulIndex;
+        }
+    }
+    lpMap->lpSlotArr[ulHoleIndex] = (struct WStrHashMapSlot) {0};
+    return true;
+}
+
+void
+WStrHashMapFree(_Inout_ struct WStrHashMap *lpMap)
+{
+    WStrHashMapAssertValid(lpMap);
+
+    for (size_t i = 0; i < lpMap->ulSlotCapacity; ++i)
+    {
+        struct WStrHashMapSlot *lpSlot = lpMap->lpSlotArr + i;
+        if (NULL != lpSlot->lpNullableKeyWCharArr) {
+            xfree((void **) &(lpSlot->lpNullableKeyWCharArr));
+        }
+    }
+    xfree((void **) &(lpMap->lpSlotArr));
+    *lpMap = (struct WStrHashMap) {.bIgnoreCase = lpMap->bIgnoreCase};
+}
@@ -0,0 +1,92 @@
+#ifndef H_COMMON_WSTR_HASH_MAP
+#define H_COMMON_WSTR_HASH_MAP
+
+#include "win32.h"
+#include "wstr.h"
+#include <sal.h>      // required for _In_, etc.
+#include <stddef.h>   // required for size_t
+#include <stdbool.h>  // required for bool
+
+// Map of wchar keys to opaque values.  Keys are copied.  Values are never read, written, or freed by the map.
+
+struct WStrHashMapSlot
+{
+    // Intentional: Copy of key hash.  Why?  Reject most non-equal slots without reading key wchars.
+    size_t   ulHash;
+    // @Nullable
+    // NULL if slot is empty.  Else, owned copy of key terminated with '\0'.
+    wchar_t *lpNullableKeyWCharArr;
+    size_t   ulKeySize;
+    // @Nullable
+    void    *lpNullableValue;
+};
+
+/**
+ * Zero-initialised struct is an empty, case-sensitive map.  No memory is allocated until first insert.
+ * <pre>{@code
+ * struct WStrHashMap map = {.bIgnoreCase = true};
+ * WStrHashMapInsert(&map, L"LCtrl", 5, lpValue);
+ * void *lpNullableValue = NULL;
+ * if (WStrHashMapFind(&map, L"lctrl", 5, &lpNullableValue)) ...
+ * WStrHashMapFree(&map);
+ * }</pre>
+ */
+struct WStrHashMap
+{
+    // Open addressing with linear probing.  Load factor is at most 1/2.
+    struct WStrHashMapSlot *lpSlotArr;
+    // Zero or power of two
+    size_t                  ulSlotCapacity;
+    // Number of keys
+    size_t                  ulSize;
+    // If true, keys are compared with same rule as WStrViewCompareI() and hashed with WStrHashWCharArrI().
+    // Important: Never change after first insert.
+    bool                    bIgnoreCase;
+};
+
+void
+WStrHashMapAssertValid(_In_ const struct WStrHashMap *lpMap);
+
+/**
+ * @param lpKeyWCharArr
+ *        @Nullable if (0 == ulKeySize)
+ *        need not be terminated with '\0'
+ *
+ * @param lpNullableValue
+ *        may be NULL
+ *
+ * @return true if key is new and inserted; false if key already exists (map is unchanged)
+ */
+bool
+WStrHashMapInsert(_Inout_ struct WStrHashMap *lpMap,
+                  _In_    const wchar_t      *lpKeyWCharArr,
+                  _In_    const size_t        ulKeySize,
+                  _In_    void               *lpNullableValue);
+
+/**
+ * @param lppNullableValue
+ *        output value -- only set if return result is true
+ *
+ * @return true if key exists
+ */
+bool
+WStrHashMapFind(_In_  const struct WStrHashMap  *lpMap,
+                _In_  const wchar_t             *lpKeyWCharArr,
+                _In_  const size_t               ulKeySize,
+                _Out_ void                     **lppNullableValue);
+
+/**
+ * @return true if key existed and is removed
+ */
+bool
+WStrHashMapErase(_Inout_ struct WStrHashMap *lpMap,
+                 _In_    const wchar_t      *lpKeyWCharArr,
+                 _In_    const size_t        ulKeySize);
+
+/**
+ * Free all keys.  Afterwards, lpMap is empty and may be reused.  bIgnoreCase is unchanged.
+ */
+void
+WStrHashMapFree(_Inout_ struct WStrHashMap *lpMap);
+
+#endif  // H_COMMON_WSTR_HASH_MAP
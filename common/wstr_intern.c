@@ -0,0 +1,236 @@
+#include "wstr_intern.h"
+#include "wstr_simd.h"
+#include "xmalloc.h"
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+
+// Intentional: Power of two.  Why?  Slot index is (ulHash & (ulSlotCapacity - 1)).
+#define WSTR_INTERN_MIN_SLOT_CAPACITY 16U
+
+struct WStrInternBlock
+{
+    // @Nullable
+    struct WStrInternBlock *lpNullableNext;
+    size_t                  ulByteSize;
+    size_t                  ulByteCapacity;
+    // Intentional: Align data.  Why?  Each struct WStrInterned is bump-allocated from here.
+    struct WStrInterned     dataArr[];
+};
+
+void
+WStrInternAssertValid(_In_ const struct WStrIntern *lpIntern)
+{
+    assert(NULL != lpIntern);
+    if (0 == lpIntern->ulSlotCapacity)
+    {
+        assert(NULL == lpIntern->lpSlotArr);
+        assert(0 == lpIntern->ulSize);
+    }
+    else
+    {
+        assert(NULL != lpIntern->lpSlotArr);
+        // Power of two
+        assert(0 == (lpIntern->ulSlotCapacity & (lpIntern->ulSlotCapacity - 1U)));
+        assert(lpIntern->ulSize <= lpIntern->ulSlotCapacity / 2U);
+    }
+    assert((0 == lpIntern->ulSize) == (NULL == lpIntern->lpNullableBlock));
+}
+
+static size_t
+StaticRoundUp(_In_ const size_t ulSize,
+              _In_ const size_t ulAlign)
+{
+    const size_t x = (ulSize + ulAlign - 1U) / ulAlign * ulAlign;
+    return x;
+}
+
+/**
+ * @return zeroed memory for one canonical instance
+ */
+static struct WStrInterned *
+StaticAllocInterned(_Inout_ struct WStrIntern *lpIntern,
+                    _In_    const size_t       ulByteSize)
+{
+    struct WStrInternBlock *lpBlock = lpIntern->lpNullableBlock;
+    if (NULL == lpBlock || lpBlock->ulByteSize + ulByteSize > lpBlock->ulByteCapacity)
+    {
+        // Intentional: Long string may need a larger block.  Why?  Canonical instance is never split.
+        const size_t ulByteCapacity = (ulByteSize > WSTR_INTERN_BLOCK_BYTE_SIZE) ? ulByteSize : WSTR_INTERN_BLOCK_BYTE_SIZE;
+        lpBlock = xcalloc(1U, sizeof(struct WStrInternBlock) + ulByteCapacity);
+        lpBlock->lpNullableNext = lpIntern->lpNullableBlock;
+        lpBlock->ulByteCapacity = ulByteCapacity;
+        lpIntern->lpNullableBlock = lpBlock;
+        lpIntern->ulBlockByteSize += ulByteCapacity;
+    }
+
+    struct WStrInterned *lpInterned = (struct WStrInterned *) (((char *) lpBlock->dataArr) + lpBlock->ulByteSize);
+    lpBlock->ulByteSize += ulByteSize;
+    return lpInterned;
+}
+
+/**
+ * @return slot for lpWCharArr: either equal string or first empty slot
+ */
+static struct WStrInternSlot *
+StaticFindSlot(_In_ const struct WStrIntern *lpIntern,
+               _In_ const wchar_t           *lpWCharArr,
+               _In_ const size_t             ulSize,
+               _In_ const size_t             ulHash)
+{
+    const size_t ulMask = lpIntern->ulSlotCapacity - 1U;
+    size_t ulIndex = ulHash & ulMask;
+    while (true)
+    {
+        struct WStrInternSlot *lpSlot = lpIntern->lpSlotArr + ulIndex;
+        if (NULL == lpSlot->lpNullableInterned) {
+            return lpSlot;
+        }
+        const struct WStr *lpWStr = &(lpSlot->lpNullableInterned->wstr);
+        if (ulHash == lpSlot->ulHash
+            && ulSize == lpWStr->ulSize
+            && ulSize == WStrSimdMismatch(lpWCharArr, lpWStr->lpWCharArr, ulSize))
+        {
+            return lpSlot;
+        }
+        ulIndex = (ulIndex + 1U) & ulMask;
+    }
+}
+
+static void
+StaticGrow(_Inout_ struct WStrIntern *lpIntern)
+{
+    const size_t ulOldSlotCapacity = lpIntern->ulSlotCapacity;
+    struct WStrInternSlot *lpOldSlotArr = lpIntern->lpSlotArr;
+
+    lpIntern->ulSlotCapacity = (0 == ulOldSlotCapacity) ? WSTR_INTERN_MIN_SLOT_CAPACITY : 2U * ulOldSlotCapacity;
+    lpIntern->lpSlotArr = xcalloc(lpIntern->ulSlotCapacity, sizeof(struct WStrInternSlot));
+
+    // Intentional: Re-insert with cached hash.  Why?  No wchars are read or hashed again.
+    const size_t ulMask = lpIntern->ulSlotCapacity - 1U;
+    for (size_t i = 0; i < ulOldSlotCapacity; ++i)
+    {
+        const struct WStrInternSlot *lpOldSlot = lpOldSlotArr + i;
+        if (NULL != lpOldSlot->lpNullableInterned)
+        {
+            size_t ulIndex = lpOldSlot->ulHash & ulMask;
+            while (NULL != lpIntern->lpSlotArr[ulIndex].lpNullableInterned)
+            {
+                ulIndex = (ulIndex + 1U) & ulMask;
+            }
+            lpIntern->lpSlotArr[ulIndex] = *lpOldSlot;
+        }
+    }
+    xfree((void **) &lpOldSlotArr);
+}
+
+const struct WStrInterned *
+WStrInternWCharArr(_Inout_ struct WStrIntern *lpIntern,
+                   _In_    const wchar_t     *lpWCharArr,
+                   _In_    const size_t       ulSize)
+{
+    WStrInternAssertValid(lpIntern);
+    assert(0 == ulSize || NULL != lpWCharArr);
+
+    // Intentional: Grow before find.  Why?  Slot pointer from StaticFindSlot() must stay valid for insert.
+    if (2U * (lpIntern->ulSize + 1U) > lpIntern->ulSlotCapacity)
+    {
+        StaticGrow(lpIntern);
+    }
+
+    const size_t ulHash = WStrHashWCharArr(lpWCharArr, ulSize);
+    struct WStrInternSlot *lpSlot = StaticFindSlot(lpIntern, lpWCharArr, ulSize, ulHash);
+    if (NULL != lpSlot->lpNullableInterned) {
+        return lpSlot->lpNullableInterned;
+    }
+
+    const bool bIsSmall = (ulSize < WSTR_SMALL_CAPACITY);
+    const size_t ulByteSize =
+        StaticRoundUp(sizeof(struct WStrInterned) + (bIsSmall ? 0 : (ulSize + LEN_NUL_CHAR) * sizeof(wchar_t)),
+                      _Alignof(struct WStrInterned));
+
+    struct WStrInterned *lpInterned = StaticAllocInterned(lpIntern, ulByteSize);
+    // Intentional: Do not call WStrCopyWCharArr().  Why?  It allocates from heap for long strings.
+    // Above, StaticAllocInterned() zeroes memory, so trailing null char is set.
+    lpInterned->wstr.lpWCharArr = bIsSmall ? lpInterned->wstr.smallWCharArr : (wchar_t *) (lpInterned + 1);
+    if (ulSize > 0) {
+        wmemcpy(lpInterned->wstr.lpWCharArr, lpWCharArr, ulSize);
+    }
+    lpInterned->wstr.ulSize = ulSize;
+    // Intentional: Not WSTR_ALLOC_HEAP.  Why?  Long wchars live in intern block: WStrFree() must not xfree() them.
+    lpInterned->wstr.eAlloc = WSTR_ALLOC_ARENA;
+    lpInterned->ulHash      = ulHash;
+
+    *lpSlot = (struct WStrInternSlot) {.ulHash = ulHash, .lpNullableInterned = lpInterned};
+    ++(lpIntern->ulSize);
+    return lpInterned;
+}
+
+const struct WStrInterned *
+WStrInternWStr(_Inout_ struct WStrIntern *lpIntern,
+               _In_    const struct WStr *lpWStr)
+{
+    WStrAssertValid(lpWStr);
+
+    const struct WStrInterned *x = WStrInternWCharArr(lpIntern, lpWStr->lpWCharArr, lpWStr->ulSize);
+    return x;
+}
+
+const struct WStrInterned *
+WStrInternWStrView(_Inout_ struct WStrIntern     *lpIntern,
+                   _In_    const struct WStrView *lpWStrView)
+{
+    WStrViewAssertValid(lpWStrView);
+
+    const struct WStrInterned *x = WStrInternWCharArr(lpIntern, lpWStrView->lpWCharArr, lpWStrView->ulSize);
+    return x;
+}
+
+const struct WStrInterned *
+WStrInternFindWCharArr(_In_ const struct WStrIntern *lpIntern,
+                       _In_ const wchar_t           *lpWCharArr,
+                       _In_ const size_t             ulSize)
+{
+    WStrInternAssertValid(lpIntern);
+    assert(0 == ulSize || NULL != lpWCharArr);
+
+    if (0 == lpIntern->ulSize) {
+        return NULL;
+    }
+
+    const size_t ulHash = WStrHashWCharArr(lpWCharArr, ulSize);
+    const struct WStrInternSlot *lpSlot = StaticFindSlot(lpIntern, lpWCharArr, ulSize, ulHash);
+    return lpSlot->lpNullableInterned;
+}
+
+size_t
+WStrInternGetHeapByteSize(_In_ const struct WStrIntern *lpIntern)
+{
+    WStrInternAssertValid(lpIntern);
+
+    size_t ulBlockCount = 0;
+    for (const struct WStrInternBlock *lpBlock = lpIntern->lpNullableBlock; NULL != lpBlock; lpBlock = lpBlock->lpNullableNext)
+    {
+        ++ulBlockCount;
+    }
+
+    const size_t x = (lpIntern->ulSlotCapacity * sizeof(struct WStrInternSlot))
+                     + (ulBlockCount * sizeof(struct WStrInternBlock))
+                     + lpIntern->ulBlockByteSize;
+    return x;
+}
+
+void
+WStrInternFree(_Inout_ struct WStrIntern *lpIntern)
+{
+    WStrInternAssertValid(lpIntern);
+
+    struct WStrInternBlock *lpBlock = lpIntern->lpNullableBlock;
+    while (NULL != lpBlock)
+    {
+        struct WStrInternBlock *lpNextBlock = lpBlock->lpNullableNext;
+        xfree((void **) &lpBlock);
+        lpBlock = lpNextBlock;
+    }
+    xfree((void **) &(lpIntern->lpSlotArr));
+    *lpIntern = (struct WStrIntern) {0};
+}
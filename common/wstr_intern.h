@@ -0,0 +1,113 @@
+#ifndef H_COMMON_WSTR_INTERN
+#define H_COMMON_WSTR_INTERN
+
+#include "win32.h"
+#include "wstr.h"
+#include <sal.h>     // required for _In_, etc.
+#include <stddef.h>  // required for size_t
+
+// Map equal strings to one canonical, immutable instance with a cached hash.
+// Two interned strings from the same WStrIntern are equal if and only if their pointers are equal.
+
+// Intentional: Canonical instances are bump-allocated from blocks, not one heap alloc each.  Why?  Less heap overhead.
+#define WSTR_INTERN_BLOCK_BYTE_SIZE (64U * 1024U)
+
+struct WStrInterned
+{
+    // Intentional: First member.  Why?  Pass &lpInterned->wstr to any function that takes const struct WStr *.
+    // Important: Never modify or free.  Memory is owned by WStrIntern.  Always WSTR_ALLOC_ARENA, so WStrFree() on a copy is safe.
+    // If shorter than WSTR_SMALL_CAPACITY, wchars are inline.  Else, wchars follow this struct in same block.
+    struct WStr wstr;
+    // Cached WStrHashWCharArr(wstr.lpWCharArr, wstr.ulSize)
+    size_t      ulHash;
+};
+
+struct WStrInternSlot
+{
+    // Intentional: Copy of lpNullableInterned->ulHash.  Why?  Reject most non-equal slots without a pointer chase.
+    size_t               ulHash;
+    // NULL if slot is empty
+    struct WStrInterned *lpNullableInterned;
+};
+
+struct WStrInternBlock;
+
+/**
+ * Zero-initialised struct is an empty table.  No memory is allocated until first string is interned.
+ * <pre>{@code
+ * struct WStrIntern intern = {0};
+ * const struct WStrInterned *lpInterned  = WStrInternWCharArr(&intern, L"abc", 3);
+ * const struct WStrInterned *lpInterned2 = WStrInternWStr(&intern, &WSTR_FROM_LITERAL(L"abc"));
+ * assert(lpInterned == lpInterned2);
+ * WStrInternFree(&intern);
+ * }</pre>
+ */
+struct WStrIntern
+{
+    // Open addressing with linear probing.  Load factor is at most 1/2.
+    struct WStrInternSlot  *lpSlotArr;
+    // Zero or power of two
+    size_t                  ulSlotCapacity;
+    // Number of distinct strings
+    size_t                  ulSize;
+    // @Nullable
+    // Most recent block first.  Only the first block has free space.
+    struct WStrInternBlock *lpNullableBlock;
+    // Sum of capacity of all blocks
+    size_t                  ulBlockByteSize;
+};
+
+void
+WStrInternAssertValid(_In_ const struct WStrIntern *lpIntern);
+
+/**
+ * @param lpWCharArr
+ *        @Nullable if (0 == ulSize)
+ *        need not be terminated with '\0'
+ *
+ * @return canonical instance equal to lpWCharArr.  If new, wchars are copied.
+ *         Pointer is valid until WStrInternFree().
+ */
+const struct WStrInterned *
+WStrInternWCharArr(_Inout_ struct WStrIntern *lpIntern,
+                   _In_    const wchar_t     *lpWCharArr,
+                   _In_    const size_t       ulSize);
+
+/**
+ * This is a convenience method to call WStrInternWCharArr().
+ */
+const struct WStrInterned *
+WStrInternWStr(_Inout_ struct WStrIntern *lpIntern,
+               _In_    const struct WStr *lpWStr);
+
+/**
+ * This is a convenience method to call WStrInternWCharArr().
+ */
+const struct WStrInterned *
+WStrInternWStrView(_Inout_ struct WStrIntern     *lpIntern,
+                   _In_    const struct WStrView *lpWStrView);
+
+/**
+ * Like WStrInternWCharArr(), but never adds.
+ *
+ * @return @Nullable
+ *         canonical instance equal to lpWCharArr, or NULL if never interned
+ */
+const struct WStrInterned *
+WStrInternFindWCharArr(_In_ const struct WStrIntern *lpIntern,
+                       _In_ const wchar_t           *lpWCharArr,
+                       _In_ const size_t             ulSize);
+
+/**
+ * @return number of bytes allocated from heap: slot array and all blocks
+ */
+size_t
+WStrInternGetHeapByteSize(_In_ const struct WStrIntern *lpIntern);
+
+/**
+ * Free all canonical instances.  Afterwards, lpIntern is empty and may be reused.
+ */
+void
+WStrInternFree(_Inout_ struct WStrIntern *lpIntern);
+
+#endif  // H_COMMON_WSTR_INTERN
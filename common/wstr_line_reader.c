@@ -0,0 +1,346 @@
+#include "wstr_line_reader.h"
+#include "wstr_simd.h"
+#include "wstr_utf8.h"
+#include "xmalloc.h"
+#include "win32_last_error.h"
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW and abort()
+#include <stdint.h>  // required for SIZE_MAX
+#include <limits.h>  // required for INT_MAX
+#include <string.h>  // required for memmove()
+#include <stdio.h>   // required for fwprintf()
+
+void
+WStrLineReaderAssertValid(_In_ const struct WStrLineReader *lpReader)
+{
+    assert(NULL != lpReader);
+    assert(INVALID_HANDLE_VALUE != lpReader->hFile);
+    assert(NULL != lpReader->hFile);
+    assert(NULL != lpReader->lpChunkCharArr);
+    assert(NULL != lpReader->lpChunkWCharArr);
+    assert(lpReader->ulChunkByteSize >= WSTR_LINE_READER_MIN_CHUNK_BYTE_SIZE);
+    assert(lpReader->ulCarryByteSize < WSTR_LINE_READER_MIN_CHUNK_BYTE_SIZE);
+    assert(lpReader->ulChunkWCharSize <= lpReader->ulChunkByteSize);
+    assert(lpReader->ulChunkWCharOffset <= lpReader->ulChunkWCharSize);
+    WStrBuilderAssertValid(&(lpReader->lineWStrBuilder));
+}
+
+void
+WStrLineReaderOpen(_Out_ struct WStrLineReader *lpReader,
+                   _In_  const wchar_t         *lpFilePathWCharArr,
+                   _In_  const UINT             codePage,  // Ex: CP_UTF8
+                   _In_  const size_t           ulChunkByteSize)
+{
+    if (!WStrLineReaderOpen2(lpReader, lpFilePathWCharArr, codePage, ulChunkByteSize, stderr))
+    {
+        abort();
+    }
+}
+
+bool
+WStrLineReaderOpen2(_Out_   struct WStrLineReader *lpReader,
+                    _In_    const wchar_t         *lpFilePathWCharArr,
+                    _In_    const UINT             codePage,  // Ex: CP_UTF8
+                    _In_    const size_t           ulChunkByteSize,
+                    _Inout_ FILE                  *lpErrorStream)
+{
+    assert(NULL != lpReader);
+    assert(NULL != lpFilePathWCharArr);
+    assert(ulChunkByteSize >= WSTR_LINE_READER_MIN_CHUNK_BYTE_SIZE);
+    // Intentional: ReadFile() and MultiByteToWideChar() count with DWORD and int.
+    assert(ulChunkByteSize <= INT_MAX);
+    assert(NULL != lpErrorStream);
+
+    if (CP_UTF8 != codePage)
+    {
+        // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winnls/nf-winnls-getcpinfo
+        CPINFO cpInfo = {0};
+        if (!GetCPInfo(codePage, &cpInfo))
+        {
+            Win32LastErrorFPrintFW(lpErrorStream,     // _In_ FILE          *lpStream
+                                   L"GetCPInfo(%u)",  // _In_ const wchar_t *lpMessageFormat
+                                   codePage);         // _In_ ...
+            return false;
+        }
+        if (1 != cpInfo.MaxCharSize)
+        {
+            Win32LastErrorFPrintFW(lpErrorStream,  // _In_ FILE          *lpStream
+                                   L"Code page %u is not supported: MaxCharSize is %u.  Only CP_UTF8 and single-byte code pages are supported.",  // _In_ const wchar_t *lpMessageFormat
+                                   codePage, cpInfo.MaxCharSize);  // _In_ ...
+            return false;
+        }
+    }
+
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    const HANDLE hFile = CreateFile(lpFilePathWCharArr,     // [in] LPCWSTR lpFileName
+                                    GENERIC_READ,           // [in] DWORD dwDesiredAccess
+                                    FILE_SHARE_READ,        // [in] DWORD dwShareMode
+                                    NULL,                   // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes
+                                    OPEN_EXISTING,          // [in] DWORD dwCreationDisposition
+                                    // Intentional: Hint to cache manager.  Why?  File is read once from start to end.
+                                    FILE_FLAG_SEQUENTIAL_SCAN,  // [in] DWORD dwFlagsAndAttributes
+                                    NULL);                  // [in, optional] hTemplateFile
+    if (INVALID_HANDLE_VALUE == hFile)
+    {
+        Win32LastErrorFPrintFW(lpErrorStream,  // _In_ FILE          *lpStream,
+                               L"CreateFile(lpFileName[%ls], GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL)",  // _In_ const wchar_t *lpMessageFormat,
+                               lpFilePathWCharArr);  // _In_ ...
+        return false;
+    }
+
+    *lpReader = (struct WStrLineReader) {
+        .hFile           = hFile,
+        .codePage        = codePage,
+        // Intentional: Not zeroed.  Why?  Only bytes from ReadFile() and wchars from decode are read.
+        .lpChunkCharArr  = xmalloc(ulChunkByteSize),
+        .ulChunkByteSize = ulChunkByteSize,
+        // Intentional: One wchar per byte is enough.  Why?  UTF-8 needs 4 bytes for a UTF-16 surrogate pair.
+        .lpChunkWCharArr = xmalloc(ulChunkByteSize * sizeof(wchar_t)),
+        .ulLineIndex     = SIZE_MAX,
+        .bIsFirstChunk   = true,
+    };
+    WStrCopyWCharArr(&(lpReader->filePathWStr), lpFilePathWCharArr, wcslen(lpFilePathWCharArr));
+
+    WStrLineReaderAssertValid(lpReader);
+    return true;
+}
+
+// Ref: https://en.wikipedia.org/wiki/UTF-8#Encoding
+static size_t
+StaticUtf8SequenceSize(_In_ const unsigned char uch)
+{
+    if (uch < 0x80) {
+        return 1;
+    }
+    else if (0xC0 == (uch & 0xE0)) {
+        return 2;
+    }
+    else if (0xE0 == (uch & 0xF0)) {
+        return 3;
+    }
+    else if (0xF0 == (uch & 0xF8)) {
+        return 4;
+    }
+    // Invalid lead byte or continuation byte: Let WStrUtf8Decode() report it.
+    return 1;
+}
+
+/**
+ * @return number of bytes that end on a complete UTF-8 sequence
+ *         remaining bytes (at most 3) are the start of a sequence that continues in next chunk
+ */
+static size_t
+StaticUtf8CompleteSize(_In_ const char   *lpCharArr,
+                       _In_ const size_t  ulSize)
+{
+    // Intentional: Look back at most 3 bytes.  Why?  Longest UTF-8 sequence is 4 bytes.
+    for (size_t ulBackCount = 1; ulBackCount <= 3 && ulBackCount <= ulSize; ++ulBackCount)
+    {
+        const unsigned char uch = (unsigned char) lpCharArr[ulSize - ulBackCount];
+        // Continuation byte: 10xxxxxx
+        if (0x80 != (uch & 0xC0))
+        {
+            const size_t ulSequenceSize = StaticUtf8SequenceSize(uch);
+            const size_t ulResult = (ulSequenceSize > ulBackCount) ? (ulSize - ulBackCount) : ulSize;
+            return ulResult;
+        }
+    }
+    return ulSize;
+}
+
+/**
+ * Print line number and file offset of invalid UTF-8 byte, then abort().
+ *
+ * @param ulInvalidByteOffset
+ *        offset in lpReader->lpChunkCharArr
+ */
+static void
+StaticUtf8DecodeAbort(_In_ const struct WStrLineReader *lpReader,
+                      _In_ const size_t                 ulInvalidByteOffset)
+{
+    // Intentional: Count '\n' bytes, not wchars.  Why?  In UTF-8, byte 0x0A is never part of a longer sequence.
+    // Each '\n' before this chunk ended a line from WStrLineReaderNext(): SIZE_MAX + 1 is zero before first line.
+    size_t ulLineIndex = lpReader->ulLineIndex + 1U;
+    for (size_t i = 0; i < ulInvalidByteOffset; ++i)
+    {
+        if ('\n' == lpReader->lpChunkCharArr[i]) {
+            ++ulLineIndex;
+        }
+    }
+    // Intentional: Not Win32LastError*().  Why?  GetLastError() is unrelated.
+    fwprintf(stderr, L"ERROR: WStrUtf8Decode: lpFileName[%ls]: line #%zu: Invalid UTF-8 at byte offset %zu\r\n",
+             lpReader->filePathWStr.lpWCharArr, 1U + ulLineIndex, lpReader->ulChunkFileByteOffset + ulInvalidByteOffset);
+    abort();
+}
+
+/**
+ * Read next chunk of bytes, then decode to lpReader->lpChunkWCharArr.
+ *
+ * @return false at end of file
+ */
+static bool
+StaticReadChunk(_Inout_ struct WStrLineReader *lpReader)
+{
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-readfile
+    const DWORD dwReadSize = (DWORD) (lpReader->ulChunkByteSize - lpReader->ulCarryByteSize);
+    DWORD dwNumberOfBytesRead = 0;
+    if (!ReadFile(lpReader->hFile, lpReader->lpChunkCharArr + lpReader->ulCarryByteSize, dwReadSize, &dwNumberOfBytesRead, NULL))
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                       // _In_ FILE          *lpStream
+                                    L"ReadFile(lpFileName:%ls)",  // _In_ const wchar_t *lpMessageFormat
+                                    lpReader->filePathWStr.lpWCharArr);  // _In_ ...
+    }
+
+    if (0 == dwNumberOfBytesRead)
+    {
+        if (lpReader->ulCarryByteSize > 0)
+        {
+            // Intentional: Not Win32LastError*().  Why?  GetLastError() is unrelated.
+            fwprintf(stderr, L"ERROR: lpFileName[%ls]: Invalid UTF-8: File ends with incomplete sequence at byte offset %zu\r\n",
+                     lpReader->filePathWStr.lpWCharArr, lpReader->ulChunkFileByteOffset);
+            abort();
+        }
+        return false;
+    }
+
+    const size_t ulByteSize = lpReader->ulCarryByteSize + dwNumberOfBytesRead;
+    size_t ulBOMSize = 0;
+    if (lpReader->bIsFirstChunk)
+    {
+        lpReader->bIsFirstChunk = false;
+        ulBOMSize = WStrFileGetBOMSize(lpReader->lpChunkCharArr, ulByteSize);
+    }
+
+    const size_t ulCompleteSize =
+        (CP_UTF8 == lpReader->codePage) ? StaticUtf8CompleteSize(lpReader->lpChunkCharArr, ulByteSize) : ulByteSize;
+
+    lpReader->ulChunkWCharSize   = 0;
+    lpReader->ulChunkWCharOffset = 0;
+
+    if (CP_UTF8 == lpReader->codePage)
+    {
+        size_t ulInvalidByteOffset = 0;
+        if (!WStrUtf8Decode(lpReader->lpChunkCharArr + ulBOMSize,  // _In_  const char   *lpCharArr
+                            ulCompleteSize - ulBOMSize,            // _In_  const size_t  ulByteSize
+                            lpReader->lpChunkWCharArr,             // _Out_ wchar_t      *lpDestWCharArr
+                            &(lpReader->ulChunkWCharSize),         // _Out_ size_t       *lpulDestSize
+                            &ulInvalidByteOffset))                 // _Out_ size_t       *lpulInvalidByteOffset
+        {
+            StaticUtf8DecodeAbort(lpReader, ulBOMSize + ulInvalidByteOffset);
+        }
+    }
+    // Intentional: Only BOM or only an incomplete sequence is possible.  Why?  MultiByteToWideChar() fails if cbMultiByte is zero.
+    else if (ulCompleteSize > ulBOMSize)
+    {
+        // Ref: https://docs.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
+        const int iWCharSize = MultiByteToWideChar(lpReader->codePage,                   // [in] UINT codePage
+                                                   MB_ERR_INVALID_CHARS,                 // [in] DWORD dwFlags
+                                                   lpReader->lpChunkCharArr + ulBOMSize,  // [in] char *lpMultiByteStr
+                                                   (int) (ulCompleteSize - ulBOMSize),   // [in] int cbMultiByte
+                                                   lpReader->lpChunkWCharArr,            // [out/opt] wchar_t *lpWideCharStr
+                                                   (int) lpReader->ulChunkByteSize);     // [in] int cchWideChar
+        if (iWCharSize <= 0)
+        {
+            Win32LastErrorFPrintFWAbort(stderr,  // _In_ FILE          *lpStream,
+                                        L"MultiByteToWideChar(codePage[%u], MB_ERR_INVALID_CHARS, ...): lpFileName:%ls",  // _In_ const wchar_t *lpMessageFormat,
+                                        lpReader->codePage, lpReader->filePathWStr.lpWCharArr);  // _In_ ...
+        }
+        lpReader->ulChunkWCharSize = (size_t) iWCharSize;
+    }
+
+    // Carry incomplete sequence to front of buffer for next chunk.
+    lpReader->ulChunkFileByteOffset += ulCompleteSize;
+    lpReader->ulCarryByteSize = ulByteSize - ulCompleteSize;
+    memmove(lpReader->lpChunkCharArr, lpReader->lpChunkCharArr + ulCompleteSize, lpReader->ulCarryByteSize);
+    return true;
+}
+
+static void
+StaticRemoveCarriageReturn(_Inout_ struct WStrView *lpLineWStrView)
+{
+    if (lpLineWStrView->ulSize > 0 && L'\r' == lpLineWStrView->lpWCharArr[lpLineWStrView->ulSize - 1U]) {
+        --(lpLineWStrView->ulSize);
+    }
+}
+
+bool
+WStrLineReaderNext(_Inout_ struct WStrLineReader *lpReader,
+                   _Out_   struct WStrView       *lpLineWStrView)
+{
+    WStrLineReaderAssertValid(lpReader);
+    assert(NULL != lpLineWStrView);
+
+    // Previous line may be in builder.  Keep capacity for next long line.
+    WStrBuilderClear(&(lpReader->lineWStrBuilder));
+    // Intentional: Separate flag.  Why?  Final line "abc\r" must be returned, but an empty builder at end of file is not a line.
+    bool bHasPartialLine = false;
+
+    while (true)
+    {
+        const wchar_t *lpBeginWCharArr = lpReader->lpChunkWCharArr + lpReader->ulChunkWCharOffset;
+        const size_t ulRemainSize = lpReader->ulChunkWCharSize - lpReader->ulChunkWCharOffset;
+        if (ulRemainSize > 0)
+        {
+            const wchar_t *lpNewLine = WStrSimdFindWChar(lpBeginWCharArr, ulRemainSize, L'\n');
+            if (NULL != lpNewLine)
+            {
+                const size_t ulSize = lpNewLine - lpBeginWCharArr;
+                lpReader->ulChunkWCharOffset += ulSize + 1U;
+                ++(lpReader->ulLineIndex);
+
+                if (false == bHasPartialLine)
+                {
+                    // Intentional: Zero-copy.  Why?  Usual case: Line is inside one chunk.
+                    *lpLineWStrView = (struct WStrView) {.lpWCharArr = lpBeginWCharArr, .ulSize = ulSize};
+                }
+                else {
+                    WStrBuilderAppendWCharArr(&(lpReader->lineWStrBuilder), lpBeginWCharArr, ulSize);
+                    *lpLineWStrView = (struct WStrView) {.lpWCharArr = lpReader->lineWStrBuilder.lpWCharArr,
+                                                         .ulSize     = lpReader->lineWStrBuilder.ulSize};
+                }
+                // Intentional: Remove "\r" after join.  Why?  "\r" and "\n" may be in different chunks.
+                StaticRemoveCarriageReturn(lpLineWStrView);
+                return true;
+            }
+
+            // Line continues in next chunk.
+            WStrBuilderAppendWCharArr(&(lpReader->lineWStrBuilder), lpBeginWCharArr, ulRemainSize);
+            lpReader->ulChunkWCharOffset = lpReader->ulChunkWCharSize;
+            bHasPartialLine = true;
+        }
+
+        if (lpReader->bIsEndOfFile || false == StaticReadChunk(lpReader))
+        {
+            lpReader->bIsEndOfFile = true;
+            if (false == bHasPartialLine) {
+                return false;
+            }
+            // Final line without line terminator: Like WStrSplitNewLine(), keep a final "\r".
+            ++(lpReader->ulLineIndex);
+            *lpLineWStrView = (struct WStrView) {.lpWCharArr = lpReader->lineWStrBuilder.lpWCharArr,
+                                                 .ulSize     = lpReader->lineWStrBuilder.ulSize};
+            return true;
+        }
+    }
+}
+
+void
+WStrLineReaderClose(_Inout_ struct WStrLineReader *lpReader)
+{
+    assert(NULL != lpReader);
+
+    if (NULL != lpReader->hFile && INVALID_HANDLE_VALUE != lpReader->hFile)
+    {
+        if (!CloseHandle(lpReader->hFile))
+        {
+            Win32LastErrorFPrintFWAbort(stderr,                                     // _In_ FILE          *lpStream
+                                        L"CloseHandle(hFile, lpFileName:%ls)",  // _In_ const wchar_t *lpMessageFormat
+                                        lpReader->filePathWStr.lpWCharArr);     // _In_ ...
+        }
+    }
+    xfree((void **) &(lpReader->lpChunkCharArr));
+    xfree((void **) &(lpReader->lpChunkWCharArr));
+    WStrBuilderFree(&(lpReader->lineWStrBuilder));
+    WStrFree(&(lpReader->filePathWStr));
+    *lpReader = (struct WStrLineReader) {0};
+}
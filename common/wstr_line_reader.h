@@ -0,0 +1,124 @@
+#ifndef H_COMMON_WSTR_LINE_READER
+#define H_COMMON_WSTR_LINE_READER
+
+#include "win32.h"
+#include "wstr.h"
+#include <sal.h>     // required for _In_, etc.
+#include <stddef.h>  // required for size_t
+#include <windef.h>  // required for UINT, HANDLE
+
+// Read a text file one line at a time with bounded memory: one chunk of bytes, one chunk of wchars, and the longest line.
+// Unlike WStrFileRead() + WStrSplitNewLine(), the whole file is never in memory, and file size is not limited.
+
+#define WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE (64U * 1024U)
+// Intentional: Minimum is longest UTF-8 sequence.  Why?  Up to 3 bytes of an incomplete sequence are carried to next chunk.
+#define WSTR_LINE_READER_MIN_CHUNK_BYTE_SIZE 4U
+
+/**
+ * <pre>{@code
+ * struct WStrLineReader reader = {0};
+ * WStrLineReaderOpen(&reader, L"config.txt", CP_UTF8, WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE);
+ * struct WStrView lineWStrView = {0};
+ * while (WStrLineReaderNext(&reader, &lineWStrView))
+ * {
+ *     // reader.ulLineIndex is zero-based index of lineWStrView
+ * }
+ * WStrLineReaderClose(&reader);
+ * }</pre>
+ */
+struct WStrLineReader
+{
+    HANDLE   hFile;
+    // Intentional: Copy.  Why?  Error messages after open.
+    struct WStr filePathWStr;
+    // Ex: CP_UTF8
+    UINT     codePage;
+
+    char    *lpChunkCharArr;
+    size_t   ulChunkByteSize;
+    // Bytes at front of lpChunkCharArr not yet decoded: (partial) UTF-8 sequence split across chunks
+    size_t   ulCarryByteSize;
+    // File offset of lpChunkCharArr[0].  Only for error messages.
+    size_t   ulChunkFileByteOffset;
+
+    // Decoded wchars from current chunk.  At most one wchar per byte.  Never terminated with '\0'.
+    wchar_t *lpChunkWCharArr;
+    size_t   ulChunkWCharSize;
+    // Next wchar to scan in lpChunkWCharArr
+    size_t   ulChunkWCharOffset;
+
+    // Intentional: Only used for lines that span chunks.  Otherwise, line is a view into lpChunkWCharArr.
+    struct WStrBuilder lineWStrBuilder;
+
+    // Zero-based index of last line returned by WStrLineReaderNext().  SIZE_MAX before first line.
+    size_t   ulLineIndex;
+    bool     bIsFirstChunk;
+    bool     bIsEndOfFile;
+};
+
+void
+WStrLineReaderAssertValid(_In_ const struct WStrLineReader *lpReader);
+
+/**
+ * This is a convenience method to call WStrLineReaderOpen2(..., stderr).
+ * On error, abort() is called.
+ */
+void
+WStrLineReaderOpen(_Out_ struct WStrLineReader *lpReader,
+                   _In_  const wchar_t         *lpFilePathWCharArr,
+                   _In_  const UINT             codePage,  // Ex: CP_UTF8
+                   _In_  const size_t           ulChunkByteSize);
+
+/**
+ * Open file for reading.  No bytes are read until first call to WStrLineReaderNext().
+ *
+ * @param codePage
+ *        CP_UTF8 or any single-byte code page, e.g., 1252
+ *        Multi-byte code pages, e.g., 932 (Shift-JIS), are not supported: Lead and trail bytes cannot be found
+ *        from end of chunk.
+ *
+ * @param ulChunkByteSize
+ *        usually WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE
+ *        must be at least WSTR_LINE_READER_MIN_CHUNK_BYTE_SIZE
+ *
+ * @param lpErrorStream
+ *        stream to print errors
+ *        usually 'stderr' (from <stdio.h>), but may be any valid stream
+ *
+ * @return true on success
+ *         false on failure and error printed to {@code lpErrorStream}
+ */
+bool
+WStrLineReaderOpen2(_Out_   struct WStrLineReader *lpReader,
+                    _In_    const wchar_t         *lpFilePathWCharArr,
+                    _In_    const UINT             codePage,  // Ex: CP_UTF8
+                    _In_    const size_t           ulChunkByteSize,
+                    _Inout_ FILE                  *lpErrorStream);
+
+/**
+ * Read next line.  Lines end with "\n" or "\r\n".  Line terminator is not included.
+ * Like WStrSplitNewLine(), a final line terminator does not begin an empty final line: "abc\r\n" -> ["abc"].
+ * Unlike WStrSplitNewLine(), an empty file has zero lines, and "\r\n" and "\n" may be mixed in one file.
+ * <p>
+ * BOM (byte order mark) is handled like WStrFileRead(): UTF-8 BOM is skipped; UTF-16 and UTF-32 BOMs abort().
+ * On read or decode error, abort() is called.
+ *
+ * @param lpLineWStrView
+ *        on true return, view of next line
+ *        Important: View is only valid until next call to WStrLineReaderNext() or WStrLineReaderClose().
+ *        Important: View is *not* terminated with '\0'.
+ *
+ * @return true if lpLineWStrView is next line
+ *         false at end of file
+ */
+bool
+WStrLineReaderNext(_Inout_ struct WStrLineReader *lpReader,
+                   _Out_   struct WStrView       *lpLineWStrView);
+
+/**
+ * Close file and free all buffers.  Safe to call for zero-initialised lpReader.
+ */
+void
+WStrLineReaderClose(_Inout_ struct WStrLineReader *lpReader);
+
+#endif  // H_COMMON_WSTR_LINE_READER
@@ -0,0 +1,578 @@
+#include "wstr_simd.h"
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+#include <wctype.h>  // required for iswspace()
+
+// Intentional: Kernels compare 16-bit lanes, so only enable when wchar_t is 16-bit, e.g., Windows.
+#if (defined(__x86_64__) || defined(__i386__)) && (2 == __SIZEOF_WCHAR_T__)
+#define WSTR_SIMD_X86 1
+#include <cpuid.h>      // required for __get_cpuid()
+#include <immintrin.h>  // required for _mm_*() and _mm256_*()
+#else
+#define WSTR_SIMD_X86 0
+#endif
+
+struct WStrSimdKernels
+{
+    enum EWStrSimdLevel eLevel;
+
+    const wchar_t *(*fpFindWChar)(_In_ const wchar_t *lpWCharArr,
+                                  _In_ const size_t   ulSize,
+                                  _In_ const wchar_t  wch);
+
+    // Only called when ulNeedleSize >= 2 and ulNeedleSize <= ulSize
+    const wchar_t *(*fpFindWCharArr)(_In_ const wchar_t *lpWCharArr,
+                                     _In_ const size_t   ulSize,
+                                     _In_ const wchar_t *lpNeedleWCharArr,
+                                     _In_ const size_t   ulNeedleSize);
+
+    // Only ASCII whitespace: '\t', '\n', '\v', '\f', '\r', ' '
+    size_t (*fpSpanAsciiSpace)(_In_ const wchar_t *lpWCharArr,
+                               _In_ const size_t   ulSize);
+
+    size_t (*fpRSpanAsciiSpace)(_In_ const wchar_t *lpWCharArr,
+                                _In_ const size_t   ulSize);
+
+    size_t (*fpMismatch)(_In_ const wchar_t *lpLeftWCharArr,
+                         _In_ const wchar_t *lpRightWCharArr,
+                         _In_ const size_t   ulSize);
+};
+
+// Intentional: Do not use wmemchr(), wmemcmp(), etc.  Why?  Scalar kernels are the reference for differential tests.
+
+static inline bool
+StaticIsAsciiSpace(_In_ const wchar_t wch)
+{
+    const bool b = (L' ' == wch) || (wch >= L'\t' && wch <= L'\r');
+    return b;
+}
+
+static const wchar_t *
+StaticScalarFindWChar(_In_ const wchar_t *lpWCharArr,
+                      _In_ const size_t   ulSize,
+                      _In_ const wchar_t  wch)
+{
+    for (size_t i = 0; i < ulSize; ++i)
+    {
+        if (wch == lpWCharArr[i]) {
+            return lpWCharArr + i;
+        }
+    }
+    return NULL;
+}
+
+static size_t
+StaticScalarMismatch(_In_ const wchar_t *lpLeftWCharArr,
+                     _In_ const wchar_t *lpRightWCharArr,
+                     _In_ const size_t   ulSize)
+{
+    size_t i = 0;
+    while (i < ulSize && lpLeftWCharArr[i] == lpRightWCharArr[i])
+    {
+        ++i;
+    }
+    return i;
+}
+
+static const wchar_t *
+StaticScalarFindWCharArr(_In_ const wchar_t *lpWCharArr,
+                         _In_ const size_t   ulSize,
+                         _In_ const wchar_t *lpNeedleWCharArr,
+                         _In_ const size_t   ulNeedleSize)
+{
+    if (ulNeedleSize > ulSize) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i <= ulSize - ulNeedleSize; ++i)
+    {
+        if (lpNeedleWCharArr[0] == lpWCharArr[i]
+            && ulNeedleSize - 1U == StaticScalarMismatch(lpWCharArr + i + 1U, lpNeedleWCharArr + 1U, ulNeedleSize - 1U))
+        {
+            return lpWCharArr + i;
+        }
+    }
+    return NULL;
+}
+
+static size_t
+StaticScalarSpanAsciiSpace(_In_ const wchar_t *lpWCharArr,
+                           _In_ const size_t   ulSize)
+{
+    size_t i = 0;
+    while (i < ulSize && StaticIsAsciiSpace(lpWCharArr[i]))
+    {
+        ++i;
+    }
+    return i;
+}
+
+static size_t
+StaticScalarRSpanAsciiSpace(_In_ const wchar_t *lpWCharArr,
+                            _In_ const size_t   ulSize)
+{
+    size_t ulCount = 0;
+    while (ulCount < ulSize && StaticIsAsciiSpace(lpWCharArr[ulSize - 1U - ulCount]))
+    {
+        ++ulCount;
+    }
+    return ulCount;
+}
+
+static const struct WStrSimdKernels SCALAR_KERNELS = {
+    .eLevel            = WSTR_SIMD_LEVEL_SCALAR,
+    .fpFindWChar       = StaticScalarFindWChar,
+    .fpFindWCharArr    = StaticScalarFindWCharArr,
+    .fpSpanAsciiSpace  = StaticScalarSpanAsciiSpace,
+    .fpRSpanAsciiSpace = StaticScalarRSpanAsciiSpace,
+    .fpMismatch        = StaticScalarMismatch,
+};
+
+#if WSTR_SIMD_X86
+
+// Each 16-bit lane is two bits in _mm_movemask_epi8() / _mm256_movemask_epi8().
+// Thus: lane index = bit index / 2
+
+#define WSTR_SIMD_SSE2_LANE_COUNT 8U
+#define WSTR_SIMD_SSE2_ALL_MASK   0xFFFFU
+
+__attribute__((target("sse2")))
+static inline __m128i
+StaticSse2IsAsciiSpace(_In_ const __m128i v)
+{
+    // Intentional: SSE2 has no unsigned 16-bit compare.  Instead: (wch - '\t') <= ('\r' - '\t') if saturated
+    // subtraction is zero.  Wrap around for wch < '\t' is intended: it becomes a large unsigned value.
+    const __m128i offset   = _mm_sub_epi16(v, _mm_set1_epi16(L'\t'));
+    const __m128i bIsCtrl  = _mm_cmpeq_epi16(_mm_subs_epu16(offset, _mm_set1_epi16(L'\r' - L'\t')), _mm_setzero_si128());
+    const __m128i bIsSpace = _mm_cmpeq_epi16(v, _mm_set1_epi16(L' '));
+    return _mm_or_si128(bIsCtrl, bIsSpace);
+}
+
+__attribute__((target("sse2")))
+static const wchar_t *
+StaticSse2FindWChar(_In_ const wchar_t *lpWCharArr,
+                    _In_ const size_t   ulSize,
+                    _In_ const wchar_t  wch)
+{
+    const __m128i needle = _mm_set1_epi16((short) wch);
+    size_t i = 0;
+    for (; i + WSTR_SIMD_SSE2_LANE_COUNT <= ulSize; i += WSTR_SIMD_SSE2_LANE_COUNT)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *) (lpWCharArr + i));
+        const unsigned mask = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi16(v, needle));
+        if (0 != mask) {
+            return lpWCharArr + i + (__builtin_ctz(mask) / 2U);
+        }
+    }
+    return StaticScalarFindWChar(lpWCharArr + i, ulSize - i, wch);
+}
+
+// Ref: http://0x80.pl/articles/simd-strfind.html ("generic SIMD": compare first and last wchar of needle)
+__attribute__((target("sse2")))
+static const wchar_t *
+StaticSse2FindWCharArr(_In_ const wchar_t *lpWCharArr,
+                       _In_ const size_t   ulSize,
+                       _In_ const wchar_t *lpNeedleWCharArr,
+                       _In_ const size_t   ulNeedleSize)
+{
+    const __m128i first = _mm_set1_epi16((short) lpNeedleWCharArr[0]);
+    const __m128i last  = _mm_set1_epi16((short) lpNeedleWCharArr[ulNeedleSize - 1U]);
+    const size_t ulLastOffset = ulNeedleSize - 1U;
+    size_t i = 0;
+    for (; i + ulLastOffset + WSTR_SIMD_SSE2_LANE_COUNT <= ulSize; i += WSTR_SIMD_SSE2_LANE_COUNT)
+    {
+        const __m128i vFirst = _mm_loadu_si128((const __m128i *) (lpWCharArr + i));
+        const __m128i vLast  = _mm_loadu_si128((const __m128i *) (lpWCharArr + i + ulLastOffset));
+        unsigned mask = (unsigned) _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(vFirst, first),
+                                                                   _mm_cmpeq_epi16(vLast, last)));
+        while (0 != mask)
+        {
+            const unsigned bit = (unsigned) __builtin_ctz(mask);
+            const wchar_t *lpCandidate = lpWCharArr + i + (bit / 2U);
+            // Intentional: First and last wchar already match.  Only compare middle.
+            if (ulNeedleSize - 2U == StaticScalarMismatch(lpCandidate + 1U, lpNeedleWCharArr + 1U, ulNeedleSize - 2U)) {
+                return lpCandidate;
+            }
+            // Clear both bits for this lane
+            mask &= ~(3U << bit);
+        }
+    }
+    const wchar_t *lpResult = StaticScalarFindWCharArr(lpWCharArr + i, ulSize - i, lpNeedleWCharArr, ulNeedleSize);
+    return lpResult;
+}
+
+__attribute__((target("sse2")))
+static size_t
+StaticSse2SpanAsciiSpace(_In_ const wchar_t *lpWCharArr,
+                         _In_ const size_t   ulSize)
+{
+    size_t i = 0;
+    for (; i + WSTR_SIMD_SSE2_LANE_COUNT <= ulSize; i += WSTR_SIMD_SSE2_LANE_COUNT)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *) (lpWCharArr + i));
+        const unsigned mask = (unsigned) _mm_movemask_epi8(StaticSse2IsAsciiSpace(v));
+        if (WSTR_SIMD_SSE2_ALL_MASK != mask) {
+            return i + (__builtin_ctz(~mask) / 2U);
+        }
+    }
+    return i + StaticScalarSpanAsciiSpace(lpWCharArr + i, ulSize - i);
+}
+
+__attribute__((target("sse2")))
+static size_t
+StaticSse2RSpanAsciiSpace(_In_ const wchar_t *lpWCharArr,
+                          _In_ const size_t   ulSize)
+{
+    // Intentional: Exclusive
+    size_t ulEnd = ulSize;
+    for (; ulEnd >= WSTR_SIMD_SSE2_LANE_COUNT; ulEnd -= WSTR_SIMD_SSE2_LANE_COUNT)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *) (lpWCharArr + ulEnd - WSTR_SIMD_SSE2_LANE_COUNT));
+        const unsigned mask = (unsigned) _mm_movemask_epi8(StaticSse2IsAsciiSpace(v));
+        if (WSTR_SIMD_SSE2_ALL_MASK != mask)
+        {
+            const unsigned notSpaceMask = WSTR_SIMD_SSE2_ALL_MASK & ~mask;
+            // Highest set bit
+            const unsigned lane = (31U - (unsigned) __builtin_clz(notSpaceMask)) / 2U;
+            return ulSize - (ulEnd - WSTR_SIMD_SSE2_LANE_COUNT + lane + 1U);
+        }
+    }
+    return (ulSize - ulEnd) + StaticScalarRSpanAsciiSpace(lpWCharArr, ulEnd);
+}
+
+__attribute__((target("sse2")))
+static size_t
+StaticSse2Mismatch(_In_ const wchar_t *lpLeftWCharArr,
+                   _In_ const wchar_t *lpRightWCharArr,
+                   _In_ const size_t   ulSize)
+{
+    size_t i = 0;
+    for (; i + WSTR_SIMD_SSE2_LANE_COUNT <= ulSize; i += WSTR_SIMD_SSE2_LANE_COUNT)
+    {
+        const __m128i vLeft  = _mm_loadu_si128((const __m128i *) (lpLeftWCharArr + i));
+        const __m128i vRight = _mm_loadu_si128((const __m128i *) (lpRightWCharArr + i));
+        const unsigned mask = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi16(vLeft, vRight));
+        if (WSTR_SIMD_SSE2_ALL_MASK != mask) {
+            return i + (__builtin_ctz(~mask) / 2U);
+        }
+    }
+    return i + StaticScalarMismatch(lpLeftWCharArr + i, lpRightWCharArr + i, ulSize - i);
+}
+
+static const struct WStrSimdKernels SSE2_KERNELS = {
+    .eLevel            = WSTR_SIMD_LEVEL_SSE2,
+    .fpFindWChar       = StaticSse2FindWChar,
+    .fpFindWCharArr    = StaticSse2FindWCharArr,
+    .fpSpanAsciiSpace  = StaticSse2SpanAsciiSpace,
+    .fpRSpanAsciiSpace = StaticSse2RSpanAsciiSpace,
+    .fpMismatch        = StaticSse2Mismatch,
+};
+
+#define WSTR_SIMD_AVX2_LANE_COUNT 16U
+#define WSTR_SIMD_AVX2_ALL_MASK   0xFFFFFFFFU
+
+__attribute__((target("avx2")))
+static inline __m256i
+StaticAvx2IsAsciiSpace(_In_ const __m256i v)
+{
+    // Same as StaticSse2IsAsciiSpace()
+    const __m256i offset   = _mm256_sub_epi16(v, _mm256_set1_epi16(L'\t'));
+    const __m256i bIsCtrl  = _mm256_cmpeq_epi16(_mm256_subs_epu16(offset, _mm256_set1_epi16(L'\r' - L'\t')), _mm256_setzero_si256());
+    const __m256i bIsSpace = _mm256_cmpeq_epi16(v, _mm256_set1_epi16(L' '));
+    return _mm256_or_si256(bIsCtrl, bIsSpace);
+}
+
+__attribute__((target("avx2")))
+static const wchar_t *
+StaticAvx2FindWChar(_In_ const wchar_t *lpWCharArr,
+                    _In_ const size_t   ulSize,
+                    _In_ const wchar_t  wch)
+{
+    const __m256i needle = _mm256_set1_epi16((short) wch);
+    size_t i = 0;
+    for (; i + WSTR_SIMD_AVX2_LANE_COUNT <= ulSize; i += WSTR_SIMD_AVX2_LANE_COUNT)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *) (lpWCharArr + i));
+        const unsigned mask = (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi16(v, needle));
+        if (0 != mask) {
+            return lpWCharArr + i + (__builtin_ctz(mask) / 2U);
+        }
+    }
+    // Intentional: Finish with SSE2, not scalar.  Why?  Up to 15 wchars remain.
+    return StaticSse2FindWChar(lpWCharArr + i, ulSize - i, wch);
+}
+
+__attribute__((target("avx2")))
+static const wchar_t *
+StaticAvx2FindWCharArr(_In_ const wchar_t *lpWCharArr,
+                       _In_ const size_t   ulSize,
+                       _In_ const wchar_t *lpNeedleWCharArr,
+                       _In_ const size_t   ulNeedleSize)
+{
+    const __m256i first = _mm256_set1_epi16((short) lpNeedleWCharArr[0]);
+    const __m256i last  = _mm256_set1_epi16((short) lpNeedleWCharArr[ulNeedleSize - 1U]);
+    const size_t ulLastOffset = ulNeedleSize - 1U;
+    size_t i = 0;
+    for (; i + ulLastOffset + WSTR_SIMD_AVX2_LANE_COUNT <= ulSize; i += WSTR_SIMD_AVX2_LANE_COUNT)
+    {
+        const __m256i vFirst = _mm256_loadu_si256((const __m256i *) (lpWCharArr + i));
+        const __m256i vLast  = _mm256_loadu_si256((const __m256i *) (lpWCharArr + i + ulLastOffset));
+        unsigned mask = (unsigned) _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi16(vFirst, first),
+                                                                         _mm256_cmpeq_epi16(vLast, last)));
+        while (0 != mask)
+        {
+            const unsigned bit = (unsigned) __builtin_ctz(mask);
+            const wchar_t *lpCandidate = lpWCharArr + i + (bit / 2U);
+            if (ulNeedleSize - 2U == StaticScalarMismatch(lpCandidate + 1U, lpNeedleWCharArr + 1U, ulNeedleSize - 2U)) {
+                return lpCandidate;
+            }
+            mask &= ~(3U << bit);
+        }
+    }
+    const wchar_t *lpResult = StaticSse2FindWCharArr(lpWCharArr + i, ulSize - i, lpNeedleWCharArr, ulNeedleSize);
+    return lpResult;
+}
+
+__attribute__((target("avx2")))
+static size_t
+StaticAvx2SpanAsciiSpace(_In_ const wchar_t *lpWCharArr,
+                         _In_ const size_t   ulSize)
+{
+    size_t i = 0;
+    for (; i + WSTR_SIMD_AVX2_LANE_COUNT <= ulSize; i += WSTR_SIMD_AVX2_LANE_COUNT)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *) (lpWCharArr + i));
+        const unsigned mask = (unsigned) _mm256_movemask_epi8(StaticAvx2IsAsciiSpace(v));
+        if (WSTR_SIMD_AVX2_ALL_MASK != mask) {
+            return i + (__builtin_ctz(~mask) / 2U);
+        }
+    }
+    return i + StaticSse2SpanAsciiSpace(lpWCharArr + i, ulSize - i);
+}
+
+__attribute__((target("avx2")))
+static size_t
+StaticAvx2RSpanAsciiSpace(_In_ const wchar_t *lpWCharArr,
+                          _In_ const size_t   ulSize)
+{
+    // Intentional: Exclusive
+    size_t ulEnd = ulSize;
+    for (; ulEnd >= WSTR_SIMD_AVX2_LANE_COUNT; ulEnd -= WSTR_SIMD_AVX2_LANE_COUNT)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *) (lpWCharArr + ulEnd - WSTR_SIMD_AVX2_LANE_COUNT));
+        const unsigned mask = (unsigned) _mm256_movemask_epi8(StaticAvx2IsAsciiSpace(v));
+        if (WSTR_SIMD_AVX2_ALL_MASK != mask)
+        {
+            const unsigned notSpaceMask = ~mask;
+            // Highest set bit
+            const unsigned lane = (31U - (unsigned) __builtin_clz(notSpaceMask)) / 2U;
+            return ulSize - (ulEnd - WSTR_SIMD_AVX2_LANE_COUNT + lane + 1U);
+        }
+    }
+    return (ulSize - ulEnd) + StaticSse2RSpanAsciiSpace(lpWCharArr, ulEnd);
+}
+
+__attribute__((target("avx2")))
+static size_t
+StaticAvx2Mismatch(_In_ const wchar_t *lpLeftWCharArr,
+                   _In_ const wchar_t *lpRightWCharArr,
+                   _In_ const size_t   ulSize)
+{
+    size_t i = 0;
+    for (; i + WSTR_SIMD_AVX2_LANE_COUNT <= ulSize; i += WSTR_SIMD_AVX2_LANE_COUNT)
+    {
+        const __m256i vLeft  = _mm256_loadu_si256((const __m256i *) (lpLeftWCharArr + i));
+        const __m256i vRight = _mm256_loadu_si256((const __m256i *) (lpRightWCharArr + i));
+        const unsigned mask = (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi16(vLeft, vRight));
+        if (WSTR_SIMD_AVX2_ALL_MASK != mask) {
+            return i + (__builtin_ctz(~mask) / 2U);
+        }
+    }
+    return i + StaticSse2Mismatch(lpLeftWCharArr + i, lpRightWCharArr + i, ulSize - i);
+}
+
+static const struct WStrSimdKernels AVX2_KERNELS = {
+    .eLevel            = WSTR_SIMD_LEVEL_AVX2,
+    .fpFindWChar       = StaticAvx2FindWChar,
+    .fpFindWCharArr    = StaticAvx2FindWCharArr,
+    .fpSpanAsciiSpace  = StaticAvx2SpanAsciiSpace,
+    .fpRSpanAsciiSpace = StaticAvx2RSpanAsciiSpace,
+    .fpMismatch        = StaticAvx2Mismatch,
+};
+
+#endif  // WSTR_SIMD_X86
+
+static enum EWStrSimdLevel
+StaticDetectMaxLevel()
+{
+#if WSTR_SIMD_X86
+    // Ref: https://en.wikipedia.org/wiki/CPUID
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (0 == __get_cpuid(1, &eax, &ebx, &ecx, &edx) || 0 == (edx & bit_SSE2)) {
+        return WSTR_SIMD_LEVEL_SCALAR;
+    }
+
+    // Important: CPU support for AVX is not enough.  The operating system must also save YMM registers.
+    // Ref: https://www.intel.com/content/www/us/en/developer/articles/technical/intel-sdm.html ("Detection of Intel AVX2")
+    if (0 == (ecx & bit_OSXSAVE) || 0 == (ecx & bit_AVX)) {
+        return WSTR_SIMD_LEVEL_SSE2;
+    }
+
+    unsigned xcr0 = 0, xcr0High = 0;
+    __asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0High) : "c" (0));
+    // Bit 1: XMM state, Bit 2: YMM state
+    if (0x6U != (xcr0 & 0x6U)) {
+        return WSTR_SIMD_LEVEL_SSE2;
+    }
+
+    if (0 == __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || 0 == (ebx & bit_AVX2)) {
+        return WSTR_SIMD_LEVEL_SSE2;
+    }
+    return WSTR_SIMD_LEVEL_AVX2;
+#else
+    return WSTR_SIMD_LEVEL_SCALAR;
+#endif
+}
+
+static const struct WStrSimdKernels *
+StaticGetKernelsForLevel(_In_ const enum EWStrSimdLevel eLevel)
+{
+    switch (eLevel)
+    {
+#if WSTR_SIMD_X86
+        case WSTR_SIMD_LEVEL_AVX2: return &AVX2_KERNELS;
+        case WSTR_SIMD_LEVEL_SSE2: return &SSE2_KERNELS;
+#endif
+        default: return &SCALAR_KERNELS;
+    }
+}
+
+// Intentional: Race to init is harmless: every thread writes the same value.
+static const struct WStrSimdKernels *lpCachedKernels = NULL;
+
+static const struct WStrSimdKernels *
+StaticGetKernels()
+{
+    if (NULL == lpCachedKernels)
+    {
+        lpCachedKernels = StaticGetKernelsForLevel(StaticDetectMaxLevel());
+    }
+    return lpCachedKernels;
+}
+
+enum EWStrSimdLevel
+WStrSimdGetMaxLevel()
+{
+    const enum EWStrSimdLevel eLevel = StaticDetectMaxLevel();
+    return eLevel;
+}
+
+enum EWStrSimdLevel
+WStrSimdGetLevel()
+{
+    const struct WStrSimdKernels *lpKernels = StaticGetKernels();
+    return lpKernels->eLevel;
+}
+
+void
+WStrSimdSetLevel(_In_ const enum EWStrSimdLevel eLevel)
+{
+    assert(eLevel >= WSTR_SIMD_LEVEL_SCALAR && eLevel <= WStrSimdGetMaxLevel());
+
+    lpCachedKernels = StaticGetKernelsForLevel(eLevel);
+}
+
+const wchar_t *
+WStrSimdFindWChar(_In_ const wchar_t *lpWCharArr,
+                  _In_ const size_t   ulSize,
+                  _In_ const wchar_t  wch)
+{
+    assert(NULL != lpWCharArr || 0 == ulSize);
+
+    const wchar_t *lpResult = StaticGetKernels()->fpFindWChar(lpWCharArr, ulSize, wch);
+    return lpResult;
+}
+
+const wchar_t *
+WStrSimdFindWCharArr(_In_ const wchar_t *lpWCharArr,
+                     _In_ const size_t   ulSize,
+                     _In_ const wchar_t *lpNeedleWCharArr,
+                     _In_ const size_t   ulNeedleSize)
+{
+    assert(NULL != lpWCharArr || 0 == ulSize);
+    assert(NULL != lpNeedleWCharArr);
+    assert(ulNeedleSize > 0);
+
+    if (ulNeedleSize > ulSize) {
+        return NULL;
+    }
+
+    const struct WStrSimdKernels *lpKernels = StaticGetKernels();
+    if (1 == ulNeedleSize)
+    {
+        const wchar_t *lpResult = lpKernels->fpFindWChar(lpWCharArr, ulSize, lpNeedleWCharArr[0]);
+        return lpResult;
+    }
+
+    const wchar_t *lpResult = lpKernels->fpFindWCharArr(lpWCharArr, ulSize, lpNeedleWCharArr, ulNeedleSize);
+    return lpResult;
+}
+
+// Intentional: iswspace() is true for all ASCII whitespace and false for all printable ASCII.  Thus, only call
+// iswspace() for other wchars, e.g., U+3000 IDEOGRAPHIC SPACE.
+static inline bool
+StaticIsSpaceSlow(_In_ const wchar_t wch)
+{
+    if (wch > L' ' && wch <= L'~') {
+        return false;
+    }
+    const bool b = (0 != iswspace(wch));
+    return b;
+}
+
+size_t
+WStrSimdSpanSpace(_In_ const wchar_t *lpWCharArr,
+                  _In_ const size_t   ulSize)
+{
+    assert(NULL != lpWCharArr || 0 == ulSize);
+
+    const struct WStrSimdKernels *lpKernels = StaticGetKernels();
+    size_t i = 0;
+    while (TRUE)
+    {
+        i += lpKernels->fpSpanAsciiSpace(lpWCharArr + i, ulSize - i);
+        if (ulSize == i || !StaticIsSpaceSlow(lpWCharArr[i])) {
+            return i;
+        }
+        ++i;
+    }
+}
+
+size_t
+WStrSimdRSpanSpace(_In_ const wchar_t *lpWCharArr,
+                   _In_ const size_t   ulSize)
+{
+    assert(NULL != lpWCharArr || 0 == ulSize);
+
+    const struct WStrSimdKernels *lpKernels = StaticGetKernels();
+    size_t ulCount = 0;
+    while (TRUE)
+    {
+        ulCount += lpKernels->fpRSpanAsciiSpace(lpWCharArr, ulSize - ulCount);
+        if (ulSize == ulCount || !StaticIsSpaceSlow(lpWCharArr[ulSize - 1U - ulCount])) {
+            return ulCount;
+        }
+        ++ulCount;
+    }
+}
+
+size_t
+WStrSimdMismatch(_In_ const wchar_t *lpLeftWCharArr,
+                 _In_ const wchar_t *lpRightWCharArr,
+                 _In_ const size_t   ulSize)
+{
+    assert((NULL != lpLeftWCharArr && NULL != lpRightWCharArr) || 0 == ulSize);
+
+    const size_t ulIndex = StaticGetKernels()->fpMismatch(lpLeftWCharArr, lpRightWCharArr, ulSize);
+    return ulIndex;
+}
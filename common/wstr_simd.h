@@ -0,0 +1,88 @@
+#ifndef H_COMMON_WSTR_SIMD
+#define H_COMMON_WSTR_SIMD
+
+#include "win32.h"
+#include <sal.h>     // required for _In_, etc.
+#include <stddef.h>  // required for size_t
+#include <wchar.h>   // required for wchar_t
+
+// Kernels for hot loops over wchar_t (16-bit code units on Windows).
+// At first call, CPUID selects the best level: AVX2, then SSE2, then scalar.
+
+enum EWStrSimdLevel
+{
+    WSTR_SIMD_LEVEL_SCALAR = 0,
+    WSTR_SIMD_LEVEL_SSE2   = 1,
+    WSTR_SIMD_LEVEL_AVX2   = 2,
+};
+
+/**
+ * @return best level supported by this CPU (and operating system, for AVX2)
+ */
+enum EWStrSimdLevel
+WStrSimdGetMaxLevel();
+
+enum EWStrSimdLevel
+WStrSimdGetLevel();
+
+/**
+ * Override level selected by CPUID, e.g., differential tests or benchmarks.
+ *
+ * @param eLevel
+ *        must be <= WStrSimdGetMaxLevel()
+ */
+void
+WStrSimdSetLevel(_In_ const enum EWStrSimdLevel eLevel);
+
+/**
+ * Same as wmemchr(), but vectorised.
+ *
+ * @return pointer to first matching wchar in lpWCharArr or NULL if not found
+ */
+const wchar_t *
+WStrSimdFindWChar(_In_ const wchar_t *lpWCharArr,
+                  _In_ const size_t   ulSize,
+                  _In_ const wchar_t  wch);
+
+/**
+ * Same as wcsstr(), but neither lpWCharArr nor lpNeedleWCharArr need to be terminated with '\0'.
+ *
+ * @param ulNeedleSize
+ *        must be > 0
+ *
+ * @return pointer to first match in lpWCharArr or NULL if not found
+ */
+const wchar_t *
+WStrSimdFindWCharArr(_In_ const wchar_t *lpWCharArr,
+                     _In_ const size_t   ulSize,
+                     _In_ const wchar_t *lpNeedleWCharArr,
+                     _In_ const size_t   ulNeedleSize);
+
+/**
+ * Result is exactly the same as iswspace() for each wchar.  ASCII is classified with SIMD; other wchars are passed
+ * to iswspace().
+ *
+ * @return number of leading whitespace wchars in [0, ulSize]
+ */
+size_t
+WStrSimdSpanSpace(_In_ const wchar_t *lpWCharArr,
+                  _In_ const size_t   ulSize);
+
+/**
+ * Same as WStrSimdSpanSpace(), but from the end.
+ *
+ * @return number of trailing whitespace wchars in [0, ulSize]
+ */
+size_t
+WStrSimdRSpanSpace(_In_ const wchar_t *lpWCharArr,
+                   _In_ const size_t   ulSize);
+
+/**
+ * @return index of first wchar that differs or ulSize if all are equal
+ */
+size_t
+WStrSimdMismatch(_In_ const wchar_t *lpLeftWCharArr,
+                 _In_ const wchar_t *lpRightWCharArr,
+                 _In_ const size_t   ulSize);
+
+#endif  // H_COMMON_WSTR_SIMD
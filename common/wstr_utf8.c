@@ -0,0 +1,394 @@
+#include "wstr_utf8.h"
+#include "wstr_simd.h"
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+#include <stdint.h>  // required for uint32_t, uint64_t
+#include <string.h>  // required for memcpy()
+
+// Intentional: Same condition as wstr_simd.c.  Why?  Kernels widen bytes to 16-bit lanes.
+#if (defined(__x86_64__) || defined(__i386__)) && (2 == __SIZEOF_WCHAR_T__)
+#define WSTR_UTF8_X86 1
+#include <immintrin.h>  // required for _mm_*()
+#else
+#define WSTR_UTF8_X86 0
+#endif
+
+#define WSTR_UTF8_SCALAR_BLOCK_SIZE 8U
+#define WSTR_UTF8_SSE2_BLOCK_SIZE   16U
+
+/**
+ * Copy leading ASCII bytes in whole blocks.
+ *
+ * @return number of bytes copied: zero or more whole blocks
+ */
+typedef size_t (*DecodeAsciiFunc)(_In_  const unsigned char *lpByteArr,
+                                  _In_  const size_t         ulByteSize,
+                                  _Out_ wchar_t             *lpDestWCharArr);
+
+/**
+ * Copy leading ASCII wchars in whole blocks.
+ *
+ * @return number of wchars copied: zero or more whole blocks
+ */
+typedef size_t (*EncodeAsciiFunc)(_In_  const wchar_t *lpWCharArr,
+                                  _In_  const size_t   ulSize,
+                                  _Out_ char          *lpDestCharArr);
+
+static size_t
+StaticScalarDecodeAscii(_In_  const unsigned char *lpByteArr,
+                        _In_  const size_t         ulByteSize,
+                        _Out_ wchar_t             *lpDestWCharArr)
+{
+    size_t i = 0;
+    for (; i + WSTR_UTF8_SCALAR_BLOCK_SIZE <= ulByteSize; i += WSTR_UTF8_SCALAR_BLOCK_SIZE)
+    {
+        uint64_t block = 0;
+        // Intentional: memcpy() for unaligned load.  Why?  Compiles to one mov; cast would be undefined behaviour.
+        memcpy(&block, lpByteArr + i, sizeof(block));
+        if (0 != (block & 0x8080808080808080ULL)) {
+            break;
+        }
+        for (size_t j = 0; j < WSTR_UTF8_SCALAR_BLOCK_SIZE; ++j)
+        {
+            lpDestWCharArr[i + j] = (wchar_t) lpByteArr[i + j];
+        }
+    }
+    return i;
+}
+
+static size_t
+StaticScalarEncodeAscii(_In_  const wchar_t *lpWCharArr,
+                        _In_  const size_t   ulSize,
+                        _Out_ char          *lpDestCharArr)
+{
+    size_t i = 0;
+    for (; i + WSTR_UTF8_SCALAR_BLOCK_SIZE <= ulSize; i += WSTR_UTF8_SCALAR_BLOCK_SIZE)
+    {
+        uint32_t ulOr = 0;
+        for (size_t j = 0; j < WSTR_UTF8_SCALAR_BLOCK_SIZE; ++j)
+        {
+            ulOr |= (uint32_t) lpWCharArr[i + j];
+        }
+        if (ulOr >= 0x80U) {
+            break;
+        }
+        for (size_t j = 0; j < WSTR_UTF8_SCALAR_BLOCK_SIZE; ++j)
+        {
+            lpDestCharArr[i + j] = (char) lpWCharArr[i + j];
+        }
+    }
+    return i;
+}
+
+#if WSTR_UTF8_X86
+
+__attribute__((target("sse2")))
+static size_t
+StaticSse2DecodeAscii(_In_  const unsigned char *lpByteArr,
+                      _In_  const size_t         ulByteSize,
+                      _Out_ wchar_t             *lpDestWCharArr)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + WSTR_UTF8_SSE2_BLOCK_SIZE <= ulByteSize; i += WSTR_UTF8_SSE2_BLOCK_SIZE)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *) (lpByteArr + i));
+        // High bit of any byte is set: Not ASCII
+        if (0 != _mm_movemask_epi8(v)) {
+            break;
+        }
+        // Widen: Interleave each byte with a zero byte
+        _mm_storeu_si128((__m128i *) (lpDestWCharArr + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *) (lpDestWCharArr + i + 8U), _mm_unpackhi_epi8(v, zero));
+    }
+    return i;
+}
+
+__attribute__((target("sse2")))
+static size_t
+StaticSse2EncodeAscii(_In_  const wchar_t *lpWCharArr,
+                      _In_  const size_t   ulSize,
+                      _Out_ char          *lpDestCharArr)
+{
+    const __m128i zero         = _mm_setzero_si128();
+    const __m128i notAsciiBits = _mm_set1_epi16((short) 0xFF80);
+    size_t i = 0;
+    for (; i + WSTR_UTF8_SSE2_BLOCK_SIZE <= ulSize; i += WSTR_UTF8_SSE2_BLOCK_SIZE)
+    {
+        const __m128i lo = _mm_loadu_si128((const __m128i *) (lpWCharArr + i));
+        const __m128i hi = _mm_loadu_si128((const __m128i *) (lpWCharArr + i + 8U));
+        const __m128i bits = _mm_and_si128(_mm_or_si128(lo, hi), notAsciiBits);
+        if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi16(bits, zero))) {
+            break;
+        }
+        // Narrow: All lanes are < 0x80, so unsigned saturation never changes a value.
+        _mm_storeu_si128((__m128i *) (lpDestCharArr + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+#endif  // WSTR_UTF8_X86
+
+static DecodeAsciiFunc
+StaticGetDecodeAsciiFunc()
+{
+#if WSTR_UTF8_X86
+    if (WStrSimdGetLevel() >= WSTR_SIMD_LEVEL_SSE2) {
+        return StaticSse2DecodeAscii;
+    }
+#endif
+    return StaticScalarDecodeAscii;
+}
+
+static EncodeAsciiFunc
+StaticGetEncodeAsciiFunc()
+{
+#if WSTR_UTF8_X86
+    if (WStrSimdGetLevel() >= WSTR_SIMD_LEVEL_SSE2) {
+        return StaticSse2EncodeAscii;
+    }
+#endif
+    return StaticScalarEncodeAscii;
+}
+
+static inline bool
+StaticIsContinuation(_In_ const unsigned char uch)
+{
+    // 10xxxxxx
+    const bool x = (0x80 == (uch & 0xC0));
+    return x;
+}
+
+/**
+ * Decode one multi-byte sequence.
+ *
+ * @param lpByteArr
+ *        first byte is not ASCII
+ *
+ * @return number of bytes in [2, 4], or zero if invalid
+ */
+static size_t
+StaticDecodeSequence(_In_  const unsigned char *lpByteArr,
+                     _In_  const size_t         ulByteSize,
+                     _Out_ uint32_t            *lpulCodePoint)
+{
+    const unsigned char uch = lpByteArr[0];
+    // Intentional: C0 and C1 are always overlong.  80-BF are continuation bytes without a lead byte.
+    if (uch < 0xC2) {
+        return 0;
+    }
+    else if (uch < 0xE0)
+    {
+        if (ulByteSize < 2U || false == StaticIsContinuation(lpByteArr[1])) {
+            return 0;
+        }
+        *lpulCodePoint = ((uch & 0x1FU) << 6) | (lpByteArr[1] & 0x3FU);
+        return 2U;
+    }
+    else if (uch < 0xF0)
+    {
+        if (ulByteSize < 3U) {
+            return 0;
+        }
+        // E0: A0-BF to reject overlong.  ED: 80-9F to reject surrogates D800-DFFF.
+        const unsigned char uchMin1 = (0xE0 == uch) ? 0xA0 : 0x80;
+        const unsigned char uchMax1 = (0xED == uch) ? 0x9F : 0xBF;
+        if (lpByteArr[1] < uchMin1 || lpByteArr[1] > uchMax1 || false == StaticIsContinuation(lpByteArr[2])) {
+            return 0;
+        }
+        *lpulCodePoint = ((uch & 0x0FU) << 12) | ((lpByteArr[1] & 0x3FU) << 6) | (lpByteArr[2] & 0x3FU);
+        return 3U;
+    }
+    else if (uch < 0xF5)
+    {
+        if (ulByteSize < 4U) {
+            return 0;
+        }
+        // F0: 90-BF to reject overlong.  F4: 80-8F to reject > U+10FFFF.
+        const unsigned char uchMin1 = (0xF0 == uch) ? 0x90 : 0x80;
+        const unsigned char uchMax1 = (0xF4 == uch) ? 0x8F : 0xBF;
+        if (lpByteArr[1] < uchMin1 || lpByteArr[1] > uchMax1
+            || false == StaticIsContinuation(lpByteArr[2])
+            || false == StaticIsContinuation(lpByteArr[3]))
+        {
+            return 0;
+        }
+        *lpulCodePoint = ((uch & 0x07U) << 18) | ((lpByteArr[1] & 0x3FU) << 12)
+                         | ((lpByteArr[2] & 0x3FU) << 6) | (lpByteArr[3] & 0x3FU);
+        return 4U;
+    }
+    // F5-FF: > U+10FFFF
+    return 0;
+}
+
+bool
+WStrUtf8Decode(_In_  const char   *lpCharArr,
+               _In_  const size_t  ulByteSize,
+               _Out_ wchar_t      *lpDestWCharArr,
+               _Out_ size_t       *lpulDestSize,
+               _Out_ size_t       *lpulInvalidByteOffset)
+{
+    assert(NULL != lpCharArr || 0 == ulByteSize);
+    assert(NULL != lpDestWCharArr || 0 == ulByteSize);
+    assert(NULL != lpulDestSize);
+    assert(NULL != lpulInvalidByteOffset);
+
+    const DecodeAsciiFunc fpDecodeAscii = StaticGetDecodeAsciiFunc();
+    const unsigned char *lpByteArr = (const unsigned char *) lpCharArr;
+    size_t i = 0;
+    size_t ulDestSize = 0;
+
+    while (i < ulByteSize)
+    {
+        const unsigned char uch = lpByteArr[i];
+        if (uch < 0x80)
+        {
+            // Intentional: Try fast path only at ASCII.  Why?  Most text is mostly ASCII, e.g., config files.
+            const size_t ulAsciiSize = fpDecodeAscii(lpByteArr + i, ulByteSize - i, lpDestWCharArr + ulDestSize);
+            if (ulAsciiSize > 0)
+            {
+                i += ulAsciiSize;
+                ulDestSize += ulAsciiSize;
+            }
+            else
+            {
+                lpDestWCharArr[ulDestSize++] = (wchar_t) uch;
+                ++i;
+            }
+            continue;
+        }
+
+        uint32_t ulCodePoint = 0;
+        const size_t ulSequenceSize = StaticDecodeSequence(lpByteArr + i, ulByteSize - i, &ulCodePoint);
+        if (0 == ulSequenceSize)
+        {
+            *lpulDestSize          = ulDestSize;
+            *lpulInvalidByteOffset = i;
+            return false;
+        }
+        i += ulSequenceSize;
+
+#if 2 == __SIZEOF_WCHAR_T__
+        if (ulCodePoint >= 0x10000U)
+        {
+            // Ref: https://en.wikipedia.org/wiki/UTF-16#Code_points_from_U+010000_to_U+10FFFF
+            const uint32_t ulOffset = ulCodePoint - 0x10000U;
+            lpDestWCharArr[ulDestSize++] = (wchar_t) (0xD800U + (ulOffset >> 10));
+            lpDestWCharArr[ulDestSize++] = (wchar_t) (0xDC00U + (ulOffset & 0x3FFU));
+            continue;
+        }
+#endif
+        lpDestWCharArr[ulDestSize++] = (wchar_t) ulCodePoint;
+    }
+
+    assert(ulDestSize <= ulByteSize);
+    *lpulDestSize = ulDestSize;
+    return true;
+}
+
+/**
+ * Read one code point.
+ *
+ * @param lpWCharArr
+ *        first wchar is not ASCII
+ *
+ * @return number of wchars in [1, 2], or zero if unpaired surrogate (or > U+10FFFF if wchar_t is 32-bit)
+ */
+static size_t
+StaticReadCodePoint(_In_  const wchar_t *lpWCharArr,
+                    _In_  const size_t   ulSize,
+                    _Out_ uint32_t      *lpulCodePoint)
+{
+    const uint32_t ulCodePoint = (uint32_t) lpWCharArr[0];
+    if (ulCodePoint >= 0xD800U && ulCodePoint <= 0xDFFFU)
+    {
+#if 2 == __SIZEOF_WCHAR_T__
+        // High surrogate must be followed by low surrogate.
+        const uint32_t ulLow = (ulSize >= 2U) ? (uint32_t) lpWCharArr[1] : 0U;
+        if (ulCodePoint > 0xDBFFU || ulLow < 0xDC00U || ulLow > 0xDFFFU) {
+            return 0;
+        }
+        *lpulCodePoint = 0x10000U + ((ulCodePoint - 0xD800U) << 10) + (ulLow - 0xDC00U);
+        return 2U;
+#else
+        (void) ulSize;
+        return 0;
+#endif
+    }
+    else if (ulCodePoint > 0x10FFFFU) {
+        return 0;
+    }
+    *lpulCodePoint = ulCodePoint;
+    return 1U;
+}
+
+bool
+WStrUtf8Encode(_In_  const wchar_t *lpWCharArr,
+               _In_  const size_t   ulSize,
+               _Out_ char          *lpDestCharArr,
+               _Out_ size_t        *lpulDestByteSize,
+               _Out_ size_t        *lpulInvalidOffset)
+{
+    assert(NULL != lpWCharArr || 0 == ulSize);
+    assert(NULL != lpDestCharArr || 0 == ulSize);
+    assert(NULL != lpulDestByteSize);
+    assert(NULL != lpulInvalidOffset);
+
+    const EncodeAsciiFunc fpEncodeAscii = StaticGetEncodeAsciiFunc();
+    unsigned char *lpDestByteArr = (unsigned char *) lpDestCharArr;
+    size_t i = 0;
+    size_t ulDestByteSize = 0;
+
+    while (i < ulSize)
+    {
+        if ((uint32_t) lpWCharArr[i] < 0x80U)
+        {
+            const size_t ulAsciiSize = fpEncodeAscii(lpWCharArr + i, ulSize - i, lpDestCharArr + ulDestByteSize);
+            if (ulAsciiSize > 0)
+            {
+                i += ulAsciiSize;
+                ulDestByteSize += ulAsciiSize;
+            }
+            else
+            {
+                lpDestByteArr[ulDestByteSize++] = (unsigned char) lpWCharArr[i];
+                ++i;
+            }
+            continue;
+        }
+
+        uint32_t ulCodePoint = 0;
+        const size_t ulReadSize = StaticReadCodePoint(lpWCharArr + i, ulSize - i, &ulCodePoint);
+        if (0 == ulReadSize)
+        {
+            *lpulDestByteSize  = ulDestByteSize;
+            *lpulInvalidOffset = i;
+            return false;
+        }
+        i += ulReadSize;
+
+        // Ref: https://en.wikipedia.org/wiki/UTF-8#Encoding
+        if (ulCodePoint < 0x800U)
+        {
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0xC0U | (ulCodePoint >> 6));
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0x80U | (ulCodePoint & 0x3FU));
+        }
+        else if (ulCodePoint < 0x10000U)
+        {
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0xE0U | (ulCodePoint >> 12));
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0x80U | ((ulCodePoint >> 6) & 0x3FU));
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0x80U | (ulCodePoint & 0x3FU));
+        }
+        else
+        {
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0xF0U | (ulCodePoint >> 18));
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0x80U | ((ulCodePoint >> 12) & 0x3FU));
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0x80U | ((ulCodePoint >> 6) & 0x3FU));
+            lpDestByteArr[ulDestByteSize++] = (unsigned char) (0x80U | (ulCodePoint & 0x3FU));
+        }
+    }
+
+    assert(ulDestByteSize <= WSTR_UTF8_MAX_BYTES_PER_WCHAR * ulSize);
+    *lpulDestByteSize = ulDestByteSize;
+    return true;
+}
@@ -0,0 +1,74 @@
+#ifndef H_COMMON_WSTR_UTF8
+#define H_COMMON_WSTR_UTF8
+
+#include "win32.h"
+#include <sal.h>     // required for _In_, etc.
+#include <stddef.h>  // required for size_t
+#include <wchar.h>   // required for wchar_t
+
+// Validating UTF-8 <-> UTF-16 transcoder.  One pass: Validate and convert together.  No sizing pass.
+// Runs of ASCII are copied with SSE2 if WStrSimdGetLevel() allows it, else 8 bytes at a time.
+// Invalid input is rejected exactly like MB_ERR_INVALID_CHARS and WC_ERR_INVALID_CHARS: overlong forms,
+// surrogates encoded in UTF-8, code points > U+10FFFF, truncated sequences, and unpaired UTF-16 surrogates.
+// Ref: https://www.unicode.org/versions/latest/ch03.pdf ("Table 3-7. Well-Formed UTF-8 Byte Sequences")
+
+// Intentional: One UTF-16 surrogate pair is 4 bytes of UTF-8, so 3 bytes per wchar is enough.
+// If wchar_t is 32-bit, e.g., Linux, then one wchar may be 4 bytes of UTF-8.
+#define WSTR_UTF8_MAX_BYTES_PER_WCHAR ((2 == sizeof(wchar_t)) ? 3U : 4U)
+
+/**
+ * Decode UTF-8 to UTF-16.  Same result as MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, ...).
+ *
+ * @param lpCharArr
+ *        @Nullable if (0 == ulByteSize)
+ *        need not be terminated with '\0'
+ *        Important: A UTF-8 BOM (byte order mark) is *not* skipped.  See WStrFileGetBOMSize().
+ *
+ * @param lpDestWCharArr
+ *        must have capacity for at least ulByteSize wchars: One byte of UTF-8 is never more than one wchar.
+ *        Result is *not* terminated with '\0'.
+ *
+ * @param lpulDestSize
+ *        on true return, number of wchars written to lpDestWCharArr
+ *        on false return, number of wchars decoded before first invalid sequence
+ *
+ * @param lpulInvalidByteOffset
+ *        on false return, byte offset of first invalid sequence in lpCharArr
+ *
+ * @return true if lpCharArr is valid UTF-8
+ */
+bool
+WStrUtf8Decode(_In_  const char   *lpCharArr,
+               _In_  const size_t  ulByteSize,
+               _Out_ wchar_t      *lpDestWCharArr,
+               _Out_ size_t       *lpulDestSize,
+               _Out_ size_t       *lpulInvalidByteOffset);
+
+/**
+ * Encode UTF-16 to UTF-8.  Same result as WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, ...).
+ *
+ * @param lpWCharArr
+ *        @Nullable if (0 == ulSize)
+ *        need not be terminated with '\0'
+ *
+ * @param lpDestCharArr
+ *        must have capacity for at least (WSTR_UTF8_MAX_BYTES_PER_WCHAR * ulSize) bytes
+ *        Result is *not* terminated with '\0'.
+ *
+ * @param lpulDestByteSize
+ *        on true return, number of bytes written to lpDestCharArr
+ *        on false return, number of bytes encoded before first unpaired surrogate
+ *
+ * @param lpulInvalidOffset
+ *        on false return, offset of first unpaired surrogate in lpWCharArr
+ *
+ * @return true if lpWCharArr is valid UTF-16: no unpaired surrogates
+ */
+bool
+WStrUtf8Encode(_In_  const wchar_t *lpWCharArr,
+               _In_  const size_t   ulSize,
+               _Out_ char          *lpDestCharArr,
+               _Out_ size_t        *lpulDestByteSize,
+               _Out_ size_t        *lpulInvalidOffset);
+
+#endif  // H_COMMON_WSTR_UTF8
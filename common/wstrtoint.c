@@ -6,12 +6,16 @@
 #include <errno.h>
 #include <stdarg.h>    // required for va_list, etc.
 
-BOOL
-WStrTryParseToUInt8(_In_    const struct WStr *lpWStr,
-                    _In_    const int          base,
-                    _Out_   uint8_t           *lpUInt8,
-                    _Inout_ FILE              *fp,
-                    _In_    const wchar_t     *lpszMsgFmt, ...)
+static BOOL
+StaticWStrTryParseToUInt8V(_In_    const struct WStr *lpWStr,
+                           _In_    const int          base,
+                           _Out_   uint8_t           *lpUInt8,
+                           _Inout_ FILE              *fp,
+                           // Intentional: Unused when NDEBUG is defined.  See: DEBUG_LOGWFV()
+                           __attribute__((unused))
+                           _In_    const wchar_t     *lpszMsgFmt,
+                           __attribute__((unused))
+                           _In_    va_list            ap)
 {
     WStrAssertValid(lpWStr);
     assert(NULL != lpUInt8);
@@ -24,53 +28,32 @@ WStrTryParseToUInt8(_In_    const struct WStr *lpWStr,
     const intmax_t lResult = wcstoimax(lpWStr->lpWCharArr, &endptr, base);
     if (ERANGE == errno)
     {
-        // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
-        va_list ap;
-        va_start(ap, lpszMsgFmt);
-
         DEBUG_LOGWFV(fp, lpszMsgFmt, ap);
 
-        va_end(ap);
-
         fprintf(fp, ": Value is out of range (too large or too small)\r\n");
         return FALSE;
     }
 
     if (endptr != lpWStr->lpWCharArr + lpWStr->ulSize)
     {
-        va_list ap;
-        va_start(ap, lpszMsgFmt);
-
         DEBUG_LOGWFV(fp, lpszMsgFmt, ap);
 
-        va_end(ap);
-
         fprintf(fp, ": Failed to parse all chars -- one or more trailing non-digit chars: [%ls]\r\n", endptr);
         return FALSE;
     }
 
     if (lResult < 0)
     {
-        va_list ap;
-        va_start(ap, lpszMsgFmt);
-
         DEBUG_LOGWFV(fp, lpszMsgFmt, ap);
 
-        va_end(ap);
-
         fprintf(fp, ": Value is negative: %jd\r\n", lResult);
         return FALSE;
     }
 
     if (lResult > UINT8_MAX)
     {
-        va_list ap;
-        va_start(ap, lpszMsgFmt);
-
         DEBUG_LOGWFV(fp, lpszMsgFmt, ap);
 
-        va_end(ap);
-
         fprintf(fp, ": Value > UINT8_MAX: %jd > %hhu\r\n", lResult, UINT8_MAX);
         return FALSE;
     }
@@ -79,3 +62,41 @@ WStrTryParseToUInt8(_In_    const struct WStr *lpWStr,
     return TRUE;
 }
 
+BOOL
+WStrTryParseToUInt8(_In_    const struct WStr *lpWStr,
+                    _In_    const int          base,
+                    _Out_   uint8_t           *lpUInt8,
+                    _Inout_ FILE              *fp,
+                    _In_    const wchar_t     *lpszMsgFmt, ...)
+{
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
+    va_list ap;
+    va_start(ap, lpszMsgFmt);
+    const BOOL b = StaticWStrTryParseToUInt8V(lpWStr, base, lpUInt8, fp, lpszMsgFmt, ap);
+    va_end(ap);
+    return b;
+}
+
+BOOL
+WStrViewTryParseToUInt8(_In_    const struct WStrView *lpWStrView,
+                        _In_    const int              base,
+                        _Out_   uint8_t               *lpUInt8,
+                        _Inout_ FILE                  *fp,
+                        _In_    const wchar_t         *lpszMsgFmt, ...)
+{
+    WStrViewAssertValid(lpWStrView);
+
+    // Intentional: wcstoimax() requires a trailing '\0' char, but a view may not have one.
+    // Numbers are short, so WStr small-string optimisation avoids heap alloc.
+    struct WStr wstr = {0};
+    WStrCopyWStrView(&wstr, lpWStrView);
+
+    // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
+    va_list ap;
+    va_start(ap, lpszMsgFmt);
+    const BOOL b = StaticWStrTryParseToUInt8V(&wstr, base, lpUInt8, fp, lpszMsgFmt, ap);
+    va_end(ap);
+
+    WStrFree(&wstr);
+    return b;
+}
@@ -14,5 +14,15 @@ WStrTryParseToUInt8(_In_    const struct WStr *lpWStr,
                     _Inout_ FILE              *fp,
                     _In_    const wchar_t     *lpszMsgFmt, ...);
 
+/**
+ * Same as WStrTryParseToUInt8(), but for a view, e.g., token from WStrSplitView().
+ */
+BOOL
+WStrViewTryParseToUInt8(_In_    const struct WStrView *lpWStrView,
+                        _In_    const int              base,
+                        _Out_   uint8_t               *lpUInt8,
+                        _Inout_ FILE                  *fp,
+                        _In_    const wchar_t         *lpszMsgFmt, ...);
+
 #endif  // H_COMMON_STRTOINT
 
@@ -0,0 +1,165 @@
+#include "xarena.h"
+#include "xmalloc.h"
+#include "win32_last_error.h"
+#include <assert.h>  // required for assert
+#include <stdlib.h>  // required for assert on MinGW
+#include <string.h>  // required for memset()
+#include <stdint.h>  // required for SIZE_MAX
+
+void
+XArenaAssertValid(_In_ const struct XArena *lpArena)
+{
+    assert(NULL != lpArena);
+    // Intentional: If ulChunkByteSize is more that *half* of SIZE_MAX, there is probably an unsigned wrap bug.
+    assert(lpArena->ulChunkByteSize <= SIZE_MAX / 2U);
+    if (NULL == lpArena->lpFirstChunk)
+    {
+        assert(NULL == lpArena->lpCurrentChunk);
+    }
+    if (NULL != lpArena->lpCurrentChunk)
+    {
+        assert(lpArena->lpCurrentChunk->ulUsedByteSize <= lpArena->lpCurrentChunk->ulByteSize);
+    }
+}
+
+/**
+ * @return ulByteSize rounded up to next multiple of XARENA_ALIGN.  Zero bytes is one unit: Each block is distinct.
+ */
+static size_t
+StaticAlign(_In_ const size_t ulByteSize)
+{
+    if (ulByteSize > SIZE_MAX / 2U)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                     // _In_ FILE          *lpStream
+                                    L"XArena: Block is too large: %zu bytes",  // _In_ const wchar_t *lpMessageFormat
+                                    ulByteSize);                               // ...
+    }
+    const size_t ulAlign = XARENA_ALIGN;
+    const size_t x = (0 == ulByteSize) ? ulAlign : ((ulByteSize + ulAlign - 1U) / ulAlign) * ulAlign;
+    return x;
+}
+
+/**
+ * Make lpArena->lpCurrentChunk the next chunk with at least ulAlignedByteSize free bytes.
+ * Reuse next chunk if large enough.  Else, insert a new chunk after current chunk.
+ */
+static void
+StaticNextChunk(_Inout_ struct XArena *lpArena,
+                _In_    const size_t   ulAlignedByteSize)
+{
+    // @Nullable
+    struct XArenaChunk *lpNextChunk =
+        (NULL == lpArena->lpCurrentChunk) ? lpArena->lpFirstChunk : lpArena->lpCurrentChunk->lpNextChunk;
+
+    // Intentional: Only try one chunk.  Why?  Usually all chunks are the same size.  Oversize chunk is rare.
+    if (NULL == lpNextChunk || lpNextChunk->ulByteSize < ulAlignedByteSize)
+    {
+        const size_t ulChunkByteSize = (0 == lpArena->ulChunkByteSize) ? XARENA_DEFAULT_CHUNK_BYTE_SIZE : lpArena->ulChunkByteSize;
+        const size_t ulByteSize = (ulAlignedByteSize > ulChunkByteSize) ? ulAlignedByteSize : ulChunkByteSize;
+
+        // Intentional: Not zeroed.  Why?  XArenaCalloc() zeroes each block.
+        struct XArenaChunk *lpNewChunk = xmalloc(sizeof(struct XArenaChunk) + ulByteSize);
+        lpNewChunk->lpNextChunk = lpNextChunk;
+        lpNewChunk->ulByteSize  = ulByteSize;
+
+        if (NULL == lpArena->lpCurrentChunk) {
+            lpArena->lpFirstChunk = lpNewChunk;
+        }
+        else {
+            lpArena->lpCurrentChunk->lpNextChunk = lpNewChunk;
+        }
+        lpNextChunk = lpNewChunk;
+    }
+
+    // Intentional: Reset here, not in XArenaResetToMark().  Why?  Reset is O(1), regardless of number of chunks.
+    lpNextChunk->ulUsedByteSize = 0;
+    lpArena->lpCurrentChunk = lpNextChunk;
+}
+
+void *
+XArenaMalloc(_Inout_ struct XArena *lpArena,
+             _In_    const size_t   ulByteSize)
+{
+    XArenaAssertValid(lpArena);
+
+    const size_t ulAlignedByteSize = StaticAlign(ulByteSize);
+
+    struct XArenaChunk *lpChunk = lpArena->lpCurrentChunk;
+    if (NULL == lpChunk || lpChunk->ulByteSize - lpChunk->ulUsedByteSize < ulAlignedByteSize)
+    {
+        // Intentional: Remaining bytes in current chunk are unused until reset.  Why?  Bump allocator is simple.
+        StaticNextChunk(lpArena, ulAlignedByteSize);
+        lpChunk = lpArena->lpCurrentChunk;
+    }
+
+    void *x = lpChunk->lpByteArr + lpChunk->ulUsedByteSize;
+    lpChunk->ulUsedByteSize += ulAlignedByteSize;
+    return x;
+}
+
+void *
+XArenaCalloc(_Inout_ struct XArena *lpArena,
+             _In_    const size_t   ulNumItem,
+             _In_    const size_t   ulSizeOfEachItem)
+{
+    if (0 != ulSizeOfEachItem && ulNumItem > SIZE_MAX / ulSizeOfEachItem)
+    {
+        Win32LastErrorFPrintFWAbort(stderr,                                                         // _In_ FILE          *lpStream
+                                    L"XArenaCalloc(ulNumItem:%zu, ulSizeOfEachItem:%zu): Overflow",  // _In_ const wchar_t *lpMessageFormat
+                                    ulNumItem, ulSizeOfEachItem);                                  // ...
+    }
+    const size_t ulByteSize = ulNumItem * ulSizeOfEachItem;
+    void *x = XArenaMalloc(lpArena, ulByteSize);
+    memset(x, 0, ulByteSize);
+    return x;
+}
+
+void
+XArenaGetMark(_In_  const struct XArena *lpArena,
+              _Out_ struct XArenaMark   *lpMark)
+{
+    XArenaAssertValid(lpArena);
+    assert(NULL != lpMark);
+
+    lpMark->lpChunk        = lpArena->lpCurrentChunk;
+    lpMark->ulUsedByteSize = (NULL == lpArena->lpCurrentChunk) ? 0 : lpArena->lpCurrentChunk->ulUsedByteSize;
+}
+
+void
+XArenaResetToMark(_Inout_ struct XArena           *lpArena,
+                  _In_    const struct XArenaMark *lpMark)
+{
+    XArenaAssertValid(lpArena);
+    assert(NULL != lpMark);
+
+    lpArena->lpCurrentChunk = lpMark->lpChunk;
+    if (NULL != lpMark->lpChunk)
+    {
+        // Important: Mark is older than current position.
+        assert(lpMark->ulUsedByteSize <= lpMark->lpChunk->ulUsedByteSize);
+        lpMark->lpChunk->ulUsedByteSize = lpMark->ulUsedByteSize;
+    }
+}
+
+void
+XArenaReset(_Inout_ struct XArena *lpArena)
+{
+    const struct XArenaMark emptyMark = {0};
+    XArenaResetToMark(lpArena, &emptyMark);
+}
+
+void
+XArenaFree(_Inout_ struct XArena *lpArena)
+{
+    XArenaAssertValid(lpArena);
+
+    struct XArenaChunk *lpChunk = lpArena->lpFirstChunk;
+    while (NULL != lpChunk)
+    {
+        struct XArenaChunk *lpNextChunk = lpChunk->lpNextChunk;
+        xfree((void **) &lpChunk);
+        lpChunk = lpNextChunk;
+    }
+    lpArena->lpFirstChunk   = NULL;
+    lpArena->lpCurrentChunk = NULL;
+}
@@ -0,0 +1,93 @@
+#ifndef H_COMMON_XARENA
+#define H_COMMON_XARENA
+
+#include "win32.h"
+#include <stddef.h>  // required for size_t, max_align_t
+
+// Bump allocator for parse-and-discard work: Many short-lived blocks, all released together.
+// Like xcalloc(), allocation never fails: abort() is called.  Not thread-safe.
+// Ex:
+// struct XArena arena = {0};
+// struct XArenaMark mark = {0};
+// XArenaGetMark(&arena, &mark);
+// ... XArenaCalloc(&arena, ...) ...
+// XArenaResetToMark(&arena, &mark);  // Release all blocks since mark.  Chunks are kept for reuse.
+// XArenaFree(&arena);                // Release all chunks.
+
+// Intentional: Same as xcalloc().  Why?  Any struct may be allocated from an arena.
+#define XARENA_ALIGN                   (_Alignof(max_align_t))
+#define XARENA_DEFAULT_CHUNK_BYTE_SIZE (64U * 1024U)
+
+struct XArenaChunk
+{
+    // @Nullable
+    struct XArenaChunk *lpNextChunk;
+    // Number of bytes in lpByteArr
+    size_t              ulByteSize;
+    // Always multiple of XARENA_ALIGN
+    size_t              ulUsedByteSize;
+    _Alignas(max_align_t) unsigned char lpByteArr[];
+};
+
+struct XArena
+{
+    // @Nullable: NULL until first allocation
+    struct XArenaChunk *lpFirstChunk;
+    // @Nullable: Chunk for next allocation.  Chunks after it are kept for reuse after reset.
+    struct XArenaChunk *lpCurrentChunk;
+    // Zero for XARENA_DEFAULT_CHUNK_BYTE_SIZE.  Larger blocks get their own chunk.
+    size_t              ulChunkByteSize;
+};
+
+// Position in an arena.  All blocks allocated after a mark are released together by XArenaResetToMark().
+struct XArenaMark
+{
+    // @Nullable: NULL if arena was empty or reset
+    struct XArenaChunk *lpChunk;
+    size_t              ulUsedByteSize;
+};
+
+void
+XArenaAssertValid(_In_ const struct XArena *lpArena);
+
+/**
+ * Allocate and zero all bytes, like xcalloc().  Never freed one-by-one: Use XArenaResetToMark() or XArenaFree().
+ */
+void *
+XArenaCalloc(_Inout_ struct XArena *lpArena,
+             _In_    const size_t   ulNumItem,
+             _In_    const size_t   ulSizeOfEachItem);
+
+/**
+ * Like XArenaCalloc(), but bytes are *not* zeroed, like xmalloc().
+ */
+void *
+XArenaMalloc(_Inout_ struct XArena *lpArena,
+             _In_    const size_t   ulByteSize);
+
+void
+XArenaGetMark(_In_  const struct XArena *lpArena,
+              _Out_ struct XArenaMark   *lpMark);
+
+/**
+ * Release all blocks allocated after lpMark.  Chunks are not freed: Next allocations reuse them.
+ * <p>
+ * Important: lpMark must be from lpArena, and not older than the most recent reset.
+ */
+void
+XArenaResetToMark(_Inout_ struct XArena           *lpArena,
+                  _In_    const struct XArenaMark *lpMark);
+
+/**
+ * Release all blocks.  Chunks are not freed: Next allocations reuse them.
+ */
+void
+XArenaReset(_Inout_ struct XArena *lpArena);
+
+/**
+ * Free all chunks.  Afterwards, arena is empty and may be used again.  ulChunkByteSize is unchanged.
+ */
+void
+XArenaFree(_Inout_ struct XArena *lpArena);
+
+#endif  // H_COMMON_XARENA
@@ -3,13 +3,47 @@
 
 #include "win32.h"
 #include <stddef.h>  // required for size_t
+#include <stdio.h>   // required for FILE
 
 // These function names are inspired by Git.
 
+enum EXMallocHeap
+{
+    // Default.  GetProcessHeap(): Serialized, so any thread may allocate and free.
+    XMALLOC_HEAP_PROCESS              = 0,
+    // HeapCreate(HEAP_NO_SERIALIZE): No lock per call.
+    // Important: Only for single-threaded apps: Every call must be from the thread that called XMallocInit().
+    // Windows does not enable the low-fragmentation heap for a HEAP_NO_SERIALIZE heap: See: bench/xmalloc_bench.c
+    XMALLOC_HEAP_PRIVATE_NO_SERIALIZE = 1,
+};
+
+/**
+ * Select heap for all later calls to xcalloc(), xmalloc(), xrealloc(), and xfree().  Heap handle is cached.
+ * Call once at startup, before first allocation.  If never called, XMALLOC_HEAP_PROCESS is used.
+ * <p>
+ * May be called again, e.g., by a benchmark, but only after every block from previous heap is freed.
+ * If previous heap is private, it is destroyed.
+ */
+void
+XMallocInit(_In_ const enum EXMallocHeap eHeap);
+
+/**
+ * Allocate and zero all bytes.
+ */
 void *
 xcalloc(_In_ const size_t ulNumItem,
         _In_ const size_t ulSizeOfEachItem);
 
+/**
+ * Like xcalloc(), but bytes are *not* zeroed.  Only use if all bytes are written before they are read,
+ * e.g., I/O buffers.
+ */
+void *
+xmalloc(_In_ const size_t ulByteSize);
+
+/**
+ * If larger, new bytes are zeroed.
+ */
 void
 xrealloc(_Inout_ void         **lppData,
          _In_    const size_t   ulNewDataSize);
@@ -17,5 +51,87 @@ xrealloc(_Inout_ void         **lppData,
 void
 xfree(_Inout_ void **lppData);
 
-#endif  // H_COMMON_XMALLOC
+// Opt-in allocation instrumentation: Build all objects with -DXMALLOC_STATS.  Ex: XMALLOC_STATS=1 ./build.bash --clean
+// Each call to xcalloc(), xmalloc(), xrealloc(), and xfree() is counted by call site (__FILE__ and __LINE__).
+// Live bytes, peak bytes, and a histogram of allocation sizes are tracked.  Report is printed to stderr at exit.
+// If not defined, these macros compile to nothing, and xcalloc(), etc. are direct calls, as before.
+#ifdef XMALLOC_STATS
+    // Power of two buckets: [0] is 0-1 bytes, [1] is 2-3 bytes, [2] is 4-7 bytes, ... Final bucket is everything larger.
+    #define XMALLOC_STATS_HISTOGRAM_BUCKET_COUNT 32U
+
+    struct XMallocStats
+    {
+        size_t ulCallocCount;
+        size_t ulMallocCount;
+        size_t ulReallocCount;
+        // Excluding xfree() of NULL
+        size_t ulFreeCount;
+        // Sum of all bytes from xcalloc(), xmalloc(), and xrealloc()
+        size_t ulTotalByteSize;
+        // Bytes not yet freed.  Sizes are from HeapSize().
+        size_t ulLiveByteSize;
+        // Max of ulLiveByteSize
+        size_t ulPeakByteSize;
+        // Count of xcalloc(), xmalloc(), and xrealloc() by new size.  Index i is [2^i, 2^(i+1)), but index 0 also counts
+        // 0-byte requests, and last index has no upper bound.
+        size_t ulHistogramArr[XMALLOC_STATS_HISTOGRAM_BUCKET_COUNT];
+    };
+
+    void *
+    XMallocStatsCalloc(_In_ const size_t  ulNumItem,
+                       _In_ const size_t  ulSizeOfEachItem,
+                       _In_ const char   *lpszFile,
+                       _In_ const int     iLine);
+
+    void *
+    XMallocStatsMalloc(_In_ const size_t  ulByteSize,
+                       _In_ const char   *lpszFile,
+                       _In_ const int     iLine);
+
+    void
+    XMallocStatsRealloc(_Inout_ void         **lppData,
+                        _In_    const size_t   ulNewDataSize,
+                        _In_    const char    *lpszFile,
+                        _In_    const int      iLine);
 
+    void
+    XMallocStatsFree(_Inout_ void       **lppData,
+                     _In_    const char  *lpszFile,
+                     _In_    const int    iLine);
+
+    /**
+     * Copy current totals.  Thread-safe.
+     */
+    void
+    XMallocStatsGet(_Out_ struct XMallocStats *lpStats);
+
+    /**
+     * Print totals, histogram, and each call site (most calls first).  Thread-safe.
+     *
+     * @param lpszLabel
+     *        Ex: "after ConfigParseFile()"
+     */
+    void
+    XMallocStatsFPrint(_Inout_ FILE       *lpStream,
+                       _In_    const char *lpszLabel);
+
+    #define xcalloc(/* const size_t */ ulNumItem, /* const size_t */ ulSizeOfEachItem) \
+        XMallocStatsCalloc((ulNumItem), (ulSizeOfEachItem), __FILE__, __LINE__)
+
+    #define xmalloc(/* const size_t */ ulByteSize) \
+        XMallocStatsMalloc((ulByteSize), __FILE__, __LINE__)
+
+    #define xrealloc(/* void ** */ lppData, /* const size_t */ ulNewDataSize) \
+        XMallocStatsRealloc((lppData), (ulNewDataSize), __FILE__, __LINE__)
+
+    #define xfree(/* void ** */ lppData) \
+        XMallocStatsFree((lppData), __FILE__, __LINE__)
+
+    #define XMALLOC_STATS_FPRINT(/* FILE * */ lpStream, /* const char * */ lpszLabel) \
+        XMallocStatsFPrint((lpStream), (lpszLabel))
+#else
+    #define XMALLOC_STATS_FPRINT(/* FILE * */ lpStream, /* const char * */ lpszLabel) \
+        ((void) 0)
+#endif  // XMALLOC_STATS
+
+#endif  // H_COMMON_XMALLOC
@@ -2,51 +2,13 @@
 #include "win32_last_error.h"
 #include "xmalloc.h"
 #include "log.h"
+#include "wstr_line_reader.h"
+#include "xarena.h"
 #include <assert.h>   // required for assert()
 #include <windows.h>
 
-static void
-ConfigEntryDynArr_AssertValid(__attribute__((unused))
-                              _In_ const struct ConfigEntryDynArr *lpDynArr)
-{
-    assert(NULL != lpDynArr);
-    // Intentional: If ulCapacity is more that *half* of SIZE_MAX, there is probably an unsigned wrap bug.
-    assert(lpDynArr->ulCapacity <= SIZE_MAX / 2U);
-    assert(lpDynArr->ulSize <= lpDynArr->ulCapacity);
-}
-
-static void
-ConfigEntryDynArr_IncreaseCapacity(_Inout_ struct ConfigEntryDynArr *lpDynArr)
-{
-    ConfigEntryDynArr_AssertValid(lpDynArr);
-
-    if (0 == lpDynArr->ulCapacity)
-    {
-        lpDynArr->lpConfigEntryArr = xcalloc(1U, sizeof(struct ConfigEntry));
-        lpDynArr->ulCapacity = 1;
-    }
-    else
-    {
-        ++(lpDynArr->ulCapacity);
-        xrealloc((void **) &(lpDynArr->lpConfigEntryArr),
-                 sizeof(struct ConfigEntry) * lpDynArr->ulCapacity);
-    }
-}
-
-static void
-ConfigEntryDynArr_Append(_Inout_ struct ConfigEntryDynArr *lpDynArr,
-                         _In_    const struct ConfigEntry *lpConfigEntry)
-{
-    ConfigEntryDynArr_AssertValid(lpDynArr);
-
-    if (lpDynArr->ulSize == lpDynArr->ulCapacity)
-    {
-        ConfigEntryDynArr_IncreaseCapacity(lpDynArr);
-    }
-
-    lpDynArr->lpConfigEntryArr[lpDynArr->ulSize] = *lpConfigEntry;
-    ++(lpDynArr->ulSize);
-}
+// Intentional: No move function.  Why?  struct ConfigEntry only has pointers to interned values: Grow with xrealloc().
+DYN_ARR_DEFINE(ConfigEntryDynArr, struct ConfigEntry, NULL)
 
 static void
 ConfigAssertValid(_In_ const struct Config *lpConfig)
@@ -69,125 +31,148 @@ ConfigParseFile(_In_  const wchar_t *lpConfigFilePathWCharArr,
                 _In_  const UINT     codePage,  // Ex: CP_UTF8
                 _Out_ struct Config *lpConfig)
 {
-    LogWF(stdout, L"INFO: Config file: Reading [%ls]...\r\n", lpConfigFilePathWCharArr);
-    struct WStr textWStr = {0};
-    WStrFileRead(lpConfigFilePathWCharArr, codePage, &textWStr);
-    LogWF(stdout, L"INFO: Config file: Read %zd chars\r\n", textWStr.ulSize);
-
-    const struct WStrSplitOptions splitOptions = {
-        .iMinTokenCount             = UNLIMITED_MIN_TOKEN_COUNT,
-        .iMaxTokenCount             = UNLIMITED_MAX_TOKEN_COUNT,
-        .fpNullableWStrConsumerFunc = WStrTrimSpace,
-    };
+    INFO_LOGWF(stdout, L"INFO: Config file: Reading [%ls]...\r\n", lpConfigFilePathWCharArr);
 
-    struct WStrArr lineWStrArr = {0};
-    WStrSplitNewLine(&textWStr, &splitOptions, &lineWStrArr);
+    // Intentional: Read one line at a time.  Why?  Memory is bounded by one chunk and the longest line, not file size.
+    struct WStrLineReader reader = {0};
+    WStrLineReaderOpen(&reader, lpConfigFilePathWCharArr, codePage, WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE);
 
     BOOL bFirstLine = TRUE;
     struct Win32ShortcutKey shortcutKey = {0};
     struct ConfigEntryDynArr dynArr = {0};
+    struct WStrIntern valueIntern = {0};
 
-    for (size_t ulLineIndex = 0; ulLineIndex < lineWStrArr.ulSize; ++ulLineIndex)
+    // Intentional: One arena for all temporary allocations.  Why?  Token arrays are bump-allocated, then released
+    // together after each line.  One call frees all chunks at end.
+    struct XArena tempArena = {0};
+    struct XArenaMark lineMark = {0};
+    XArenaGetMark(&tempArena, &lineMark);
+
+    struct WStrView lineWStrView = {0};
+    while (WStrLineReaderNext(&reader, &lineWStrView))
     {
-        const struct WStr *lpLineWStr = lineWStrArr.lpWStrArr + ulLineIndex;
+        // Important: View is only valid until next call to WStrLineReaderNext().
+        WStrViewTrimSpace(&lineWStrView);
 
-        if (0 == lpLineWStr->ulSize) {
+        if (0 == lineWStrView.ulSize) {
             continue;  // skip blank line
         }
 
-        if (L'#' == lpLineWStr->lpWCharArr[0]) {
+        if (L'#' == lineWStrView.lpWCharArr[0]) {
             continue;  // skip comment -- begins with '#'
         }
 
         if (TRUE == bFirstLine)
         {
             bFirstLine = FALSE;
+            // Intentional: Copy.  Why?  Win32ShortcutKeyTryParseWStr() requires a trailing '\0' char.
+            // Intentional: Stack buffers.  Why?  Usual shortcut key line and error message: No heap alloc.
+            wchar_t lpLineWCharArr[64];
+            struct WStr lineWStr = {0};
+            WStrInitStackBuffer(&lineWStr, lpLineWCharArr, sizeof(lpLineWCharArr) / sizeof(lpLineWCharArr[0]));
+            WStrCopyWStrView(&lineWStr, &lineWStrView);
+            wchar_t lpErrorWCharArr[256];
             struct WStr errorWStr = {0};
-            if (FALSE == Win32ShortcutKeyTryParseWStr(lpLineWStr, &shortcutKey, &errorWStr))
+            WStrInitStackBuffer(&errorWStr, lpErrorWCharArr, sizeof(lpErrorWCharArr) / sizeof(lpErrorWCharArr[0]));
+            if (FALSE == Win32ShortcutKeyTryParseWStr(&lineWStr, &shortcutKey, &errorWStr))
             {
                 Win32LastErrorFPutWSAbort(stderr,                 // _In_ FILE          *lpStream
                                           errorWStr.lpWCharArr);  // _In_ const wchar_t *lpMessage
             }
+            WStrFree(&errorWStr);
+            WStrFree(&lineWStr);
         }
         else {
             struct ConfigEntry configEntry = {0};
-            ConfigParseLine(ulLineIndex, lpLineWStr, &configEntry);
-            ConfigEntryDynArr_Append(&dynArr, &configEntry);
+            ConfigParseLine(reader.ulLineIndex, &lineWStrView, &valueIntern, &tempArena, &configEntry);
+            ConfigEntryDynArr_Push(&dynArr, &configEntry);
+            XArenaResetToMark(&tempArena, &lineMark);
         }
     }
 
+    INFO_LOGWF(stdout, L"INFO: Config file: Read %zd lines\r\n", reader.ulLineIndex + 1U);
+    WStrLineReaderClose(&reader);
+    XArenaFree(&tempArena);
+    // Intentional: Release unused capacity.  Why?  Entries are never added after parsing.
+    ConfigEntryDynArr_ShrinkToFit(&dynArr);
+
     lpConfig->shortcutKey = shortcutKey;
     lpConfig->dynArr      = dynArr;
-
-    WStrFree(&textWStr);
-    WStrArrFree(&lineWStrArr);
+    lpConfig->valueIntern = valueIntern;
 
     ConfigAssertValid(lpConfig);
-    LogWF(stdout, L"INFO: Config file: Read %zd entries\r\n", lpConfig->dynArr.ulSize);
+    INFO_LOGWF(stdout, L"INFO: Config file: Read %zd entries: %zd distinct usernames and passwords\r\n",
+               lpConfig->dynArr.ulSize, lpConfig->valueIntern.ulSize);
 }
 
 void
-ConfigParseLine(_In_  const size_t        ulLineIndex,
-                _In_  const struct WStr  *lpLineWStr,  // Ex: L"username|password"
-                _Out_ struct ConfigEntry *lpConfigEntry)
+ConfigParseLine(_In_    const size_t           ulLineIndex,
+                _In_    const struct WStrView *lpLineWStrView,  // Ex: L"username|password"
+                _Inout_ struct WStrIntern     *lpValueIntern,
+                _Inout_ struct XArena         *lpTempArena,
+                _Out_   struct ConfigEntry    *lpConfigEntry)
 {
-    WStrAssertValid(lpLineWStr);
+    WStrViewAssertValid(lpLineWStrView);
+    WStrInternAssertValid(lpValueIntern);
+    XArenaAssertValid(lpTempArena);
     assert(NULL != lpConfigEntry);
 
-    const struct WStr delimWStr = WSTR_FROM_LITERAL(L"|");
+    const struct WStrView delimWStrView = WSTR_VIEW_FROM_LITERAL(L"|");
 
-    const struct WStrSplitOptions splitOptions = {
-        .iMinTokenCount             = UNLIMITED_MIN_TOKEN_COUNT,
-        .iMaxTokenCount             = UNLIMITED_MAX_TOKEN_COUNT,
-        .fpNullableWStrConsumerFunc = WStrTrimSpace,
+    const struct WStrViewSplitOptions splitOptions = {
+        .iMinTokenCount                 = UNLIMITED_MIN_TOKEN_COUNT,
+        .iMaxTokenCount                 = UNLIMITED_MAX_TOKEN_COUNT,
+        .fpNullableWStrViewConsumerFunc = WStrViewTrimSpace,
     };
 
     // Ex: "username|password" -> ["username", "password"]
-    struct WStrArr tokenWStrArr = {};
-    WStrSplit(lpLineWStr, &delimWStr, &splitOptions, &tokenWStrArr);
+    // Intentional: Array of views from arena.  Why?  Caller releases after each line: No heap alloc per line.
+    struct WStrViewArr tokenWStrViewArr = {0};
+    WStrSplitViewXArena(lpLineWStrView, &delimWStrView, &splitOptions, lpTempArena, &tokenWStrViewArr);
 
-    if (tokenWStrArr.ulSize < 2)
+    // Note: Line view is not terminated with '\0', so print with "%.*ls".
+    const int iLineSize = (int) lpLineWStrView->ulSize;
+
+    if (tokenWStrViewArr.ulSize < 2)
     {
         Win32LastErrorFPrintFWAbort(stderr,                 // _In_ FILE          *lpStream,
                                     L"Config file: Failed to find delim [%ls]\r\n"
-                                    L"Line #%zd: %ls\r\n",  // _In_ const wchar_t *lpMessageFormat,
-                                    delimWStr.lpWCharArr, (1 + ulLineIndex), lpLineWStr->lpWCharArr);  // _In_ ...
+                                    L"Line #%zd: %.*ls\r\n",  // _In_ const wchar_t *lpMessageFormat,
+                                    delimWStrView.lpWCharArr, (1 + ulLineIndex), iLineSize, lpLineWStrView->lpWCharArr);  // _In_ ...
     }
 
-    if (tokenWStrArr.ulSize > 2)
+    if (tokenWStrViewArr.ulSize > 2)
     {
         Win32LastErrorFPrintFWAbort(stderr,                 // _In_ FILE          *lpStream,
                                     L"Config file: Found multiple delim [%ls]\r\n"
-                                    L"Line #%zd: %ls\r\n",  // _In_ const wchar_t *lpMessageFormat,
-                                    delimWStr.lpWCharArr, (1 + ulLineIndex), lpLineWStr->lpWCharArr);  // _In_ ...
+                                    L"Line #%zd: %.*ls\r\n",  // _In_ const wchar_t *lpMessageFormat,
+                                    delimWStrView.lpWCharArr, (1 + ulLineIndex), iLineSize, lpLineWStrView->lpWCharArr);  // _In_ ...
     }
 
     // Ex: L"username|password" -> L"username"
-    const struct WStr *lpUsernameWStr = tokenWStrArr.lpWStrArr + 0;  // Explicit: '+ 0'
+    const struct WStrView *lpUsernameWStrView = tokenWStrViewArr.lpWStrViewArr + 0;  // Explicit: '+ 0'
 
     // Ex: L"username|password" -> L"password"
-    const struct WStr *lpPasswordWStr = tokenWStrArr.lpWStrArr + 1;
+    const struct WStrView *lpPasswordWStrView = tokenWStrViewArr.lpWStrViewArr + 1;
 
-    if (0 == lpUsernameWStr->ulSize)
+    if (0 == lpUsernameWStrView->ulSize)
     {
         Win32LastErrorFPrintFWAbort(stderr,                 // _In_ FILE          *lpStream,
                                     L"Config file: Username is empty\r\n"
-                                    L"Line #%zd: %ls\r\n",  // _In_ const wchar_t *lpMessageFormat,
-                                    (1 + ulLineIndex), lpLineWStr->lpWCharArr);  // _In_ ...
+                                    L"Line #%zd: %.*ls\r\n",  // _In_ const wchar_t *lpMessageFormat,
+                                    (1 + ulLineIndex), iLineSize, lpLineWStrView->lpWCharArr);  // _In_ ...
     }
-    else if (0 == lpPasswordWStr->ulSize)
+    else if (0 == lpPasswordWStrView->ulSize)
     {
         Win32LastErrorFPrintFWAbort(stderr,                 // _In_ FILE          *lpStream,
                                     L"Config file: Password is empty\r\n"
-                                    L"Line #%zd: %ls\r\n",  // _In_ const wchar_t *lpMessageFormat,
-                                    (1 + ulLineIndex), lpLineWStr->lpWCharArr);  // _In_ ...
+                                    L"Line #%zd: %.*ls\r\n",  // _In_ const wchar_t *lpMessageFormat,
+                                    (1 + ulLineIndex), iLineSize, lpLineWStrView->lpWCharArr);  // _In_ ...
     }
 
-    // Intentional: MUST copy.  Do not assign.  Why?  WStrArrFree() is called next.
-    WStrCopyWStr(&lpConfigEntry->usernameWStr, lpUsernameWStr);
-    // Intentional: MUST copy.  Do not assign.  Why?  WStrArrFree() is called next.
-    WStrCopyWStr(&lpConfigEntry->passwordWStr, lpPasswordWStr);
-
-    WStrArrFree(&tokenWStrArr);
+    // Intentional: MUST intern (copy).  Why?  Views point into chunk buffer of WStrLineReader: Next WStrLineReaderNext()
+    // overwrites it.
+    // Repeated values are copied only once.
+    lpConfigEntry->lpUsernameWStr = &(WStrInternWStrView(lpValueIntern, lpUsernameWStrView)->wstr);
+    lpConfigEntry->lpPasswordWStr = &(WStrInternWStrView(lpValueIntern, lpPasswordWStrView)->wstr);
 }
-
@@ -2,27 +2,29 @@
 #define H_CONFIG
 
 #include "wstr.h"
+#include "wstr_intern.h"
+#include "xarena.h"
+#include "dyn_arr.h"
 #include "win32_shortcut_key.h"
 
 // TODO: Support comma separate list of hot keys?
 
 struct ConfigEntry
 {
-    struct WStr usernameWStr;
-    struct WStr passwordWStr;
+    // Interned: Owned by struct Config.valueIntern.  Equal values share one instance, so compare pointers.
+    const struct WStr *lpUsernameWStr;
+    const struct WStr *lpPasswordWStr;
 };
 
-struct ConfigEntryDynArr
-{
-    struct ConfigEntry *lpConfigEntryArr;
-    size_t              ulSize;
-    size_t              ulCapacity;
-};
+// struct ConfigEntryDynArr: lpElemArr, ulSize, ulCapacity
+DYN_ARR_DECLARE(ConfigEntryDynArr, struct ConfigEntry)
 
 struct Config
 {
     struct Win32ShortcutKey  shortcutKey;
     struct ConfigEntryDynArr dynArr;
+    // Intentional: Intern usernames and passwords.  Why?  Large configs repeat the same values many times.
+    struct WStrIntern        valueIntern;
 };
 
 void ConfigParseFile(_In_  const wchar_t *lpConfigFilePathWCharArr,
@@ -32,9 +34,12 @@ void ConfigParseFile(_In_  const wchar_t *lpConfigFilePathWCharArr,
 // All functions below are public/non-static for testing.
 // Ref: https://stackoverflow.com/questions/593414/how-to-test-a-static-function
 
-void ConfigParseLine(_In_  const size_t        ulLineIndex,
-                     _In_  const struct WStr  *lpLineWStr,  // Ex: L"username|password"
-                     _Out_ struct ConfigEntry *lpConfigEntry);
+void ConfigParseLine(_In_    const size_t           ulLineIndex,
+                     _In_    const struct WStrView *lpLineWStrView,  // Ex: L"username|password"
+                     _Inout_ struct WStrIntern     *lpValueIntern,
+                     // Token array is allocated here.  Caller may reset after each line.
+                     _Inout_ struct XArena         *lpTempArena,
+                     _Out_   struct ConfigEntry    *lpConfigEntry);
 
 #endif  // H_CONFIG
 
@@ -1,6 +1,9 @@
 #include "win32.h"
 #include "win32_clipboard.h"
 #include "log.h"
+#include "log_async.h"
+#include "log_file.h"
+#include "latency_hist.h"
 #include "wstr.h"
 #include "win32_monitor.h"
 #include "win32_hwnd.h"
@@ -8,6 +11,7 @@
 #include "win32_size_grip_control.h"
 #include "win32_set_focus.h"
 #include "win32_last_error.h"
+#include "xmalloc.h"
 #include "config.h"
 #include <windows.h>
 #include <windowsx.h>
@@ -153,8 +157,20 @@ struct Global
     enum EWin32KeyModifier eKeyModifierDownFlags;
     struct Window          win;
     BOOL                   bIsRightMouseButtonDown;
+    // Opened only if --log-file=PATH.  Intentional: Global.  Why?  Crash handlers and exit() write its buffer.
+    struct LogFile         logFile;
+    // Duration of LowLevelKeyboardProc(), excluding CallNextHookEx().  Why?  Windows silently removes a hook that is
+    // slower than registry value LowLevelHooksTimeout.  Matched: Shortcut key down shows window.  Unmatched: All others.
+    struct LatencyHist     matchedLatencyHist;
+    struct LatencyHist     unmatchedLatencyHist;
+    // Window messages to trace: See --log-msg=CATEGORIES and StaticIsMsgTraced()
+    enum EWin32MsgCategory eTraceMsgCategories;
+};
+struct Global global = {
+    .eTraceMsgCategories  = WIN32_MSG_CATEGORY_ALL,
+    .matchedLatencyHist   = LATENCY_HIST_INIT(L"LowLevelKeyboardProc: Matched"),
+    .unmatchedLatencyHist = LATENCY_HIST_INIT(L"LowLevelKeyboardProc: Unmatched"),
 };
-struct Global global = {0};
 
 enum ECopyFailIfNoSelectedIndex
 {
@@ -195,7 +211,7 @@ StaticTryGetConfigEntryForSelectedListBoxItem(_In_ struct Window
     }
     else
     {
-        struct ConfigEntry *lpConfigEntry = lpWin->config.dynArr.lpConfigEntryArr + selectedIndex;
+        struct ConfigEntry *lpConfigEntry = lpWin->config.dynArr.lpElemArr + selectedIndex;
         return lpConfigEntry;
     }
 }
@@ -209,8 +225,8 @@ StaticCopyUsername(_In_ struct Window                         *lpWin,
                                                       eCopyFailIfNoSelectedIndex);  // _In_ const ECopyFailIfNoSelectedIndex  eCopyFailIfNoSelectedIndex
     if (NULL != lpConfigEntry)
     {
-        Win32ClipboardWriteWStr(lpWin->hWnd,                    // _In_ HWND               hWnd
-                                &lpConfigEntry->usernameWStr);  // _In_ const struct WStr *lpWStr
+        Win32ClipboardWriteWStr(lpWin->hWnd,                     // _In_ HWND               hWnd
+                                lpConfigEntry->lpUsernameWStr);  // _In_ const struct WStr *lpWStr
     }
 }
 static void
@@ -223,8 +239,8 @@ StaticCopyPassword(_In_ struct Window                         *lpWin,
                                                       eCopyFailIfNoSelectedIndex);  // _In_ const ECopyFailIfNoSelectedIndex  eCopyFailIfNoSelectedIndex
     if (NULL != lpConfigEntry)
     {
-        Win32ClipboardWriteWStr(lpWin->hWnd,                    // _In_ HWND               hWnd
-                                &lpConfigEntry->passwordWStr);  // _In_ const struct WStr *lpWStr
+        Win32ClipboardWriteWStr(lpWin->hWnd,                     // _In_ HWND               hWnd
+                                lpConfigEntry->lpPasswordWStr);  // _In_ const struct WStr *lpWStr
     }
 }
 // Ref: https://docs.microsoft.com/en-us/windows/win32/winmsg/lowlevelkeyboardproc
@@ -233,6 +249,9 @@ LowLevelKeyboardProc(_In_ const int    nCode,
                      _In_ const WPARAM wParam,  // Any of: WM_KEYDOWN, WM_KEYUP, WM_SYSKEYDOWN, or WM_SYSKEYUP
                      _In_ const LPARAM lParam)
 {
+    const int64_t llStartTicks = LatencyHistNow();
+    bool bIsMatched = false;
+
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winuser/ns-winuser-kbdllhookstruct
     const KBDLLHOOKSTRUCT* info = (KBDLLHOOKSTRUCT *) lParam;
 //    const BOOL bIsInjected = (0 != (info->flags & LLKHF_INJECTED));
@@ -248,8 +267,8 @@ LowLevelKeyboardProc(_In_ const int    nCode,
         // If TRUE, then key is released (up).  If FALSE, then key is pressed (down).
         // If TRUE, then key is pressed (down).  If FALSE, then key is released (up).
         const BOOL bIsKeyDown = (0 == (info->flags & LLKHF_UP));
-        DEBUG_LOGWF(stdout, L"INFO: bIsKeyDown:%s, global.eKeyModifierDownFlags:%d, info->vkCode:%u\r\n",
-                    bIsKeyDown ? "TRUE" : "FALSE", global.eKeyModifierDownFlags, info->vkCode);
+        TRACE_LOGWF(stdout, L"TRACE: bIsKeyDown:%ls, global.eKeyModifierDownFlags:%d, info->vkCode:%u\r\n",
+                    bIsKeyDown ? L"TRUE" : L"FALSE", global.eKeyModifierDownFlags, info->vkCode);
 
         const enum EWin32KeyModifier eKeyMod = WIN32_VIRTUAL_KEY_CODE_TO_KEY_MODIFIER_ARR[info->vkCode];
         if (0 != eKeyMod)
@@ -269,7 +288,8 @@ LowLevelKeyboardProc(_In_ const int    nCode,
                  && global.eKeyModifierDownFlags == global.win.config.shortcutKey.eKeyModifiers
                  && info->vkCode                 == global.win.config.shortcutKey.dwVkCode)
         {
-            DEBUG_LOGW(stdout, L"INFO: Shortcut key pressed\r\n");
+            DEBUG_LOGW(stdout, L"DEBUG: Shortcut key pressed\r\n");
+            bIsMatched = true;
             // Is window minimised?  Show.
             // Is window hidden?  Show.
             // Is window visible?  Activate.
@@ -358,39 +378,69 @@ LowLevelKeyboardProc(_In_ const int    nCode,
             }
         }
     }
+    // Intentional: Exclude CallNextHookEx().  Why?  Only our own work counts against our timeout.
+    LatencyHistRecord(bIsMatched ? &(global.matchedLatencyHist) : &(global.unmatchedLatencyHist),  // _Inout_ struct LatencyHist *lpHist
+                      LatencyHistNow() - llStartTicks);                                            // _In_    const int64_t       llValue
+
     const LRESULT x = CallNextHookEx((HHOOK) 0, nCode, wParam, lParam);
     return x;
 }
 static void
-_printfLParamWM_SIZE(_In_ const LPARAM lParam)
+LogLatencyHists()
+{
+    LatencyHistLogW(stdout, &(global.matchedLatencyHist));
+    LatencyHistLogW(stdout, &(global.unmatchedLatencyHist));
+}
+static void
+_appendLParamWM_SIZE(_In_    const LPARAM        lParam,
+                     _Inout_ struct WStrBuilder *lpWStrBuilder)
 {
-    __attribute__((unused))
     const WORD wWidth  = LOWORD(lParam);
-    __attribute__((unused))
     const WORD wHeight = HIWORD(lParam);
-    DEBUG_LOGWF(stdout, L"width:LOWORD(lParam):%d, height:HIWORD(lParam):%d", wWidth, wHeight);
+    WStrBuilderAppendF(lpWStrBuilder, L"width:LOWORD(lParam):%d, height:HIWORD(lParam):%d", wWidth, wHeight);
 }
 /*
 static void
-_printfLParamRECT(const LPARAM lParam)
+_appendLParamRECT(_In_    const LPARAM        lParam,
+                  _Inout_ struct WStrBuilder *lpWStrBuilder)
 {
     const RECT *lpRect = (RECT *) lParam;
-    wprintf(L"{.left=%ld, .top=%ld, .right=%ld, .bottom=%ld}",
-            lpRect->left, lpRect->top, lpRect->right, lpRect->bottom);
+    WStrBuilderAppendF(lpWStrBuilder, L"{.left=%ld, .top=%ld, .right=%ld, .bottom=%ld}",
+                       lpRect->left, lpRect->top, lpRect->right, lpRect->bottom);
 }
 */
+/**
+ * Intentional: Level, then category, then format.  Why?  Disabled or filtered messages cost one table search, not a format.
+ *
+ * @return true if trace level is enabled and a category of uMsg is in global.eTraceMsgCategories
+ */
+static bool
+StaticIsMsgTraced(_In_ const UINT uMsg)
+{
+    const bool x = LOG_IS_ENABLED(LOG_LEVEL_TRACE)
+                   && 0 != (Win32MsgToCategories(uMsg) & global.eTraceMsgCategories);
+    return x;
+}
 static void
-_logMessage(__attribute__((unused))
-            _In_ const LPCWSTR lpMsg,
+_logMessage(_In_ const UINT    uMsg,
             _In_ const WPARAM  wParam,
             _In_ const LPARAM  lParam,
-            _In_ void (*fpPrintfLParam) (const LPARAM lParam), ...)  // one or more pairs: (LPCWSTR lpValue, WPARAM wParam), followed by NULL
+            _In_ void (*fpAppendLParam) (const LPARAM lParam, struct WStrBuilder *lpWStrBuilder), ...)  // one or more pairs: (LPCWSTR lpValue, WPARAM wParam), followed by NULL
 {
-    DEBUG_LOGWF(stdout, L"INFO: %ls: ", lpMsg);
+    // Intentional: Check once, then build one line.  Why?  If disabled or filtered, no formatting at all.
+    if (!StaticIsMsgTraced(uMsg))
+    {
+        return;
+    }
+
+    wchar_t lpBufferWCharArr[256];
+    struct WStrBuilder sb = {0};
+    WStrBuilderInitBuffer(&sb, lpBufferWCharArr, sizeof(lpBufferWCharArr) / sizeof(lpBufferWCharArr[0]));
+    WStrBuilderAppendF(&sb, L"TRACE: %ls: ", Win32MsgToText(uMsg));
 
     // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/va-arg-va-copy-va-end-va-start?view=msvc-170
     va_list ap;
-    va_start(ap, fpPrintfLParam);
+    va_start(ap, fpAppendLParam);
     BOOL match = FALSE;
     while (TRUE)
     {
@@ -402,26 +452,22 @@ _logMessage(__attribute__((unused))
         const WPARAM wParam2 = va_arg(ap, WPARAM);
         if (wParam == wParam2)
         {
-            #ifndef NDEBUG
-                wprintf(L"WPARAM wParam: %lu/%ls, ", wParam, lpValue);
-            #endif
+            WStrBuilderAppendF(&sb, L"WPARAM wParam: %llu/%ls, ", wParam, lpValue);
             match = TRUE;
             break;
         }
     }
+    va_end(ap);
     if (!match)
     {
-        #ifndef NDEBUG
-            printf("WPARAM wParam: %llu/???, ", wParam);
-        #endif
-    }
-    #ifndef NDEBUG
-        printf("LPARAM lParam: ");
-    #endif
-    fpPrintfLParam(lParam);
-    #ifndef NDEBUG
-        puts("\r\n");  // newline only
-    #endif
+        WStrBuilderAppendF(&sb, L"WPARAM wParam: %llu/???, ", wParam);
+    }
+    WStrBuilderAppendF(&sb, L"LPARAM lParam: ");
+    fpAppendLParam(lParam, &sb);
+    WStrBuilderAppendF(&sb, L"\r\n");
+
+    LogW(stdout, sb.lpWCharArr);
+    WStrBuilderFree(&sb);
 }
 static void
 ListBoxSubclassProc_WM_RBUTTONDOWN_WM_MOUSEMOVE(__attribute__((unused))
@@ -633,8 +679,11 @@ ListBoxSubclassProc(_In_    HWND            hWnd,
                     _Inout_ const DWORD_PTR dwRefData)
 {
     struct Window *lpWin = (struct Window *) dwRefData;
-    DEBUG_LOGWF(stdout, L"INFO: ListBoxSubclassProc(HWND hWnd[%p]: UINT uMsg[%u/%ls], WPARAM wParam[%llu], LPARAM lParam[%lld], UINT_PTR uIdSubclass[%llu], DWORD_PTR dwRefData[%llu])\n",
-                hWnd, uMsg, Win32MsgToText(uMsg), wParam, lParam, uIdSubclass, dwRefData);
+    if (StaticIsMsgTraced(uMsg))
+    {
+        TRACE_LOGWF(stdout, L"TRACE: ListBoxSubclassProc(HWND hWnd[%p]: UINT uMsg[%u/%ls], WPARAM wParam[%llu], LPARAM lParam[%lld], UINT_PTR uIdSubclass[%llu], DWORD_PTR dwRefData[%llu])\r\n",
+                    hWnd, uMsg, Win32MsgToText(uMsg), wParam, lParam, uIdSubclass, dwRefData);
+    }
     switch (uMsg)
     {
         // Ref: https://learn.microsoft.com/en-us/windows/win32/inputdev/wm-rbuttondown
@@ -979,7 +1028,7 @@ WindowLayoutInit(_In_ const HWND     hWnd,
                                   L"AdjustWindowRectExForDpi");  // _In_ const wchar_t *lpMessage
     }
 
-    DEBUG_LOGWF(stdout, L"INFO: AdjustWindowRectExForDpi(): RECT{.left = %d->%d, .top = %d->%d, .right = %d->%d, .bottom = %d->%d}\n",
+    DEBUG_LOGWF(stdout, L"DEBUG: AdjustWindowRectExForDpi(): RECT{.left = %d->%d, .top = %d->%d, .right = %d->%d, .bottom = %d->%d}\n",
                 left, adjRect.left, top, adjRect.top, left + lWidth, adjRect.right, top + lHeight, adjRect.bottom);
 
     setRectEx(&lpLayout->windowNonClientRectEx,
@@ -1111,7 +1160,7 @@ WindowProc_WM_CREATE(_In_ const HWND   hWnd,
             WC_STATICW);  // ...
     }
 
-    DEBUG_LOGWF(stdout, L"INFO: hStaticDesc: %p\r\n", lpWin->hStaticDesc);
+    DEBUG_LOGWF(stdout, L"DEBUG: hStaticDesc: %p\r\n", lpWin->hStaticDesc);
 
     // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-sendmessage
     // Ref: https://learn.microsoft.com/en-us/windows/win32/winmsg/wm-setfont?redirectedfrom=MSDN
@@ -1174,11 +1223,11 @@ WindowProc_WM_CREATE(_In_ const HWND   hWnd,
             WC_LISTBOXW);  // ...
     }
 
-    DEBUG_LOGWF(stdout, L"INFO: hListBox: %p\r\n", lpWin->hListBox);
+    DEBUG_LOGWF(stdout, L"DEBUG: hListBox: %p\r\n", lpWin->hListBox);
 
     for (size_t i = 0; i < lpWin->config.dynArr.ulSize; ++i)
     {
-        const struct ConfigEntry *lpConfigEntry = lpWin->config.dynArr.lpConfigEntryArr + i;
+        const struct ConfigEntry *lpConfigEntry = lpWin->config.dynArr.lpElemArr + i;
         // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-sendmessage
         // Ref: https://learn.microsoft.com/en-us/windows/win32/controls/lb-addstring
         // "The return value is the zero-based index of the string in the list box.
@@ -1191,21 +1240,21 @@ WindowProc_WM_CREATE(_In_ const HWND   hWnd,
                 // "This parameter is not used."
                 (WPARAM) NULL,                                     // [in] WPARAM wParam
                 // "A pointer to the null-terminated string that is to be added."
-                (LPARAM) lpConfigEntry->usernameWStr.lpWCharArr);  // [in] LPARAM lParam
+                (LPARAM) lpConfigEntry->lpUsernameWStr->lpWCharArr);  // [in] LPARAM lParam
 
         if (LB_ERR == lResult)
         {
             Win32LastErrorFPrintFWAbort(
                 stderr,                                            // _In_ FILE *lpStream
-                L"Failed to add listbox #%zu: LB_ERR == SendMessage(lpWin->hListBox, LB_ADDSTRING, NULL, lpConfigEntry->usernameWStr.lpWCharArr[%ls])",  // _In_ const wchar_t *lpMessageFormat
-                (1 + i), lpConfigEntry->usernameWStr.lpWCharArr);  // ...
+                L"Failed to add listbox #%zu: LB_ERR == SendMessage(lpWin->hListBox, LB_ADDSTRING, NULL, lpConfigEntry->lpUsernameWStr->lpWCharArr[%ls])",  // _In_ const wchar_t *lpMessageFormat
+                (1 + i), lpConfigEntry->lpUsernameWStr->lpWCharArr);  // ...
         }
         else if (LB_ERRSPACE == lResult)
         {
             Win32LastErrorFPrintFWAbort(
                 stderr,                                            // _In_ FILE *lpStream
-                L"Failed to add listbox #%zu: LB_ERRSPACE == SendMessage(lpWin->hListBox, LB_ADDSTRING, NULL, lpConfigEntry->usernameWStr.lpWCharArr[%ls])",  // _In_ const wchar_t *lpMessageFormat
-                (1 + i), lpConfigEntry->usernameWStr.lpWCharArr);  // ...
+                L"Failed to add listbox #%zu: LB_ERRSPACE == SendMessage(lpWin->hListBox, LB_ADDSTRING, NULL, lpConfigEntry->lpUsernameWStr->lpWCharArr[%ls])",  // _In_ const wchar_t *lpMessageFormat
+                (1 + i), lpConfigEntry->lpUsernameWStr->lpWCharArr);  // ...
         }
     }
 
@@ -1288,7 +1337,7 @@ WindowProc_WM_CREATE(_In_ const HWND   hWnd,
             WC_STATICW);  // ...
     }
 
-    DEBUG_LOGWF(stdout, L"INFO: hStaticTip: %p\r\n", lpWin->hStaticTip);
+    DEBUG_LOGWF(stdout, L"DEBUG: hStaticTip: %p\r\n", lpWin->hStaticTip);
 
     // "This message does not return a value."
     SendMessage(
@@ -1331,7 +1380,7 @@ WindowProc_WM_CREATE(_In_ const HWND   hWnd,
             WIN32_SIZE_GRIP_CONTROL_CLASS_NAMEW);                 // ...
     }
 
-    DEBUG_LOGWF(stdout, L"INFO: hLeftSizeGrip: %p\r\n", lpWin->hLeftSizeGrip);
+    DEBUG_LOGWF(stdout, L"DEBUG: hLeftSizeGrip: %p\r\n", lpWin->hLeftSizeGrip);
 
     // Before this function returns, the following window messages are received by wndproc: WM_PARENTNOTIFY
     lpWin->hButtonOk =
@@ -1375,7 +1424,7 @@ WindowProc_WM_CREATE(_In_ const HWND   hWnd,
             WC_BUTTONW);                                      // ...
     }
 
-    DEBUG_LOGWF(stdout, L"INFO: hButtonOk: %p\r\n", lpWin->hButtonOk);
+    DEBUG_LOGWF(stdout, L"DEBUG: hButtonOk: %p\r\n", lpWin->hButtonOk);
 
     // "This message does not return a value."
     SendMessage(
@@ -1426,7 +1475,7 @@ WindowProc_WM_CREATE(_In_ const HWND   hWnd,
             WC_BUTTONW);                                          // ...
     }
 
-    DEBUG_LOGWF(stdout, L"INFO: hButtonCancel: %p\r\n", lpWin->hButtonCancel);
+    DEBUG_LOGWF(stdout, L"DEBUG: hButtonCancel: %p\r\n", lpWin->hButtonCancel);
 
     // "This message does not return a value."
     SendMessage(
@@ -1572,7 +1621,7 @@ WindowProc_WM_CREATE(_In_ const HWND   hWnd,
             WIN32_SIZE_GRIP_CONTROL_CLASS_NAMEW);                  // ...
     }
 
-    DEBUG_LOGWF(stdout, L"INFO: hRightSizeGrip: %p\r\n", lpWin->hRightSizeGrip);
+    DEBUG_LOGWF(stdout, L"DEBUG: hRightSizeGrip: %p\r\n", lpWin->hRightSizeGrip);
 
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-setwindowshookexw
     lpWin->hHookLowLevelKeyboard =
@@ -1751,7 +1800,7 @@ WindowProc_WM_SIZE(__attribute__((unused))
                    _In_ const WPARAM wParam,
                    _In_ const LPARAM lParam)
 {
-    _logMessage(L"WM_SIZE", wParam, lParam, _printfLParamWM_SIZE,
+    _logMessage(WM_SIZE, wParam, lParam, _appendLParamWM_SIZE,
                 L"SIZE_MAXHIDE", (WPARAM) 4, L"SIZE_MAXIMIZED", (WPARAM) 2, L"SIZE_MAXSHOW", (WPARAM) 3, L"SIZE_MINIMIZED", (WPARAM) 1, L"SIZE_RESTORED", (WPARAM) 0,
                 NULL);
     const struct Window *lpWin = Win32GetWindowLongPtrW(hWnd, WINDOW_LONG_PTR_INDEX, L"GetWindowLongPtrW(hWnd, WINDOW_LONG_PTR_INDEX)");
@@ -2062,8 +2111,12 @@ WindowProc(_In_ const HWND   hWnd,
            _In_ const WPARAM wParam,
            _In_ const LPARAM lParam)
 {
-//    DEBUG_LOGWF(stdout, L"INFO: WindowProc(HWND hWnd[%p], UINT uMsg[%u/%ls], WPARAM wParam[%llu]hi:%lu,lo:%lu, LPARAM lParam[%lld])\n",
-//                hWnd, uMsg, Win32MsgToText(uMsg), wParam, HIWORD(wParam), LOWORD(wParam), lParam);
+    // Intentional: Filtered by category.  Why?  Without --log-msg=CATEGORIES, this is most trace lines: WM_MOUSEMOVE, WM_NCHITTEST, ...
+    if (StaticIsMsgTraced(uMsg))
+    {
+        TRACE_LOGWF(stdout, L"TRACE: WindowProc(HWND hWnd[%p], UINT uMsg[%u/%ls], WPARAM wParam[%llu]hi:%lu,lo:%lu, LPARAM lParam[%lld])\r\n",
+                    hWnd, uMsg, Win32MsgToText(uMsg), wParam, HIWORD(wParam), LOWORD(wParam), lParam);
+    }
     switch (uMsg)
     {
         // Ref: https://learn.microsoft.com/en-us/windows/win32/winmsg/wm-create
@@ -2137,7 +2190,7 @@ WindowProc(_In_ const HWND   hWnd,
             return 0;
         }
     }
-//    DEBUG_LOGW(stdout, L"DefWindowProc(...)\n");
+//    TRACE_LOGW(stdout, L"TRACE: DefWindowProc(...)\r\n");
     // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-defwindowprocw
     const LRESULT x = DefWindowProc(hWnd, uMsg, wParam, lParam);
     return x;
@@ -2160,7 +2213,7 @@ ShowHelpThenExit(_In_opt_ const wchar_t *lpszNullableErrorMsgFmt, ...)
     }
 
     printf("\n");
-    printf("Usage: %ls CONFIG_FILE_PATH [/?] [-h] [-help] [--help]\n", __wargv[0]);
+    printf("Usage: %ls [--log-level=LEVEL] [--log-file=PATH] [--log-msg=CATEGORIES] CONFIG_FILE_PATH [/?] [-h] [-help] [--help]\n", __wargv[0]);
     wprintf(APP_CAPTIONW L"\n");
     printf("\n");
     printf("Required Arguments:\n");
@@ -2199,19 +2252,74 @@ ShowHelpThenExit(_In_opt_ const wchar_t *lpszNullableErrorMsgFmt, ...)
     printf("                        ... will send input 'P*assw0rd' for keyboard shortcut: LCtrl+LShift+LAlt+F2\n");
     printf("\n");
     printf("Optional Arguments:\n");
+    printf("    --log-level=LEVEL\n");
+    printf("        Minimum log level: trace, debug, info, warn, error, or off\n");
+    printf("        Default: Environment variable %ls, else info (or debug for debug builds)\n", LOG_LEVEL_ENV_VAR_NAME);
+    printf("        Example: --log-level=trace to log each keyboard hook call and window message\n");
+    printf("\n");
+    printf("    --log-file=PATH\n");
+    printf("        Also write log to file: Buffered, and rotated at 16 MiB: PATH.1 ... PATH.5\n");
+    printf("        Lines for stdout are only written to file.  Default: No log file\n");
+    printf("        Example: --log-file=C:\\temp\\passport.log\n");
+    printf("\n");
+    printf("    --log-msg=CATEGORIES\n");
+    printf("        Window messages to trace (needs --log-level=trace): Comma-separated, left to right; '-' removes\n");
+    printf("        Categories: window, nonclient, paint, mouse, keyboard, ime, timer, menu, notify, clipboard, system, control, other, all\n");
+    printf("        Default: all\n");
+    printf("        Example: --log-msg=all,-mouse,-nonclient,-timer\n");
+    printf("\n");
     printf("    /? or -h or -help or --help\n");
     printf("        Show this help page\n");
     printf("\n");
+    printf("Hot Keys:\n");
+    printf("    Ctrl+Alt+Shift+F12: Log latency of keyboard hook as p50/p99/p99.9/max: Matched and unmatched keys\n");
+    printf("        Also logged on exit\n");
+    printf("\n");
 
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-exitprocess
     ExitProcess(1);
 }
+// See: Win32ArgvValueFunc
+static bool
+ParseLogMsgArg(_In_ const wchar_t *lpszCsv,
+               __attribute__((unused)) _Inout_ void *lpContext)
+{
+    if (!Win32MsgCategoriesFromText(lpszCsv, &(global.eTraceMsgCategories)))
+    {
+        ShowHelpThenExit(L"Invalid message categories: [%ls]", lpszCsv);
+    }
+    return true;
+}
+
+/**
+ * Remove each --log-msg=CATEGORIES from command-line args, then set global.eTraceMsgCategories.  Same as LogLevelInit():
+ * Each arg is parsed, and last arg wins.  Any invalid arg exits.
+ */
+static void
+ParseLogMsgArgs()
+{
+    Win32ArgvRemovePrefix(&__argc, __wargv, WIN32_MSG_CATEGORY_ARG_PREFIX, ParseLogMsgArg, NULL);
+}
 static void
 ParseCommandLineArgs(_Out_ wchar_t **lppConfigFilePathWCharArr)
 {
     assert(NULL != lppConfigFilePathWCharArr);
 
+    // Intentional: First.  Why?  Remove --log-level=LEVEL, --log-file=PATH, and --log-msg=CATEGORIES before other args are checked.
     // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/argc-argv-wargv?view=msvc-170
+    if (!LogLevelInit(&__argc, __wargv, stderr))
+    {
+        ShowHelpThenExit(L"Invalid log level");
+    }
+
+    // Intentional: Before LogAsyncStart().  Why?  Async log background thread owns the file.  See: LogSetFile()
+    if (!LogFileInit(&__argc, __wargv, &(global.logFile), stderr))
+    {
+        ShowHelpThenExit(L"Invalid log file");
+    }
+
+    ParseLogMsgArgs();
+
     if (1 == __argc)
     {
         ShowHelpThenExit(L"Missing argument: CONFIG_FILE_PATH");
@@ -2261,6 +2369,9 @@ wWinMain(HINSTANCE hInstance,      // The operating system uses this value to id
          __attribute__((unused))
          int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
 {
+    // Intentional: First, before any allocation.  Why?  All heap operations are from this UI thread: No heap lock.
+    XMallocInit(XMALLOC_HEAP_PRIVATE_NO_SERIALIZE);
+
     // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-setprocessdpiawarenesscontext
     // Return value: "This function returns TRUE if the operation was successful, and FALSE otherwise."
     // Ref: https://learn.microsoft.com/en-us/windows/win32/hidpi/dpi-awareness-context
@@ -2299,6 +2410,12 @@ wWinMain(HINSTANCE hInstance,      // The operating system uses this value to id
     ConfigParseFile(lpConfigFilePathWCharArr,  // _In_  const wchar_t *lpConfigFilePathWCharArr
                     CP_UTF8,                   // _In_  const UINT     codePage  // Ex: CP_UTF8
                     &config);                  // _Out_ struct Config *lpConfig
+    // Only if built with XMALLOC_STATS: Heap operations to load config
+    XMALLOC_STATS_FPRINT(stderr, "after ConfigParseFile()");
+
+    // Intentional: Before hook and window are created.  Why?  LowLevelKeyboardProc() and message tracing must never wait
+    // for console I/O.  Drop, not block, if ring buffer is full: Windows silently removes a slow hook.
+    LogAsyncStart(LOG_ASYNC_OVERFLOW_DROP);
 
     global.win.config = config;
     global.win.bIsInitDone = FALSE;
@@ -2439,6 +2556,17 @@ wWinMain(HINSTANCE hInstance,      // The operating system uses this value to id
 
     Win32SetWindowLongPtrW(hWnd, WINDOW_LONG_PTR_INDEX, &global.win, L"SetWindowLongPtrW(hWnd, WINDOW_LONG_PTR_INDEX, &global.win)");
 
+    // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-registerhotkey
+    // Intentional: NULL hWnd.  Why?  WM_HOTKEY is posted to this thread's queue, then handled below before dispatch.
+    if (FALSE == RegisterHotKey(NULL,                                              // [in, optional] HWND hWnd
+                                HOT_KEY_ID_LOG_LATENCY,                            // [in]           int  id
+                                MOD_CONTROL | MOD_ALT | MOD_SHIFT | MOD_NOREPEAT,  // [in]           UINT fsModifiers
+                                VK_F12))                                           // [in]           UINT vk
+    {
+        // Intentional: Not fatal.  Why?  Another process may own this hot key.  Latency is still logged on exit.
+        WARN_LOGWF(stderr, L"WARN: RegisterHotKey(Ctrl+Alt+Shift+F12) failed: GetLastError():%lu\r\n", GetLastError());
+    }
+
     // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winuser/ns-winuser-msg
     MSG msg = {0};
     while (TRUE)
@@ -2454,14 +2582,23 @@ wWinMain(HINSTANCE hInstance,      // The operating system uses this value to id
                                       L"GetMessage");  // _In_ const wchar_t *lpMessage
         }
 
-        DEBUG_LOGWF(stdout, L"INFO: GetMessageW(msg{HWND hwnd[%p], UINT message[%u/0x%04X/%ls], WPARAM wParam[%llu/0x%X], LPARAM lParam[%lld], DWORD time[%u], POINT pt{LONG x[%d], LONG y[%d]}, ...)\n",
-                    msg.hwnd, msg.message, msg.message, Win32MsgToText(msg.message), msg.wParam, msg.wParam, msg.lParam, msg.time, msg.pt.x, msg.pt.y);
+        if (StaticIsMsgTraced(msg.message))
+        {
+            TRACE_LOGWF(stdout, L"TRACE: GetMessageW(msg{HWND hwnd[%p], UINT message[%u/0x%04X/%ls], WPARAM wParam[%llu/0x%X], LPARAM lParam[%lld], DWORD time[%u], POINT pt{LONG x[%d], LONG y[%d]}, ...)\r\n",
+                        msg.hwnd, msg.message, msg.message, Win32MsgToText(msg.message), msg.wParam, msg.wParam, msg.lParam, msg.time, msg.pt.x, msg.pt.y);
+        }
 
         if (FALSE == bRet)
         {
             break;  // WM_QUIT received
         }
 
+        if (WM_HOTKEY == msg.message && (WPARAM) HOT_KEY_ID_LOG_LATENCY == msg.wParam)
+        {
+            LogLatencyHists();
+            continue;
+        }
+
         // Ref: https://stackoverflow.com/questions/29276275/should-i-call-isdialogmessage-before-translateaccelerator
         // TL;DR: Must call TranslateAcceleratorW() before IsDialogMessageW()
         // Ref: https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-translateacceleratorw
@@ -2495,6 +2632,7 @@ wWinMain(HINSTANCE hInstance,      // The operating system uses this value to id
         }
         DEBUG_BREAKPOINT;
     }
+    LogLatencyHists();
     // Return the exit code to the system from PostQuitMessage()
     return msg.wParam;
 }
@@ -83,9 +83,19 @@ main()
         -o "$EXECUTABLE" \
         "$COMMON_DIR_PATH/win32.o" \
         "$COMMON_DIR_PATH/log.o" \
+        "$COMMON_DIR_PATH/log_async.o" \
+        "$COMMON_DIR_PATH/log_file.o" \
+        "$COMMON_DIR_PATH/latency_hist.o" \
         "$COMMON_DIR_PATH/error_exit.o" \
         "$COMMON_DIR_PATH/win32_xmalloc.o" \
+        "$COMMON_DIR_PATH/xarena.o" \
         "$COMMON_DIR_PATH/wstr.o" \
+        "$COMMON_DIR_PATH/wstr_simd.o" \
+        "$COMMON_DIR_PATH/wstr_line_reader.o" \
+        "$COMMON_DIR_PATH/wstr_file_map.o" \
+        "$COMMON_DIR_PATH/wstr_utf8.o" \
+        "$COMMON_DIR_PATH/wstr_file_writer.o" \
+        "$COMMON_DIR_PATH/wstr_hash_map.o" \
         "$COMMON_DIR_PATH/min_max.o" \
         "$COMMON_DIR_PATH/console.o" \
         config.o main.o -lgdi32
@@ -2,47 +2,28 @@
 #include "error_exit.h"
 #include "xmalloc.h"
 #include "log.h"
+#include "wstr_line_reader.h"
+#include "wstr_hash_map.h"
+#include "xarena.h"
 #include <assert.h>   // required for assert()
 #include <windows.h>
 
-static void ConfigEntryDynArr_AssertValid(_In_ const struct ConfigEntryDynArr *lpDynArr)
+static void ConfigEntryMove(_Inout_ struct ConfigEntry *lpDestConfigEntry,
+                            _Inout_ struct ConfigEntry *lpSrcConfigEntry)
 {
-    assert(NULL != lpDynArr);
-    // Intentional: If ulCapacity is more that *half* of SIZE_MAX, there is probably an unsigned wrap bug.
-    assert(lpDynArr->ulCapacity <= SIZE_MAX / 2U);
-    assert(lpDynArr->ulSize <= lpDynArr->ulCapacity);
+    lpDestConfigEntry->shortcutKey     = lpSrcConfigEntry->shortcutKey;
+    // Intentional: Do not assign.  Why?  struct WStr may point to its own inline buffer.
+    WStrMove(&lpDestConfigEntry->sendKeysWStr, &lpSrcConfigEntry->sendKeysWStr);
+    lpDestConfigEntry->inputKeyArr     = lpSrcConfigEntry->inputKeyArr;
+    lpDestConfigEntry->ulSendKeysCount = lpSrcConfigEntry->ulSendKeysCount;
+
+    lpSrcConfigEntry->shortcutKey     = (struct ShortcutKey) {};
+    lpSrcConfigEntry->inputKeyArr     = (struct InputKeyArr) {};
+    lpSrcConfigEntry->ulSendKeysCount = 0;
 }
 
-static void ConfigEntryDynArr_IncreaseCapacity(_Inout_ struct ConfigEntryDynArr *lpDynArr)
-{
-    ConfigEntryDynArr_AssertValid(lpDynArr);
-
-    if (0 == lpDynArr->ulCapacity)
-    {
-        lpDynArr->lpConfigEntryArr = xcalloc(1U, sizeof(struct ConfigEntry));
-        lpDynArr->ulCapacity = 1;
-    }
-    else
-    {
-        ++(lpDynArr->ulCapacity);
-        xrealloc((void **) &(lpDynArr->lpConfigEntryArr),
-                 sizeof(struct ConfigEntry) * lpDynArr->ulCapacity);
-    }
-}
-
-static void ConfigEntryDynArr_Append(_Inout_ struct ConfigEntryDynArr *lpDynArr,
-                                     _In_    const struct ConfigEntry *lpConfigEntry)
-{
-    ConfigEntryDynArr_AssertValid(lpDynArr);
-
-    if (lpDynArr->ulSize == lpDynArr->ulCapacity)
-    {
-        ConfigEntryDynArr_IncreaseCapacity(lpDynArr);
-    }
-
-    lpDynArr->lpConfigEntryArr[lpDynArr->ulSize] = *lpConfigEntry;
-    ++(lpDynArr->ulSize);
-}
+// Intentional: Move function.  Why?  struct ConfigEntry.sendKeysWStr may point to its own inline buffer.
+DYN_ARR_DEFINE(ConfigEntryDynArr, struct ConfigEntry, ConfigEntryMove)
 
 static void ConfigAssertValid(_In_ const struct ConfigEntryDynArr *lpDynArr)
 {
@@ -51,231 +32,282 @@ static void ConfigAssertValid(_In_ const struct ConfigEntryDynArr *lpDynArr)
         ErrorExit("Zero config entries found!");
     }
 
+    // Intentional: One pass with a hash map, not pairwise compare.  Why?  Linear, not quadratic, in number of entries.
+    struct WStrHashMap map = {};
     for (size_t i = 0; i < lpDynArr->ulSize; ++i)
     {
-        for (size_t j = 1 + i; j < lpDynArr->ulSize; ++j)
+        const struct ConfigEntry *lpEntry = lpDynArr->lpElemArr + i;
+        // Intentional: Binary key.  Why?  Modifiers (max 0x3F) and virtual key code (max 0xFE) each fit in one wchar.
+        const wchar_t keyWCharArr[] = { (wchar_t) lpEntry->shortcutKey.eModifiers, (wchar_t) lpEntry->shortcutKey.dwVkCode };
+        const size_t ulKeySize = sizeof(keyWCharArr) / sizeof(keyWCharArr[0]);
+        if (!WStrHashMapInsert(&map, keyWCharArr, ulKeySize, (void *) lpEntry))
         {
-            const struct ConfigEntry *lpEntry  = lpDynArr->lpConfigEntryArr + i;
-            const struct ConfigEntry *lpEntry2 = lpDynArr->lpConfigEntryArr + j;
-            if (lpEntry->shortcutKey.eModifiers == lpEntry2->shortcutKey.eModifiers
-                && lpEntry->shortcutKey.dwVkCode == lpEntry2->shortcutKey.dwVkCode)
-            {
-                ErrorExitF("Config entries #%zd and #%zd have the same shortcut key\n", (1 + i), (1 + j));
-            }
+            void *lpNullableValue = NULL;
+            WStrHashMapFind(&map, keyWCharArr, ulKeySize, &lpNullableValue);
+            const struct ConfigEntry *lpPrevEntry = lpNullableValue;
+            const size_t ulPrevIndex = lpPrevEntry - lpDynArr->lpElemArr;
+            ErrorExitF("Config entries #%zd and #%zd have the same shortcut key\n", (1 + ulPrevIndex), (1 + i));
         }
     }
+    WStrHashMapFree(&map);
 }
 
 void ConfigParseFile(_In_    const wchar_t            *lpConfigFilePath,
                      _In_    const UINT                codePage,  // Ex: CP_UTF8
                      _Inout_ struct ConfigEntryDynArr *lpDynArr)
 {
-    struct WStr textWStr = {};
-    WStrFileRead(lpConfigFilePath, codePage, &textWStr);
-
-    const int iMaxLineCount = -1;
-    struct WStrArr lineWStrArr = {};
-    WStrSplitNewLine(&textWStr, iMaxLineCount, &lineWStrArr);
-    // Intentional: LTrim here.  Why?  Do NOT RTrim to allow SendKeys text to contain leading & trailing whitespace.
-    WStrArrForEach(&lineWStrArr, WStrLTrimSpace);
-
-    for (size_t ulLineIndex = 0; ulLineIndex < lineWStrArr.ulSize; ++ulLineIndex)
+    // Intentional: Read one line at a time.  Why?  Memory is bounded by one chunk and the longest line, not file size.
+    struct WStrLineReader reader = {};
+    WStrLineReaderOpen(&reader, lpConfigFilePath, codePage, WSTR_LINE_READER_DEFAULT_CHUNK_BYTE_SIZE);
+
+    // Intentional: One arena for all temporary allocations.  Why?  Token arrays are bump-allocated, then released
+    // together after each line.  One call frees all chunks at end.
+    struct XArena tempArena = {};
+    struct XArenaMark lineMark = {};
+    XArenaGetMark(&tempArena, &lineMark);
+
+    struct WStrView lineWStrView = {};
+    while (WStrLineReaderNext(&reader, &lineWStrView))
     {
-        const struct WStr *lpLineWStr = lineWStrArr.lpWStrArr + ulLineIndex;
+        // Intentional: LTrim here.  Why?  Do NOT RTrim to allow SendKeys text to contain leading & trailing whitespace.
+        WStrViewLTrimSpace(&lineWStrView);
 
-        if (0 == lpLineWStr->ulSize) {
+        if (0 == lineWStrView.ulSize) {
             continue;  // skip blank line
         }
 
-        if (L'#' == lpLineWStr->lpWCharArr[0]) {
+        if (L'#' == lineWStrView.lpWCharArr[0]) {
             continue;  // skip comment -- begins with '#'
         }
 
         struct ConfigEntry configEntry = {};
-        ConfigParseLine(ulLineIndex, lpLineWStr, &configEntry);
-        ConfigEntryDynArr_Append(lpDynArr, &configEntry);
+        ConfigParseLine(reader.ulLineIndex, &lineWStrView, &tempArena, &configEntry);
+        ConfigEntryDynArr_Push(lpDynArr, &configEntry);
+        XArenaResetToMark(&tempArena, &lineMark);
     }
 
-    WStrFree(&textWStr);
-    WStrArrFree(&lineWStrArr);
+    WStrLineReaderClose(&reader);
+    XArenaFree(&tempArena);
+    // Intentional: Release unused capacity.  Why?  Entries are never added after parsing.
+    ConfigEntryDynArr_ShrinkToFit(lpDynArr);
 
     ConfigAssertValid(lpDynArr);
 }
 
-void ConfigParseLine(_In_  const size_t        ulLineIndex,
-                     _In_  const struct WStr  *lpLineWStr,  // Ex: L"Ctrl+Shift+Alt+0x70|username"
-                     _Out_ struct ConfigEntry *lpConfigEntry)
+void ConfigParseLine(_In_    const size_t           ulLineIndex,
+                     _In_    const struct WStrView *lpLineWStrView,  // Ex: L"Ctrl+Shift+Alt+0x70|username"
+                     _Inout_ struct XArena         *lpTempArena,
+                     _Out_   struct ConfigEntry    *lpConfigEntry)
 {
-    WStrAssertValid(lpLineWStr);
+    WStrViewAssertValid(lpLineWStrView);
+    XArenaAssertValid(lpTempArena);
     assert(NULL != lpConfigEntry);
 
-    wchar_t *lpDelimWCharArr = L"|";
-    struct WStr delimWStr = {.lpWCharArr = lpDelimWCharArr, .ulSize = wcslen(lpDelimWCharArr)};
+    const struct WStrView delimWStrView = WSTR_VIEW_FROM_LITERAL(L"|");
+
+    const struct WStrViewSplitOptions splitOptions = {
+        .iMinTokenCount                 = UNLIMITED_MIN_TOKEN_COUNT,
+        .iMaxTokenCount                 = 2,
+        // Intentional: Do NOT trim.  Why?  SendKeys text may contain leading and trailing whitespace.
+        .fpNullableWStrViewConsumerFunc = NULL,
+    };
 
     // Ex: "Ctrl+Shift+Alt+0x70|username" -> ["Ctrl+Shift+Alt+0x70", "username"]
-    const int iMaxTokenCount = 2;
-    struct WStrArr tokenWStrArr = {};
-    WStrSplit(lpLineWStr, &delimWStr, iMaxTokenCount, &tokenWStrArr);
-    // Intentional: Do NOT trim.  Why?  SendKeys text may contain leading and trailing whitespace.
+    // Intentional: Array of views from arena.  Why?  Caller releases after each line: No heap alloc per line.
+    struct WStrViewArr tokenWStrViewArr = {};
+    WStrSplitViewXArena(lpLineWStrView, &delimWStrView, &splitOptions, lpTempArena, &tokenWStrViewArr);
+
+    // Note: Line view is not terminated with '\0', so print with "%.*ls".
+    const int iLineSize = (int) lpLineWStrView->ulSize;
 
-    if (1 == tokenWStrArr.ulSize)
+    if (1 == tokenWStrViewArr.ulSize)
     {
         ErrorExitF("Config file: Line #%zd: Failed to find delim [%ls]\n"
-                   "Line: %ls\n",
-                   (1 + ulLineIndex), lpDelimWCharArr, lpLineWStr->lpWCharArr);
+                   "Line: %.*ls\n",
+                   (1 + ulLineIndex), delimWStrView.lpWCharArr, iLineSize, lpLineWStrView->lpWCharArr);
     }
 
     // Ex: L"Ctrl+Shift+Alt+0x70|username" -> L"Ctrl+Shift+Alt+0x70"
-    struct WStr *lpShortcutKeyWStr = tokenWStrArr.lpWStrArr + 0;  // '+0" -> Explicit
+    struct WStrView shortcutKeyWStrView = tokenWStrViewArr.lpWStrViewArr[0];
     // Ex: L"  Ctrl+Shift+Alt+0x70  " -> L"Ctrl+Shift+Alt+0x70"
-    WStrTrimSpace(lpShortcutKeyWStr);
+    WStrViewTrimSpace(&shortcutKeyWStrView);
 
     // Ex: L"Ctrl+Shift+Alt+0x70|username"     -> L"username"
     // Ex: L"Ctrl+Shift+Alt+0x70|  username  " -> L"  username  "
-    const struct WStr *lpSendKeysWStr = tokenWStrArr.lpWStrArr + 1;
-    // Intentional: Do not trim 'lpSendKeysWStr'
+    const struct WStrView *lpSendKeysWStrView = tokenWStrViewArr.lpWStrViewArr + 1;
+    // Intentional: Do not trim 'lpSendKeysWStrView'
 
-    if (0 == lpShortcutKeyWStr->ulSize)
+    if (0 == shortcutKeyWStrView.ulSize)
     {
         ErrorExitF("Config file: Line #%zd: Left side shortcut key is empty\n"
-                   "Line: %ls\n",
-                   (1 + ulLineIndex), lpLineWStr->lpWCharArr);
+                   "Line: %.*ls\n",
+                   (1 + ulLineIndex), iLineSize, lpLineWStrView->lpWCharArr);
     }
-    else if (0 == lpSendKeysWStr->ulSize)
+    else if (0 == lpSendKeysWStrView->ulSize)
     {
         ErrorExitF("Config file: Line #%zd: Right side send keys text is empty\n"
-                   "Line: %ls\n",
-                   (1 + ulLineIndex), lpLineWStr->lpWCharArr);
+                   "Line: %.*ls\n",
+                   (1 + ulLineIndex), iLineSize, lpLineWStrView->lpWCharArr);
     }
 
-    ConfigParseShortcutKey(lpShortcutKeyWStr, ulLineIndex, lpLineWStr, &(lpConfigEntry->shortcutKey));
-
-    ConfigParseSendKeys(lpSendKeysWStr, &(lpConfigEntry->inputKeyArr));
+    ConfigParseShortcutKey(&shortcutKeyWStrView, ulLineIndex, lpLineWStrView, lpTempArena, &(lpConfigEntry->shortcutKey));
 
-    // Intentional: MUST copy.  Do not assign.  Why?  WStrArrFree() is called next.
-    WStrCopyWStr(&(lpConfigEntry->sendKeysWStr), lpSendKeysWStr);
+    // Intentional: MUST copy.  Why?  Views point into chunk buffer of WStrLineReader, which WStrLineReaderNext() overwrites.
+    WStrCopyWStrView(&(lpConfigEntry->sendKeysWStr), lpSendKeysWStrView);
 
-    WStrArrFree(&tokenWStrArr);
+    ConfigParseSendKeys(&(lpConfigEntry->sendKeysWStr), &(lpConfigEntry->inputKeyArr));
 
-    LogF(stdout, "Parsed config line #%d: [%ls]", (1 + ulLineIndex), lpLineWStr->lpWCharArr);
+    DEBUG_LOGWF(stdout, L"DEBUG: Parsed config line #%zd: [%.*ls]\r\n", (1 + ulLineIndex), iLineSize, lpLineWStrView->lpWCharArr);
 }
 
-void ConfigParseShortcutKey(_In_  const struct WStr  *lpShortcutKeyWStr,  // Ex: L"Ctrl+Shift+Alt+0x70"
-                            _In_  const size_t        ulLineIndex,
-                            _In_  const struct WStr  *lpLineWStr,         // Ex: L"Ctrl+Shift+Alt+0x70|username"
-                            _Out_ struct ShortcutKey *lpShortcutKey)
+void ConfigParseShortcutKey(_In_    const struct WStrView *lpShortcutKeyWStrView,  // Ex: L"Ctrl+Shift+Alt+0x70"
+                            _In_    const size_t           ulLineIndex,
+                            _In_    const struct WStrView *lpLineWStrView,         // Ex: L"Ctrl+Shift+Alt+0x70|username"
+                            _Inout_ struct XArena         *lpTempArena,
+                            _Out_   struct ShortcutKey    *lpShortcutKey)
 {
-    WStrAssertValid(lpShortcutKeyWStr);
-    WStrAssertValid(lpLineWStr);
+    WStrViewAssertValid(lpShortcutKeyWStrView);
+    WStrViewAssertValid(lpLineWStrView);
+    XArenaAssertValid(lpTempArena);
     assert(NULL != lpShortcutKey);
 
-    wchar_t *lpDelimWCharArr = L"+";
-    struct WStr delimWStr = {.lpWCharArr = lpDelimWCharArr, .ulSize = wcslen(lpDelimWCharArr)};
+    const struct WStrView delimWStrView = WSTR_VIEW_FROM_LITERAL(L"+");
 
-    // Ex: "0x70" -> [], "Ctrl+Shift+Alt+0x70" -> ["Ctrl", "Shift", "Alt", "0x70"]
-    const int iMaxTokenCount = -1;
-    struct WStrArr tokenWStrArr = {};
-    WStrSplit(lpShortcutKeyWStr, &delimWStr, iMaxTokenCount, &tokenWStrArr);
-    WStrArrForEach(&tokenWStrArr, WStrTrimSpace);
+    const struct WStrViewSplitOptions splitOptions = {
+        .iMinTokenCount                 = UNLIMITED_MIN_TOKEN_COUNT,
+        .iMaxTokenCount                 = UNLIMITED_MAX_TOKEN_COUNT,
+        .fpNullableWStrViewConsumerFunc = WStrViewTrimSpace,
+    };
+
+    // Ex: "0x70" -> ["0x70"], "Ctrl+Shift+Alt+0x70" -> ["Ctrl", "Shift", "Alt", "0x70"]
+    struct WStrViewArr tokenWStrViewArr = {};
+    WStrSplitViewXArena(lpShortcutKeyWStrView, &delimWStrView, &splitOptions, lpTempArena, &tokenWStrViewArr);
 
     enum EKeyModifier eModifiers = 0;
 
     // Modifiers always appear before virtual-key code.  If more than two tokens, there is at least one modifier.
-    if (tokenWStrArr.ulSize >= 2)
+    if (tokenWStrViewArr.ulSize >= 2)
     {
-        for (size_t i = 0; i < tokenWStrArr.ulSize - 1; ++i)
+        for (size_t i = 0; i < tokenWStrViewArr.ulSize - 1; ++i)
         {
             // Ex: "Ctrl"
-            const struct WStr *lpTokenWStr = tokenWStrArr.lpWStrArr + i;
-            ConfigParseModifier(lpTokenWStr, lpShortcutKeyWStr, ulLineIndex, lpLineWStr, &eModifiers);
+            const struct WStrView *lpTokenWStrView = tokenWStrViewArr.lpWStrViewArr + i;
+            ConfigParseModifier(lpTokenWStrView, lpShortcutKeyWStrView, ulLineIndex, lpLineWStrView, &eModifiers);
         }
     }
 
     // Ex: "0x70"
-    const struct WStr *lpVkCodeWStr = tokenWStrArr.lpWStrArr + (tokenWStrArr.ulSize - 1);
+    const struct WStrView *lpVkCodeWStrView = tokenWStrViewArr.lpWStrViewArr + (tokenWStrViewArr.ulSize - 1);
+    // Intentional: Copy.  Why?  swscanf() requires a trailing '\0' char.  Small-string optimisation: No heap alloc.
+    struct WStr vkCodeWStr = {};
+    WStrCopyWStrView(&vkCodeWStr, lpVkCodeWStrView);
     // Ex: "0x70" -> (unsigned int) 0x70
     // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/sscanf-sscanf-l-swscanf-swscanf-l?view=msvc-170
     const int iFieldCount = 1;
     DWORD dwVkCode = 0;
     // Note: Prefix '0x' and '0X' are automatically ignored.  Also, hex chars may be upper or lowercase.
-    if (iFieldCount != swscanf(lpVkCodeWStr->lpWCharArr, L"%x", &dwVkCode))
+    if (0 == vkCodeWStr.ulSize || iFieldCount != swscanf(vkCodeWStr.lpWCharArr, L"%x", &dwVkCode))
     {
-        ErrorExitF("Config file: Line #%zd: Failed to parse virtual key code [%ls]\n"
-                   "Line: %ls\n",
-                   (1 + ulLineIndex), lpVkCodeWStr->lpWCharArr, lpLineWStr->lpWCharArr);
+        ErrorExitF("Config file: Line #%zd: Failed to parse virtual key code [%.*ls]\n"
+                   "Line: %.*ls\n",
+                   (1 + ulLineIndex), (int) vkCodeWStr.ulSize, vkCodeWStr.lpWCharArr,
+                   (int) lpLineWStrView->ulSize, lpLineWStrView->lpWCharArr);
     }
 
     // Ref: https://docs.microsoft.com/en-us/windows/win32/inputdev/virtual-key-codes
     if (dwVkCode < 0x01 || dwVkCode > 0xFE)
     {
         ErrorExitF("Config file: Line #%zd: Invalid virtual key code [%ls]->%d: Min: 0x01 (1), Max: 0xFE (254)\n"
-                   "Line: %ls\n",
-                   (1 + ulLineIndex), lpVkCodeWStr->lpWCharArr, dwVkCode, lpLineWStr->lpWCharArr);
+                   "Line: %.*ls\n",
+                   (1 + ulLineIndex), vkCodeWStr.lpWCharArr, dwVkCode,
+                   (int) lpLineWStrView->ulSize, lpLineWStrView->lpWCharArr);
     }
 
-    WStrArrFree(&tokenWStrArr);
+    WStrFree(&vkCodeWStr);
 
     lpShortcutKey->eModifiers = eModifiers;
     lpShortcutKey->dwVkCode   = dwVkCode;
 }
 
-static BOOL ConfigParseModifier0(_In_    const wchar_t           *lpTokenWCharArr,    // Ex: L"LShift"
-                                 _In_    const enum EKeyModifier  eModifier,          // Ex: SHIFT_LEFT
-                                 _In_    const struct WStr       *lpTokenWStr,        // Ex: L"LShift"
-                                 _In_    const struct WStr       *lpShortcutKeyWStr,  // Ex: L"LCtrl+LShift+LAlt+0x70"
-                                 _In_    const size_t             ulLineIndex,
-                                 _In_    const struct WStr       *lpLineWStr,         // Ex: L"LCtrl+LShift+LAlt+0x70|username"
-                                 _Inout_ enum EKeyModifier       *peModifiers)
+struct ConfigModifierName
+{
+    // Ex: L"LShift"
+    const wchar_t           *lpNameWCharArr;
+    // Zero if generic modifier is not supported, e.g., L"Shift"
+    const enum EKeyModifier  eModifier;
+    // @Nullable
+    // Only set if (0 == eModifier)
+    const char              *lpszNullableErrorMessage;
+};
+
+static const struct ConfigModifierName CONFIG_MODIFIER_NAME_ARR[] =
+{
+    { L"LShift", SHIFT_LEFT , NULL },
+    { L"RShift", SHIFT_RIGHT, NULL },
+    { L"LCtrl" , CTRL_LEFT  , NULL },
+    { L"RCtrl" , CTRL_RIGHT , NULL },
+    { L"LAlt"  , ALT_LEFT   , NULL },
+    { L"RAlt"  , ALT_RIGHT  , NULL },
+    { L"Shift" , 0, "Shortcut key modifier 'Shift' is not supported.  Please use 'LShift' or 'RShift'." },
+    { L"Ctrl"  , 0, "Shortcut key modifier 'Ctrl' is not supported.  Please use 'LCtrl' or 'RCtrl'." },
+    { L"Alt"   , 0, "Shortcut key modifier 'Alt' is not supported.  Please use 'LAlt' or 'RAlt'." },
+};
+
+/**
+ * @return case-insensitive map: modifier name -> const struct ConfigModifierName *
+ */
+static const struct WStrHashMap *ConfigGetModifierNameMap()
 {
-    if (0 == _wcsicmp(lpTokenWCharArr, lpTokenWStr->lpWCharArr))
+    // Intentional: Build once, never free.  Why?  Each modifier token is one lookup, not one compare per name.
+    static struct WStrHashMap map = {.bIgnoreCase = true};
+    if (0 == map.ulSize)
     {
-        if (0 != (eModifier & *peModifiers))
+        const size_t ulCount = sizeof(CONFIG_MODIFIER_NAME_ARR) / sizeof(CONFIG_MODIFIER_NAME_ARR[0]);
+        for (size_t i = 0; i < ulCount; ++i)
         {
-            ErrorExitF("Config file: Line #%zd: Multiple %ls modifiers are not allowed: [%ls]\n"
-                       "Line: %ls\n",
-                       (1 + ulLineIndex), lpTokenWCharArr, lpShortcutKeyWStr->lpWCharArr, lpLineWStr->lpWCharArr);
+            const struct ConfigModifierName *lpName = CONFIG_MODIFIER_NAME_ARR + i;
+            const bool bIsNew = WStrHashMapInsert(&map, lpName->lpNameWCharArr, wcslen(lpName->lpNameWCharArr), (void *) lpName);
+            assert(bIsNew);
         }
-        *peModifiers |= eModifier;
-        return TRUE;
     }
-    return FALSE;
+    return &map;
 }
 
-void ConfigParseModifier(_In_    const struct WStr *lpTokenWStr,        // Ex: L"Shift"
-                         _In_    const struct WStr *lpShortcutKeyWStr,  // Ex: L"Ctrl+Shift+Alt+0x70"
-                         _In_    const size_t       ulLineIndex,
-                         _In_    const struct WStr *lpLineWStr,         // Ex: L"Ctrl+Shift+Alt+0x70|username"
-                         _Inout_ enum EKeyModifier *peModifiers)
+void ConfigParseModifier(_In_    const struct WStrView *lpTokenWStrView,        // Ex: L"Shift"
+                         _In_    const struct WStrView *lpShortcutKeyWStrView,  // Ex: L"Ctrl+Shift+Alt+0x70"
+                         _In_    const size_t           ulLineIndex,
+                         _In_    const struct WStrView *lpLineWStrView,         // Ex: L"Ctrl+Shift+Alt+0x70|username"
+                         _Inout_ enum EKeyModifier     *peModifiers)
 {
-    WStrAssertValid(lpTokenWStr);
-    WStrAssertValid(lpShortcutKeyWStr);
-    WStrAssertValid(lpLineWStr);
+    WStrViewAssertValid(lpTokenWStrView);
+    WStrViewAssertValid(lpShortcutKeyWStrView);
+    WStrViewAssertValid(lpLineWStrView);
     assert(NULL != peModifiers);
 
-    if (0 == _wcsicmp(L"Shift", lpTokenWStr->lpWCharArr))
+    void *lpNullableValue = NULL;
+    if (!WStrHashMapFind(ConfigGetModifierNameMap(), lpTokenWStrView->lpWCharArr, lpTokenWStrView->ulSize, &lpNullableValue))
     {
-        ErrorExit("Shortcut key modifier 'Shift' is not supported.  Please use 'LShift' or 'RShift'.");
+        ErrorExitF("Config file: Line #%zd: Unknown modifier: [%.*ls]\n"
+                   "Line: %.*ls\n",
+                   (1 + ulLineIndex), (int) lpTokenWStrView->ulSize, lpTokenWStrView->lpWCharArr,
+                   (int) lpLineWStrView->ulSize, lpLineWStrView->lpWCharArr);
     }
-    if (0 == _wcsicmp(L"Ctrl", lpTokenWStr->lpWCharArr))
-    {
-        ErrorExit("Shortcut key modifier 'Ctrl' is not supported.  Please use 'LCtrl' or 'RCtrl'.");
-    }
-    if (0 == _wcsicmp(L"Alt", lpTokenWStr->lpWCharArr))
+
+    const struct ConfigModifierName *lpName = lpNullableValue;
+    if (0 == lpName->eModifier)
     {
-        ErrorExit("Shortcut key modifier 'Alt' is not supported.  Please use 'LAlt' or 'RAlt'.");
+        ErrorExit(lpName->lpszNullableErrorMessage);
     }
 
-    if (!ConfigParseModifier0(L"LShift", SHIFT_LEFT , lpTokenWStr, lpShortcutKeyWStr, ulLineIndex, lpLineWStr, peModifiers)
-    &&  !ConfigParseModifier0(L"RShift", SHIFT_RIGHT, lpTokenWStr, lpShortcutKeyWStr, ulLineIndex, lpLineWStr, peModifiers)
-    &&  !ConfigParseModifier0(L"LCtrl" , CTRL_LEFT  , lpTokenWStr, lpShortcutKeyWStr, ulLineIndex, lpLineWStr, peModifiers)
-    &&  !ConfigParseModifier0(L"RCtrl" , CTRL_RIGHT , lpTokenWStr, lpShortcutKeyWStr, ulLineIndex, lpLineWStr, peModifiers)
-    &&  !ConfigParseModifier0(L"LAlt"  , ALT_LEFT   , lpTokenWStr, lpShortcutKeyWStr, ulLineIndex, lpLineWStr, peModifiers)
-    &&  !ConfigParseModifier0(L"RAlt"  , ALT_RIGHT  , lpTokenWStr, lpShortcutKeyWStr, ulLineIndex, lpLineWStr, peModifiers))
+    if (0 != (lpName->eModifier & *peModifiers))
     {
-        ErrorExitF("Config file: Line #%zd: Unknown modifier: [%ls]\n"
-                   "Line: %ls\n",
-                   (1 + ulLineIndex), lpTokenWStr->lpWCharArr, lpLineWStr->lpWCharArr);
+        ErrorExitF("Config file: Line #%zd: Multiple %ls modifiers are not allowed: [%.*ls]\n"
+                   "Line: %.*ls\n",
+                   (1 + ulLineIndex), lpName->lpNameWCharArr,
+                   (int) lpShortcutKeyWStrView->ulSize, lpShortcutKeyWStrView->lpWCharArr,
+                   (int) lpLineWStrView->ulSize, lpLineWStrView->lpWCharArr);
     }
+    *peModifiers |= lpName->eModifier;
 }
 
 void ConfigParseSendKeys(_In_  const struct WStr  *lpSendKeysWStr,  // Ex: L"username"
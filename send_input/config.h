@@ -2,6 +2,8 @@
 #define _H_CONFIG
 
 #include "wstr.h"
+#include "xarena.h"
+#include "dyn_arr.h"
 #include <winuser.h>  // required for INPUT
 
 // Captain Obvious says: These are all bitwise flags (power of two).
@@ -39,31 +41,30 @@ struct ConfigEntry
     size_t             ulSendKeysCount;
 };
 
-struct ConfigEntryDynArr
-{
-    struct ConfigEntry *lpConfigEntryArr;
-    size_t ulSize;
-    size_t ulCapacity;
-};
+// struct ConfigEntryDynArr: lpElemArr, ulSize, ulCapacity
+DYN_ARR_DECLARE(ConfigEntryDynArr, struct ConfigEntry)
 
 void ConfigParseFile(_In_    const wchar_t            *lpConfigFilePath,
                      _In_    const UINT                codePage,  // Ex: CP_UTF8
                      _Inout_ struct ConfigEntryDynArr *lpDynArr);
 
-void ConfigParseLine(_In_  const size_t        ulLineIndex,
-                     _In_  const struct WStr  *lpLineWStr,  // Ex: L"Ctrl+Shift+Alt+0x70|username"
-                     _Out_ struct ConfigEntry *lpConfigEntry);
+// Token arrays are allocated from lpTempArena.  Caller may reset after each line.
+void ConfigParseLine(_In_    const size_t           ulLineIndex,
+                     _In_    const struct WStrView *lpLineWStrView,  // Ex: L"Ctrl+Shift+Alt+0x70|username"
+                     _Inout_ struct XArena         *lpTempArena,
+                     _Out_   struct ConfigEntry    *lpConfigEntry);
 
-void ConfigParseShortcutKey(_In_  const struct WStr  *lpShortcutKeyWStr,  // Ex: L"Ctrl+Shift+Alt+0x70"
-                            _In_  const size_t        ulLineIndex,
-                            _In_  const struct WStr  *lpLineWStr,
-                            _Out_ struct ShortcutKey *lpShortcutKey);
+void ConfigParseShortcutKey(_In_    const struct WStrView *lpShortcutKeyWStrView,  // Ex: L"Ctrl+Shift+Alt+0x70"
+                            _In_    const size_t           ulLineIndex,
+                            _In_    const struct WStrView *lpLineWStrView,
+                            _Inout_ struct XArena         *lpTempArena,
+                            _Out_   struct ShortcutKey    *lpShortcutKey);
 
-void ConfigParseModifier(_In_    const struct WStr *lpTokenWStr,        // Ex: L"Shift"
-                         _In_    const struct WStr *lpShortcutKeyWStr,  // Ex: L"Ctrl+Shift+Alt+0x70"
-                         _In_    const size_t       ulLineIndex,
-                         _In_    const struct WStr *lpLineWStr,
-                         _Inout_ enum EKeyModifier *peModifiers);
+void ConfigParseModifier(_In_    const struct WStrView *lpTokenWStrView,        // Ex: L"Shift"
+                         _In_    const struct WStrView *lpShortcutKeyWStrView,  // Ex: L"Ctrl+Shift+Alt+0x70"
+                         _In_    const size_t           ulLineIndex,
+                         _In_    const struct WStrView *lpLineWStrView,
+                         _Inout_ enum EKeyModifier     *peModifiers);
 
 void ConfigParseSendKeys(_In_  const struct WStr  *lpSendKeysWStr,  // Ex: L"username"
                          _Out_ struct InputKeyArr *lpInputKeyArr);
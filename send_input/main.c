@@ -1,8 +1,12 @@
 #include "win32.h"
 #include "console.h"
 #include "log.h"
+#include "log_async.h"
+#include "log_file.h"
+#include "latency_hist.h"
 #include "wstr.h"
 #include "error_exit.h"
+#include "xmalloc.h"
 #include "config.h"
 #include <windows.h>
 #include <assert.h>
@@ -13,11 +17,31 @@ struct ConfigEntryDynArr g_configEntryDynArr = {};
 
 enum EKeyModifier g_eKeyModifiers = 0;
 
+// Only opened for --log-file=PATH.  Must live until exit: See: LogFileInit()
+struct LogFile g_logFile = {0};
+
+// Duration of LowLevelKeyboardProc(), excluding CallNextHookEx().  Why?  Windows silently removes a hook slower than
+// registry value LowLevelHooksTimeout.  Matched: Shortcut key up, then SendInput().  Unmatched: All other keys.
+// Ref: https://docs.microsoft.com/en-us/windows/win32/winmsg/lowlevelkeyboardproc
+struct LatencyHist g_matchedLatencyHist   = LATENCY_HIST_INIT(L"LowLevelKeyboardProc: Matched");
+struct LatencyHist g_unmatchedLatencyHist = LATENCY_HIST_INIT(L"LowLevelKeyboardProc: Unmatched");
+
+static void LogLatencyHists()
+{
+    LatencyHistLogW(stdout, &g_matchedLatencyHist);
+    LatencyHistLogW(stdout, &g_unmatchedLatencyHist);
+}
+
 // Ref: https://docs.microsoft.com/en-us/windows/console/registering-a-control-handler-function
 // Ref: https://docs.microsoft.com/en-us/windows/console/handlerroutine
+// Important: Runs on a console control thread.  See: SetConsoleCtrlHandler() in wWinMain()
 static BOOL WINAPI HandlerRoutine(__attribute__((unused)) _In_ DWORD dwCtrlType)
 {
-    Log(stdout, "Handled event: CTRL_C_EVENT, CTRL_BREAK_EVENT, CTRL_CLOSE_EVENT, CTRL_LOGOFF_EVENT, CTRL_SHUTDOWN_EVENT");
+    INFO_LOGW(stdout, L"INFO: Handled event: CTRL_C_EVENT, CTRL_BREAK_EVENT, CTRL_CLOSE_EVENT, CTRL_LOGOFF_EVENT, CTRL_SHUTDOWN_EVENT\r\n");
+    // Intentional: Read without lock from this handler thread.  Why?  A count may be off by one: Good enough at exit.
+    LogLatencyHists();
+    // Important: ExitProcess() does not flush async log.
+    LogAsyncFlush();
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-exitprocess
     ExitProcess(1);
 }
@@ -37,11 +61,12 @@ static void UpdateEKeyModifiers(_In_ const BOOL              bIsKeyUp,
     }
 }
 
-static void HandleKeyUp(_In_ const DWORD dwVkCode)
+// @return true if shortcut key matched, then inputs were sent
+static bool HandleKeyUp(_In_ const DWORD dwVkCode)
 {
     for (size_t i = 0; i < g_configEntryDynArr.ulSize; ++i)
     {
-        struct ConfigEntry *lpConfigEntry = g_configEntryDynArr.lpConfigEntryArr + i;
+        struct ConfigEntry *lpConfigEntry = g_configEntryDynArr.lpElemArr + i;
 
         if (g_eKeyModifiers != lpConfigEntry->shortcutKey.eModifiers
         ||  dwVkCode        != lpConfigEntry->shortcutKey.dwVkCode)
@@ -50,7 +75,8 @@ static void HandleKeyUp(_In_ const DWORD dwVkCode)
         }
 
         ++(lpConfigEntry->ulSendKeysCount);
-        LogF(stdout, "%zd:SendKeys(%ls)", lpConfigEntry->ulSendKeysCount, lpConfigEntry->sendKeysWStr.lpWCharArr);
+        // Intentional: INFO_LOGWF(), not printf().  Why?  After LogAsyncStart(), this hook thread only formats into ring buffer: No console I/O.
+        INFO_LOGWF(stdout, L"INFO: %zd:SendKeys(%ls)\r\n", lpConfigEntry->ulSendKeysCount, lpConfigEntry->sendKeysWStr.lpWCharArr);
 
         // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-sendinput
         // Ref: https://stackoverflow.com/questions/32149644/keyboard-input-via-sendinput-win32-api-doesnt-work-hardware-one-does
@@ -69,8 +95,9 @@ static void HandleKeyUp(_In_ const DWORD dwVkCode)
                            uSent, lpConfigEntry->inputKeyArr.ulSize);
             }
         }
-        break;
+        return true;
     }
+    return false;
 }
 
 // Ref: https://docs.microsoft.com/en-us/windows/win32/winmsg/lowlevelkeyboardproc
@@ -79,6 +106,9 @@ static LRESULT CALLBACK LowLevelKeyboardProc(_In_ int    nCode,
                                              _In_ WPARAM wParam,  // Any of: WM_KEYDOWN, WM_KEYUP, WM_SYSKEYDOWN, or WM_SYSKEYUP
                                              _In_ LPARAM lParam)
 {
+    const int64_t llStartTicks = LatencyHistNow();
+    bool bIsMatched = false;
+
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winuser/ns-winuser-kbdllhookstruct
     const KBDLLHOOKSTRUCT* info = (KBDLLHOOKSTRUCT*) lParam;
     const BOOL bIsInjected = (0 != (info->flags & LLKHF_INJECTED));
@@ -130,12 +160,15 @@ static LRESULT CALLBACK LowLevelKeyboardProc(_In_ int    nCode,
                 // Captain Obvious says: Only sent inputs on shortcut key *UP*.
                 if (bIsKeyUp)
                 {
-                    HandleKeyUp(info->vkCode);
+                    bIsMatched = HandleKeyUp(info->vkCode);
                 }
                 break;  // Explicit
             }
         }
     }
+    // Intentional: Exclude CallNextHookEx().  Why?  Other hooks have their own timeout.
+    LatencyHistRecord(bIsMatched ? &g_matchedLatencyHist : &g_unmatchedLatencyHist, LatencyHistNow() - llStartTicks);
+
     const LRESULT x = CallNextHookEx((HHOOK) 0, nCode, wParam, lParam);
     return x;
 }
@@ -158,7 +191,7 @@ static void ShowHelpThenExit(_In_opt_ const char *lpszNulllableErrorMsgFmt, ...)
     }
 
     printf("\n");
-    printf("Usage: %ls CONFIG_FILE_PATH [/?] [-h] [--help]\n", __wargv[0]);
+    printf("Usage: %ls [--log-level=LEVEL] [--log-file=PATH] CONFIG_FILE_PATH [/?] [-h] [--help]\n", __wargv[0]);
     printf("Register Windows global keyboard shortcuts to send keys, usually username or password.\n");
     printf("\n");
     printf("Required Arguments:\n");
@@ -197,9 +230,22 @@ static void ShowHelpThenExit(_In_opt_ const char *lpszNulllableErrorMsgFmt, ...)
     printf("                        ... will send input 'P*assw0rd' for keyboard shortcut: LCtrl+LShift+LAlt+F2\n");
     printf("\n");
     printf("Optional Arguments:\n");
+    printf("    --log-level=LEVEL\n");
+    printf("        Minimum log level: trace, debug, info, warn, error, or off\n");
+    printf("        Default: Environment variable %ls, else info (or debug for debug builds)\n", LOG_LEVEL_ENV_VAR_NAME);
+    printf("\n");
+    printf("    --log-file=PATH\n");
+    printf("        Also write log to file: Buffered, and rotated at 16 MiB: PATH.1 ... PATH.5\n");
+    printf("        Lines for stdout are only written to file.  Default: No log file\n");
+    printf("        Example: --log-file=C:\\temp\\send_input.log\n");
+    printf("\n");
     printf("    /? or -h or --help\n");
     printf("        Show this help page\n");
     printf("\n");
+    printf("Hot Keys:\n");
+    printf("    Ctrl+Alt+Shift+F12: Log latency of keyboard hook as p50/p99/p99.9/max: Matched and unmatched keys\n");
+    printf("        Also logged on exit\n");
+    printf("\n");
 
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-exitprocess
     ExitProcess(1);
@@ -209,7 +255,19 @@ static void CheckCommandLineArgs(_Out_ wchar_t **lppConfigFilePath)
 {
     assert(NULL != lppConfigFilePath);
 
+    // Intentional: First.  Why?  Remove --log-level=LEVEL and --log-file=PATH before other args are checked.
     // Ref: https://docs.microsoft.com/en-us/cpp/c-runtime-library/argc-argv-wargv?view=msvc-170
+    if (!LogLevelInit(&__argc, __wargv, stderr))
+    {
+        ShowHelpThenExit("Invalid log level");
+    }
+
+    // Intentional: Before LogAsyncStart().  Why?  Async log background thread owns the file.  See: LogSetFile()
+    if (!LogFileInit(&__argc, __wargv, &g_logFile, stderr))
+    {
+        ShowHelpThenExit("Invalid log file");
+    }
+
     if (1 == __argc)
     {
         ShowHelpThenExit("Missing argument CONFIG_FILE_PATH");
@@ -249,19 +307,31 @@ int WINAPI wWinMain(                        HINSTANCE hInstance,      // The ope
                     __attribute__((unused)) PWSTR     lpCmdLine,      // ... contains the command-line arguments as a Unicode string.
                     __attribute__((unused)) int       nCmdShow)       // ... is a flag that says whether the main application window will be minimized, maximized, or shown normally.
 {
+    // Intentional: First, before any allocation.  Why?  Config and LowLevelKeyboardProc() run on this thread: No heap lock.
+    XMallocInit(XMALLOC_HEAP_PRIVATE_NO_SERIALIZE);
+
     const size_t ulMinConsoleLines = 500;
     const size_t ulMaxConsoleLines = 500;
     RedirectIOToConsole(ulMinConsoleLines, ulMaxConsoleLines);
 
+    wchar_t *lpConfigFilePath = NULL;
+    CheckCommandLineArgs(&lpConfigFilePath);
+
+    ConfigParseFile(lpConfigFilePath, CP_UTF8, &g_configEntryDynArr);
+    // Only if built with XMALLOC_STATS: Heap operations to load config
+    XMALLOC_STATS_FPRINT(stderr, "after ConfigParseFile()");
+
+    // Intentional: Before hook is installed.  Why?  LowLevelKeyboardProc() must never wait for console I/O.
+    // Drop, not block, if ring buffer is full: Windows silently removes a slow hook.
+    LogAsyncStart(LOG_ASYNC_OVERFLOW_DROP);
+
+    // Intentional: After LogAsyncStart().  Why?  HandlerRoutine() runs on a console control thread: Its log lines must
+    // be pushed to the ring buffer, never formatted on the heap from XMallocInit(XMALLOC_HEAP_PRIVATE_NO_SERIALIZE).
     const BOOL bIsAdd = TRUE;
     if (!SetConsoleCtrlHandler(HandlerRoutine, bIsAdd))
     {
         ErrorExit("SetConsoleCtrlHandler()");
     }
-    wchar_t *lpConfigFilePath = NULL;
-    CheckCommandLineArgs(&lpConfigFilePath);
-
-    ConfigParseFile(lpConfigFilePath, CP_UTF8, &g_configEntryDynArr);
 
     // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-setwindowshookexw
     const HHOOK hHook = SetWindowsHookEx(WH_KEYBOARD_LL,        // [in] int       idHook
@@ -273,6 +343,17 @@ int WINAPI wWinMain(                        HINSTANCE hInstance,      // The ope
         ErrorExit("SetWindowsHookEx(WH_KEYBOARD_LL, ...)");
     }
 
+    // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-registerhotkey
+    // Intentional: NULL hWnd.  Why?  WM_HOTKEY is posted to this thread's message queue: See GetMessage() below.
+    if (!RegisterHotKey(NULL,                                              // [in, optional] HWND hWnd
+                        HOT_KEY_ID_LOG_LATENCY,                            // [in]           int  id
+                        MOD_CONTROL | MOD_ALT | MOD_SHIFT | MOD_NOREPEAT,  // [in]           UINT fsModifiers
+                        VK_F12))                                           // [in]           UINT vk
+    {
+        // Intentional: Not fatal.  Why?  Hot key may be registered by another process.  Latency is still logged on exit.
+        WARN_LOGWF(stderr, L"WARN: RegisterHotKey(Ctrl+Alt+Shift+F12) failed: GetLastError():%lu\r\n", GetLastError());
+    }
+
     MSG msg = {};
     while (TRUE)
     {
@@ -291,6 +372,12 @@ int WINAPI wWinMain(                        HINSTANCE hInstance,      // The ope
             break;  // WM_QUIT received
         }
 
+        if (WM_HOTKEY == msg.message && HOT_KEY_ID_LOG_LATENCY == msg.wParam)
+        {
+            LogLatencyHists();
+            continue;
+        }
+
         // Ref: https://docs.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-translatemessage
         __attribute__((unused)) const BOOL    bRet2   = TranslateMessage(&msg);
 
@@ -301,6 +388,8 @@ int WINAPI wWinMain(                        HINSTANCE hInstance,      // The ope
         DEBUG_BREAKPOINT;
     }
 
+    LogLatencyHists();
+
     // Return the exit code to the system from PostQuitMessage()
     return msg.wParam;
 }
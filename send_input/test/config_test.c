@@ -10,17 +10,15 @@ static void TestConfigParseModifier(_In_ wchar_t                 *lpTokenWCharAr
 {
     printf("TestConfigParseModifier: (%zd)[%ls] & [%d] -> [%d]\r\n", wcslen(lpTokenWCharArr), lpTokenWCharArr, eModifiers, eModifiersExpected);
 
-    struct WStr tokenWStr = {.lpWCharArr = lpTokenWCharArr, .ulSize = wcslen(lpTokenWCharArr)};
+    struct WStrView tokenWStrView = {.lpWCharArr = lpTokenWCharArr, .ulSize = wcslen(lpTokenWCharArr)};
 
-    wchar_t *lpShortcutKeyWCharArr = L"XYZ";
-    struct WStr shortcutKeyWStr = {.lpWCharArr = lpShortcutKeyWCharArr, .ulSize = wcslen(lpShortcutKeyWCharArr)};
+    struct WStrView shortcutKeyWStrView = WSTR_VIEW_FROM_LITERAL(L"XYZ");
 
     const size_t ulLineIndex = 3;
 
-    wchar_t *lpLineWCharArr = L"blah blah blah";
-    struct WStr lineWStr = {.lpWCharArr = lpLineWCharArr, .ulSize = wcslen(lpLineWCharArr)};
+    struct WStrView lineWStrView = WSTR_VIEW_FROM_LITERAL(L"blah blah blah");
 
-    ConfigParseModifier(&tokenWStr, &shortcutKeyWStr, ulLineIndex, &lineWStr, &eModifiers);
+    ConfigParseModifier(&tokenWStrView, &shortcutKeyWStrView, ulLineIndex, &lineWStrView, &eModifiers);
 
     assert(eModifiers == eModifiersExpected);
 }
@@ -31,15 +29,16 @@ static void TestConfigParseShortcutKey(_In_ wchar_t                 *lpShortcutK
 {
     printf("TestConfigParseShortcutKey: [%ls]\r\n", lpShortcutKeyWCharArr);
 
-    struct WStr shortcutKeyWStr = {.lpWCharArr = lpShortcutKeyWCharArr, .ulSize = wcslen(lpShortcutKeyWCharArr)};
+    struct WStrView shortcutKeyWStrView = {.lpWCharArr = lpShortcutKeyWCharArr, .ulSize = wcslen(lpShortcutKeyWCharArr)};
 
     const size_t ulLineIndex = 3;
 
-    wchar_t *lpLineWCharArr = L"blah blah blah";
-    struct WStr lineWStr = {.lpWCharArr = lpLineWCharArr, .ulSize = wcslen(lpLineWCharArr)};
+    struct WStrView lineWStrView = WSTR_VIEW_FROM_LITERAL(L"blah blah blah");
 
     struct ShortcutKey shortcutKey = {};
-    ConfigParseShortcutKey(&shortcutKeyWStr, ulLineIndex, &lineWStr, &shortcutKey);
+    struct XArena arena = {};
+    ConfigParseShortcutKey(&shortcutKeyWStrView, ulLineIndex, &lineWStrView, &arena, &shortcutKey);
+    XArenaFree(&arena);
 
     assert(shortcutKey.eModifiers == eModifiersExpected);
     assert(shortcutKey.dwVkCode == dwVkCodeExpected);
@@ -81,12 +80,14 @@ static void TestConfigParseLine(_In_ wchar_t                 *lpLineWCharArr,  /
 {
     printf("TestConfigParseLine: [%ls] -> [%d][0x%x][%ls]\r\n", lpLineWCharArr, eModifiersExpected, dwVkCodeExpected, lpSendKeysWCharArr);
 
-    struct WStr lineWStr = {.lpWCharArr = lpLineWCharArr, .ulSize = wcslen(lpLineWCharArr)};
+    struct WStrView lineWStrView = {.lpWCharArr = lpLineWCharArr, .ulSize = wcslen(lpLineWCharArr)};
 
     const size_t ulLineIndex = 3;
 
     struct ConfigEntry configEntry = {};
-    ConfigParseLine(ulLineIndex, &lineWStr, &configEntry);
+    struct XArena arena = {};
+    ConfigParseLine(ulLineIndex, &lineWStrView, &arena, &configEntry);
+    XArenaFree(&arena);
 
     assert(configEntry.shortcutKey.eModifiers == eModifiersExpected);
     assert(configEntry.shortcutKey.dwVkCode   == dwVkCodeExpected);
@@ -135,28 +136,28 @@ L" # Comment\r\n"
     assert(dynArr.ulSize == 4);
 
     // L"0x75|abcdef\r\n"
-    assert(dynArr.lpConfigEntryArr[0].shortcutKey.eModifiers == 0);
-    assert(dynArr.lpConfigEntryArr[0].shortcutKey.dwVkCode == 0x75);
-    assert(0 == wcscmp(dynArr.lpConfigEntryArr[0].sendKeysWStr.lpWCharArr, L"abcdef"));
-    assert(dynArr.lpConfigEntryArr[0].inputKeyArr.ulSize == 2U * wcslen(L"abcdef"));
+    assert(dynArr.lpElemArr[0].shortcutKey.eModifiers == 0);
+    assert(dynArr.lpElemArr[0].shortcutKey.dwVkCode == 0x75);
+    assert(0 == wcscmp(dynArr.lpElemArr[0].sendKeysWStr.lpWCharArr, L"abcdef"));
+    assert(dynArr.lpElemArr[0].inputKeyArr.ulSize == 2U * wcslen(L"abcdef"));
 
     // L"LCtrl+LShift+LAlt+0x70|password\r\n"
-    assert(dynArr.lpConfigEntryArr[1].shortcutKey.eModifiers == (CTRL_LEFT | SHIFT_LEFT | ALT_LEFT));
-    assert(dynArr.lpConfigEntryArr[1].shortcutKey.dwVkCode == 0x70);
-    assert(0 == wcscmp(dynArr.lpConfigEntryArr[1].sendKeysWStr.lpWCharArr, L"password"));
-    assert(dynArr.lpConfigEntryArr[1].inputKeyArr.ulSize == 2U * wcslen(L"password"));
+    assert(dynArr.lpElemArr[1].shortcutKey.eModifiers == (CTRL_LEFT | SHIFT_LEFT | ALT_LEFT));
+    assert(dynArr.lpElemArr[1].shortcutKey.dwVkCode == 0x70);
+    assert(0 == wcscmp(dynArr.lpElemArr[1].sendKeysWStr.lpWCharArr, L"password"));
+    assert(dynArr.lpElemArr[1].inputKeyArr.ulSize == 2U * wcslen(L"password"));
 
     // L"LShift+LAlt+0x72| username \r\n"
-    assert(dynArr.lpConfigEntryArr[2].shortcutKey.eModifiers == (SHIFT_LEFT | ALT_LEFT));
-    assert(dynArr.lpConfigEntryArr[2].shortcutKey.dwVkCode == 0x72);
-    assert(0 == wcscmp(dynArr.lpConfigEntryArr[2].sendKeysWStr.lpWCharArr, L" username "));
-    assert(dynArr.lpConfigEntryArr[2].inputKeyArr.ulSize == 2U * wcslen(L" username "));
+    assert(dynArr.lpElemArr[2].shortcutKey.eModifiers == (SHIFT_LEFT | ALT_LEFT));
+    assert(dynArr.lpElemArr[2].shortcutKey.dwVkCode == 0x72);
+    assert(0 == wcscmp(dynArr.lpElemArr[2].sendKeysWStr.lpWCharArr, L" username "));
+    assert(dynArr.lpElemArr[2].inputKeyArr.ulSize == 2U * wcslen(L" username "));
 
     // L"RCtrl+RAlt+0x72|user東京name\r\n"
-    assert(dynArr.lpConfigEntryArr[3].shortcutKey.eModifiers == (CTRL_RIGHT | ALT_RIGHT));
-    assert(dynArr.lpConfigEntryArr[3].shortcutKey.dwVkCode == 0x72);
-    assert(0 == wcscmp(dynArr.lpConfigEntryArr[3].sendKeysWStr.lpWCharArr, L"user東京name"));
-    assert(dynArr.lpConfigEntryArr[3].inputKeyArr.ulSize == 2U * wcslen(L"user東京name"));
+    assert(dynArr.lpElemArr[3].shortcutKey.eModifiers == (CTRL_RIGHT | ALT_RIGHT));
+    assert(dynArr.lpElemArr[3].shortcutKey.dwVkCode == 0x72);
+    assert(0 == wcscmp(dynArr.lpElemArr[3].sendKeysWStr.lpWCharArr, L"user東京name"));
+    assert(dynArr.lpElemArr[3].inputKeyArr.ulSize == 2U * wcslen(L"user東京name"));
 
     // Intentional: Ignore return value (BOOL)
     DeleteFile(lpFilePath);